@@ -29,6 +29,23 @@ endif()
 
 set(CMAKE_CXX_FLAGS_DEBUG "${CMAKE_CXX_FLAGS_DEBUG} -DSPECTRE_DEBUG")
 
+option(SPECTRE_ACTION_TRACING
+  "Record the wall time of all actions, see Parallel::tracing" OFF)
+
+if(${SPECTRE_ACTION_TRACING})
+  set_property(TARGET SpectreFlags
+    APPEND PROPERTY INTERFACE_COMPILE_DEFINITIONS SPECTRE_ACTION_TRACING)
+endif()
+
+option(SPECTRE_TRACK_ALLOCATIONS
+  "Count the memory held by DataVectors and Variables, see memory_tracking"
+  OFF)
+
+if(${SPECTRE_TRACK_ALLOCATIONS})
+  set_property(TARGET SpectreFlags
+    APPEND PROPERTY INTERFACE_COMPILE_DEFINITIONS SPECTRE_TRACK_ALLOCATIONS)
+endif()
+
 if(${SPECTRE_OPTIMIZE_SIZE})
   set(CMAKE_CXX_FLAGS_DEBUG "${CMAKE_CXX_FLAGS_DEBUG} -Oz")
 endif()
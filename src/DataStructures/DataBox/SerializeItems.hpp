@@ -0,0 +1,134 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/TagName.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Serialization/Fingerprint.hpp"
+#include "Utilities/Serialization/Serialize.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace db {
+namespace SerializeItems_detail {
+template <typename DbTagsList, typename ExcludedTags>
+using serialized_tags = tmpl::list_difference<
+    typename DataBox<DbTagsList>::mutable_item_creation_tags, ExcludedTags>;
+}  // namespace SerializeItems_detail
+
+/*!
+ * \ingroup DataBoxGroup
+ * \brief Serialize each mutable item of the DataBox separately.
+ *
+ * \details The result maps the `db::tag_name` of each mutable item that is not
+ * a subitem to its serialized value. Compute and reference items are not
+ * serialized since they can be recomputed from the mutable items. Serializing
+ * the items separately allows comparing them between snapshots of the same
+ * DataBox, e.g. to only write the items that changed to disk.
+ *
+ * \tparam ExcludedTags mutable items that are not serialized, e.g. items that
+ * are owned by the parallel runtime
+ */
+template <typename ExcludedTags = tmpl::list<>, typename DbTagsList>
+std::map<std::string, std::vector<char>> serialize_mutable_items(
+    const DataBox<DbTagsList>& box) {
+  std::map<std::string, std::vector<char>> result{};
+  tmpl::for_each<
+      SerializeItems_detail::serialized_tags<DbTagsList, ExcludedTags>>(
+      [&box, &result](auto tag_v) {
+        using tag = tmpl::type_from<decltype(tag_v)>;
+        result.emplace(db::tag_name<tag>(),
+                       serialize<typename tag::type>(db::get<tag>(box)));
+      });
+  return result;
+}
+
+/*!
+ * \ingroup DataBoxGroup
+ * \brief Serialize only the mutable items of the DataBox whose `db::tag_name`
+ * is in `item_names`.
+ *
+ * \details Entries of `item_names` that don't correspond to a mutable item of
+ * the DataBox are ignored. This is used together with
+ * `db::fingerprint_mutable_items` to only serialize the items that changed.
+ */
+template <typename ExcludedTags = tmpl::list<>, typename DbTagsList>
+std::map<std::string, std::vector<char>> serialize_mutable_items(
+    const DataBox<DbTagsList>& box,
+    const std::vector<std::string>& item_names) {
+  std::map<std::string, std::vector<char>> result{};
+  tmpl::for_each<
+      SerializeItems_detail::serialized_tags<DbTagsList, ExcludedTags>>(
+      [&box, &item_names, &result](auto tag_v) {
+        using tag = tmpl::type_from<decltype(tag_v)>;
+        std::string name = db::tag_name<tag>();
+        if (std::find(item_names.begin(), item_names.end(), name) !=
+            item_names.end()) {
+          result.emplace(std::move(name),
+                         serialize<typename tag::type>(db::get<tag>(box)));
+        }
+      });
+  return result;
+}
+
+/*!
+ * \ingroup DataBoxGroup
+ * \brief The `Fingerprint` of each mutable item of the DataBox, keyed like the
+ * result of `db::serialize_mutable_items`.
+ *
+ * \details Computing the fingerprints doesn't allocate buffers for the
+ * serialized items, so comparing fingerprints is a cheap way to find the items
+ * that changed since a previous snapshot of the DataBox.
+ */
+template <typename ExcludedTags = tmpl::list<>, typename DbTagsList>
+std::map<std::string, Fingerprint> fingerprint_mutable_items(
+    const DataBox<DbTagsList>& box) {
+  std::map<std::string, Fingerprint> result{};
+  tmpl::for_each<
+      SerializeItems_detail::serialized_tags<DbTagsList, ExcludedTags>>(
+      [&box, &result](auto tag_v) {
+        using tag = tmpl::type_from<decltype(tag_v)>;
+        result.emplace(db::tag_name<tag>(),
+                       fingerprint<typename tag::type>(db::get<tag>(box)));
+      });
+  return result;
+}
+
+/*!
+ * \ingroup DataBoxGroup
+ * \brief Restore the mutable items of the DataBox that are in `items`, as
+ * returned by `db::serialize_mutable_items`.
+ *
+ * \details Items of the DataBox that are not in `items` are left unchanged,
+ * and entries of `items` that don't correspond to a mutable item of the DataBox
+ * are ignored. The subitems and compute items that depend on the restored items
+ * are updated as if the items were mutated with `db::mutate`.
+ *
+ * \tparam ExcludedTags mutable items that are never restored
+ */
+template <typename ExcludedTags = tmpl::list<>, typename DbTagsList>
+void deserialize_mutable_items(
+    const gsl::not_null<DataBox<DbTagsList>*> box,
+    const std::map<std::string, std::vector<char>>& items) {
+  tmpl::for_each<
+      SerializeItems_detail::serialized_tags<DbTagsList, ExcludedTags>>(
+      [&box, &items](auto tag_v) {
+        using tag = tmpl::type_from<decltype(tag_v)>;
+        const auto item = items.find(db::tag_name<tag>());
+        if (item != items.end()) {
+          db::mutate<tag>(
+              [&item](const gsl::not_null<typename tag::type*> value) {
+                deserialize(value, item->second.data());
+              },
+              box);
+        }
+      });
+}
+}  // namespace db
@@ -0,0 +1,132 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "DataStructures/MemoryTracking.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Utilities/ErrorHandling/Assert.hpp"
+
+namespace memory_tracking {
+namespace {
+struct ComponentRegistry {
+  std::mutex mutex{};
+  std::unordered_map<std::string, size_t> ids{};
+  std::vector<std::string> names{"Other"};
+};
+
+ComponentRegistry& component_registry() {
+  static ComponentRegistry registry{};
+  return registry;
+}
+}  // namespace
+
+size_t register_component(const std::string& name) {
+  auto& components = component_registry();
+  const std::lock_guard lock(components.mutex);
+  if (const auto it = components.ids.find(name); it != components.ids.end()) {
+    return it->second;
+  }
+  if (components.names.size() == max_number_of_components) {
+    // Counted with the allocations outside of any component
+    return 0;
+  }
+  components.ids.emplace(name, components.names.size());
+  components.names.push_back(name);
+  return components.names.size() - 1;
+}
+
+const std::string& component_name(const size_t id) {
+  auto& components = component_registry();
+  const std::lock_guard lock(components.mutex);
+  ASSERT(id < components.names.size(),
+         "No component is registered for the ID " << id);
+  return components.names[id];
+}
+
+#ifdef SPECTRE_TRACK_ALLOCATIONS
+namespace {
+struct Registry {
+  std::mutex mutex{};
+  // A deque so that the counters of existing threads never move
+  std::deque<detail::ThreadCounters> counters{};
+};
+
+Registry& registry() {
+  static Registry registry{};
+  return registry;
+}
+
+template <size_t Size>
+size_t sum_over_threads(
+    std::array<std::atomic<std::int64_t>, Size> detail::ThreadCounters::*const
+        counter,
+    const size_t index) {
+  auto& r = registry();
+  const std::lock_guard lock(r.mutex);
+  std::int64_t result = 0;
+  for (const auto& thread_counters : r.counters) {
+    result += (thread_counters.*counter)[index].load(std::memory_order_relaxed);
+  }
+  // Frees of memory allocated on other threads may briefly make the sum
+  // negative while the allocating thread hasn't published its counters yet.
+  return result > 0 ? static_cast<size_t>(result) : 0;
+}
+}  // namespace
+
+namespace detail {
+ThreadCounters& register_thread_counters() {
+  auto& r = registry();
+  const std::lock_guard lock(r.mutex);
+  return r.counters.emplace_back();
+}
+}  // namespace detail
+
+size_t bytes_allocated(const size_t component, const Group group,
+                       const Kind kind) {
+  ASSERT(component < max_number_of_components,
+         "The component ID " << component << " is out of range");
+  return sum_over_threads(&detail::ThreadCounters::bytes,
+                          detail::category_index(component, group, kind));
+}
+
+size_t number_of_allocations(const Kind kind) {
+  return sum_over_threads(&detail::ThreadCounters::allocations,
+                          static_cast<size_t>(kind));
+}
+#else
+size_t bytes_allocated(const size_t /*component*/, const Group /*group*/,
+                       const Kind /*kind*/) {
+  return 0;
+}
+
+size_t number_of_allocations(const Kind /*kind*/) { return 0; }
+#endif  // SPECTRE_TRACK_ALLOCATIONS
+
+size_t bytes_allocated(const Kind kind) {
+  size_t result = 0;
+  for (size_t component = 0; component < max_number_of_components;
+       ++component) {
+    for (size_t group = 0; group < number_of_groups; ++group) {
+      result += bytes_allocated(component, static_cast<Group>(group), kind);
+    }
+  }
+  return result;
+}
+
+size_t bytes_allocated() {
+  size_t result = 0;
+  for (size_t i = 0; i < number_of_kinds; ++i) {
+    result += bytes_allocated(static_cast<Kind>(i));
+  }
+  return result;
+}
+}  // namespace memory_tracking
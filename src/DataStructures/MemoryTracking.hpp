@@ -0,0 +1,312 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "Utilities/Gsl.hpp"
+#include "Utilities/MemoryHelpers.hpp"
+#include "Utilities/PrettyType.hpp"
+
+/*!
+ * \brief Process-wide counters of the heap memory owned by the data
+ * structures that hold the bulk of the simulation data.
+ *
+ * \details When SpECTRE is configured with `-D SPECTRE_TRACK_ALLOCATIONS=ON`,
+ * `VectorImpl` (and therefore `DataVector`, `ComplexDataVector`, etc.) and
+ * `Variables` allocate their heap memory through
+ * `memory_tracking::make_tracked_array_for_overwrite`, so the number of bytes
+ * currently held is known at all times and can be read without traversing the
+ * objects, unlike `size_of_object_in_bytes`. Non-owning vectors and
+ * `Variables` don't hold any allocation and aren't counted.
+ *
+ * Every allocation is counted in a category made of
+ * - the `Kind` of data structure that allocated it,
+ * - the parallel component whose code allocated it, set by a
+ *   `ScopedComponent` (the parallel components set it while running their
+ *   actions and receiving data), and
+ * - the `Group` of DataBox items it is allocated for, set by a `ScopedGroup`
+ *   (e.g. the time stepper history and the mortar data set it where they
+ *   allocate).
+ *
+ * The category is stored with the allocation, so the memory is subtracted
+ * from the same category when it is freed, wherever that happens.
+ *
+ * Each thread updates its own counters, which live on their own cache lines,
+ * so recording an allocation doesn't need an atomic read-modify-write. The
+ * process-wide values are summed over all threads when they are read, so a
+ * value read while other threads allocate is only a snapshot. Memory freed on
+ * a different thread than the one that allocated it is subtracted from the
+ * counters of the freeing thread, which only matters for the sum.
+ *
+ * Without the CMake option, `tracked_array` is a plain `std::unique_ptr`, the
+ * scopes do nothing, nothing is recorded and all counters read zero.
+ */
+namespace memory_tracking {
+/// The kinds of data structures whose allocations are tracked
+enum class Kind { VectorImpl, Variables };
+
+/// The number of values of `Kind`
+constexpr size_t number_of_kinds = 2;
+
+/// The groups of DataBox items whose allocations are counted separately
+enum class Group { Other, TimeStepperHistory, Mortars };
+
+/// The number of values of `Group`
+constexpr size_t number_of_groups = 3;
+
+/// \brief The maximum number of parallel components that are counted
+/// separately.
+///
+/// \details The component with ID 0 collects the allocations made outside of
+/// any `ScopedComponent`, and those of components registered after the limit
+/// was reached.
+constexpr size_t max_number_of_components = 32;
+
+/// Whether SpECTRE was configured with `SPECTRE_TRACK_ALLOCATIONS`
+#ifdef SPECTRE_TRACK_ALLOCATIONS
+constexpr bool enabled = true;
+#else
+constexpr bool enabled = false;
+#endif  // SPECTRE_TRACK_ALLOCATIONS
+
+/// \brief Register a parallel component by name and return its ID.
+///
+/// \details Registering the same name again returns the same ID. The IDs
+/// depend on the order of registration, so they differ between processes.
+size_t register_component(const std::string& name);
+
+/// The name registered for the component `id`
+const std::string& component_name(size_t id);
+
+/// The ID of the parallel component `Component`, see `register_component`
+template <typename Component>
+size_t component_id() {
+  static const size_t id = register_component(pretty_type::name<Component>());
+  return id;
+}
+
+namespace detail {
+// Where in the counters the allocations of a category are stored
+constexpr size_t category_index(const size_t component, const Group group,
+                                const Kind kind) {
+  return (component * number_of_groups + static_cast<size_t>(group)) *
+             number_of_kinds +
+         static_cast<size_t>(kind);
+}
+
+constexpr size_t number_of_categories =
+    max_number_of_components * number_of_groups * number_of_kinds;
+
+struct Category {
+  size_t component = 0;
+  Group group = Group::Other;
+};
+
+// The category of the allocations made on this thread
+inline Category& current_category() {
+  thread_local Category category{};
+  return category;
+}
+}  // namespace detail
+
+#ifdef SPECTRE_TRACK_ALLOCATIONS
+/// \brief Count the tracked allocations made on this thread during the
+/// lifetime of the object as allocations of the component `component`.
+///
+/// \details The previous component is restored on destruction, so scopes can
+/// be nested.
+class ScopedComponent {
+ public:
+  explicit ScopedComponent(const size_t component)
+      : previous_(std::exchange(detail::current_category().component,
+                                component)) {}
+  ScopedComponent(const ScopedComponent&) = delete;
+  ScopedComponent& operator=(const ScopedComponent&) = delete;
+  ScopedComponent(ScopedComponent&&) = delete;
+  ScopedComponent& operator=(ScopedComponent&&) = delete;
+  ~ScopedComponent() { detail::current_category().component = previous_; }
+
+ private:
+  size_t previous_;
+};
+
+/// \brief Count the tracked allocations made on this thread during the
+/// lifetime of the object as allocations of the group `group`.
+///
+/// \details The previous group is restored on destruction, so scopes can be
+/// nested.
+class ScopedGroup {
+ public:
+  explicit ScopedGroup(const Group group)
+      : previous_(std::exchange(detail::current_category().group, group)) {}
+  ScopedGroup(const ScopedGroup&) = delete;
+  ScopedGroup& operator=(const ScopedGroup&) = delete;
+  ScopedGroup(ScopedGroup&&) = delete;
+  ScopedGroup& operator=(ScopedGroup&&) = delete;
+  ~ScopedGroup() { detail::current_category().group = previous_; }
+
+ private:
+  Group previous_;
+};
+
+namespace detail {
+// Only the owning thread writes the counters, other threads only read them.
+struct alignas(64) ThreadCounters {
+  std::array<std::atomic<std::int64_t>, number_of_categories> bytes{};
+  std::array<std::atomic<std::int64_t>, number_of_kinds> allocations{};
+};
+
+// Registers a new set of counters for the calling thread. The counters are
+// never freed, so the allocations of threads that exited are still counted.
+ThreadCounters& register_thread_counters();
+
+inline ThreadCounters& thread_counters() {
+  thread_local ThreadCounters& counters = register_thread_counters();
+  return counters;
+}
+
+// Never decremented and never read by other threads, so it isn't atomic
+inline size_t& thread_allocation_count() {
+  thread_local size_t count = 0;
+  return count;
+}
+
+inline void add(const gsl::not_null<std::atomic<std::int64_t>*> counter,
+                const std::int64_t value) {
+  counter->store(counter->load(std::memory_order_relaxed) + value,
+                 std::memory_order_relaxed);
+}
+}  // namespace detail
+
+/// \brief Record that `bytes` were allocated by a data structure of kind
+/// `kind` in the current category of this thread.
+///
+/// \details Returns the index of the category, which must be passed to
+/// `record_deallocation` when the memory is freed.
+inline size_t record_allocation(const Kind kind, const size_t bytes) {
+  auto& counters = detail::thread_counters();
+  const auto& category = detail::current_category();
+  const size_t index =
+      detail::category_index(category.component, category.group, kind);
+  detail::add(&counters.bytes[index], static_cast<std::int64_t>(bytes));
+  detail::add(&counters.allocations[static_cast<size_t>(kind)], 1);
+  ++detail::thread_allocation_count();
+  return index;
+}
+
+/// Record that `bytes` allocated in the category `category_index` were freed
+inline void record_deallocation(const size_t category_index,
+                                const size_t bytes) {
+  auto& counters = detail::thread_counters();
+  detail::add(&counters.bytes[category_index],
+              -static_cast<std::int64_t>(bytes));
+  detail::add(&counters.allocations[category_index % number_of_kinds], -1);
+}
+#else
+class ScopedComponent {
+ public:
+  explicit ScopedComponent(const size_t /*component*/) {}
+};
+
+class ScopedGroup {
+ public:
+  explicit ScopedGroup(const Group /*group*/) {}
+};
+#endif  // SPECTRE_TRACK_ALLOCATIONS
+
+/// @{
+/// The number of bytes currently allocated on this process by data structures
+/// of kind `kind`, or by all tracked data structures.
+size_t bytes_allocated(Kind kind);
+
+size_t bytes_allocated();
+/// @}
+
+/// The number of bytes currently allocated on this process by data structures
+/// of kind `kind` for the group `group` of the component `component`.
+size_t bytes_allocated(size_t component, Group group, Kind kind);
+
+/// The number of live allocations on this process by data structures of kind
+/// `kind`.
+size_t number_of_allocations(Kind kind);
+
+/// \brief The number of tracked allocations made by the calling thread since
+/// it started.
+///
+/// \details Unlike `number_of_allocations` this is never decremented, so the
+/// difference of two calls is the number of allocations made in between. The
+/// count is private to the thread and is always zero without
+/// `SPECTRE_TRACK_ALLOCATIONS`.
+inline size_t allocations_on_this_thread() {
+#ifdef SPECTRE_TRACK_ALLOCATIONS
+  return detail::thread_allocation_count();
+#else
+  return 0;
+#endif  // SPECTRE_TRACK_ALLOCATIONS
+}
+
+/// The name of `kind` as it is written to disk
+inline const char* name(const Kind kind) {
+  return kind == Kind::VectorImpl ? "VectorImpl" : "Variables";
+}
+
+/// The name of `group` as it is written to disk
+inline const char* name(const Group group) {
+  switch (group) {
+    case Group::TimeStepperHistory:
+      return "TimeStepperHistory";
+    case Group::Mortars:
+      return "Mortars";
+    default:
+      return "Other";
+  }
+}
+
+#ifdef SPECTRE_TRACK_ALLOCATIONS
+/// \brief Deleter for a heap array that records the deallocation.
+template <typename T, Kind TrackedKind>
+struct TrackedArrayDeleter {
+  size_t size = 0;
+  size_t category_index = 0;
+
+  void operator()(T* const pointer) const {
+    record_deallocation(category_index, size * sizeof(T));
+    delete[] pointer;  // NOLINT
+  }
+};
+
+/// A `std::unique_ptr` to a heap array whose allocation is tracked
+template <typename T, Kind TrackedKind>
+using tracked_array = std::unique_ptr<T[], TrackedArrayDeleter<T, TrackedKind>>;
+
+/// \brief Allocate an array of `size` default-initialized `T`s and record
+/// the allocation.
+///
+/// This is the tracked equivalent of `cpp20::make_unique_for_overwrite`.
+template <typename T, Kind TrackedKind>
+tracked_array<T, TrackedKind> make_tracked_array_for_overwrite(
+    const size_t size) {
+  T* const pointer = new T[size];  // NOLINT
+  return tracked_array<T, TrackedKind>{
+      pointer, TrackedArrayDeleter<T, TrackedKind>{
+                   size, record_allocation(TrackedKind, size * sizeof(T))}};
+}
+#else
+template <typename T, Kind TrackedKind>
+using tracked_array = std::unique_ptr<T[]>;
+
+template <typename T, Kind TrackedKind>
+tracked_array<T, TrackedKind> make_tracked_array_for_overwrite(
+    const size_t size) {
+  return cpp20::make_unique_for_overwrite<T[]>(size);
+}
+#endif  // SPECTRE_TRACK_ALLOCATIONS
+}  // namespace memory_tracking
@@ -0,0 +1,195 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines functions contracting tensors that are symmetric in their last two
+/// indices
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Utilities/ContainerHelpers.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/SetNumberOfGridPoints.hpp"
+
+namespace SymmetricContractions_detail {
+// For each independent component of the result of a contraction, the storage
+// indices of the components of the contracted tensor that appear in the sum.
+// Term `t` of the sum is multiplied by `factors[t]` and by the component with
+// storage index `other_storage_indices[t]` of the other operand.
+template <size_t NumberOfResultComponents, size_t NumberOfTerms>
+struct ContractionTable {
+  std::array<std::array<size_t, NumberOfTerms>, NumberOfResultComponents>
+      tensor_storage_indices{};
+  std::array<size_t, NumberOfTerms> other_storage_indices{};
+  std::array<double, NumberOfTerms> factors{};
+};
+
+// Table for R_{L} = T_{L c d} M^{cd}, where L are the leading indices of T.
+// Only the independent components of M are summed over, with off-diagonal
+// terms counted twice.
+template <typename ResultType, typename TensorType, typename MetricType>
+constexpr auto last_symmetric_pair_table() {
+  constexpr size_t result_rank = ResultType::rank();
+  ContractionTable<ResultType::size(), MetricType::size()> table{};
+  for (size_t t = 0; t < MetricType::size(); ++t) {
+    const auto pair = MetricType::structure::get_canonical_tensor_index(t);
+    gsl::at(table.other_storage_indices, t) = t;
+    gsl::at(table.factors, t) =
+        static_cast<double>(MetricType::structure::multiplicity(t));
+    for (size_t r = 0; r < ResultType::size(); ++r) {
+      const auto leading = ResultType::structure::get_canonical_tensor_index(r);
+      std::array<size_t, result_rank + 2> tensor_index{};
+      for (size_t i = 0; i < result_rank; ++i) {
+        gsl::at(tensor_index, i) = gsl::at(leading, i);
+      }
+      tensor_index[result_rank] = pair[0];
+      tensor_index[result_rank + 1] = pair[1];
+      gsl::at(gsl::at(table.tensor_storage_indices, r), t) =
+          TensorType::structure::get_storage_index(tensor_index);
+    }
+  }
+  return table;
+}
+
+// Table for R_{bc} = V^a T_{abc}
+template <typename ResultType, typename TensorType, typename VectorType>
+constexpr auto first_index_table() {
+  ContractionTable<ResultType::size(), VectorType::size()> table{};
+  for (size_t a = 0; a < VectorType::size(); ++a) {
+    gsl::at(table.other_storage_indices, a) = a;
+    gsl::at(table.factors, a) = 1.0;
+    for (size_t r = 0; r < ResultType::size(); ++r) {
+      const auto pair = ResultType::structure::get_canonical_tensor_index(r);
+      gsl::at(gsl::at(table.tensor_storage_indices, r), a) =
+          TensorType::structure::get_storage_index(
+              std::array<size_t, 3>{{a, pair[0], pair[1]}});
+    }
+  }
+  return table;
+}
+
+// Evaluates the contraction described by `Table` one result component at a
+// time. The sum over the terms is done at each grid point so that the loop
+// over grid points can be vectorized and each result component is only
+// written once.
+template <const auto& Table, typename ResultType, typename TensorType,
+          typename OtherType>
+void contract(const gsl::not_null<ResultType*> result,
+              const TensorType& tensor, const OtherType& other) {
+  set_number_of_grid_points(result, other);
+  const size_t number_of_points = get_size(other[0]);
+  constexpr size_t number_of_terms = Table.factors.size();
+  for (size_t r = 0; r < ResultType::size(); ++r) {
+    const auto& tensor_storage_indices =
+        gsl::at(Table.tensor_storage_indices, r);
+    auto& result_component = (*result)[r];
+    for (size_t s = 0; s < number_of_points; ++s) {
+      double sum = Table.factors[0] *
+                   get_element(tensor[tensor_storage_indices[0]], s) *
+                   get_element(other[Table.other_storage_indices[0]], s);
+      for (size_t t = 1; t < number_of_terms; ++t) {
+        sum += gsl::at(Table.factors, t) *
+               get_element(tensor[gsl::at(tensor_storage_indices, t)], s) *
+               get_element(other[gsl::at(Table.other_storage_indices, t)], s);
+      }
+      get_element(result_component, s) = sum;
+    }
+  }
+}
+
+template <typename ResultType, typename TensorType, typename MetricType>
+inline constexpr auto last_symmetric_pair_table_v =
+    last_symmetric_pair_table<ResultType, TensorType, MetricType>();
+
+template <typename ResultType, typename TensorType, typename VectorType>
+inline constexpr auto first_index_table_v =
+    first_index_table<ResultType, TensorType, VectorType>();
+}  // namespace SymmetricContractions_detail
+
+/// @{
+/*!
+ * \ingroup TensorGroup
+ * \brief Contracts the last two indices of a tensor that is symmetric in them
+ * with a symmetric rank-2 tensor.
+ *
+ * \details Computes \f$R_a = T_{abc} M^{bc}\f$ or \f$R_{ab} = T_{abcd}
+ * M^{cd}\f$. Only the independent components of the symmetric pair are
+ * visited, using storage indices that are computed at compile time, and the
+ * full sum is accumulated at each grid point before the result is stored.
+ * The indices can be spatial or spacetime indices and have either valence.
+ */
+template <typename DataType, typename Index0, typename Index1>
+void contract_last_symmetric_pair(
+    const gsl::not_null<Tensor<DataType, Symmetry<1>, index_list<Index0>>*>
+        result,
+    const Tensor<DataType, Symmetry<2, 1, 1>,
+                 index_list<Index0, Index1, Index1>>& tensor,
+    const Tensor<DataType, Symmetry<1, 1>,
+                 index_list<change_index_up_lo<Index1>,
+                            change_index_up_lo<Index1>>>& metric) {
+  using result_type = std::decay_t<decltype(*result)>;
+  using tensor_type = std::decay_t<decltype(tensor)>;
+  using metric_type = std::decay_t<decltype(metric)>;
+  SymmetricContractions_detail::contract<
+      SymmetricContractions_detail::last_symmetric_pair_table_v<
+          result_type, tensor_type, metric_type>>(result, tensor, metric);
+}
+
+template <typename DataType, typename ResultSymm, typename TensorSymm,
+          typename Index0, typename Index1, typename Index2>
+void contract_last_symmetric_pair(
+    const gsl::not_null<
+        Tensor<DataType, ResultSymm, index_list<Index0, Index1>>*>
+        result,
+    const Tensor<DataType, TensorSymm,
+                 index_list<Index0, Index1, Index2, Index2>>& tensor,
+    const Tensor<DataType, Symmetry<1, 1>,
+                 index_list<change_index_up_lo<Index2>,
+                            change_index_up_lo<Index2>>>& metric) {
+  static_assert(
+      (std::is_same_v<TensorSymm, Symmetry<3, 2, 1, 1>> and
+       std::is_same_v<ResultSymm, Symmetry<2, 1>>) or
+          (std::is_same_v<TensorSymm, Symmetry<2, 2, 1, 1>> and
+           std::is_same_v<ResultSymm, Symmetry<1, 1>>),
+      "The tensor must be symmetric in its last two indices and the symmetry "
+      "of its first two indices must match the symmetry of the result.");
+  using result_type = std::decay_t<decltype(*result)>;
+  using tensor_type = std::decay_t<decltype(tensor)>;
+  using metric_type = std::decay_t<decltype(metric)>;
+  SymmetricContractions_detail::contract<
+      SymmetricContractions_detail::last_symmetric_pair_table_v<
+          result_type, tensor_type, metric_type>>(result, tensor, metric);
+}
+/// @}
+
+/*!
+ * \ingroup TensorGroup
+ * \brief Contracts the first index of a tensor that is symmetric in its last
+ * two indices with a vector.
+ *
+ * \details Computes \f$R_{bc} = V^a T_{abc}\f$, e.g. the contraction of the
+ * shift with the generalized harmonic variable \f$\Phi_{iab}\f$. Only the
+ * independent components of the result are computed, using storage indices
+ * that are computed at compile time.
+ */
+template <typename DataType, typename Index0, typename Index1>
+void contract_first_index(
+    const gsl::not_null<
+        Tensor<DataType, Symmetry<1, 1>, index_list<Index1, Index1>>*>
+        result,
+    const Tensor<DataType, Symmetry<1>,
+                 index_list<change_index_up_lo<Index0>>>& vector,
+    const Tensor<DataType, Symmetry<2, 1, 1>,
+                 index_list<Index0, Index1, Index1>>& tensor) {
+  using result_type = std::decay_t<decltype(*result)>;
+  using tensor_type = std::decay_t<decltype(tensor)>;
+  using vector_type = std::decay_t<decltype(vector)>;
+  SymmetricContractions_detail::contract<
+      SymmetricContractions_detail::first_index_table_v<
+          result_type, tensor_type, vector_type>>(result, tensor, vector);
+}
@@ -6,6 +6,7 @@
 #include <cstddef>
 
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/EagerMath/SymmetricContractions.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 
@@ -18,19 +19,7 @@ void trace_last_indices(
     const Tensor<DataType, Symmetry<1, 1>,
                  index_list<change_index_up_lo<Index1>,
                             change_index_up_lo<Index1>>>& metric) {
-  constexpr auto dimension_of_trace = Index0::dim;
-  constexpr auto dimension_of_metric = Index1::dim;
-  for (size_t i = 0; i < dimension_of_trace; ++i) {
-    trace_of_tensor->get(i) = tensor.get(i, 0, 0) * get<0, 0>(metric);
-    for (size_t j = 0; j < dimension_of_metric; ++j) {
-      if (j != 0) {
-        trace_of_tensor->get(i) += tensor.get(i, j, j) * metric.get(j, j);
-      }
-      for (size_t k = j + 1; k < dimension_of_metric; ++k) {
-        trace_of_tensor->get(i) += 2.0 * tensor.get(i, j, k) * metric.get(j, k);
-      }
-    }
-  }
+  contract_last_symmetric_pair(trace_of_tensor, tensor, metric);
 }
 
 template <typename DataType, typename Index0>
@@ -22,6 +22,7 @@
 #include "DataStructures/Tensor/Expressions/TensorExpression.hpp"
 #include "DataStructures/VectorImpl.hpp"
 #include "Utilities/NoSuchType.hpp"
+#include "Utilities/Simd/Simd.hpp"
 
 namespace tenex {
 template <typename DataType>
@@ -57,12 +58,18 @@ constexpr bool is_supported_number_datatype_v =
 /// `TensorExpression`s, add the type to this alias and adjust other templates
 /// in this file, as necessary.
 ///
+/// `Tensor`s holding a `simd::batch<double>` are supported so that pointwise
+/// kernels can be written with `TensorExpression`s. Like for `double`, the
+/// evaluation of these expressions is fully unrolled at compile time (see
+/// `tenex::evaluate`).
+///
 /// \tparam X the `Tensor` data type
 template <typename X>
 struct is_supported_tensor_datatype
     : std::disjunction<
           std::is_same<X, double>, std::is_same<X, std::complex<double>>,
-          std::is_same<X, DataVector>, std::is_same<X, ComplexDataVector>> {};
+          std::is_same<X, DataVector>, std::is_same<X, ComplexDataVector>,
+          std::is_same<X, simd::batch<double>>> {};
 
 template <typename X>
 constexpr bool is_supported_tensor_datatype_v =
@@ -177,6 +184,10 @@ template <typename ValueType1, typename VectorType1, size_t StaticSize1,
 struct is_assignable<VectorImpl<ValueType1, VectorType1, StaticSize1>,
                      VectorImpl<ValueType2, VectorType2, StaticSize2>>
     : ::VectorImpl_detail::is_assignable<VectorType1, VectorType2> {};
+/// Can assign a `simd::batch` to its value type, i.e. set all of its lanes
+template <typename ValueType, typename Arch>
+struct is_assignable<simd::batch<ValueType, Arch>, ValueType>
+    : std::true_type {};
 /// Can assign a `VectorImpl` to its value type, e.g. can assign a `DataVector`
 /// to a `double`
 template <typename ValueType, typename VectorType, size_t StaticSize>
@@ -278,6 +289,19 @@ struct get_binop_datatype_impl<
 };
 /// @}
 /// @{
+/// A binary operation between a `simd::batch` and its underlying value type
+/// yields the `simd::batch`, e.g. `simd::batch<double> OP double =
+/// simd::batch<double>`
+template <typename ValueType, typename Arch>
+struct get_binop_datatype_impl<simd::batch<ValueType, Arch>, ValueType> {
+  using type = simd::batch<ValueType, Arch>;
+};
+template <typename ValueType, typename Arch>
+struct get_binop_datatype_impl<ValueType, simd::batch<ValueType, Arch>> {
+  using type = simd::batch<ValueType, Arch>;
+};
+/// @}
+/// @{
 /// A binary operation between a real-valued `VectorImpl` and the complex-valued
 /// partner to the `VectorImpl`'s underlying type yields the complex partner
 /// type of the `VectorImpl`, e.g.
@@ -10,6 +10,7 @@
 #include <complex>
 #include <cstddef>
 #include <type_traits>
+#include <utility>
 
 #include "DataStructures/ComplexDataVector.hpp"
 #include "DataStructures/DataVector.hpp"
@@ -103,6 +104,80 @@ struct CheckNoLhsAntiSymmetries<SymmList<Symm...>> {
   static constexpr bool value = (... and (Symm::value > 0));
 };
 
+/*!
+ * \ingroup TensorExpressionsGroup
+ * \brief For each component of the LHS tensor, whether or not it is evaluated
+ * and the multi-index of the RHS component from which it is computed
+ *
+ * \details The returned array is indexed by the storage index of the LHS
+ * component. Since this is computed at compile time, `evaluate_impl` can fully
+ * unroll the evaluation of the LHS components when the data type is not a
+ * vector type.
+ *
+ * @tparam LhsTensorType the type of the LHS `Tensor`
+ * @tparam RhsIndexList the list of \ref SpacetimeIndex "TensorIndexType"s of
+ * the RHS expression
+ * @tparam LhsTensorIndices the `TensorIndex`s of the LHS `Tensor`
+ * @tparam RhsTensorIndices the `TensorIndex`s of the RHS expression
+ */
+template <typename LhsTensorType, typename RhsIndexList,
+          typename... LhsTensorIndices, typename... RhsTensorIndices>
+constexpr auto get_rhs_multi_indices_of_lhs_components(
+    tmpl::list<LhsTensorIndices...> /*meta*/,
+    tmpl::list<RhsTensorIndices...> /*meta*/) {
+  constexpr size_t num_lhs_indices = sizeof...(LhsTensorIndices);
+  constexpr size_t num_rhs_indices = sizeof...(RhsTensorIndices);
+
+  using lhs_tensorindex_list = tmpl::list<LhsTensorIndices...>;
+  using rhs_tensorindex_list = tmpl::list<RhsTensorIndices...>;
+
+  constexpr std::array<size_t, num_rhs_indices> index_transformation =
+      compute_tensorindex_transformation<num_lhs_indices, num_rhs_indices>(
+          {{LhsTensorIndices::value...}}, {{RhsTensorIndices::value...}});
+
+  // positions of indices in LHS tensor where generic spatial indices are used
+  // for spacetime indices
+  constexpr auto lhs_spatial_spacetime_index_positions =
+      get_spatial_spacetime_index_positions<typename LhsTensorType::index_list,
+                                            lhs_tensorindex_list>();
+  // positions of indices in RHS tensor where generic spatial indices are used
+  // for spacetime indices
+  constexpr auto rhs_spatial_spacetime_index_positions =
+      get_spatial_spacetime_index_positions<RhsIndexList,
+                                            rhs_tensorindex_list>();
+
+  // positions of indices in LHS tensor where concrete time indices are used
+  constexpr auto lhs_time_index_positions =
+      get_time_index_positions<lhs_tensorindex_list>();
+
+  std::array<std::pair<bool, std::array<size_t, num_rhs_indices>>,
+             LhsTensorType::size()>
+      rhs_multi_indices{};
+  for (size_t i = 0; i < LhsTensorType::size(); i++) {
+    auto lhs_multi_index =
+        LhsTensorType::structure::get_canonical_tensor_index(i);
+    if (is_evaluated_lhs_multi_index(lhs_multi_index,
+                                     lhs_spatial_spacetime_index_positions,
+                                     lhs_time_index_positions)) {
+      for (size_t j = 0; j < lhs_spatial_spacetime_index_positions.size();
+           j++) {
+        gsl::at(lhs_multi_index,
+                gsl::at(lhs_spatial_spacetime_index_positions, j)) -= 1;
+      }
+      auto rhs_multi_index =
+          transform_multi_index(lhs_multi_index, index_transformation);
+      for (size_t j = 0; j < rhs_spatial_spacetime_index_positions.size();
+           j++) {
+        gsl::at(rhs_multi_index,
+                gsl::at(rhs_spatial_spacetime_index_positions, j)) += 1;
+      }
+      gsl::at(rhs_multi_indices, i).first = true;
+      gsl::at(rhs_multi_indices, i).second = rhs_multi_index;
+    }
+  }
+  return rhs_multi_indices;
+}
+
 /*!
  * \ingroup TensorExpressionsGroup
  * \brief Evaluate subtrees of the RHS expression or the RHS expression as a
@@ -164,9 +239,10 @@ void evaluate_impl(
   static_assert(is_supported_tensor_datatype_v<LhsDataType> and
                     is_supported_tensor_datatype_v<RhsDataType>,
                 "TensorExpressions currently only support Tensors whose data "
-                "type is double, std::complex<double>, DataVector, or "
-                "ComplexDataVector. It is possible to add support for other "
-                "data types that are supported by Tensor.");
+                "type is double, std::complex<double>, DataVector, "
+                "ComplexDataVector, or simd::batch<double>. It is possible "
+                "to add support for other data types that are supported by "
+                "Tensor.");
   static_assert(
       is_assignable_v<LhsDataType, RhsDataType>,
       "Assignment of the LHS Tensor's data type to the RHS TensorExpression's "
@@ -247,69 +323,57 @@ void evaluate_impl(
     }
   }
 
-  constexpr std::array<size_t, num_rhs_indices> index_transformation =
-      compute_tensorindex_transformation<num_lhs_indices, num_rhs_indices>(
-          {{LhsTensorIndices::value...}}, {{RhsTensorIndices::value...}});
-
-  // positions of indices in LHS tensor where generic spatial indices are used
-  // for spacetime indices
-  constexpr auto lhs_spatial_spacetime_index_positions =
-      get_spatial_spacetime_index_positions<LhsIndexList,
-                                            lhs_tensorindex_list>();
-  // positions of indices in RHS tensor where generic spatial indices are used
-  // for spacetime indices
-  constexpr auto rhs_spatial_spacetime_index_positions =
-      get_spatial_spacetime_index_positions<RhsIndexList,
-                                            rhs_tensorindex_list>();
-
-  // positions of indices in LHS tensor where concrete time indices are used
-  constexpr auto lhs_time_index_positions =
-      get_time_index_positions<lhs_tensorindex_list>();
-
   using rhs_expression_type =
       typename std::decay_t<decltype(~rhs_tensorexpression)>;
 
-  for (size_t i = 0; i < lhs_tensor_type::size(); i++) {
-    auto lhs_multi_index =
-        lhs_tensor_type::structure::get_canonical_tensor_index(i);
-    if (is_evaluated_lhs_multi_index(lhs_multi_index,
-                                     lhs_spatial_spacetime_index_positions,
-                                     lhs_time_index_positions)) {
-      for (size_t j = 0; j < lhs_spatial_spacetime_index_positions.size();
-           j++) {
-        gsl::at(lhs_multi_index,
-                gsl::at(lhs_spatial_spacetime_index_positions, j)) -= 1;
-      }
-      auto rhs_multi_index =
-          transform_multi_index(lhs_multi_index, index_transformation);
-      for (size_t j = 0; j < rhs_spatial_spacetime_index_positions.size();
-           j++) {
-        gsl::at(rhs_multi_index,
-                gsl::at(rhs_spatial_spacetime_index_positions, j)) += 1;
-      }
-
-      // The expression will either be evaluated as one whole expression
-      // or it will be split up into subtrees that are evaluated one at a time.
-      // See the section on splitting in the documentation for the
-      // `TensorExpression` class to understand the logic and terminology used
-      // in this control flow below.
-      if constexpr (EvaluateSubtrees) {
-        // the expression is split up, so evaluate subtrees at splits
-        (~rhs_tensorexpression)
-            .evaluate_primary_subtree((*lhs_tensor)[i], rhs_multi_index);
-        if constexpr (not rhs_expression_type::is_primary_start) {
-          // the root expression type is not the starting point of a leg, so it
-          // has not yet been evaluated, so now we evaluate this last leg of the
-          // expression at the root of the tree
-          (*lhs_tensor)[i] =
-              (~rhs_tensorexpression)
-                  .get_primary((*lhs_tensor)[i], rhs_multi_index);
+  static constexpr auto rhs_multi_indices =
+      get_rhs_multi_indices_of_lhs_components<lhs_tensor_type, RhsIndexList>(
+          lhs_tensorindex_list{}, rhs_tensorindex_list{});
+
+  const auto evaluate_component =
+      [&lhs_tensor, &rhs_tensorexpression](
+          const size_t i,
+          const std::array<size_t, num_rhs_indices>& rhs_multi_index) {
+        // The expression will either be evaluated as one whole expression
+        // or it will be split up into subtrees that are evaluated one at a
+        // time. See the section on splitting in the documentation for the
+        // `TensorExpression` class to understand the logic and terminology
+        // used in this control flow below.
+        if constexpr (EvaluateSubtrees) {
+          // the expression is split up, so evaluate subtrees at splits
+          (~rhs_tensorexpression)
+              .evaluate_primary_subtree((*lhs_tensor)[i], rhs_multi_index);
+          if constexpr (not rhs_expression_type::is_primary_start) {
+            // the root expression type is not the starting point of a leg, so
+            // it has not yet been evaluated, so now we evaluate this last leg
+            // of the expression at the root of the tree
+            (*lhs_tensor)[i] =
+                (~rhs_tensorexpression)
+                    .get_primary((*lhs_tensor)[i], rhs_multi_index);
+          }
+        } else {
+          // the expression is not split up, so evaluate full expression
+          (*lhs_tensor)[i] = (~rhs_tensorexpression).get(rhs_multi_index);
         }
-      } else {
-        // the expression is not split up, so evaluate full expression
-        (*lhs_tensor)[i] = (~rhs_tensorexpression).get(rhs_multi_index);
+      };
+
+  if constexpr (is_derived_of_vector_impl_v<LhsDataType>) {
+    for (size_t i = 0; i < lhs_tensor_type::size(); i++) {
+      if (gsl::at(rhs_multi_indices, i).first) {
+        evaluate_component(i, gsl::at(rhs_multi_indices, i).second);
       }
     }
+  } else {
+    // For fixed-size data types like `double` and `simd::batch<double>`, the
+    // loop over the LHS components is unrolled so that each component is
+    // computed by straight-line code with a compile-time multi-index
+    tmpl::for_each<tmpl::range<size_t, 0, lhs_tensor_type::size()>>(
+        [&evaluate_component](auto index_v) {
+          constexpr size_t i = tmpl::type_from<decltype(index_v)>::value;
+          if constexpr (std::get<i>(rhs_multi_indices).first) {
+            evaluate_component(i, std::get<i>(rhs_multi_indices).second);
+          }
+        });
   }
 }
 
@@ -339,9 +403,10 @@ void evaluate_impl(
 
   static_assert(is_supported_tensor_datatype_v<X> and
                 "TensorExpressions currently only support Tensors whose data "
-                "type is double, std::complex<double>, DataVector, or "
-                "ComplexDataVector. It is possible to add support for other "
-                "data types that are supported by Tensor.");
+                "type is double, std::complex<double>, DataVector, "
+                "ComplexDataVector, or simd::batch<double>. It is possible "
+                "to add support for other data types that are supported by "
+                "Tensor.");
   static_assert(
       is_assignable_v<X, NumberType>,
       "Assignment of the LHS Tensor's data type to the RHS number's data type "
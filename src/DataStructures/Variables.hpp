@@ -30,6 +30,7 @@
 #include "DataStructures/DataBox/TagTraits.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/MathWrapper.hpp"
+#include "DataStructures/MemoryTracking.hpp"
 #include "DataStructures/SpinWeighted.hpp"
 #include "DataStructures/Tensor/IndexType.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
@@ -573,7 +574,8 @@ class Variables<tmpl::list<Tags...>> {
 
   std::array<value_type, number_of_independent_components>
       variable_data_impl_static_;
-  std::unique_ptr<value_type[]> variable_data_impl_dynamic_{};
+  memory_tracking::tracked_array<value_type, memory_tracking::Kind::Variables>
+      variable_data_impl_dynamic_{};
   bool owning_{true};
   size_t size_ = 0;
   size_t number_of_grid_points_ = 0;
@@ -670,7 +672,8 @@ void Variables<tmpl::list<Tags...>>::initialize(
       variable_data_impl_dynamic_.reset();
     } else {
       variable_data_impl_dynamic_ =
-          cpp20::make_unique_for_overwrite<value_type[]>(size_);
+          memory_tracking::make_tracked_array_for_overwrite<
+              value_type, memory_tracking::Kind::Variables>(size_);
     }
     add_reference_variable_data();
 #if defined(SPECTRE_DEBUG) || defined(SPECTRE_NAN_INIT)
@@ -22,6 +22,7 @@
 #include <type_traits>
 
 #include "DataStructures/Blaze/StepFunction.hpp"
+#include "DataStructures/MemoryTracking.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ForceInline.hpp"
 #include "Utilities/Gsl.hpp"
@@ -317,7 +318,8 @@ class VectorImpl
   void pup(PUP::er& p);
 
  protected:
-  std::unique_ptr<value_type[]> owned_data_{};
+  memory_tracking::tracked_array<value_type, memory_tracking::Kind::VectorImpl>
+      owned_data_{};
   std::array<T, StaticSize> static_owned_data_{};
   bool owning_{true};
 
@@ -342,10 +344,12 @@ class VectorImpl
     }
   }
 
-  SPECTRE_ALWAYS_INLINE std::unique_ptr<value_type[]> heap_alloc_if_necessary(
-      const size_t set_size) {
+  SPECTRE_ALWAYS_INLINE memory_tracking::tracked_array<
+      value_type, memory_tracking::Kind::VectorImpl>
+  heap_alloc_if_necessary(const size_t set_size) {
     return set_size > StaticSize
-               ? cpp20::make_unique_for_overwrite<value_type[]>(set_size)
+               ? memory_tracking::make_tracked_array_for_overwrite<
+                     value_type, memory_tracking::Kind::VectorImpl>(set_size)
                : nullptr;
   }
 };
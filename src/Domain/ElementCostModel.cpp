@@ -0,0 +1,166 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Domain/ElementCostModel.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <optional>
+#include <pup.h>
+#include <pup_stl.h>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/Matrix.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Literals.hpp"
+#include "Utilities/Numeric.hpp"
+#include "Utilities/StdHelpers.hpp"
+
+namespace domain {
+template <size_t Dim>
+std::vector<std::string> ElementCostModel<Dim>::legend() {
+  std::vector<std::string> result{"Time", "BlockId"};
+  for (size_t d = 0; d < Dim; ++d) {
+    result.push_back("Extent" + std::to_string(d));
+  }
+  result.emplace_back("SubcellActive");
+  result.emplace_back("Cost");
+  return result;
+}
+
+template <size_t Dim>
+ElementCostModel<Dim>::ElementCostModel(const Matrix& measured_costs) {
+  if (measured_costs.columns() != Dim + 4) {
+    ERROR("The measured element costs must have the "
+          << Dim + 4 << " columns " << legend() << " but have "
+          << measured_costs.columns() << " columns.");
+  }
+  for (size_t row = 0; row < measured_costs.rows(); ++row) {
+    std::array<size_t, Dim> extents{};
+    for (size_t d = 0; d < Dim; ++d) {
+      extents[d] = static_cast<size_t>(std::lround(measured_costs(row, d + 2)));
+    }
+    insert(static_cast<size_t>(std::lround(measured_costs(row, 1))), extents,
+           measured_costs(row, Dim + 2) != 0.0, measured_costs(row, Dim + 3));
+  }
+}
+
+template <size_t Dim>
+void ElementCostModel<Dim>::insert(const size_t block_id,
+                                   const std::array<size_t, Dim>& extents,
+                                   const bool subcell_active,
+                                   const double cost) {
+  auto& [sum, count] = costs_[Key{block_id, extents, subcell_active}];
+  sum += cost;
+  ++count;
+  total_cost_ += cost;
+  total_grid_points_ +=
+      alg::accumulate(extents, 1_st, std::multiplies<size_t>());
+}
+
+template <size_t Dim>
+std::optional<double> ElementCostModel<Dim>::cost(
+    const size_t block_id, const std::array<size_t, Dim>& extents,
+    const bool subcell_active) const {
+  const auto it = costs_.find(Key{block_id, extents, subcell_active});
+  if (it == costs_.end()) {
+    return std::nullopt;
+  }
+  return it->second.first / static_cast<double>(it->second.second);
+}
+
+template <size_t Dim>
+std::optional<double> ElementCostModel<Dim>::cost(
+    const size_t block_id, const std::array<size_t, Dim>& extents) const {
+  double sum = 0.0;
+  size_t count = 0;
+  for (const bool subcell_active : {false, true}) {
+    const auto it = costs_.find(Key{block_id, extents, subcell_active});
+    if (it != costs_.end()) {
+      sum += it->second.first;
+      count += it->second.second;
+    }
+  }
+  if (count == 0) {
+    return std::nullopt;
+  }
+  return sum / static_cast<double>(count);
+}
+
+template <size_t Dim>
+double ElementCostModel<Dim>::cost_per_grid_point() const {
+  if (total_grid_points_ == 0) {
+    ERROR("No element costs were measured.");
+  }
+  return total_cost_ / static_cast<double>(total_grid_points_);
+}
+
+template <size_t Dim>
+size_t ElementCostModel<Dim>::number_of_measurements() const {
+  size_t result = 0;
+  for (const auto& [key, sum_and_count] : costs_) {
+    result += sum_and_count.second;
+  }
+  return result;
+}
+
+template <size_t Dim>
+void ElementCostModel<Dim>::pup(PUP::er& p) {
+  p | costs_;
+  p | total_cost_;
+  p | total_grid_points_;
+}
+
+template <size_t Dim>
+void ElementCostModel<Dim>::Key::pup(PUP::er& p) {
+  p | block_id;
+  p | extents;
+  p | subcell_active;
+}
+
+template <size_t Dim>
+bool ElementCostModel<Dim>::Key::operator<(const Key& rhs) const {
+  return std::tie(block_id, extents, subcell_active) <
+         std::tie(rhs.block_id, rhs.extents, rhs.subcell_active);
+}
+
+template <size_t Dim>
+bool ElementCostModel<Dim>::Key::operator==(const Key& rhs) const {
+  return block_id == rhs.block_id and extents == rhs.extents and
+         subcell_active == rhs.subcell_active;
+}
+
+template <size_t Dim>
+bool operator==(const ElementCostModel<Dim>& lhs,
+                const ElementCostModel<Dim>& rhs) {
+  return lhs.costs_ == rhs.costs_ and lhs.total_cost_ == rhs.total_cost_ and
+         lhs.total_grid_points_ == rhs.total_grid_points_;
+}
+
+template <size_t Dim>
+bool operator!=(const ElementCostModel<Dim>& lhs,
+                const ElementCostModel<Dim>& rhs) {
+  return not(lhs == rhs);
+}
+
+#define GET_DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATION(r, data)                                          \
+  template class ElementCostModel<GET_DIM(data)>;                       \
+  template bool operator==(const ElementCostModel<GET_DIM(data)>& lhs,  \
+                           const ElementCostModel<GET_DIM(data)>& rhs); \
+  template bool operator!=(const ElementCostModel<GET_DIM(data)>& lhs,  \
+                           const ElementCostModel<GET_DIM(data)>& rhs);
+
+GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
+
+#undef GET_DIM
+#undef INSTANTIATION
+}  // namespace domain
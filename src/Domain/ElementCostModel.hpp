@@ -0,0 +1,104 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+/// \cond
+class Matrix;
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace domain {
+/*!
+ * \brief The computational cost of `Element`s measured in a previous run,
+ * keyed by the block, the extents of the (DG) mesh and whether the element
+ * evolved on the subcell grid.
+ *
+ * \details The costs are recorded with `Events::ObserveElementCosts`, which
+ * writes one row per element and observation with the columns listed in
+ * `legend()`. The model stores the mean cost of all rows with the same key.
+ * Pass the model to `get_element_costs()` to distribute the elements by their
+ * measured cost with the `BlockZCurveProcDistribution`.
+ *
+ * The costs are wall times, so they are only meaningful relative to each other
+ * and the model should be recorded on a machine similar to the one it is used
+ * on.
+ */
+template <size_t Dim>
+class ElementCostModel {
+ public:
+  /// The columns of the measured costs, see `Events::ObserveElementCosts`
+  static std::vector<std::string> legend();
+
+  ElementCostModel() = default;
+
+  /// Construct the model from the rows of measured costs, with the columns
+  /// listed in `legend()`
+  explicit ElementCostModel(const Matrix& measured_costs);
+
+  /// Add a measured cost
+  void insert(size_t block_id, const std::array<size_t, Dim>& extents,
+              bool subcell_active, double cost);
+
+  /// The mean cost of the elements in the block with the extents that were
+  /// (or weren't) evolved on the subcell grid, if any were measured
+  std::optional<double> cost(size_t block_id,
+                             const std::array<size_t, Dim>& extents,
+                             bool subcell_active) const;
+
+  /// The mean cost of all elements in the block with the extents, whether they
+  /// were evolved on the DG or the subcell grid, if any were measured
+  ///
+  /// This is the expected cost of an element that doesn't know yet which grid
+  /// it will evolve on, e.g. when distributing the elements at startup.
+  std::optional<double> cost(size_t block_id,
+                             const std::array<size_t, Dim>& extents) const;
+
+  /// The mean cost per grid point of all measured elements, used to estimate
+  /// the cost of elements that weren't measured
+  double cost_per_grid_point() const;
+
+  /// The number of measured costs
+  size_t number_of_measurements() const;
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+
+ private:
+  template <size_t LocalDim>
+  // NOLINTNEXTLINE(readability-redundant-declaration)
+  friend bool operator==(const ElementCostModel<LocalDim>& lhs,
+                         const ElementCostModel<LocalDim>& rhs);
+
+  struct Key {
+    size_t block_id{};
+    std::array<size_t, Dim> extents{};
+    bool subcell_active{false};
+
+    // NOLINTNEXTLINE(google-runtime-references)
+    void pup(PUP::er& p);
+
+    bool operator<(const Key& rhs) const;
+    bool operator==(const Key& rhs) const;
+  };
+
+  // The sum and the number of the measured costs of each key
+  std::map<Key, std::pair<double, size_t>> costs_{};
+  double total_cost_{0.0};
+  size_t total_grid_points_{0};
+};
+
+template <size_t Dim>
+bool operator!=(const ElementCostModel<Dim>& lhs,
+                const ElementCostModel<Dim>& rhs);
+}  // namespace domain
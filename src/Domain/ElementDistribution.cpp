@@ -17,6 +17,7 @@
 #include "DataStructures/Tensor/IndexType.hpp"
 #include "Domain/Block.hpp"
 #include "Domain/CreateInitialElement.hpp"
+#include "Domain/ElementCostModel.hpp"
 #include "Domain/ElementMap.hpp"
 #include "Domain/MinimumGridSpacing.hpp"
 #include "Domain/Structure/CreateInitialMesh.hpp"
@@ -131,6 +132,33 @@ std::unordered_map<ElementId<Dim>, double> get_element_costs(
   return element_costs;
 }
 
+template <size_t Dim>
+std::unordered_map<ElementId<Dim>, double> get_element_costs(
+    const std::vector<Block<Dim>>& blocks,
+    const std::vector<std::array<size_t, Dim>>& initial_refinement_levels,
+    const std::vector<std::array<size_t, Dim>>& initial_extents,
+    const ElementCostModel<Dim>& cost_model) {
+  std::unordered_map<ElementId<Dim>, double> element_costs{};
+  const double cost_per_grid_point = cost_model.cost_per_grid_point();
+
+  for (size_t block_number = 0; block_number < blocks.size(); block_number++) {
+    const auto& extents = initial_extents[block_number];
+    const std::vector<ElementId<Dim>> element_ids = initial_element_ids(
+        blocks[block_number].id(), initial_refinement_levels[block_number]);
+    const double cost =
+        cost_model.cost(block_number, extents)
+            .value_or(static_cast<double>(alg::accumulate(
+                          extents, 1_st, std::multiplies<size_t>())) *
+                      cost_per_grid_point);
+
+    for (const auto& element_id : element_ids) {
+      element_costs.insert({element_id, cost});
+    }
+  }
+
+  return element_costs;
+}
+
 template <size_t Dim>
 BlockZCurveProcDistribution<Dim>::BlockZCurveProcDistribution(
     const std::unordered_map<ElementId<Dim>, double>& element_costs,
@@ -335,7 +363,14 @@ size_t BlockZCurveProcDistribution<Dim>::get_proc_for_element(
           initial_refinement_levels,                                         \
       const std::vector<std::array<size_t, GET_DIM(data)>>& initial_extents, \
       ElementWeight element_weight,                                          \
-      const std::optional<Spectral::Quadrature>& quadrature);
+      const std::optional<Spectral::Quadrature>& quadrature);                \
+  template std::unordered_map<ElementId<GET_DIM(data)>, double>              \
+  get_element_costs(                                                         \
+      const std::vector<Block<GET_DIM(data)>>& blocks,                       \
+      const std::vector<std::array<size_t, GET_DIM(data)>>&                  \
+          initial_refinement_levels,                                         \
+      const std::vector<std::array<size_t, GET_DIM(data)>>& initial_extents, \
+      const ElementCostModel<GET_DIM(data)>& cost_model);
 
 GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
 
@@ -23,6 +23,10 @@ class Block;
 template <size_t Dim>
 class ElementId;
 
+namespace domain {
+template <size_t Dim>
+class ElementCostModel;
+}  // namespace domain
 namespace Spectral {
 enum class Quadrature : uint8_t;
 }  // namespace Spectral
@@ -63,6 +67,21 @@ std::unordered_map<ElementId<Dim>, double> get_element_costs(
     ElementWeight element_weight,
     const std::optional<Spectral::Quadrature>& quadrature);
 
+/// \brief Get the cost of each `Element` in a list of `Block`s from the costs
+/// measured in a previous run
+///
+/// \details The cost of each `Element` is the mean measured cost of the
+/// `Element`s in its `Block` with the same extents, whether they evolved on the
+/// DG or the subcell grid (see `ElementCostModel::cost()`). `Element`s without
+/// measurements are assigned their number of grid points times the mean
+/// measured cost per grid point.
+template <size_t Dim>
+std::unordered_map<ElementId<Dim>, double> get_element_costs(
+    const std::vector<Block<Dim>>& blocks,
+    const std::vector<std::array<size_t, Dim>>& initial_refinement_levels,
+    const std::vector<std::array<size_t, Dim>>& initial_extents,
+    const ElementCostModel<Dim>& cost_model);
+
 /*!
  * \brief Distribution strategy for assigning elements to CPUs using a
  * Morton ('Z-order') space-filling curve to determine placement within each
@@ -0,0 +1,77 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/Matrix.hpp"
+#include "Domain/ElementCostModel.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/Dat.hpp"
+#include "IO/H5/File.hpp"
+#include "Options/Auto.hpp"
+#include "Options/String.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+namespace Parallel::OptionTags {
+struct Parallelization;
+}  // namespace Parallel::OptionTags
+/// \endcond
+
+namespace domain {
+namespace OptionTags {
+/// \ingroup OptionTagsGroup
+/// \ingroup ComputationalDomainGroup
+/// The H5 file with the element costs measured in a previous run, see
+/// `domain::ElementCostModel`
+struct ElementCostModel {
+  using type = Options::Auto<std::string, Options::AutoLabel::None>;
+  static constexpr Options::String help = {
+      "H5 file with the element costs measured by the ObserveElementCosts "
+      "event in a previous run with the same domain. The costs replace the "
+      "weights of the ZCurve ElementDistribution. Specify 'None' to use the "
+      "weights."};
+  using group = Parallel::OptionTags::Parallelization;
+};
+}  // namespace OptionTags
+
+namespace Tags {
+/// \ingroup DataBoxTagsGroup
+/// \ingroup ComputationalDomainGroup
+/// The element costs measured in a previous run, read from the subfile
+/// `subfile_name` of the file given in the input file.
+///
+/// When this tag is in the global cache, the elements are distributed by
+/// their measured cost instead of the `domain::Tags::ElementDistribution`
+/// weights, see `Parallel::create_elements_using_distribution()`.
+template <size_t Dim>
+struct ElementCostModel : db::SimpleTag {
+  using type = std::optional<domain::ElementCostModel<Dim>>;
+  using option_tags = tmpl::list<OptionTags::ElementCostModel>;
+
+  /// The subfile written by `Events::ObserveElementCosts`
+  static std::string subfile_name() { return "/ElementCosts"; }
+
+  static constexpr bool pass_metavariables = false;
+  static type create_from_options(const std::optional<std::string>& file_name) {
+    if (not file_name.has_value()) {
+      return std::nullopt;
+    }
+    const h5::H5File<h5::AccessType::ReadOnly> file{*file_name};
+    const auto& dat = file.get<h5::Dat>(subfile_name());
+    domain::ElementCostModel<Dim> result{dat.get_data()};
+    if (result.number_of_measurements() == 0) {
+      ERROR("The subfile '" << subfile_name() << "' of the file '" << *file_name
+                            << "' holds no element costs.");
+    }
+    return result;
+  }
+};
+}  // namespace Tags
+}  // namespace domain
@@ -9,6 +9,7 @@
 #include "DataStructures/DataBox/TagName.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
 #include "Parallel/GlobalCache.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/EventsAndTriggers.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/Tags.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/WhenToCheck.hpp"
 #include "Time/SelfStart.hpp"
@@ -26,17 +27,18 @@ struct TimeStepId;
 
 namespace evolution::Actions {
 namespace detail {
-template <typename DbTags, typename Metavariables, typename ArrayIndex,
+template <typename ObservationBoxType, typename DbTags,
+          typename Metavariables, typename ArrayIndex,
           typename ParallelComponent, typename EventsAndTriggers_t>
-void run_events_and_triggers(db::DataBox<DbTags>& box,
-                             Parallel::GlobalCache<Metavariables>& cache,
-                             const ArrayIndex& array_index,
-                             const ParallelComponent* const component,
-                             const EventsAndTriggers_t& events_and_triggers,
-                             const TimeStepId& time_step_id) {
+void run_events_and_triggers(
+    const gsl::not_null<std::optional<ObservationBoxType>*> observation_box,
+    db::DataBox<DbTags>& box, Parallel::GlobalCache<Metavariables>& cache,
+    const ArrayIndex& array_index, const ParallelComponent* const component,
+    const EventsAndTriggers_t& events_and_triggers,
+    const TimeStepId& time_step_id) {
   if (time_step_id.substep() == 0) {
     events_and_triggers.run_events(
-        make_not_null(&box), cache, array_index, component,
+        observation_box, make_not_null(&box), cache, array_index, component,
         {db::tag_name<::Tags::Time>(), db::get<::Tags::Time>(box)});
   } else {
     const double substep_offset = 1.0e6;
@@ -44,7 +46,7 @@ void run_events_and_triggers(db::DataBox<DbTags>& box,
         time_step_id.step_time().value() +
         substep_offset * static_cast<double>(time_step_id.substep());
     events_and_triggers.run_events(
-        make_not_null(&box), cache, array_index, component,
+        observation_box, make_not_null(&box), cache, array_index, component,
         {db::tag_name<::Tags::Time>(), observation_value},
         [&box](const Trigger& trigger) {
           const auto* substep_trigger =
@@ -63,6 +65,10 @@ void run_events_and_triggers(db::DataBox<DbTags>& box,
 /// Triggers will only be checked on the first step of each slab to
 /// ensure that a consistent set of events is run across all elements.
 ///
+/// With local time stepping, the events triggered at steps and at slabs share
+/// one `ObservationBox`, so compute items needed by both are only evaluated
+/// once per step.
+///
 /// Uses:
 /// - GlobalCache: the EventsAndTriggers tag, as required by
 ///   events and triggers
@@ -94,10 +100,13 @@ struct RunEventsAndTriggers {
       return {Parallel::AlgorithmExecution::Continue, std::nullopt};
     }
 
+    std::optional<EventsAndTriggers::ObservationBoxType<DbTags, Metavariables>>
+        observation_box{};
     if constexpr (local_time_stepping) {
       const auto& events_and_triggers_at_steps = Parallel::get<
           ::Tags::EventsAndTriggers<Triggers::WhenToCheck::AtSteps>>(cache);
-      detail::run_events_and_triggers(box, cache, array_index, component,
+      detail::run_events_and_triggers(make_not_null(&observation_box), box,
+                                      cache, array_index, component,
                                       events_and_triggers_at_steps,
                                       time_step_id);
     }
@@ -108,7 +117,8 @@ struct RunEventsAndTriggers {
 
     const auto& events_and_triggers_at_slabs = Parallel::get<
         ::Tags::EventsAndTriggers<Triggers::WhenToCheck::AtSlabs>>(cache);
-    detail::run_events_and_triggers(box, cache, array_index, component,
+    detail::run_events_and_triggers(make_not_null(&observation_box), box,
+                                    cache, array_index, component,
                                     events_and_triggers_at_slabs, time_step_id);
     return {Parallel::AlgorithmExecution::Continue, std::nullopt};
   }
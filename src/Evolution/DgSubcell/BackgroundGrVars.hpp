@@ -23,6 +23,8 @@
 #include "Domain/Structure/Element.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Tags.hpp"
+#include "Evolution/DiscontinuousGalerkin/BackgroundGrVarsKey.hpp"
+#include "Evolution/DgSubcell/Tags/BackgroundGrVarsKey.hpp"
 #include "Evolution/DgSubcell/Tags/Coordinates.hpp"
 #include "Evolution/DgSubcell/Tags/DidRollback.hpp"
 #include "Evolution/DgSubcell/Tags/Inactive.hpp"
@@ -50,6 +52,13 @@ namespace evolution::dg::subcell {
  * a curved spacetime without solving Einstein equations (e.g. ValenciaDivclean,
  * ForceFree),
  *
+ * In time-dependent blocks the variables are not evaluated again if they were
+ * already evaluated on the same FD mesh at the same time, as recorded in
+ * `evolution::dg::subcell::Tags::BackgroundGrVarsKey`. This avoids repeated
+ * evaluations of the analytic solution when the mutator is called more than
+ * once per substep, e.g. both after a rollback and before the FD time
+ * derivative.
+ *
  * \warning This mutator assumes that the GR analytic data or solution
  * specifying background spacetime metric is time-independent.
  *
@@ -83,13 +92,15 @@ struct BackgroundGrVars : tt::ConformsTo<db::protocols::Mutator> {
                           ::Tags::AnalyticSolutionOrData>>;
 
   using return_tags =
-      tmpl::list<gr_vars_tag, inactive_gr_vars_tag, subcell_faces_gr_tag>;
+      tmpl::list<gr_vars_tag, inactive_gr_vars_tag, subcell_faces_gr_tag,
+                 subcell::Tags::BackgroundGrVarsKey<volume_dim>>;
 
   template <typename T>
   static void apply(
       const gsl::not_null<GrVars*> active_gr_vars,
       const gsl::not_null<InactiveGrVars*> inactive_gr_vars,
       const gsl::not_null<SubcellFaceGrVars*> subcell_face_gr_vars,
+      const gsl::not_null<BackgroundGrVarsKey<volume_dim>*> key,
       const double time,
       const std::unordered_map<
           std::string,
@@ -116,7 +127,8 @@ struct BackgroundGrVars : tt::ConformsTo<db::protocols::Mutator> {
       const size_t block_id = element_id.block_id();
       const Block<volume_dim>& block = domain.blocks()[block_id];
 
-      if (block.is_time_dependent()) {
+      if (block.is_time_dependent() and
+          not key->is_valid_for(subcell_mesh, time, true)) {
         if (did_rollback or not ComputeOnlyOnRollback) {
           if (did_rollback) {
             // Right after rollback, subcell GR vars are stored in the
@@ -146,6 +158,7 @@ struct BackgroundGrVars : tt::ConformsTo<db::protocols::Mutator> {
           face_centered_impl(subcell_face_gr_vars, time, functions_of_time,
                              logical_to_grid_map, grid_to_inertial_map,
                              subcell_mesh, solution_or_data);
+          key->set(subcell_mesh, time);
         }
       }
 
@@ -171,6 +184,7 @@ struct BackgroundGrVars : tt::ConformsTo<db::protocols::Mutator> {
       face_centered_impl(subcell_face_gr_vars, time, functions_of_time,
                          logical_to_grid_map, grid_to_inertial_map,
                          subcell_mesh, solution_or_data);
+      key->set(subcell_mesh, time);
     }
   }
 
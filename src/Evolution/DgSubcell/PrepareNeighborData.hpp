@@ -3,9 +3,11 @@
 
 #pragma once
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
 #include <optional>
+#include <unordered_set>
 #include <utility>
 
 #include "DataStructures/DataBox/DataBox.hpp"
@@ -50,6 +52,11 @@ namespace evolution::dg::subcell {
  * having the mutator `GhostVariables` is to allow sending primitive or
  * characteristic variables for reconstruction.
  *
+ * Neighbors in blocks listed in `SubcellOptions::only_dg_block_ids()` never
+ * switch to FD and so never use the data for reconstruction. In directions
+ * where all neighbors are in such blocks only the RDMP TCI data is sent,
+ * avoiding both the message volume and the projection and slicing cost.
+ *
  * \note If all neighbors are using DG then we send our DG volume data _without_
  * orienting it. This elides the expense of projection and slicing. If any
  * neighbors are doing FD, we project and slice to all neighbors. A future
@@ -73,15 +80,28 @@ void prepare_neighbor_data(
       db::get<::evolution::dg::subcell::Tags::Mesh<Dim>>(*box);
   const auto& element = db::get<::domain::Tags::Element<Dim>>(*box);
 
-  const std::unordered_set<Direction<Dim>>& directions_to_slice =
-      element.internal_boundaries();
+  const auto& subcell_options =
+      db::get<evolution::dg::subcell::Tags::SubcellOptions<Dim>>(*box);
+  // Directions in which a neighbor may need our data for reconstruction. If
+  // all neighbors in a direction are in DG-only blocks, we send only the RDMP
+  // TCI data in that direction.
+  const auto is_dg_only = [&subcell_options](const ElementId<Dim>& id) {
+    return std::binary_search(subcell_options.only_dg_block_ids().begin(),
+                              subcell_options.only_dg_block_ids().end(),
+                              id.block_id());
+  };
+  std::unordered_set<Direction<Dim>> directions_to_slice{};
+  for (const auto& [direction, neighbors] : element.neighbors()) {
+    if (not alg::all_of(neighbors, is_dg_only)) {
+      directions_to_slice.insert(direction);
+    }
+  }
 
   const auto& neighbor_meshes = db::get<domain::Tags::NeighborMesh<Dim>>(*box);
   const subcell::RdmpTciData& rdmp_data =
       db::get<subcell::Tags::DataForRdmpTci>(*box);
   const ::fd::DerivativeOrder fd_derivative_order =
-      get<evolution::dg::subcell::Tags::SubcellOptions<Dim>>(*box)
-          .finite_difference_derivative_order();
+      subcell_options.finite_difference_derivative_order();
   const size_t rdmp_size = rdmp_data.max_variables_values.size() +
                            rdmp_data.min_variables_values.size();
   const size_t extra_size_for_ghost_data =
@@ -159,6 +179,10 @@ void prepare_neighbor_data(
     for (const auto& [directional_element_id, interpolator] :
          db::get<evolution::dg::subcell::Tags::InterpolatorsFromDgToNeighborFd<
              Dim>>(*box)) {
+      if (directions_to_slice.count(directional_element_id.direction()) ==
+          0) {
+        continue;
+      }
       // NOTE: no orienting is needed, that's done by the interpolation.
       ASSERT(interpolator.has_value(),
              "All interpolators must have values. The std::optional is used "
@@ -177,6 +201,10 @@ void prepare_neighbor_data(
   // call. That means once in the initial data and then in both the DG and FD
   // TCIs.
   for (const auto& [direction, neighbors] : element.neighbors()) {
+    if (directions_to_slice.count(direction) == 0) {
+      all_neighbor_data_for_reconstruction->insert_or_assign(
+          direction, DataVector{rdmp_size});
+    }
     // Add the RDMP TCI data to what we will be sending.
     // Note that this is added _after_ the reconstruction data has been
     // re-oriented (in the case where we have neighbors doing FD).
@@ -0,0 +1,22 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Evolution/DiscontinuousGalerkin/BackgroundGrVarsKey.hpp"
+
+namespace evolution::dg::subcell::Tags {
+/// \brief The subcell mesh and time of the background GR variables on the
+/// cell-centered and face-centered FD grid points, see
+/// `evolution::dg::BackgroundGrVarsKey`.
+///
+/// The key belongs to the FD grid, not to the active grid, so it stays valid
+/// while the variables are swapped between the active and inactive tags.
+template <size_t Dim>
+struct BackgroundGrVarsKey : db::SimpleTag {
+  using type = evolution::dg::BackgroundGrVarsKey<Dim>;
+};
+}  // namespace evolution::dg::subcell::Tags
@@ -18,6 +18,7 @@
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "DataStructures/DataBox/Prefixes.hpp"
+#include "DataStructures/MemoryTracking.hpp"
 #include "DataStructures/Tensor/EagerMath/Magnitude.hpp"
 #include "Domain/FaceNormal.hpp"
 #include "Domain/Structure/DirectionalIdMap.hpp"
@@ -311,6 +312,8 @@ bool receive_boundary_data_global_time_stepping(
         make_not_null(&db::as_access(*box)), received_temporal_id_and_data);
   }
 
+  const memory_tracking::ScopedGroup tracked_group{
+      memory_tracking::Group::Mortars};
   db::mutate<evolution::dg::Tags::MortarMesh<volume_dim>,
              evolution::dg::Tags::MortarData<volume_dim>,
              evolution::dg::Tags::MortarNextTemporalId<volume_dim>,
@@ -443,6 +446,8 @@ bool receive_boundary_data_local_time_stepping(
   ASSERT(inbox_ptr != nullptr, "The inbox pointer should not be null.");
   InboxMap& inbox = *inbox_ptr;
 
+  const memory_tracking::ScopedGroup tracked_group{
+      memory_tracking::Group::Mortars};
   const bool have_all_intermediate_messages = db::mutate<
       evolution::dg::Tags::MortarMesh<Dim>,
       evolution::dg::Tags::MortarDataHistory<Dim,
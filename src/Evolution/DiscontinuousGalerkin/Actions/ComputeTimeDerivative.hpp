@@ -14,10 +14,12 @@
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/MemoryTracking.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
 #include "DataStructures/VariablesTag.hpp"
 #include "Domain/CoordinateMaps/Tags.hpp"
+#include "Domain/Creators/Tags/Domain.hpp"
 #include "Domain/Creators/Tags/ExternalBoundaryConditions.hpp"
 #include "Domain/InterfaceHelpers.hpp"
 #include "Domain/Structure/Direction.hpp"
@@ -33,6 +35,7 @@
 #include "Evolution/DiscontinuousGalerkin/Actions/VolumeTermsImpl.hpp"
 #include "Evolution/DiscontinuousGalerkin/BoundaryData.hpp"
 #include "Evolution/DiscontinuousGalerkin/InboxTags.hpp"
+#include "Evolution/DiscontinuousGalerkin/MessagePriorities.hpp"
 #include "Evolution/DiscontinuousGalerkin/MortarData.hpp"
 #include "Evolution/DiscontinuousGalerkin/MortarDataHolder.hpp"
 #include "Evolution/DiscontinuousGalerkin/MortarTags.hpp"
@@ -57,6 +60,7 @@
 #include "Time/BoundaryHistory.hpp"
 #include "Time/Tags/HistoryEvolvedVariables.hpp"
 #include "Time/Tags/MinimumTimeStep.hpp"
+#include "Time/Tags/TimeStep.hpp"
 #include "Time/TakeStep.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/Gsl.hpp"
@@ -661,6 +665,8 @@ void ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers,
         [[maybe_unused]] const Variables<db::wrap_tags_in<
             ::Tags::Flux, typename EvolutionSystem::flux_variables,
             tmpl::size_t<Dim>, Frame::Inertial>>& volume_fluxes) {
+  const memory_tracking::ScopedGroup tracked_group{
+      memory_tracking::Group::Mortars};
   auto& receiver_proxy =
       Parallel::get_parallel_component<ParallelComponent>(*cache);
   const auto& element = db::get<domain::Tags::Element<Dim>>(*box);
@@ -688,6 +694,23 @@ void ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers,
     tci_decision = evolution::dg::subcell::get_tci_decision(*box);
   }
 
+  // Data from elements on the critical path is delivered first
+  std::optional<int> message_priority{};
+  if constexpr (Parallel::is_in_global_cache<
+                    Metavariables, evolution::dg::Tags::MessagePriorities>) {
+    const auto& message_priorities =
+        Parallel::get<evolution::dg::Tags::MessagePriorities>(*cache);
+    if (message_priorities.has_value()) {
+      const auto& domain = Parallel::get<domain::Tags::Domain<Dim>>(*cache);
+      message_priority = evolution::dg::MessagePriorities::priority(
+          time_step_id, db::get<::Tags::TimeStep>(*box),
+          db::get<evolution::dg::Tags::MortarNextTemporalId<Dim>>(*box),
+          message_priorities->is_prioritized(
+              domain.blocks()[element.id().block_id()].name(),
+              domain.block_groups()));
+    }
+  }
+
   for (const auto& [direction, neighbors] : element.neighbors()) {
     const auto& orientation = neighbors.orientation();
     const auto direction_from_neighbor = orientation(direction.opposite());
@@ -760,7 +783,16 @@ void ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers,
                 Dim, UseNodegroupDgElements>{},
             neighbor, time_step_id,
             std::make_pair(DirectionalId{direction_from_neighbor, element.id()},
-                           std::move(data)));
+                           std::move(data)),
+            message_priority.value_or(0));
+      } else if (message_priority.has_value()) {
+        Parallel::receive_data<
+            evolution::dg::Tags::BoundaryCorrectionAndGhostCellsInbox<
+                Dim, UseNodegroupDgElements>>(
+            receiver_proxy[neighbor], time_step_id,
+            std::make_pair(DirectionalId{direction_from_neighbor, element.id()},
+                           std::move(data)),
+            false, *message_priority);
       } else {
         Parallel::receive_data<
             evolution::dg::Tags::BoundaryCorrectionAndGhostCellsInbox<
@@ -800,6 +832,8 @@ void ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers,
     // using the `NormalDotNumericalFlux` prefix tag. This is because the
     // returned quantity is more a `dt` quantity than a
     // `NormalDotNormalDotFlux` since it's been lifted to the volume.
+    const memory_tracking::ScopedGroup tracked_group{
+        memory_tracking::Group::Mortars};
     db::mutate<evolution::dg::Tags::MortarData<Dim>,
                evolution::dg::Tags::MortarDataHistory<
                    Dim, typename dt_variables_tag::type>>(
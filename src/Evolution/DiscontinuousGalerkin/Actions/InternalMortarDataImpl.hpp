@@ -12,6 +12,7 @@
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/MemoryTracking.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
 #include "Domain/CoordinateMaps/CoordinateMap.hpp"
@@ -337,6 +338,8 @@ void internal_mortar_data(
     const Variables<get_primitive_vars_tags_from_system<System>>* const
         primitive_vars,
     tmpl::list<PackageDataVolumeTags...> /*meta*/) {
+  const memory_tracking::ScopedGroup tracked_group{
+      memory_tracking::Group::Mortars};
   db::mutate<evolution::dg::Tags::NormalCovectorAndMagnitude<Dim>,
              evolution::dg::Tags::MortarData<Dim>>(
       [&boundary_correction, &face_temporaries, &packaged_data_buffer,
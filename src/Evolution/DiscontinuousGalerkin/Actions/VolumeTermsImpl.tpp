@@ -14,6 +14,7 @@
 #include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
+#include "Evolution/DiscontinuousGalerkin/ApplyOnTiles.hpp"
 #include "Evolution/PassVariables.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Formulation.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/MetricIdentityJacobian.hpp"
@@ -29,6 +30,16 @@
 #include "Utilities/TMPL.hpp"
 
 namespace evolution::dg::Actions::detail {
+template <typename T, typename = std::void_t<>>
+struct has_volume_tile_size : std::false_type {};
+
+template <typename T>
+struct has_volume_tile_size<T, std::void_t<decltype(T::volume_tile_size)>>
+    : std::true_type {};
+
+template <typename T>
+constexpr bool has_volume_tile_size_v = has_volume_tile_size<T>::value;
+
 /*
  * Computes the volume terms for a discontinuous Galerkin scheme.
  *
@@ -46,6 +57,13 @@ namespace evolution::dg::Actions::detail {
  * 2. The volume time derivatives are calculated from
  *    `System::compute_volume_time_derivative_terms`
  *
+ *    If the `compute_volume_time_derivative_terms` define a
+ *    `static constexpr size_t volume_tile_size` and their
+ *    `static bool can_be_tiled(time_derivative_args...)` returns true, the
+ *    terms are evaluated on blocks of `volume_tile_size` grid points at a
+ *    time, see `evolution::dg::apply_on_tiles`. This keeps the temporaries in
+ *    cache on large elements and gives identical results.
+ *
  *    The source terms and nonconservative products are contributed directly
  *    to the `dt_vars` arguments passed to the time derivative function, while
  *    the volume fluxes are computed into the `volume_fluxes` arguments. The
@@ -142,14 +160,45 @@ void volume_terms(
           time_derivative_args...);
     }
   } else {
-    ComputeVolumeTimeDerivativeTerms::apply(
-        make_not_null(&get<::Tags::dt<VariablesTags>>(*dt_vars_ptr))...,
-        make_not_null(&get<::Tags::Flux<FluxVariablesTags, tmpl::size_t<Dim>,
-                                        Frame::Inertial>>(*volume_fluxes))...,
-        make_not_null(&get<TemporaryTags>(*temporaries))...,
-        get<::Tags::deriv<PartialDerivTags, tmpl::size_t<Dim>,
-                          Frame::Inertial>>(*partial_derivs)...,
-        time_derivative_args...);
+    const auto apply_terms = [](const auto&... args) {
+      ComputeVolumeTimeDerivativeTerms::apply(args...);
+    };
+    bool use_tiles = false;
+    if constexpr (has_volume_tile_size_v<ComputeVolumeTimeDerivativeTerms>) {
+      static_assert(
+          ComputeVolumeTimeDerivativeTerms::volume_tile_size % 8 == 0,
+          "The volume tile size must be a multiple of the SIMD width so that "
+          "the results don't depend on the tiles.");
+      use_tiles = mesh.number_of_grid_points() >
+                      ComputeVolumeTimeDerivativeTerms::volume_tile_size and
+                  ComputeVolumeTimeDerivativeTerms::can_be_tiled(
+                      time_derivative_args...);
+    }
+    if (use_tiles) {
+      if constexpr (has_volume_tile_size_v<ComputeVolumeTimeDerivativeTerms>) {
+        evolution::dg::apply_on_tiles(
+            apply_terms, mesh.number_of_grid_points(),
+            ComputeVolumeTimeDerivativeTerms::volume_tile_size,
+            make_not_null(&get<::Tags::dt<VariablesTags>>(*dt_vars_ptr))...,
+            make_not_null(
+                &get<::Tags::Flux<FluxVariablesTags, tmpl::size_t<Dim>,
+                                  Frame::Inertial>>(*volume_fluxes))...,
+            make_not_null(&get<TemporaryTags>(*temporaries))...,
+            get<::Tags::deriv<PartialDerivTags, tmpl::size_t<Dim>,
+                              Frame::Inertial>>(*partial_derivs)...,
+            time_derivative_args...);
+      }
+    } else {
+      apply_terms(
+          make_not_null(&get<::Tags::dt<VariablesTags>>(*dt_vars_ptr))...,
+          make_not_null(
+              &get<::Tags::Flux<FluxVariablesTags, tmpl::size_t<Dim>,
+                                Frame::Inertial>>(*volume_fluxes))...,
+          make_not_null(&get<TemporaryTags>(*temporaries))...,
+          get<::Tags::deriv<PartialDerivTags, tmpl::size_t<Dim>,
+                            Frame::Inertial>>(*partial_derivs)...,
+          time_derivative_args...);
+    }
   }
 
   // Add volume terms for moving meshes
@@ -0,0 +1,124 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <optional>
+#include <tuple>
+#include <utility>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace evolution::dg {
+namespace ApplyOnTiles_detail {
+// Arguments that aren't tensors of `DataVector`s are passed to every tile
+// unchanged.
+template <typename T>
+class Tile {
+ public:
+  explicit Tile(const T& full) : full_(&full) {}
+  void set(const size_t /*offset*/, const size_t /*size*/) {}
+  const T& get() const { return *full_; }
+
+ private:
+  const T* full_;
+};
+
+template <typename Symm, typename IndexList>
+class Tile<Tensor<DataVector, Symm, IndexList>> {
+ public:
+  using type = Tensor<DataVector, Symm, IndexList>;
+  explicit Tile(const type& full) : full_(&full) {}
+  void set(const size_t offset, const size_t size) {
+    for (size_t i = 0; i < full_->size(); ++i) {
+      make_const_view(make_not_null(&std::as_const(view_[i])), (*full_)[i],
+                      offset, size);
+    }
+  }
+  const type& get() const { return view_; }
+
+ private:
+  const type* full_;
+  type view_{};
+};
+
+template <typename Symm, typename IndexList>
+class Tile<std::optional<Tensor<DataVector, Symm, IndexList>>> {
+ public:
+  using type = std::optional<Tensor<DataVector, Symm, IndexList>>;
+  explicit Tile(const type& full) : full_(&full) {
+    if (full_->has_value()) {
+      view_.emplace();
+    }
+  }
+  void set(const size_t offset, const size_t size) {
+    if (full_->has_value()) {
+      for (size_t i = 0; i < full_->value().size(); ++i) {
+        make_const_view(make_not_null(&std::as_const(view_.value()[i])),
+                        full_->value()[i], offset, size);
+      }
+    }
+  }
+  const type& get() const { return view_; }
+
+ private:
+  const type* full_;
+  type view_{};
+};
+
+template <typename Symm, typename IndexList>
+class Tile<gsl::not_null<Tensor<DataVector, Symm, IndexList>*>> {
+ public:
+  using type = Tensor<DataVector, Symm, IndexList>;
+  explicit Tile(const gsl::not_null<type*> full) : full_(full) {}
+  void set(const size_t offset, const size_t size) {
+    for (size_t i = 0; i < full_->size(); ++i) {
+      view_[i].set_data_ref((*full_)[i].data() + offset, size);
+    }
+  }
+  gsl::not_null<type*> get() { return make_not_null(&view_); }
+
+ private:
+  gsl::not_null<type*> full_;
+  type view_{};
+};
+}  // namespace ApplyOnTiles_detail
+
+/*!
+ * \brief Call `f(args...)` on consecutive blocks of `tile_size` grid points
+ * instead of on all `number_of_points` grid points at once.
+ *
+ * \details Tensors of `DataVector`s, optional ones, and `gsl::not_null`
+ * pointers to them are replaced by non-owning views into the grid points of
+ * the current tile, and all other arguments are passed unchanged. This keeps
+ * the temporaries that `f` computes for a tile in cache when evaluating many
+ * pointwise terms on large elements. `f` must therefore be pointwise in all
+ * tensor arguments, and must not use the other arguments to infer the number
+ * of grid points.
+ *
+ * The tensors are evaluated with the same operations in the same order as
+ * without tiles, and thus give identical results as long as `tile_size` is a
+ * multiple of the SIMD width, so the vectorized loops over each tile split
+ * off the same points as the loop over all grid points.
+ */
+template <typename F, typename... Args>
+void apply_on_tiles(F&& f, const size_t number_of_points,
+                    const size_t tile_size, const Args&... args) {
+  ASSERT(tile_size > 0, "The tile size must be positive.");
+  std::tuple<ApplyOnTiles_detail::Tile<Args>...> tiles{args...};
+  for (size_t offset = 0; offset < number_of_points; offset += tile_size) {
+    const size_t size = std::min(tile_size, number_of_points - offset);
+    std::apply(
+        [&f, &offset, &size](auto&... tile) {
+          (tile.set(offset, size), ...);
+          f(tile.get()...);
+        },
+        tiles);
+  }
+}
+}  // namespace evolution::dg
@@ -16,6 +16,7 @@
 #include "Domain/Structure/Element.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Tags.hpp"
+#include "Evolution/DiscontinuousGalerkin/BackgroundGrVarsKey.hpp"
 #include "Evolution/Initialization/InitialData.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "PointwiseFunctions/AnalyticData/Tags.hpp"
@@ -43,6 +44,10 @@ struct EmptyStruct {
  * for evolution systems run on a curved spacetime without solving Einstein
  * equations (e.g. ValenciaDivclean, ForceFree).
  *
+ * The variables are evaluated again only if the mesh changed, or if the block
+ * is time-dependent and the time changed since the last evaluation, as
+ * recorded in `evolution::dg::Tags::BackgroundGrVarsKey`.
+ *
  * \warning This mutator assumes that the GR analytic data or solution
  * specifying background spacetime metric is time-independent.
  *
@@ -69,39 +74,34 @@ struct BackgroundGrVars : tt::ConformsTo<db::protocols::Mutator> {
                                      evolution::initial_data::Tags::InitialData,
                                      ::Tags::AnalyticSolutionOrData>>;
 
-  using return_tags = tmpl::list<gr_variables_tag>;
+  using return_tags =
+      tmpl::list<gr_variables_tag, Tags::BackgroundGrVarsKey<volume_dim>>;
 
   template <typename T>
   static void apply(
-      const gsl::not_null<GrVars*> background_gr_vars, const double time,
+      const gsl::not_null<GrVars*> background_gr_vars,
+      const gsl::not_null<BackgroundGrVarsKey<volume_dim>*> key,
+      const double time,
       const Domain<volume_dim>& domain,
       const tnsr::I<DataVector, volume_dim, Frame::Inertial>& inertial_coords,
       const Mesh<volume_dim>& mesh, const Element<volume_dim>& element,
       const T& solution_or_data) {
-    const size_t num_grid_pts = mesh.number_of_grid_points();
-
-    if (background_gr_vars->number_of_grid_points() != 0) {  // Evolution phase
-      ASSERT((*background_gr_vars).number_of_grid_points() == num_grid_pts,
-             "The size of GR variables ("
-                 << (*background_gr_vars).number_of_grid_points()
-                 << ") is not equal to the number of grid points ("
-                 << mesh.number_of_grid_points() << ").");
+    // Check if the mesh is actually moving i.e. block coordinate map is
+    // time-dependent. If not, we can skip the evaluation of GR variables
+    // since they may stay with their values assigned when the mesh was set.
+    const size_t block_id = element.id().block_id();
+    const Block<volume_dim>& block = domain.blocks()[block_id];
+    if (key->is_valid_for(mesh, time, block.is_time_dependent())) {
+      return;
+    }
 
-      // Check if the mesh is actually moving i.e. block coordinate map is
-      // time-dependent. If not, we can skip the evaluation of GR variables
-      // since they may stay with their values assigned at the initialization
-      // phase.
-      const auto& element_id = element.id();
-      const size_t block_id = element_id.block_id();
-      const Block<volume_dim>& block = domain.blocks()[block_id];
-      if (block.is_time_dependent()) {
-        impl(background_gr_vars, time, inertial_coords, solution_or_data);
-      }
-    } else {
-      // Initialization phase
-      (*background_gr_vars).initialize(num_grid_pts);
-      impl(background_gr_vars, time, inertial_coords, solution_or_data);
+    const size_t num_grid_pts = mesh.number_of_grid_points();
+    if (background_gr_vars->number_of_grid_points() != num_grid_pts) {
+      // Initialization phase or the mesh changed
+      background_gr_vars->initialize(num_grid_pts);
     }
+    impl(background_gr_vars, time, inertial_coords, solution_or_data);
+    key->set(mesh, time);
   }
 
  private:
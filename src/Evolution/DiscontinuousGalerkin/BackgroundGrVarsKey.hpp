@@ -0,0 +1,82 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <limits>
+#include <pup.h>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+
+namespace evolution::dg {
+/*!
+ * \brief The mesh and time on which an element last evaluated its background
+ * GR variables.
+ *
+ * \details Background GR variables of analytic data or solutions that are
+ * time-independent only need to be evaluated again if the grid points move,
+ * i.e. if the mesh changes or if the block's coordinate map is
+ * time-dependent and the time changes. Mutators and actions that evaluate
+ * the background store this key next to the variables and skip the
+ * evaluation if the variables are still valid.
+ */
+template <size_t Dim>
+class BackgroundGrVarsKey {
+ public:
+  BackgroundGrVarsKey() = default;
+
+  /// Whether the variables evaluated for this key are valid on `mesh` at
+  /// `time`. The time is only compared if `is_time_dependent`.
+  bool is_valid_for(const Mesh<Dim>& mesh, const double time,
+                    const bool is_time_dependent) const {
+    // A default-constructed key has no grid points, so it doesn't match the
+    // mesh of any element.
+    return mesh_ == mesh and (not is_time_dependent or time_ == time);
+  }
+
+  /// Record that the variables were evaluated on `mesh` at `time`.
+  void set(const Mesh<Dim>& mesh, const double time) {
+    mesh_ = mesh;
+    time_ = time;
+  }
+
+  const Mesh<Dim>& mesh() const { return mesh_; }
+  double time() const { return time_; }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) {
+    p | mesh_;
+    p | time_;
+  }
+
+ private:
+  Mesh<Dim> mesh_{};
+  double time_{std::numeric_limits<double>::signaling_NaN()};
+};
+
+template <size_t Dim>
+bool operator==(const BackgroundGrVarsKey<Dim>& lhs,
+                const BackgroundGrVarsKey<Dim>& rhs) {
+  // The time of an unset key is NaN
+  return lhs.mesh() == rhs.mesh() and
+         (lhs.time() == rhs.time() or
+          (lhs.time() != lhs.time() and rhs.time() != rhs.time()));
+}
+
+template <size_t Dim>
+bool operator!=(const BackgroundGrVarsKey<Dim>& lhs,
+                const BackgroundGrVarsKey<Dim>& rhs) {
+  return not(lhs == rhs);
+}
+
+namespace Tags {
+/// \brief The mesh and time of the background GR variables on the DG grid,
+/// see `evolution::dg::BackgroundGrVarsKey`.
+template <size_t Dim>
+struct BackgroundGrVarsKey : db::SimpleTag {
+  using type = evolution::dg::BackgroundGrVarsKey<Dim>;
+};
+}  // namespace Tags
+}  // namespace evolution::dg
@@ -6,6 +6,7 @@
 #include <pup.h>
 #include <pup_stl.h>
 
+#include "DataStructures/MemoryTracking.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Serialization/PupStlCpp17.hpp"
 #include "Utilities/StdHelpers.hpp"
@@ -13,6 +14,8 @@
 namespace evolution::dg {
 template <size_t Dim>
 void BoundaryData<Dim>::pup(PUP::er& p) {
+  const memory_tracking::ScopedGroup tracked_group{
+      memory_tracking::Group::Mortars};
   p | volume_mesh;
   p | volume_mesh_ghost_cell_data;
   p | boundary_correction_mesh;
@@ -0,0 +1,93 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/DiscontinuousGalerkin/MessagePriorities.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <pup.h>
+#include <pup_stl.h>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "Domain/Structure/BlockGroups.hpp"
+#include "Domain/Structure/DirectionalIdMap.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Utilities/Algorithm.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+
+namespace evolution::dg {
+MessagePriorities::MessagePriorities(
+    std::vector<std::string> prioritized_blocks)
+    : prioritized_blocks_(std::move(prioritized_blocks)) {}
+
+bool MessagePriorities::is_prioritized(
+    const std::string& block_name,
+    const std::unordered_map<std::string, std::unordered_set<std::string>>&
+        block_groups) const {
+  return alg::any_of(prioritized_blocks_,
+                     [&block_name, &block_groups](const std::string& name) {
+                       return domain::block_is_in_group(block_name, name,
+                                                        block_groups);
+                     });
+}
+
+template <size_t Dim>
+int MessagePriorities::priority(
+    const TimeStepId& time_step_id, const TimeDelta& time_step,
+    const DirectionalIdMap<Dim, TimeStepId>& neighbor_next_time_step_ids,
+    const bool is_prioritized) {
+  double steps_ahead = 0.0;
+  if (not neighbor_next_time_step_ids.empty() and time_step.value() != 0.0) {
+    // The slowest neighbor is the one we expect data from earliest
+    const TimeStepId& slowest_neighbor =
+        std::min_element(
+            neighbor_next_time_step_ids.begin(),
+            neighbor_next_time_step_ids.end(),
+            [](const auto& lhs, const auto& rhs) {
+              return lhs.second < rhs.second;
+            })
+            ->second;
+    // Dividing by the signed step keeps the result positive for an element
+    // that is ahead when evolving backwards in time.
+    steps_ahead = (time_step_id.substep_time() -
+                   slowest_neighbor.substep_time()) /
+                  time_step.value();
+  }
+  const int result =
+      static_cast<int>(std::lround(std::clamp(
+          steps_ahead, -static_cast<double>(max_priority),
+          static_cast<double>(max_priority)))) -
+      (is_prioritized ? 1 : 0);
+  return std::clamp(result, -max_priority, max_priority);
+}
+
+void MessagePriorities::pup(PUP::er& p) { p | prioritized_blocks_; }
+
+bool operator==(const MessagePriorities& lhs, const MessagePriorities& rhs) {
+  return lhs.prioritized_blocks() == rhs.prioritized_blocks();
+}
+
+bool operator!=(const MessagePriorities& lhs, const MessagePriorities& rhs) {
+  return not(lhs == rhs);
+}
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATION(r, data)                                      \
+  template int MessagePriorities::priority(                         \
+      const TimeStepId& time_step_id, const TimeDelta& time_step,   \
+      const DirectionalIdMap<DIM(data), TimeStepId>&                \
+          neighbor_next_time_step_ids,                              \
+      bool is_prioritized);
+
+GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
+
+#undef INSTANTIATION
+#undef DIM
+}  // namespace evolution::dg
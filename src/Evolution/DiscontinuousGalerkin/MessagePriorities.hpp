@@ -0,0 +1,138 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Domain/Structure/DirectionalIdMap.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/Tags/OptionsGroup.hpp"
+#include "Options/Auto.hpp"
+#include "Options/String.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+class TimeDelta;
+class TimeStepId;
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace evolution::dg {
+/*!
+ * \brief Priorities with which elements send their boundary data, so elements
+ * on the critical path run first.
+ *
+ * \details Without priorities all boundary data is delivered in the order it
+ * is sent, so elements that hold up their neighbors compete equally with
+ * elements that are ahead. With priorities, the boundary data sent by an
+ * element is tagged with how many of its time steps the element is ahead of
+ * its slowest neighbor, i.e. the neighbor with the earliest next time step id
+ * on the mortars. Elements that are behind their neighbors therefore send data
+ * with a smaller priority, and their receivers run first. Elements in the
+ * `PrioritizedBlocks` (or block groups), e.g. the blocks in which horizons are
+ * found, additionally have their priority reduced by one step, since the
+ * horizon finds and thus the control systems wait for them.
+ *
+ * Like Charm++ message priorities, smaller values are more urgent and the
+ * default priority is zero. The priority is used for the Charm++ message to
+ * elements of a `DgElementArray` and for the order in which the
+ * `Parallel::ElementReadyQueues` of a `Parallel::DgElementCollection` run
+ * their elements.
+ */
+class MessagePriorities {
+ public:
+  struct PrioritizedBlocks {
+    using type = std::vector<std::string>;
+    static constexpr Options::String help = {
+        "Names of blocks or block groups whose elements get a higher "
+        "priority, e.g. the blocks in which horizons are found. Can be "
+        "empty."};
+  };
+
+  using options = tmpl::list<PrioritizedBlocks>;
+  static constexpr Options::String help = {
+      "Send boundary data with a priority derived from how far the sending "
+      "element is ahead of its slowest neighbor."};
+
+  /// The magnitude of the priority is limited to this value.
+  static constexpr int max_priority = 1024;
+
+  MessagePriorities() = default;
+  explicit MessagePriorities(std::vector<std::string> prioritized_blocks);
+
+  const std::vector<std::string>& prioritized_blocks() const {
+    return prioritized_blocks_;
+  }
+
+  /// Whether the block `block_name` is one of the `PrioritizedBlocks` or in
+  /// one of the block groups.
+  bool is_prioritized(
+      const std::string& block_name,
+      const std::unordered_map<std::string, std::unordered_set<std::string>>&
+          block_groups) const;
+
+  /*!
+   * \brief The priority of the boundary data an element sends at
+   * `time_step_id`.
+   *
+   * \param time_step_id the time step id of the sending element
+   * \param time_step the current step size of the sending element
+   * \param neighbor_next_time_step_ids the next time step ids at which the
+   * element receives data from each of its neighbors, i.e.
+   * `evolution::dg::Tags::MortarNextTemporalId`
+   * \param is_prioritized whether the element is in one of the
+   * `PrioritizedBlocks`, see `is_prioritized()`
+   */
+  template <size_t Dim>
+  static int priority(
+      const TimeStepId& time_step_id, const TimeDelta& time_step,
+      const DirectionalIdMap<Dim, TimeStepId>& neighbor_next_time_step_ids,
+      bool is_prioritized);
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+
+ private:
+  std::vector<std::string> prioritized_blocks_{};
+};
+
+bool operator==(const MessagePriorities& lhs, const MessagePriorities& rhs);
+bool operator!=(const MessagePriorities& lhs, const MessagePriorities& rhs);
+
+namespace OptionTags {
+/// \brief Whether and how to prioritize boundary data, see
+/// `evolution::dg::MessagePriorities`.
+struct MessagePriorities {
+  using type =
+      Options::Auto<evolution::dg::MessagePriorities, Options::AutoLabel::None>;
+  using group = ::dg::OptionTags::DiscontinuousGalerkinGroup;
+  static constexpr Options::String help =
+      "Prioritize the boundary data of elements on the critical path. Specify "
+      "None to send all boundary data with the default priority.";
+};
+}  // namespace OptionTags
+
+namespace Tags {
+/// \brief Whether and how to prioritize boundary data, see
+/// `evolution::dg::MessagePriorities`.
+///
+/// Add this tag to the `const_global_cache_tags` to enable priorities.
+struct MessagePriorities : db::SimpleTag {
+  using type = std::optional<evolution::dg::MessagePriorities>;
+
+  using option_tags = tmpl::list<OptionTags::MessagePriorities>;
+  static constexpr bool pass_metavariables = false;
+  static type create_from_options(const type& message_priorities) {
+    return message_priorities;
+  }
+};
+}  // namespace Tags
+}  // namespace evolution::dg
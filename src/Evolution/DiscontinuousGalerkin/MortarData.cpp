@@ -14,6 +14,7 @@
 
 #include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/MemoryTracking.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Projection.hpp"
@@ -24,6 +25,8 @@
 namespace evolution::dg {
 template <size_t Dim>
 void MortarData<Dim>::pup(PUP::er& p) {
+  const memory_tracking::ScopedGroup tracked_group{
+      memory_tracking::Group::Mortars};
   p | mortar_data;
   p | face_normal_magnitude;
   p | face_det_jacobian;
@@ -25,6 +25,7 @@
 #include "Domain/Creators/BinaryCompactObject.hpp"
 #include "Domain/Creators/CylindricalBinaryCompactObject.hpp"
 #include "Domain/Tags.hpp"
+#include "Domain/Tags/ElementCostModel.hpp"
 #include "Domain/TagsCharacteristicSpeeds.hpp"
 #include "Evolution/Actions/RunEventsAndDenseTriggers.hpp"
 #include "Evolution/Actions/RunEventsAndTriggers.hpp"
@@ -34,6 +35,7 @@
 #include "Evolution/DiscontinuousGalerkin/DgElementArray.hpp"
 #include "Evolution/DiscontinuousGalerkin/InboxTags.hpp"
 #include "Evolution/DiscontinuousGalerkin/Initialization/Mortars.hpp"
+#include "Evolution/DiscontinuousGalerkin/MessagePriorities.hpp"
 #include "Evolution/Executables/GeneralizedHarmonic/Deadlock.hpp"
 #include "Evolution/Initialization/DgDomain.hpp"
 #include "Evolution/Initialization/Evolution.hpp"
@@ -119,6 +121,7 @@
 #include "ParallelAlgorithms/ApparentHorizonFinder/ObserveCenters.hpp"
 #include "ParallelAlgorithms/Events/Factory.hpp"
 #include "ParallelAlgorithms/Events/MonitorMemory.hpp"
+#include "ParallelAlgorithms/Events/ObserveElementCosts.hpp"
 #include "ParallelAlgorithms/Events/ObserveTimeStepVolume.hpp"
 #include "ParallelAlgorithms/EventsAndDenseTriggers/DenseTrigger.hpp"
 #include "ParallelAlgorithms/EventsAndDenseTriggers/DenseTriggers/Factory.hpp"
@@ -237,7 +240,7 @@ struct EvolutionMetavars {
 
   static constexpr size_t volume_dim = 3;
   static constexpr bool use_damped_harmonic_rollon = false;
-  using system = gh::System<volume_dim>;
+  using system = detail::gh_system<volume_dim>;
   using temporal_id = Tags::TimeStepId;
   using TimeStepperBase = LtsTimeStepper;
 
@@ -466,6 +469,7 @@ struct EvolutionMetavars {
                 intrp::Events::InterpolateWithoutInterpComponent<
                     3, ExcisionBoundaryB, interpolator_source_vars>,
                 Events::MonitorMemory<3>, Events::Completion,
+                Events::ObserveElementCosts<volume_dim>,
                 dg::Events::field_observations<volume_dim, observe_fields,
                                                non_tensor_compute_tags>,
                 control_system::metafunctions::control_system_events<
@@ -512,7 +516,9 @@ struct EvolutionMetavars {
                  gh::ConstraintDamping::Tags::DampingFunctionGamma1<
                      volume_dim, Frame::Grid>,
                  gh::ConstraintDamping::Tags::DampingFunctionGamma2<
-                     volume_dim, Frame::Grid>>;
+                     volume_dim, Frame::Grid>,
+                 evolution::dg::Tags::MessagePriorities,
+                 domain::Tags::ElementCostModel<volume_dim>>;
 
   using dg_registration_list =
       tmpl::list<observers::Actions::RegisterEventsWithObservers,
@@ -14,6 +14,7 @@
 #include "Domain/Creators/Factory2D.hpp"
 #include "Domain/Creators/Factory3D.hpp"
 #include "Domain/Tags.hpp"
+#include "Domain/Tags/ElementCostModel.hpp"
 #include "Domain/TagsCharacteristicSpeeds.hpp"
 #include "Evolution/Actions/RunEventsAndDenseTriggers.hpp"
 #include "Evolution/ComputeTags.hpp"
@@ -28,6 +29,7 @@
 #include "Evolution/Systems/GeneralizedHarmonic/BoundaryConditions/Factory.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/BoundaryCorrections/Factory.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/Equations.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/FusedTimeDerivative.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/Factory.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/Gauges.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/SetPiAndPhiFromConstraints.hpp"
@@ -84,6 +86,11 @@
 #include "ParallelAlgorithms/ApparentHorizonFinder/InterpolationTarget.hpp"
 #include "ParallelAlgorithms/Events/Factory.hpp"
 #include "ParallelAlgorithms/Events/MonitorMemory.hpp"
+#include "ParallelAlgorithms/Events/ObserveActionTraces.hpp"
+#include "ParallelAlgorithms/Events/ObserveElementCosts.hpp"
+#include "ParallelAlgorithms/Events/ObserveElementCollectionStatistics.hpp"
+#include "ParallelAlgorithms/Events/ObserveEventTimings.hpp"
+#include "ParallelAlgorithms/Events/ObserveFunctionOfTimeStalls.hpp"
 #include "ParallelAlgorithms/Events/ObserveTimeStep.hpp"
 #include "ParallelAlgorithms/Events/ObserveTimeStepVolume.hpp"
 #include "ParallelAlgorithms/Events/Tags.hpp"
@@ -158,10 +165,19 @@ class CProxy_GlobalCache;
 /// \endcond
 
 namespace detail {
+// The volume terms are evaluated with `gh::FusedTimeDerivative` in the
+// executables for which CMakeLists.txt defines USE_FUSED_GH_TIME_DERIVATIVE.
+template <size_t volume_dim>
+using gh_system =
+#ifdef USE_FUSED_GH_TIME_DERIVATIVE
+    gh::System<volume_dim, gh::FusedTimeDerivative<volume_dim>>;
+#else
+    gh::System<volume_dim>;
+#endif
 
 template <size_t volume_dim>
 struct ObserverTags {
-  using system = gh::System<volume_dim>;
+  using system = gh_system<volume_dim>;
 
   using variables_tag = typename system::variables_tag;
   using analytic_solution_fields = typename variables_tag::tags_list;
@@ -266,7 +282,7 @@ struct ObserverTags {
 
 template <size_t volume_dim, bool LocalTimeStepping>
 struct FactoryCreation : tt::ConformsTo<Options::protocols::FactoryCreation> {
-  using system = gh::System<volume_dim>;
+  using system = gh_system<volume_dim>;
 
   using factory_classes = tmpl::map<
       tmpl::pair<
@@ -284,6 +300,10 @@ struct FactoryCreation : tt::ConformsTo<Options::protocols::FactoryCreation> {
           Event,
           tmpl::flatten<tmpl::list<
               Events::Completion, Events::MonitorMemory<volume_dim>,
+              Events::ObserveActionTraces,
+              Events::ObserveElementCollectionStatistics,
+              Events::ObserveElementCosts<volume_dim>,
+              Events::ObserveEventTimings, Events::ObserveFunctionOfTimeStalls,
               typename detail::ObserverTags<volume_dim>::field_observations,
               Events::time_events<system>,
               dg::Events::ObserveTimeStepVolume<volume_dim>>>>,
@@ -319,7 +339,7 @@ struct FactoryCreation : tt::ConformsTo<Options::protocols::FactoryCreation> {
 template <size_t VolumeDim, bool LocalTimeStepping>
 struct GeneralizedHarmonicTemplateBase {
   static constexpr size_t volume_dim = VolumeDim;
-  using system = gh::System<volume_dim>;
+  using system = detail::gh_system<volume_dim>;
   using TimeStepperBase =
       tmpl::conditional_t<LocalTimeStepping, LtsTimeStepper, TimeStepper>;
 
@@ -351,7 +371,8 @@ struct GeneralizedHarmonicTemplateBase {
                  gh::ConstraintDamping::Tags::DampingFunctionGamma1<
                      volume_dim, Frame::Grid>,
                  gh::ConstraintDamping::Tags::DampingFunctionGamma2<
-                     volume_dim, Frame::Grid>>;
+                     volume_dim, Frame::Grid>,
+                 domain::Tags::ElementCostModel<volume_dim>>;
 
   using dg_registration_list =
       tmpl::list<observers::Actions::RegisterEventsWithObservers>;
@@ -5,6 +5,7 @@
 
 #include <vector>
 
+#include "Domain/Tags/ElementCostModel.hpp"
 #include "Evolution/DiscontinuousGalerkin/Limiters/Tags.hpp"
 #include "Evolution/Executables/GrMhd/GhValenciaDivClean/GhValenciaDivCleanBase.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/Tags.hpp"
@@ -124,7 +125,8 @@ struct EvolutionMetavars
       gh::ConstraintDamping::Tags::DampingFunctionGamma1<volume_dim,
                                                          Frame::Grid>,
       gh::ConstraintDamping::Tags::DampingFunctionGamma2<volume_dim,
-                                                         Frame::Grid>>>;
+                                                         Frame::Grid>,
+      domain::Tags::ElementCostModel<volume_dim>>>;
 
   using observed_reduction_data_tags = observers::collect_reduction_data_tags<
       tmpl::at<typename factory_creation::factory_classes, Event>>;
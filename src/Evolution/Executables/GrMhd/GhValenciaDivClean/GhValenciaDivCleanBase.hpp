@@ -22,6 +22,7 @@
 #include "Domain/Creators/BinaryCompactObject.hpp"
 #include "Domain/Creators/Factory3D.hpp"
 #include "Domain/Tags.hpp"
+#include "Domain/Tags/ElementCostModel.hpp"
 #include "Evolution/Actions/RunEventsAndDenseTriggers.hpp"
 #include "Evolution/Actions/RunEventsAndTriggers.hpp"
 #include "Evolution/ComputeTags.hpp"
@@ -146,6 +147,7 @@
 #include "ParallelAlgorithms/ApparentHorizonFinder/InterpolationTarget.hpp"
 #include "ParallelAlgorithms/Events/Factory.hpp"
 #include "ParallelAlgorithms/Events/ObserveAtExtremum.hpp"
+#include "ParallelAlgorithms/Events/ObserveElementCosts.hpp"
 #include "ParallelAlgorithms/Events/ObserveTimeStepVolume.hpp"
 #include "ParallelAlgorithms/EventsAndDenseTriggers/DenseTrigger.hpp"
 #include "ParallelAlgorithms/EventsAndDenseTriggers/DenseTriggers/Factory.hpp"
@@ -606,6 +608,7 @@ struct GhValenciaDivCleanTemplateBase<
                            volume_dim, observe_fields, non_tensor_compute_tags>,
                        Events::ObserveAtExtremum<observe_fields,
                                                  non_tensor_compute_tags>,
+                       Events::ObserveElementCosts<volume_dim>,
                        Events::time_events<system>,
                        dg::Events::ObserveTimeStepVolume<volume_dim>,
                        control_system::metafunctions::control_system_events<
@@ -667,7 +670,8 @@ struct GhValenciaDivCleanTemplateBase<
       gh::ConstraintDamping::Tags::DampingFunctionGamma1<volume_dim,
                                                          Frame::Grid>,
       gh::ConstraintDamping::Tags::DampingFunctionGamma2<volume_dim,
-                                                         Frame::Grid>>>;
+                                                         Frame::Grid>,
+      domain::Tags::ElementCostModel<volume_dim>>>;
 
   using dg_registration_list =
       tmpl::list<intrp::Actions::RegisterElementWithInterpolator,
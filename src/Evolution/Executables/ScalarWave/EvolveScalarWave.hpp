@@ -34,6 +34,7 @@
 #include "Evolution/Systems/ScalarWave/System.hpp"
 #include "Evolution/Tags/Filter.hpp"
 #include "IO/Observer/Actions/RegisterEvents.hpp"
+#include "IO/Observer/Actions/RestoreFromIncrementalCheckpoint.hpp"
 #include "IO/Observer/Helpers.hpp"
 #include "IO/Observer/ObserverComponent.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Formulation.hpp"
@@ -66,8 +67,10 @@
 #include "ParallelAlgorithms/Amr/Criteria/Random.hpp"
 #include "ParallelAlgorithms/Amr/Criteria/Tags/Criteria.hpp"
 #include "ParallelAlgorithms/Amr/Criteria/TruncationError.hpp"
+#include "ParallelAlgorithms/Amr/Events/EvaluateAmrCriteria.hpp"
 #include "ParallelAlgorithms/Amr/Events/ObserveAmrCriteria.hpp"
 #include "ParallelAlgorithms/Amr/Events/RefineMesh.hpp"
+#include "ParallelAlgorithms/Amr/Events/SampleCriteria.hpp"
 #include "ParallelAlgorithms/Amr/Projectors/CopyFromCreatorOrLeaveAsIs.hpp"
 #include "ParallelAlgorithms/Amr/Projectors/DefaultInitialize.hpp"
 #include "ParallelAlgorithms/Amr/Projectors/Tensors.hpp"
@@ -75,6 +78,7 @@
 #include "ParallelAlgorithms/Amr/Protocols/AmrMetavariables.hpp"
 #include "ParallelAlgorithms/Events/Factory.hpp"
 #include "ParallelAlgorithms/Events/Tags.hpp"
+#include "ParallelAlgorithms/Events/WriteIncrementalCheckpoint.hpp"
 #include "ParallelAlgorithms/EventsAndDenseTriggers/DenseTrigger.hpp"
 #include "ParallelAlgorithms/EventsAndDenseTriggers/DenseTriggers/Factory.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/Completion.hpp"
@@ -186,7 +190,10 @@ struct EvolutionMetavars {
         tmpl::pair<DomainCreator<volume_dim>, domain_creators<volume_dim>>,
         tmpl::pair<Event,
                    tmpl::flatten<tmpl::list<
-                       Events::Completion, amr::Events::RefineMesh,
+                       Events::Completion, Events::WriteIncrementalCheckpoint,
+                       amr::Events::RefineMesh,
+                       amr::Events::SampleCriteria,
+                       amr::Events::EvaluateAmrCriteria,
                        amr::Events::ObserveAmrCriteria<EvolutionMetavars>,
                        dg::Events::field_observations<
                            volume_dim, observe_fields, non_tensor_compute_tags>,
@@ -287,9 +294,13 @@ struct EvolutionMetavars {
               Parallel::Phase::InitializeTimeStepperHistory,
               SelfStart::self_start_procedure<step_actions, system>>,
 
-          Parallel::PhaseActions<Parallel::Phase::Register,
-                                 tmpl::list<dg_registration_list,
-                                            Parallel::Actions::TerminatePhase>>,
+          // Restoring from an incremental checkpoint must happen after
+          // self-starting, which would overwrite the restored history
+          Parallel::PhaseActions<
+              Parallel::Phase::Register,
+              tmpl::list<observers::Actions::RestoreFromIncrementalCheckpoint,
+                         dg_registration_list,
+                         Parallel::Actions::TerminatePhase>>,
 
           Parallel::PhaseActions<Parallel::Phase::CheckDomain,
                                  tmpl::list<::amr::Actions::SendAmrDiagnostics,
@@ -9,10 +9,12 @@
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/Creators/Tags/Domain.hpp"
 #include "Domain/Tags.hpp"
+#include "Evolution/DiscontinuousGalerkin/BackgroundGrVarsKey.hpp"
 #include "Evolution/Initialization/InitialData.hpp"
 #include "Evolution/Initialization/Tags.hpp"
 #include "Evolution/Systems/CurvedScalarWave/BackgroundSpacetime.hpp"
 #include "Evolution/Systems/CurvedScalarWave/System.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "PointwiseFunctions/AnalyticData/Tags.hpp"
@@ -30,20 +32,24 @@ namespace CurvedScalarWave::Actions {
 /// spacetime background of the CurvedScalarWave system
 ///
 /// If `SkipForStaticBlocks` is `true`, then this action does nothing if the
-/// block of the domain is time independent. This is a performance optimization
-/// to avoid updating the background spacetime in blocks that are time
-/// independent. Note that this assumes that the background spacetime is also
-/// time independent.
+/// background spacetime was already computed on the current mesh and, for
+/// time-dependent blocks, at the current time. This is a performance
+/// optimization to avoid updating the background spacetime in blocks that are
+/// time independent or more than once per substep. Note that this assumes
+/// that the background spacetime is also time independent.
 ///
 /// DataBox changes:
 /// - Adds:
 ///   * `CurvedScalarWave::System::spacetime_tag_list`
+///   * `evolution::dg::Tags::BackgroundGrVarsKey<Dim>`
 /// - Removes: nothing
 /// - Modifies: nothing
 template <typename System, bool SkipForStaticDomains>
 struct CalculateGrVars {
   static constexpr size_t Dim = System::volume_dim;
-  using simple_tags = db::AddSimpleTags<typename System::spacetime_tag_list>;
+  using simple_tags =
+      tmpl::push_back<typename System::spacetime_tag_list,
+                      evolution::dg::Tags::BackgroundGrVarsKey<Dim>>;
   using compute_tags = db::AddComputeTags<>;
 
   template <typename DbTagsList, typename... InboxTags, typename Metavariables,
@@ -57,7 +63,10 @@ struct CalculateGrVars {
     if constexpr (SkipForStaticDomains) {
       const auto& domain = db::get<domain::Tags::Domain<Dim>>(box);
       const auto& block = domain.blocks()[element_id.block_id()];
-      if (not block.is_time_dependent()) {
+      if (db::get<evolution::dg::Tags::BackgroundGrVarsKey<Dim>>(box)
+              .is_valid_for(db::get<domain::Tags::Mesh<Dim>>(box),
+                            db::get<::Tags::Time>(box),
+                            block.is_time_dependent())) {
         return {Parallel::AlgorithmExecution::Continue, std::nullopt};
       }
     }
@@ -76,6 +85,12 @@ struct CalculateGrVars {
               },
               make_not_null(&box));
         });
+    db::mutate<evolution::dg::Tags::BackgroundGrVarsKey<Dim>>(
+        [](const auto key, const Mesh<Dim>& mesh, const double time) {
+          key->set(mesh, time);
+        },
+        make_not_null(&box), db::get<domain::Tags::Mesh<Dim>>(box),
+        db::get<::Tags::Time>(box));
 
     return {Parallel::AlgorithmExecution::Continue, std::nullopt};
   }
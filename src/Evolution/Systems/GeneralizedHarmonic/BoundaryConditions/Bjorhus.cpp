@@ -144,6 +144,13 @@ std::optional<std::string> ConstraintPreservingBjorhus<Dim>::dg_time_derivative(
                         ::Tags::Tempiaa<3, Dim, Frame::Inertial, DataVector>,
                         ::Tags::Tempaa<5, Dim, Frame::Inertial, DataVector>,
                         ::Tags::Tempaa<6, Dim, Frame::Inertial, DataVector>,
+                        // characteristic speeds
+                        ::Tags::TempScalar<0, DataVector>,
+                        ::Tags::TempScalar<1, DataVector>,
+                        ::Tags::TempScalar<2, DataVector>,
+                        ::Tags::TempScalar<3, DataVector>,
+                        // radial mesh velocity
+                        ::Tags::TempScalar<4, DataVector>,
                         gr::Tags::SpacetimeNormalOneForm<DataVector, Dim>,
                         // inertial time derivatives
                         ::Tags::dt<gr::Tags::SpacetimeMetric<DataVector, Dim>>,
@@ -248,7 +255,19 @@ std::optional<std::string> ConstraintPreservingBjorhus<Dim>::dg_time_derivative(
   auto& constraint_char_zero_minus =
       get<::Tags::Tempa<3, Dim, Frame::Inertial, DataVector>>(local_buffer);
 
+  // The characteristic speeds point into the buffer so computing them doesn't
+  // allocate
   typename Tags::CharacteristicSpeeds<DataVector, Dim>::type char_speeds;
+  char_speeds[0].set_data_ref(make_not_null(
+      &get(get<::Tags::TempScalar<0, DataVector>>(local_buffer))));
+  char_speeds[1].set_data_ref(make_not_null(
+      &get(get<::Tags::TempScalar<1, DataVector>>(local_buffer))));
+  char_speeds[2].set_data_ref(make_not_null(
+      &get(get<::Tags::TempScalar<2, DataVector>>(local_buffer))));
+  char_speeds[3].set_data_ref(make_not_null(
+      &get(get<::Tags::TempScalar<3, DataVector>>(local_buffer))));
+  auto& radial_mesh_velocity =
+      get<::Tags::TempScalar<4, DataVector>>(local_buffer);
 
   auto& bc_dt_v_psi =
       get<::Tags::Tempaa<4, Dim, Frame::Inertial, DataVector>>(local_buffer);
@@ -283,10 +302,10 @@ std::optional<std::string> ConstraintPreservingBjorhus<Dim>::dg_time_derivative(
 
   // Account for moving mesh: char speeds -> cher speeds - n_i v^i_g
   if (face_mesh_velocity.has_value()) {
-    const auto radial_mesh_velocity =
-        get(dot_product(normal_covector, *face_mesh_velocity));
+    dot_product(make_not_null(&radial_mesh_velocity), normal_covector,
+                *face_mesh_velocity);
     for (size_t a = 0; a < 4; ++a) {
-      char_speeds.at(a) -= radial_mesh_velocity;
+      char_speeds.at(a) -= get(radial_mesh_velocity);
     }
   }
 
@@ -356,22 +375,16 @@ std::optional<std::string> ConstraintPreservingBjorhus<Dim>::dg_time_derivative(
   // method), and are written down in Eq. (63) - (65) of Lindblom et al (2005).
   // Now that we have calculated those corrections, we project them back as
   // corrections to dt<evolved variables>
-  auto dt_evolved_vars = evolved_fields_from_characteristic_fields(
+  evolved_fields_from_characteristic_fields(
+      dt_spacetime_metric_correction, dt_pi_correction, dt_phi_correction,
       gamma2, bc_dt_v_psi, bc_dt_v_zero, bc_dt_v_plus, bc_dt_v_minus,
       normal_covector);
 
-  *dt_pi_correction = get<Tags::Pi<DataVector, Dim>>(dt_evolved_vars);
-  *dt_phi_correction = get<Tags::Phi<DataVector, Dim>>(dt_evolved_vars);
-  *dt_spacetime_metric_correction =
-      get<gr::Tags::SpacetimeMetric<DataVector, Dim>>(dt_evolved_vars);
-
   if (face_mesh_velocity.has_value()) {
-    const auto radial_mesh_velocity =
-        get(dot_product(normal_covector, *face_mesh_velocity));
     // we use 1e-10 instead of 0 below to allow for purely tangentially
     // moving grids, eg a rotating sphere, with some leeway for
     // floating-point errors.
-    if (max(radial_mesh_velocity) > 1.e-10) {
+    if (max(get(radial_mesh_velocity)) > 1.e-10) {
       return {
           "We found the radial mesh velocity points in the direction "
           "of the outward normal, i.e. we possibly have an expanding "
@@ -507,17 +520,12 @@ void ConstraintPreservingBjorhus<Dim>::compute_intermediate_vars(
                                      spacetime_unit_normal_vector,
                                      *unit_interface_normal_vector);
 
-  const auto dt_char_fields = characteristic_fields(
-      gamma2, *inverse_spatial_metric, dt_spacetime_metric, dt_pi, dt_phi,
-      normal_covector);
-  *char_projected_rhs_dt_v_psi =
-      get<Tags::VSpacetimeMetric<DataVector, Dim>>(dt_char_fields);
-  *char_projected_rhs_dt_v_zero =
-      get<Tags::VZero<DataVector, Dim>>(dt_char_fields);
-  *char_projected_rhs_dt_v_plus =
-      get<Tags::VPlus<DataVector, Dim>>(dt_char_fields);
-  *char_projected_rhs_dt_v_minus =
-      get<Tags::VMinus<DataVector, Dim>>(dt_char_fields);
+  characteristic_fields(char_projected_rhs_dt_v_psi,
+                        char_projected_rhs_dt_v_zero,
+                        char_projected_rhs_dt_v_plus,
+                        char_projected_rhs_dt_v_minus, gamma2,
+                        *inverse_spatial_metric, dt_spacetime_metric, dt_pi,
+                        dt_phi, normal_covector);
 
   // c^{\hat{0}-}_a = F_a + n^k C_{ka}
   gh::two_index_constraint(
@@ -4,6 +4,7 @@
 #include "Evolution/Systems/GeneralizedHarmonic/BoundaryConditions/DemandOutgoingCharSpeeds.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cstddef>
 #include <limits>
 #include <memory>
@@ -49,26 +50,52 @@ DemandOutgoingCharSpeeds<Dim>::dg_demand_outgoing_char_speeds(
 
     const Scalar<DataVector>& gamma_1, const Scalar<DataVector>& lapse,
     const tnsr::I<DataVector, Dim, Frame::Inertial>& shift) {
-  const auto char_speeds = characteristic_speeds(
-      gamma_1, lapse, shift, outward_directed_normal_covector,
-      face_mesh_velocity);
-  Scalar<DataVector> normal_dot_mesh_velocity;
-  if (face_mesh_velocity.has_value()) {
-    normal_dot_mesh_velocity = dot_product(outward_directed_normal_covector,
-                                           face_mesh_velocity.value());
-  }
-  double min_speed = std::numeric_limits<double>::signaling_NaN();
-  for (size_t i = 0; i < char_speeds.size(); ++i) {
+  // The minimum of each characteristic speed is computed in a single pass
+  // over the grid points so that nothing is allocated when the condition is
+  // satisfied, which is on every call for a valid domain.
+  std::array<double, 4> min_speeds{};
+  min_speeds.fill(std::numeric_limits<double>::max());
+  const size_t number_of_grid_points = get(lapse).size();
+  for (size_t s = 0; s < number_of_grid_points; ++s) {
+    double shift_dot_normal =
+        get<0>(shift)[s] * get<0>(outward_directed_normal_covector)[s];
+    for (size_t i = 1; i < Dim; ++i) {
+      shift_dot_normal +=
+          shift.get(i)[s] * outward_directed_normal_covector.get(i)[s];
+    }
+    double normal_dot_mesh_velocity = 0.0;
     if (face_mesh_velocity.has_value()) {
-      min_speed = min(gsl::at(char_speeds, i) - get(normal_dot_mesh_velocity));
-    } else {
-      min_speed = min(gsl::at(char_speeds, i));
+      for (size_t i = 0; i < Dim; ++i) {
+        normal_dot_mesh_velocity += face_mesh_velocity->get(i)[s] *
+                                    outward_directed_normal_covector.get(i)[s];
+      }
     }
-    if (min_speed < 0.0) {
+    // Same as gh::characteristic_speeds, minus the normal mesh velocity
+    const std::array<double, 4> speeds{
+        {-(1.0 + get(gamma_1)[s]) * shift_dot_normal -
+             get(gamma_1)[s] * normal_dot_mesh_velocity -
+             normal_dot_mesh_velocity,
+         -shift_dot_normal - normal_dot_mesh_velocity,
+         -shift_dot_normal + get(lapse)[s] - normal_dot_mesh_velocity,
+         -shift_dot_normal - get(lapse)[s] - normal_dot_mesh_velocity}};
+    for (size_t i = 0; i < 4; ++i) {
+      gsl::at(min_speeds, i) =
+          std::min(gsl::at(min_speeds, i), gsl::at(speeds, i));
+    }
+  }
+  for (size_t i = 0; i < min_speeds.size(); ++i) {
+    if (gsl::at(min_speeds, i) < 0.0) {
+      auto char_speeds = characteristic_speeds(
+          gamma_1, lapse, shift, outward_directed_normal_covector,
+          face_mesh_velocity);
+      if (face_mesh_velocity.has_value()) {
+        gsl::at(char_speeds, i) -= get(dot_product(
+            outward_directed_normal_covector, face_mesh_velocity.value()));
+      }
       return {MakeString{}
               << "DemandOutgoingCharSpeeds boundary condition violated with "
                  "speed index "
-              << i << " ingoing: " << min_speed
+              << i << " ingoing: " << gsl::at(min_speeds, i)
               << "\n speed: " << gsl::at(char_speeds, i)
               << "\nn_i: " << outward_directed_normal_covector
               << "\n"
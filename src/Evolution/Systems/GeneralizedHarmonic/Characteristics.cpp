@@ -5,12 +5,11 @@
 
 #include <algorithm>
 #include <array>
+#include <cstddef>
 #include <optional>
 
 #include "DataStructures/DataVector.hpp"
-#include "DataStructures/Tensor/EagerMath/DotProduct.hpp"
 #include "DataStructures/Tensor/EagerMath/Magnitude.hpp"
-#include "DataStructures/Tensor/EagerMath/RaiseOrLowerIndex.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
 #include "Domain/TagsTimeDependent.hpp"
@@ -20,6 +19,16 @@
 
 namespace gh {
 
+namespace {
+template <typename TensorType>
+void destructive_resize_components(const gsl::not_null<TensorType*> tensor,
+                                   const size_t size) {
+  for (auto& component : *tensor) {
+    component.destructive_resize(size);
+  }
+}
+}  // namespace
+
 template <size_t Dim, typename Frame>
 void characteristic_speeds(
     const gsl::not_null<std::array<DataVector, 4>*> char_speeds,
@@ -27,16 +36,33 @@ void characteristic_speeds(
     const tnsr::I<DataVector, Dim, Frame>& shift,
     const tnsr::i<DataVector, Dim, Frame>& unit_normal_one_form,
     const std::optional<tnsr::I<DataVector, Dim, Frame>>& mesh_velocity) {
-  const auto shift_dot_normal = get(dot_product(shift, unit_normal_one_form));
-  (*char_speeds)[0] =
-      -(1. + get(gamma_1)) * shift_dot_normal;  // lambda(VSpacetimeMetric)
-  if (mesh_velocity.has_value()) {
-    (*char_speeds)[0] -=
-        get(gamma_1) * get(dot_product((*mesh_velocity), unit_normal_one_form));
+  const size_t number_of_grid_points = get(lapse).size();
+  for (auto& char_speed : *char_speeds) {
+    char_speed.destructive_resize(number_of_grid_points);
+  }
+  // Computed in a single pass over the grid points so that no temporaries
+  // are allocated
+  for (size_t s = 0; s < number_of_grid_points; ++s) {
+    double shift_dot_normal =
+        get<0>(shift)[s] * get<0>(unit_normal_one_form)[s];
+    for (size_t i = 1; i < Dim; ++i) {
+      shift_dot_normal += shift.get(i)[s] * unit_normal_one_form.get(i)[s];
+    }
+    // lambda(VSpacetimeMetric)
+    (*char_speeds)[0][s] = -(1. + get(gamma_1)[s]) * shift_dot_normal;
+    if (mesh_velocity.has_value()) {
+      double mesh_velocity_dot_normal =
+          get<0>(*mesh_velocity)[s] * get<0>(unit_normal_one_form)[s];
+      for (size_t i = 1; i < Dim; ++i) {
+        mesh_velocity_dot_normal +=
+            mesh_velocity->get(i)[s] * unit_normal_one_form.get(i)[s];
+      }
+      (*char_speeds)[0][s] -= get(gamma_1)[s] * mesh_velocity_dot_normal;
+    }
+    (*char_speeds)[1][s] = -shift_dot_normal;                   // lambda(VZero)
+    (*char_speeds)[2][s] = -shift_dot_normal + get(lapse)[s];  // lambda(VPlus)
+    (*char_speeds)[3][s] = -shift_dot_normal - get(lapse)[s];  // lambda(VMinus)
   }
-  (*char_speeds)[1] = -shift_dot_normal;        // lambda(VZero)
-  (*char_speeds)[2] = -shift_dot_normal + get(lapse);  // lambda(VPlus)
-  (*char_speeds)[3] = -shift_dot_normal - get(lapse);  // lambda(VMinus)
 }
 
 template <size_t Dim, typename Frame>
@@ -55,60 +81,84 @@ std::array<DataVector, 4> characteristic_speeds(
 
 template <size_t Dim, typename Frame>
 void characteristic_fields(
-    const gsl::not_null<
-        typename Tags::CharacteristicFields<DataVector, Dim, Frame>::type*>
-        char_fields,
+    const gsl::not_null<tnsr::aa<DataVector, Dim, Frame>*> v_spacetime_metric,
+    const gsl::not_null<tnsr::iaa<DataVector, Dim, Frame>*> v_zero,
+    const gsl::not_null<tnsr::aa<DataVector, Dim, Frame>*> v_plus,
+    const gsl::not_null<tnsr::aa<DataVector, Dim, Frame>*> v_minus,
     const Scalar<DataVector>& gamma_2,
     const tnsr::II<DataVector, Dim, Frame>& inverse_spatial_metric,
     const tnsr::aa<DataVector, Dim, Frame>& spacetime_metric,
     const tnsr::aa<DataVector, Dim, Frame>& pi,
     const tnsr::iaa<DataVector, Dim, Frame>& phi,
     const tnsr::i<DataVector, Dim, Frame>& unit_normal_one_form) {
-  const auto number_of_grid_points = get(gamma_2).size();
-  if (UNLIKELY(number_of_grid_points != char_fields->number_of_grid_points())) {
-    char_fields->initialize(number_of_grid_points);
-  }
-  auto phi_dot_normal =
-      make_with_value<tnsr::aa<DataVector, Dim, Frame>>(pi, 0.);
-  auto unit_normal_vector =
-      raise_or_lower_index(unit_normal_one_form, inverse_spatial_metric);
+  const size_t number_of_grid_points = get(gamma_2).size();
+  destructive_resize_components(v_spacetime_metric, number_of_grid_points);
+  destructive_resize_components(v_zero, number_of_grid_points);
+  destructive_resize_components(v_plus, number_of_grid_points);
+  destructive_resize_components(v_minus, number_of_grid_points);
 
-  // Compute phi_dot_normal_{ab} = n^i \Phi_{iab}
-  for (size_t a = 0; a < Dim + 1; ++a) {
-    for (size_t b = 0; b < a + 1; ++b) {
-      for (size_t i = 0; i < Dim; ++i) {
-        phi_dot_normal.get(a, b) +=
-            unit_normal_vector.get(i) * phi.get(i, a, b);
+  // Computed in a single pass over the grid points so that the unit normal
+  // vector and n^i \Phi_{iab} don't need to be stored
+  for (size_t s = 0; s < number_of_grid_points; ++s) {
+    std::array<double, Dim> unit_normal_vector{};
+    for (size_t i = 0; i < Dim; ++i) {
+      gsl::at(unit_normal_vector, i) =
+          inverse_spatial_metric.get(i, 0)[s] * get<0>(unit_normal_one_form)[s];
+      for (size_t j = 1; j < Dim; ++j) {
+        gsl::at(unit_normal_vector, i) +=
+            inverse_spatial_metric.get(i, j)[s] *
+            unit_normal_one_form.get(j)[s];
       }
     }
-  }
-
-  // Eq.(34) of Lindblom+ (2005)
-  for (size_t i = 0; i < Dim; ++i) {
     for (size_t a = 0; a < Dim + 1; ++a) {
       for (size_t b = 0; b < a + 1; ++b) {
-        get<Tags::VZero<DataVector, Dim, Frame>>(*char_fields).get(i, a, b) =
-            phi.get(i, a, b) -
-            unit_normal_one_form.get(i) * phi_dot_normal.get(a, b);
+        // n^i \Phi_{iab}
+        double phi_dot_normal = 0.0;
+        for (size_t i = 0; i < Dim; ++i) {
+          phi_dot_normal +=
+              gsl::at(unit_normal_vector, i) * phi.get(i, a, b)[s];
+        }
+        // Eq.(34) of Lindblom+ (2005)
+        for (size_t i = 0; i < Dim; ++i) {
+          v_zero->get(i, a, b)[s] =
+              phi.get(i, a, b)[s] -
+              unit_normal_one_form.get(i)[s] * phi_dot_normal;
+        }
+        // Eq.(32) of Lindblom+ (2005)
+        v_spacetime_metric->get(a, b)[s] = spacetime_metric.get(a, b)[s];
+        // Eq.(33) of Lindblom+ (2005)
+        v_plus->get(a, b)[s] = pi.get(a, b)[s] + phi_dot_normal -
+                               get(gamma_2)[s] * spacetime_metric.get(a, b)[s];
+        v_minus->get(a, b)[s] = pi.get(a, b)[s] - phi_dot_normal -
+                                get(gamma_2)[s] * spacetime_metric.get(a, b)[s];
       }
     }
   }
+}
 
-  // Eq.(32) of Lindblom+ (2005)
-  get<Tags::VSpacetimeMetric<DataVector, Dim, Frame>>(*char_fields) =
-      spacetime_metric;
-
-  for (size_t a = 0; a < Dim + 1; ++a) {
-    for (size_t b = 0; b < a + 1; ++b) {
-      // Eq.(33) of Lindblom+ (2005)
-      get<Tags::VPlus<DataVector, Dim, Frame>>(*char_fields).get(a, b) =
-          pi.get(a, b) + phi_dot_normal.get(a, b) -
-          get(gamma_2) * spacetime_metric.get(a, b);
-      get<Tags::VMinus<DataVector, Dim, Frame>>(*char_fields).get(a, b) =
-          pi.get(a, b) - phi_dot_normal.get(a, b) -
-          get(gamma_2) * spacetime_metric.get(a, b);
-    }
+template <size_t Dim, typename Frame>
+void characteristic_fields(
+    const gsl::not_null<
+        typename Tags::CharacteristicFields<DataVector, Dim, Frame>::type*>
+        char_fields,
+    const Scalar<DataVector>& gamma_2,
+    const tnsr::II<DataVector, Dim, Frame>& inverse_spatial_metric,
+    const tnsr::aa<DataVector, Dim, Frame>& spacetime_metric,
+    const tnsr::aa<DataVector, Dim, Frame>& pi,
+    const tnsr::iaa<DataVector, Dim, Frame>& phi,
+    const tnsr::i<DataVector, Dim, Frame>& unit_normal_one_form) {
+  const auto number_of_grid_points = get(gamma_2).size();
+  if (UNLIKELY(number_of_grid_points != char_fields->number_of_grid_points())) {
+    char_fields->initialize(number_of_grid_points);
   }
+  characteristic_fields(
+      make_not_null(
+          &get<Tags::VSpacetimeMetric<DataVector, Dim, Frame>>(*char_fields)),
+      make_not_null(&get<Tags::VZero<DataVector, Dim, Frame>>(*char_fields)),
+      make_not_null(&get<Tags::VPlus<DataVector, Dim, Frame>>(*char_fields)),
+      make_not_null(&get<Tags::VMinus<DataVector, Dim, Frame>>(*char_fields)),
+      gamma_2, inverse_spatial_metric, spacetime_metric, pi, phi,
+      unit_normal_one_form);
 }
 
 template <size_t Dim, typename Frame>
@@ -129,6 +179,41 @@ characteristic_fields(
   return char_fields;
 }
 
+template <size_t Dim, typename Frame>
+void evolved_fields_from_characteristic_fields(
+    const gsl::not_null<tnsr::aa<DataVector, Dim, Frame>*> spacetime_metric,
+    const gsl::not_null<tnsr::aa<DataVector, Dim, Frame>*> pi,
+    const gsl::not_null<tnsr::iaa<DataVector, Dim, Frame>*> phi,
+    const Scalar<DataVector>& gamma_2,
+    const tnsr::aa<DataVector, Dim, Frame>& u_psi,
+    const tnsr::iaa<DataVector, Dim, Frame>& u_zero,
+    const tnsr::aa<DataVector, Dim, Frame>& u_plus,
+    const tnsr::aa<DataVector, Dim, Frame>& u_minus,
+    const tnsr::i<DataVector, Dim, Frame>& unit_normal_one_form) {
+  const size_t number_of_grid_points = get(gamma_2).size();
+  destructive_resize_components(spacetime_metric, number_of_grid_points);
+  destructive_resize_components(pi, number_of_grid_points);
+  destructive_resize_components(phi, number_of_grid_points);
+
+  for (size_t s = 0; s < number_of_grid_points; ++s) {
+    for (size_t a = 0; a < Dim + 1; ++a) {
+      for (size_t b = 0; b < a + 1; ++b) {
+        // Invert Eq.(32) - (34) of Lindblom+ (2005) for Psi, Pi and Phi
+        spacetime_metric->get(a, b)[s] = u_psi.get(a, b)[s];
+        pi->get(a, b)[s] = 0.5 * (u_plus.get(a, b)[s] + u_minus.get(a, b)[s]) +
+                           get(gamma_2)[s] * u_psi.get(a, b)[s];
+        const double half_u_plus_minus_u_minus =
+            0.5 * (u_plus.get(a, b)[s] - u_minus.get(a, b)[s]);
+        for (size_t i = 0; i < Dim; ++i) {
+          phi->get(i, a, b)[s] =
+              half_u_plus_minus_u_minus * unit_normal_one_form.get(i)[s] +
+              u_zero.get(i, a, b)[s];
+        }
+      }
+    }
+  }
+}
+
 template <size_t Dim, typename Frame>
 void evolved_fields_from_characteristic_fields(
     const gsl::not_null<typename Tags::EvolvedFieldsFromCharacteristicFields<
@@ -145,24 +230,13 @@ void evolved_fields_from_characteristic_fields(
                evolved_fields->number_of_grid_points())) {
     evolved_fields->initialize(number_of_grid_points);
   }
-  // Invert Eq.(32) of Lindblom+ (2005) for Psi
-  get<::gr::Tags::SpacetimeMetric<DataVector, Dim, Frame>>(*evolved_fields) =
-      u_psi;
-
-  for (size_t a = 0; a < Dim + 1; ++a) {
-    for (size_t b = 0; b < a + 1; ++b) {
-      // Invert Eq.(32) - (34) of Lindblom+ (2005) for Pi and Phi
-      get<Tags::Pi<DataVector, Dim, Frame>>(*evolved_fields).get(a, b) =
-          0.5 * (u_plus.get(a, b) + u_minus.get(a, b)) +
-          get(gamma_2) * u_psi.get(a, b);
-      for (size_t i = 0; i < Dim; ++i) {
-        get<Tags::Phi<DataVector, Dim, Frame>>(*evolved_fields).get(i, a, b) =
-            0.5 * (u_plus.get(a, b) - u_minus.get(a, b)) *
-                unit_normal_one_form.get(i) +
-            u_zero.get(i, a, b);
-      }
-    }
-  }
+  evolved_fields_from_characteristic_fields(
+      make_not_null(
+          &get<::gr::Tags::SpacetimeMetric<DataVector, Dim, Frame>>(
+              *evolved_fields)),
+      make_not_null(&get<Tags::Pi<DataVector, Dim, Frame>>(*evolved_fields)),
+      make_not_null(&get<Tags::Phi<DataVector, Dim, Frame>>(*evolved_fields)),
+      gamma_2, u_psi, u_zero, u_plus, u_minus, unit_normal_one_form);
 }
 
 template <size_t Dim, typename Frame>
@@ -216,6 +290,23 @@ void Tags::ComputeLargestCharacteristicSpeed<Dim, Frame>::function(
   template struct gh::CharacteristicSpeedsCompute<DIM(data), FRAME(data)>;     \
   template struct gh::CharacteristicSpeedsOnStrahlkorperCompute<DIM(data),     \
                                                                 FRAME(data)>;  \
+  template void gh::characteristic_fields(                                     \
+      const gsl::not_null<tnsr::aa<DataVector, DIM(data), FRAME(data)>*>       \
+          v_spacetime_metric,                                                  \
+      const gsl::not_null<tnsr::iaa<DataVector, DIM(data), FRAME(data)>*>      \
+          v_zero,                                                              \
+      const gsl::not_null<tnsr::aa<DataVector, DIM(data), FRAME(data)>*>       \
+          v_plus,                                                              \
+      const gsl::not_null<tnsr::aa<DataVector, DIM(data), FRAME(data)>*>       \
+          v_minus,                                                             \
+      const Scalar<DataVector>& gamma_2,                                       \
+      const tnsr::II<DataVector, DIM(data), FRAME(data)>&                      \
+          inverse_spatial_metric,                                              \
+      const tnsr::aa<DataVector, DIM(data), FRAME(data)>& spacetime_metric,    \
+      const tnsr::aa<DataVector, DIM(data), FRAME(data)>& pi,                  \
+      const tnsr::iaa<DataVector, DIM(data), FRAME(data)>& phi,                \
+      const tnsr::i<DataVector, DIM(data), FRAME(data)>&                       \
+          unit_normal_one_form);                                               \
   template void gh::characteristic_fields(                                     \
       const gsl::not_null<typename gh::Tags::CharacteristicFields<             \
           DataVector, DIM(data), FRAME(data)>::type*>                          \
@@ -240,6 +331,18 @@ void Tags::ComputeLargestCharacteristicSpeed<Dim, Frame>::function(
       const tnsr::i<DataVector, DIM(data), FRAME(data)>&                       \
           unit_normal_one_form);                                               \
   template struct gh::CharacteristicFieldsCompute<DIM(data), FRAME(data)>;     \
+  template void gh::evolved_fields_from_characteristic_fields(                 \
+      const gsl::not_null<tnsr::aa<DataVector, DIM(data), FRAME(data)>*>       \
+          spacetime_metric,                                                    \
+      const gsl::not_null<tnsr::aa<DataVector, DIM(data), FRAME(data)>*> pi,   \
+      const gsl::not_null<tnsr::iaa<DataVector, DIM(data), FRAME(data)>*> phi, \
+      const Scalar<DataVector>& gamma_2,                                       \
+      const tnsr::aa<DataVector, DIM(data), FRAME(data)>& u_psi,               \
+      const tnsr::iaa<DataVector, DIM(data), FRAME(data)>& u_zero,             \
+      const tnsr::aa<DataVector, DIM(data), FRAME(data)>& u_plus,              \
+      const tnsr::aa<DataVector, DIM(data), FRAME(data)>& u_minus,             \
+      const tnsr::i<DataVector, DIM(data), FRAME(data)>&                       \
+          unit_normal_one_form);                                               \
   template void gh::evolved_fields_from_characteristic_fields(                 \
       const gsl::not_null<                                                     \
           typename gh::Tags::EvolvedFieldsFromCharacteristicFields<            \
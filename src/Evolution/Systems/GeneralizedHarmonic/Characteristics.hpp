@@ -204,6 +204,25 @@ void characteristic_fields(
     const tnsr::iaa<DataVector, Dim, Frame>& phi,
     const tnsr::i<DataVector, Dim, Frame>& unit_normal_one_form);
 
+/*!
+ * Computes the characteristic fields into separate tensors, e.g. the
+ * components of a buffer that is reused between calls. This makes a single
+ * pass over the grid points and does not allocate memory unless the outputs
+ * have to be resized.
+ */
+template <size_t Dim, typename Frame>
+void characteristic_fields(
+    gsl::not_null<tnsr::aa<DataVector, Dim, Frame>*> v_spacetime_metric,
+    gsl::not_null<tnsr::iaa<DataVector, Dim, Frame>*> v_zero,
+    gsl::not_null<tnsr::aa<DataVector, Dim, Frame>*> v_plus,
+    gsl::not_null<tnsr::aa<DataVector, Dim, Frame>*> v_minus,
+    const Scalar<DataVector>& gamma_2,
+    const tnsr::II<DataVector, Dim, Frame>& inverse_spatial_metric,
+    const tnsr::aa<DataVector, Dim, Frame>& spacetime_metric,
+    const tnsr::aa<DataVector, Dim, Frame>& pi,
+    const tnsr::iaa<DataVector, Dim, Frame>& phi,
+    const tnsr::i<DataVector, Dim, Frame>& unit_normal_one_form);
+
 template <size_t Dim, typename Frame>
 struct CharacteristicFieldsCompute
     : Tags::CharacteristicFields<DataVector, Dim, Frame>,
@@ -255,6 +274,23 @@ void evolved_fields_from_characteristic_fields(
     const tnsr::aa<DataVector, Dim, Frame>& u_minus,
     const tnsr::i<DataVector, Dim, Frame>& unit_normal_one_form);
 
+/*!
+ * Computes the evolved fields into separate tensors in a single pass over the
+ * grid points, without allocating memory unless the outputs have to be
+ * resized.
+ */
+template <size_t Dim, typename Frame>
+void evolved_fields_from_characteristic_fields(
+    gsl::not_null<tnsr::aa<DataVector, Dim, Frame>*> spacetime_metric,
+    gsl::not_null<tnsr::aa<DataVector, Dim, Frame>*> pi,
+    gsl::not_null<tnsr::iaa<DataVector, Dim, Frame>*> phi,
+    const Scalar<DataVector>& gamma_2,
+    const tnsr::aa<DataVector, Dim, Frame>& u_psi,
+    const tnsr::iaa<DataVector, Dim, Frame>& u_zero,
+    const tnsr::aa<DataVector, Dim, Frame>& u_plus,
+    const tnsr::aa<DataVector, Dim, Frame>& u_minus,
+    const tnsr::i<DataVector, Dim, Frame>& unit_normal_one_form);
+
 template <size_t Dim, typename Frame>
 struct EvolvedFieldsFromCharacteristicFieldsCompute
     : Tags::EvolvedFieldsFromCharacteristicFields<DataVector, Dim, Frame>,
@@ -0,0 +1,490 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Evolution/Systems/GeneralizedHarmonic/FusedTimeDerivative.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <optional>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/ConstraintDamping/Tags.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/DuDtTempTags.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/Dispatch.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/Gauges.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/Tags.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace gh {
+namespace {
+// Copy grid point `s` of `tensor` into `point`
+template <typename Symm, typename IndexList>
+void load(const gsl::not_null<Tensor<double, Symm, IndexList>*> point,
+          const Tensor<DataVector, Symm, IndexList>& tensor, const size_t s) {
+  for (size_t i = 0; i < tensor.size(); ++i) {
+    (*point)[i] = tensor[i][s];
+  }
+}
+
+// Copy `point` into grid point `s` of `tensor`
+template <typename Symm, typename IndexList>
+void store(const gsl::not_null<Tensor<DataVector, Symm, IndexList>*> tensor,
+           const Tensor<double, Symm, IndexList>& point, const size_t s) {
+  for (size_t i = 0; i < point.size(); ++i) {
+    (*tensor)[i][s] = point[i];
+  }
+}
+}  // namespace
+
+template <size_t Dim>
+void FusedTimeDerivative<Dim>::apply(
+    const gsl::not_null<tnsr::aa<DataVector, Dim>*> dt_spacetime_metric,
+    const gsl::not_null<tnsr::aa<DataVector, Dim>*> dt_pi,
+    const gsl::not_null<tnsr::iaa<DataVector, Dim>*> dt_phi,
+    const gsl::not_null<Scalar<DataVector>*> temp_gamma1,
+    const gsl::not_null<Scalar<DataVector>*> temp_gamma2,
+    const gsl::not_null<tnsr::a<DataVector, Dim>*> gauge_function,
+    const gsl::not_null<tnsr::ab<DataVector, Dim>*>
+        spacetime_deriv_gauge_function,
+    const gsl::not_null<Scalar<DataVector>*> half_pi_two_normals,
+    const gsl::not_null<tnsr::i<DataVector, Dim>*> half_phi_two_normals,
+    const gsl::not_null<tnsr::iaa<DataVector, Dim>*> three_index_constraint,
+    const gsl::not_null<Scalar<DataVector>*> lapse,
+    const gsl::not_null<tnsr::I<DataVector, Dim>*> shift,
+    const gsl::not_null<tnsr::II<DataVector, Dim>*> inverse_spatial_metric,
+    const gsl::not_null<Scalar<DataVector>*> sqrt_det_spatial_metric,
+    const gsl::not_null<tnsr::AA<DataVector, Dim>*> inverse_spacetime_metric,
+    const gsl::not_null<tnsr::A<DataVector, Dim>*> normal_spacetime_vector,
+    const tnsr::iaa<DataVector, Dim>& d_spacetime_metric,
+    const tnsr::iaa<DataVector, Dim>& d_pi,
+    const tnsr::ijaa<DataVector, Dim>& d_phi,
+    const tnsr::aa<DataVector, Dim>& spacetime_metric,
+    const tnsr::aa<DataVector, Dim>& pi, const tnsr::iaa<DataVector, Dim>& phi,
+    const Scalar<DataVector>& gamma0, const Scalar<DataVector>& gamma1,
+    const Scalar<DataVector>& gamma2,
+    const gauges::GaugeCondition& gauge_condition, const Mesh<Dim>& mesh,
+    const double time,
+    const tnsr::I<DataVector, Dim, Frame::Inertial>& inertial_coords,
+    const InverseJacobian<DataVector, Dim, Frame::ElementLogical,
+                          Frame::Inertial>& inverse_jacobian,
+    const std::optional<tnsr::I<DataVector, Dim, Frame::Inertial>>&
+        mesh_velocity) {
+  const size_t number_of_points = get<0, 0>(*dt_spacetime_metric).size();
+  const bool using_harmonic_gauge = gauge_condition.is_harmonic();
+  const bool has_mesh_velocity = mesh_velocity.has_value();
+  // Need constraint damping on interfaces in DG schemes
+  *temp_gamma1 = gamma1;
+  *temp_gamma2 = gamma2;
+
+  // Values of the current grid point. They are declared outside the loops so
+  // the compiler can keep them in registers and the stack frame.
+  tnsr::aa<double, Dim> g{};
+  tnsr::aa<double, Dim> pi_p{};
+  tnsr::iaa<double, Dim> phi_p{};
+  tnsr::ii<double, Dim> spatial_metric{};
+  Scalar<double> det_spatial_metric{};
+  tnsr::II<double, Dim> inv_spatial{};
+  tnsr::I<double, Dim> beta{};
+  tnsr::AA<double, Dim> inv_g{};
+  tnsr::A<double, Dim> normal{};
+  tnsr::aa<double, Dim> dt_g{};
+  tnsr::i<double, Dim> half_phi_nn{};
+
+  // First pass: the 3+1 quantities, the part of dt_spacetime_metric that
+  // doesn't involve constraints (i.e. the time derivative used in the
+  // Christoffel symbols), and the normal projections the gauge condition needs.
+  for (size_t s = 0; s < number_of_points; ++s) {
+    load(make_not_null(&g), spacetime_metric, s);
+    load(make_not_null(&pi_p), pi, s);
+    load(make_not_null(&phi_p), phi, s);
+    for (size_t i = 0; i < Dim; ++i) {
+      for (size_t j = i; j < Dim; ++j) {
+        spatial_metric.get(i, j) = g.get(i + 1, j + 1);
+      }
+    }
+    determinant_and_inverse(make_not_null(&det_spatial_metric),
+                            make_not_null(&inv_spatial), spatial_metric);
+    for (size_t i = 0; i < Dim; ++i) {
+      beta.get(i) = inv_spatial.get(i, 0) * g.get(1, 0);
+      for (size_t j = 1; j < Dim; ++j) {
+        beta.get(i) += inv_spatial.get(i, j) * g.get(j + 1, 0);
+      }
+    }
+    double alpha = -get<0, 0>(g);
+    for (size_t i = 0; i < Dim; ++i) {
+      alpha += beta.get(i) * g.get(i + 1, 0);
+    }
+    alpha = sqrt(alpha);
+    const double one_over_lapse = 1.0 / alpha;
+    const double one_over_lapse_sqrd = square(one_over_lapse);
+
+    get<0, 0>(inv_g) = -one_over_lapse_sqrd;
+    get<0>(normal) = one_over_lapse;
+    for (size_t i = 0; i < Dim; ++i) {
+      inv_g.get(0, i + 1) = beta.get(i) * one_over_lapse_sqrd;
+      normal.get(i + 1) = -beta.get(i) * one_over_lapse;
+      for (size_t j = i; j < Dim; ++j) {
+        inv_g.get(i + 1, j + 1) = inv_spatial.get(i, j) -
+                                  beta.get(i) * beta.get(j) *
+                                      one_over_lapse_sqrd;
+      }
+    }
+
+    for (size_t mu = 0; mu < Dim + 1; ++mu) {
+      for (size_t nu = mu; nu < Dim + 1; ++nu) {
+        dt_g.get(mu, nu) = -alpha * pi_p.get(mu, nu);
+        for (size_t m = 0; m < Dim; ++m) {
+          dt_g.get(mu, nu) += beta.get(m) * phi_p.get(m, mu, nu);
+        }
+      }
+    }
+
+    double half_pi_nn = 0.0;
+    for (size_t i = 0; i < Dim; ++i) {
+      half_phi_nn.get(i) = 0.0;
+    }
+    for (size_t mu = 0; mu < Dim + 1; ++mu) {
+      for (size_t nu = 0; nu < Dim + 1; ++nu) {
+        const double nn = normal.get(mu) * normal.get(nu);
+        half_pi_nn += nn * pi_p.get(mu, nu);
+        for (size_t i = 0; i < Dim; ++i) {
+          half_phi_nn.get(i) += nn * phi_p.get(i, mu, nu);
+        }
+      }
+    }
+    get(*half_pi_two_normals)[s] = 0.5 * half_pi_nn;
+    for (size_t i = 0; i < Dim; ++i) {
+      half_phi_nn.get(i) *= 0.5;
+    }
+    store(half_phi_two_normals, half_phi_nn, s);
+
+    get(*lapse)[s] = alpha;
+    if (not using_harmonic_gauge) {
+      get(*sqrt_det_spatial_metric)[s] = sqrt(get(det_spatial_metric));
+    }
+    store(shift, beta, s);
+    store(inverse_spatial_metric, inv_spatial, s);
+    store(inverse_spacetime_metric, inv_g, s);
+    store(normal_spacetime_vector, normal, s);
+    store(dt_spacetime_metric, dt_g, s);
+  }
+
+  {
+    const tnsr::abb<DataVector, Dim> da_spacetime_metric{};
+    for (size_t a = 0; a < Dim + 1; ++a) {
+      for (size_t b = a; b < Dim + 1; ++b) {
+        make_const_view(make_not_null(&da_spacetime_metric.get(0, a, b)),
+                        dt_spacetime_metric->get(a, b), 0, number_of_points);
+        for (size_t i = 0; i < Dim; ++i) {
+          make_const_view(make_not_null(&da_spacetime_metric.get(i + 1, a, b)),
+                          phi.get(i, a, b), 0, number_of_points);
+        }
+      }
+    }
+    gauges::dispatch<Dim>(
+        gauge_function, spacetime_deriv_gauge_function, *lapse, *shift,
+        *sqrt_det_spatial_metric, *inverse_spatial_metric, da_spacetime_metric,
+        *half_pi_two_normals, *half_phi_two_normals, spacetime_metric, phi,
+        mesh, time, inertial_coords, inverse_jacobian, gauge_condition);
+  }
+
+  tnsr::iaa<double, Dim> d_g{};
+  tnsr::iaa<double, Dim> d_pi_p{};
+  tnsr::ijaa<double, Dim> d_phi_p{};
+  tnsr::I<double, Dim> mesh_vel{};
+  tnsr::a<double, Dim> gauge_h{};
+  tnsr::ab<double, Dim> d4_gauge_h{};
+  tnsr::abb<double, Dim> da_g{};
+  tnsr::abb<double, Dim> christoffel{};
+  tnsr::Abb<double, Dim> christoffel_second{};
+  tnsr::abC<double, Dim> christoffel_3_up{};
+  tnsr::a<double, Dim> gauge_constraint{};
+  tnsr::iaa<double, Dim> three_index{};
+  tnsr::aa<double, Dim> shift_dot_three_index{};
+  tnsr::aa<double, Dim> mesh_velocity_dot_three_index{};
+  tnsr::Iaa<double, Dim> phi_1_up{};
+  tnsr::iaB<double, Dim> phi_3_up{};
+  tnsr::aB<double, Dim> pi_2_up{};
+  tnsr::a<double, Dim> pi_one_normal{};
+  tnsr::ia<double, Dim> phi_one_normal{};
+  tnsr::aa<double, Dim> dt_pi_p{};
+  tnsr::iaa<double, Dim> dt_phi_p{};
+
+  // Second pass: the equations
+  for (size_t s = 0; s < number_of_points; ++s) {
+    load(make_not_null(&g), spacetime_metric, s);
+    load(make_not_null(&pi_p), pi, s);
+    load(make_not_null(&phi_p), phi, s);
+    load(make_not_null(&d_g), d_spacetime_metric, s);
+    load(make_not_null(&d_pi_p), d_pi, s);
+    load(make_not_null(&d_phi_p), d_phi, s);
+    load(make_not_null(&beta), *shift, s);
+    load(make_not_null(&inv_spatial), *inverse_spatial_metric, s);
+    load(make_not_null(&inv_g), *inverse_spacetime_metric, s);
+    load(make_not_null(&normal), *normal_spacetime_vector, s);
+    load(make_not_null(&dt_g), *dt_spacetime_metric, s);
+    load(make_not_null(&half_phi_nn), *half_phi_two_normals, s);
+    if (not using_harmonic_gauge) {
+      load(make_not_null(&gauge_h), *gauge_function, s);
+      load(make_not_null(&d4_gauge_h), *spacetime_deriv_gauge_function, s);
+    }
+    if (has_mesh_velocity) {
+      load(make_not_null(&mesh_vel), *mesh_velocity, s);
+    }
+    const double alpha = get(*lapse)[s];
+    const double half_pi_nn = get(*half_pi_two_normals)[s];
+    const double gamma0_p = get(gamma0)[s];
+    const double gamma1_p = get(gamma1)[s];
+    const double gamma2_p = get(gamma2)[s];
+    const double gamma12 = gamma1_p * gamma2_p;
+
+    for (size_t a = 0; a < Dim + 1; ++a) {
+      for (size_t b = a; b < Dim + 1; ++b) {
+        da_g.get(0, a, b) = dt_g.get(a, b);
+        for (size_t i = 0; i < Dim; ++i) {
+          da_g.get(i + 1, a, b) = phi_p.get(i, a, b);
+        }
+      }
+    }
+    for (size_t c = 0; c < Dim + 1; ++c) {
+      for (size_t a = 0; a < Dim + 1; ++a) {
+        for (size_t b = a; b < Dim + 1; ++b) {
+          christoffel.get(c, a, b) =
+              0.5 * (da_g.get(a, b, c) + da_g.get(b, a, c) - da_g.get(c, a, b));
+        }
+      }
+    }
+
+    // The gauge constraint is the trace of the Christoffel symbols plus the
+    // gauge source function
+    for (size_t c = 0; c < Dim + 1; ++c) {
+      gauge_constraint.get(c) = 0.0;
+      for (size_t a = 0; a < Dim + 1; ++a) {
+        for (size_t b = 0; b < Dim + 1; ++b) {
+          gauge_constraint.get(c) += inv_g.get(a, b) * christoffel.get(c, a, b);
+        }
+      }
+      if (not using_harmonic_gauge) {
+        gauge_constraint.get(c) += gauge_h.get(c);
+      }
+    }
+    // Multiplied by gamma0 since it always shows up multiplied by gamma0 in
+    // the equations
+    double normal_dot_gauge_constraint = 0.0;
+    for (size_t mu = 0; mu < Dim + 1; ++mu) {
+      normal_dot_gauge_constraint += normal.get(mu) * gauge_constraint.get(mu);
+    }
+    normal_dot_gauge_constraint *= gamma0_p;
+
+    for (size_t i = 0; i < Dim; ++i) {
+      for (size_t mu = 0; mu < Dim + 1; ++mu) {
+        for (size_t nu = mu; nu < Dim + 1; ++nu) {
+          three_index.get(i, mu, nu) =
+              d_g.get(i, mu, nu) - phi_p.get(i, mu, nu);
+        }
+      }
+    }
+    for (size_t mu = 0; mu < Dim + 1; ++mu) {
+      for (size_t nu = mu; nu < Dim + 1; ++nu) {
+        shift_dot_three_index.get(mu, nu) =
+            get<0>(beta) * three_index.get(0, mu, nu);
+        for (size_t m = 1; m < Dim; ++m) {
+          shift_dot_three_index.get(mu, nu) +=
+              beta.get(m) * three_index.get(m, mu, nu);
+        }
+        if (has_mesh_velocity) {
+          mesh_velocity_dot_three_index.get(mu, nu) =
+              get<0>(mesh_vel) * three_index.get(0, mu, nu);
+          for (size_t m = 1; m < Dim; ++m) {
+            mesh_velocity_dot_three_index.get(mu, nu) +=
+                mesh_vel.get(m) * three_index.get(m, mu, nu);
+          }
+        }
+      }
+    }
+
+    if (not using_harmonic_gauge) {
+      for (size_t d = 0; d < Dim + 1; ++d) {
+        for (size_t a = 0; a < Dim + 1; ++a) {
+          for (size_t b = a; b < Dim + 1; ++b) {
+            christoffel_second.get(d, a, b) =
+                inv_g.get(d, 0) * christoffel.get(0, a, b);
+            for (size_t c = 1; c < Dim + 1; ++c) {
+              christoffel_second.get(d, a, b) +=
+                  inv_g.get(d, c) * christoffel.get(c, a, b);
+            }
+          }
+        }
+      }
+    }
+
+    for (size_t m = 0; m < Dim; ++m) {
+      for (size_t mu = 0; mu < Dim + 1; ++mu) {
+        for (size_t nu = mu; nu < Dim + 1; ++nu) {
+          phi_1_up.get(m, mu, nu) =
+              inv_spatial.get(m, 0) * phi_p.get(0, mu, nu);
+          for (size_t n = 1; n < Dim; ++n) {
+            phi_1_up.get(m, mu, nu) +=
+                inv_spatial.get(m, n) * phi_p.get(n, mu, nu);
+          }
+        }
+      }
+    }
+    for (size_t m = 0; m < Dim; ++m) {
+      for (size_t nu = 0; nu < Dim + 1; ++nu) {
+        for (size_t alpha_index = 0; alpha_index < Dim + 1; ++alpha_index) {
+          phi_3_up.get(m, nu, alpha_index) =
+              inv_g.get(alpha_index, 0) * phi_p.get(m, nu, 0);
+          for (size_t beta_index = 1; beta_index < Dim + 1; ++beta_index) {
+            phi_3_up.get(m, nu, alpha_index) +=
+                inv_g.get(alpha_index, beta_index) *
+                phi_p.get(m, nu, beta_index);
+          }
+        }
+      }
+    }
+    for (size_t nu = 0; nu < Dim + 1; ++nu) {
+      for (size_t alpha_index = 0; alpha_index < Dim + 1; ++alpha_index) {
+        pi_2_up.get(nu, alpha_index) =
+            inv_g.get(alpha_index, 0) * pi_p.get(nu, 0);
+        for (size_t beta_index = 1; beta_index < Dim + 1; ++beta_index) {
+          pi_2_up.get(nu, alpha_index) +=
+              inv_g.get(alpha_index, beta_index) * pi_p.get(nu, beta_index);
+        }
+      }
+    }
+    for (size_t mu = 0; mu < Dim + 1; ++mu) {
+      for (size_t nu = 0; nu < Dim + 1; ++nu) {
+        for (size_t alpha_index = 0; alpha_index < Dim + 1; ++alpha_index) {
+          christoffel_3_up.get(mu, nu, alpha_index) =
+              inv_g.get(alpha_index, 0) * christoffel.get(mu, nu, 0);
+          for (size_t beta_index = 1; beta_index < Dim + 1; ++beta_index) {
+            christoffel_3_up.get(mu, nu, alpha_index) +=
+                inv_g.get(alpha_index, beta_index) *
+                christoffel.get(mu, nu, beta_index);
+          }
+        }
+      }
+    }
+    for (size_t mu = 0; mu < Dim + 1; ++mu) {
+      pi_one_normal.get(mu) = get<0>(normal) * pi_p.get(0, mu);
+      for (size_t nu = 1; nu < Dim + 1; ++nu) {
+        pi_one_normal.get(mu) += normal.get(nu) * pi_p.get(nu, mu);
+      }
+    }
+    for (size_t n = 0; n < Dim; ++n) {
+      for (size_t nu = 0; nu < Dim + 1; ++nu) {
+        phi_one_normal.get(n, nu) = get<0>(normal) * phi_p.get(n, 0, nu);
+        for (size_t mu = 1; mu < Dim + 1; ++mu) {
+          phi_one_normal.get(n, nu) += normal.get(mu) * phi_p.get(n, mu, nu);
+        }
+      }
+    }
+
+    // Equation for dt_spacetime_metric
+    for (size_t mu = 0; mu < Dim + 1; ++mu) {
+      for (size_t nu = mu; nu < Dim + 1; ++nu) {
+        dt_g.get(mu, nu) +=
+            (1.0 + gamma1_p) * shift_dot_three_index.get(mu, nu);
+        if (has_mesh_velocity) {
+          dt_g.get(mu, nu) +=
+              gamma1_p * mesh_velocity_dot_three_index.get(mu, nu);
+        }
+      }
+    }
+
+    // Equation for dt_pi. The n_a contributions only have a=0 since n_i=0
+    // identically.
+    const double minus_gamma0_lapse = -gamma0_p * alpha;
+    for (size_t i = 1; i < Dim + 1; ++i) {
+      dt_pi_p.get(0, i) = minus_gamma0_lapse * gauge_constraint.get(i) -
+                          normal_dot_gauge_constraint * g.get(0, i);
+    }
+    get<0, 0>(dt_pi_p) = 2.0 * minus_gamma0_lapse * get<0>(gauge_constraint) -
+                         normal_dot_gauge_constraint * get<0, 0>(g);
+    for (size_t mu = 1; mu < Dim + 1; ++mu) {
+      for (size_t nu = mu; nu < Dim + 1; ++nu) {
+        dt_pi_p.get(mu, nu) = -normal_dot_gauge_constraint * g.get(mu, nu);
+      }
+    }
+
+    for (size_t mu = 0; mu < Dim + 1; ++mu) {
+      for (size_t nu = mu; nu < Dim + 1; ++nu) {
+        double& dt_pi_mu_nu = dt_pi_p.get(mu, nu);
+        dt_pi_mu_nu -= half_pi_nn * pi_p.get(mu, nu);
+        if (not using_harmonic_gauge) {
+          dt_pi_mu_nu -= d4_gauge_h.get(mu, nu) + d4_gauge_h.get(nu, mu);
+        }
+        for (size_t delta = 0; delta < Dim + 1; ++delta) {
+          dt_pi_mu_nu -= 2.0 * pi_p.get(mu, delta) * pi_2_up.get(nu, delta);
+          if (not using_harmonic_gauge) {
+            dt_pi_mu_nu += 2.0 * christoffel_second.get(delta, mu, nu) *
+                           gauge_h.get(delta);
+          }
+          for (size_t n = 0; n < Dim; ++n) {
+            dt_pi_mu_nu +=
+                2.0 * phi_1_up.get(n, mu, delta) * phi_3_up.get(n, nu, delta);
+          }
+          for (size_t alpha_index = 0; alpha_index < Dim + 1; ++alpha_index) {
+            dt_pi_mu_nu -= 2.0 * christoffel_3_up.get(mu, alpha_index, delta) *
+                           christoffel_3_up.get(nu, delta, alpha_index);
+          }
+        }
+        for (size_t m = 0; m < Dim; ++m) {
+          dt_pi_mu_nu -= pi_one_normal.get(m + 1) * phi_1_up.get(m, mu, nu);
+          for (size_t n = 0; n < Dim; ++n) {
+            dt_pi_mu_nu -= inv_spatial.get(m, n) * d_phi_p.get(m, n, mu, nu);
+          }
+        }
+        dt_pi_mu_nu *= alpha;
+        dt_pi_mu_nu += gamma12 * shift_dot_three_index.get(mu, nu);
+        if (has_mesh_velocity) {
+          dt_pi_mu_nu += gamma12 * mesh_velocity_dot_three_index.get(mu, nu);
+        }
+        for (size_t m = 0; m < Dim; ++m) {
+          // DualFrame term
+          dt_pi_mu_nu += beta.get(m) * d_pi_p.get(m, mu, nu);
+        }
+      }
+    }
+
+    // Equation for dt_phi
+    for (size_t i = 0; i < Dim; ++i) {
+      for (size_t mu = 0; mu < Dim + 1; ++mu) {
+        for (size_t nu = mu; nu < Dim + 1; ++nu) {
+          double& dt_phi_i_mu_nu = dt_phi_p.get(i, mu, nu);
+          dt_phi_i_mu_nu = pi_p.get(mu, nu) * half_phi_nn.get(i) -
+                           d_pi_p.get(i, mu, nu) +
+                           gamma2_p * three_index.get(i, mu, nu);
+          for (size_t n = 0; n < Dim; ++n) {
+            dt_phi_i_mu_nu +=
+                phi_one_normal.get(i, n + 1) * phi_1_up.get(n, mu, nu);
+          }
+          dt_phi_i_mu_nu *= alpha;
+          for (size_t m = 0; m < Dim; ++m) {
+            dt_phi_i_mu_nu += beta.get(m) * d_phi_p.get(m, i, mu, nu);
+          }
+        }
+      }
+    }
+
+    store(three_index_constraint, three_index, s);
+    store(dt_spacetime_metric, dt_g, s);
+    store(dt_pi, dt_pi_p, s);
+    store(dt_phi, dt_phi_p, s);
+  }
+}
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATE(_, data) template struct FusedTimeDerivative<DIM(data)>;
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
+
+#undef INSTANTIATE
+#undef DIM
+}  // namespace gh
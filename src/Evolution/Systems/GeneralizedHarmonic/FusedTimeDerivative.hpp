@@ -0,0 +1,128 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+
+#include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Domain/Tags.hpp"
+#include "Domain/TagsTimeDependent.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/ConstraintDamping/Tags.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/DuDtTempTags.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/Gauges.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/Tags/GaugeCondition.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/Tags.hpp"
+#include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
+#include "PointwiseFunctions/GeneralRelativity/TagsDeclarations.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+class DataVector;
+
+namespace Tags {
+struct Time;
+}  // namespace Tags
+
+namespace gsl {
+template <class T>
+class not_null;
+}  // namespace gsl
+
+template <typename, typename, typename>
+class Tensor;
+/// \endcond
+
+namespace gh {
+/*!
+ * \brief Compute the RHS of the Generalized Harmonic formulation of
+ * Einstein's equations in two passes over the grid points.
+ *
+ * \details Evaluates the same equations as `gh::TimeDerivative`, but instead
+ * of evaluating each tensor equation as a `DataVector` expression over all
+ * grid points, which writes and reads back dozens of temporary tensors, this
+ * computes all contractions of one grid point before moving on to the next.
+ * The intermediate tensors of a grid point, e.g. the Christoffel symbols and
+ * \f$\Phi^i{}_{ab}\f$, are held in `Tensor<double>`s that stay in registers
+ * and the L1 cache.
+ *
+ * The computation is split into two passes because the gauge condition needs
+ * the lapse, shift, spatial metric and \f$\partial_a g_{bc}\f$ on the whole
+ * element (the analytic gauge takes numerical derivatives). The first pass
+ * computes these quantities, the gauge source function is evaluated with
+ * `gauges::dispatch`, and the second pass computes everything else.
+ *
+ * Only the temporaries that are needed by the gauge condition, the boundary
+ * conditions, and the boundary corrections are stored, so the
+ * `temporary_tags` are a subset of those of `gh::TimeDerivative`.
+ *
+ * Select this implementation for an executable with
+ * `gh::System<Dim, gh::FusedTimeDerivative<Dim>>`. Results agree with
+ * `gh::TimeDerivative` to roundoff but not bit-for-bit, since the order of the
+ * floating point operations differs.
+ *
+ * \warning When using harmonic gauge,
+ * gr::Tags::SqrtDetSpatialMetric<DataVector> is not computed.
+ */
+template <size_t Dim>
+struct FusedTimeDerivative {
+ public:
+  using temporary_tags = tmpl::list<
+      ::gh::ConstraintDamping::Tags::ConstraintGamma1,
+      ::gh::ConstraintDamping::Tags::ConstraintGamma2,
+      Tags::GaugeH<DataVector, Dim>,
+      Tags::SpacetimeDerivGaugeH<DataVector, Dim>, Tags::HalfPiTwoNormals,
+      Tags::HalfPhiTwoNormals<Dim>,
+      Tags::ThreeIndexConstraint<DataVector, Dim>,
+      gr::Tags::Lapse<DataVector>, gr::Tags::Shift<DataVector, Dim>,
+      gr::Tags::InverseSpatialMetric<DataVector, Dim>,
+      gr::Tags::SqrtDetSpatialMetric<DataVector>,
+      gr::Tags::InverseSpacetimeMetric<DataVector, Dim>,
+      gr::Tags::SpacetimeNormalVector<DataVector, Dim>>;
+  using argument_tags =
+      tmpl::list<gr::Tags::SpacetimeMetric<DataVector, Dim>,
+                 Tags::Pi<DataVector, Dim>, Tags::Phi<DataVector, Dim>,
+                 ::gh::ConstraintDamping::Tags::ConstraintGamma0,
+                 ::gh::ConstraintDamping::Tags::ConstraintGamma1,
+                 ::gh::ConstraintDamping::Tags::ConstraintGamma2,
+                 gauges::Tags::GaugeCondition, domain::Tags::Mesh<Dim>,
+                 ::Tags::Time, domain::Tags::Coordinates<Dim, Frame::Inertial>,
+                 domain::Tags::InverseJacobian<Dim, Frame::ElementLogical,
+                                               Frame::Inertial>,
+                 domain::Tags::MeshVelocity<Dim, Frame::Inertial>>;
+
+  static void apply(
+      gsl::not_null<tnsr::aa<DataVector, Dim>*> dt_spacetime_metric,
+      gsl::not_null<tnsr::aa<DataVector, Dim>*> dt_pi,
+      gsl::not_null<tnsr::iaa<DataVector, Dim>*> dt_phi,
+      gsl::not_null<Scalar<DataVector>*> temp_gamma1,
+      gsl::not_null<Scalar<DataVector>*> temp_gamma2,
+      gsl::not_null<tnsr::a<DataVector, Dim>*> gauge_function,
+      gsl::not_null<tnsr::ab<DataVector, Dim>*>
+          spacetime_deriv_gauge_function,
+      gsl::not_null<Scalar<DataVector>*> half_pi_two_normals,
+      gsl::not_null<tnsr::i<DataVector, Dim>*> half_phi_two_normals,
+      gsl::not_null<tnsr::iaa<DataVector, Dim>*> three_index_constraint,
+      gsl::not_null<Scalar<DataVector>*> lapse,
+      gsl::not_null<tnsr::I<DataVector, Dim>*> shift,
+      gsl::not_null<tnsr::II<DataVector, Dim>*> inverse_spatial_metric,
+      gsl::not_null<Scalar<DataVector>*> sqrt_det_spatial_metric,
+      gsl::not_null<tnsr::AA<DataVector, Dim>*> inverse_spacetime_metric,
+      gsl::not_null<tnsr::A<DataVector, Dim>*> normal_spacetime_vector,
+      const tnsr::iaa<DataVector, Dim>& d_spacetime_metric,
+      const tnsr::iaa<DataVector, Dim>& d_pi,
+      const tnsr::ijaa<DataVector, Dim>& d_phi,
+      const tnsr::aa<DataVector, Dim>& spacetime_metric,
+      const tnsr::aa<DataVector, Dim>& pi,
+      const tnsr::iaa<DataVector, Dim>& phi, const Scalar<DataVector>& gamma0,
+      const Scalar<DataVector>& gamma1, const Scalar<DataVector>& gamma2,
+      const gauges::GaugeCondition& gauge_condition, const Mesh<Dim>& mesh,
+      double time,
+      const tnsr::I<DataVector, Dim, Frame::Inertial>& inertial_coords,
+      const InverseJacobian<DataVector, Dim, Frame::ElementLogical,
+                            Frame::Inertial>& inverse_jacobian,
+      const std::optional<tnsr::I<DataVector, Dim, Frame::Inertial>>&
+          mesh_velocity);
+};
+}  // namespace gh
@@ -8,29 +8,13 @@
 #include <cstddef>
 #include <limits>
 
-#include "DataStructures/Blaze/IntegerPow.hpp"
 #include "DataStructures/DataVector.hpp"
-#include "DataStructures/Tags/TempTensor.hpp"
-#include "DataStructures/TempBuffer.hpp"
-#include "DataStructures/Tensor/EagerMath/DotProduct.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
-#include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/DampedWaveHelpers.hpp"
-#include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/HalfPiPhiTwoNormals.hpp"
-#include "PointwiseFunctions/GeneralRelativity/DerivativesOfSpacetimeMetric.hpp"
-#include "PointwiseFunctions/GeneralRelativity/GeneralizedHarmonic/DerivSpatialMetric.hpp"
-#include "PointwiseFunctions/GeneralRelativity/GeneralizedHarmonic/SpacetimeDerivOfDetSpatialMetric.hpp"
-#include "PointwiseFunctions/GeneralRelativity/GeneralizedHarmonic/SpacetimeDerivativeOfSpacetimeMetric.hpp"
-#include "PointwiseFunctions/GeneralRelativity/GeneralizedHarmonic/SpatialDerivOfLapse.hpp"
-#include "PointwiseFunctions/GeneralRelativity/GeneralizedHarmonic/SpatialDerivOfShift.hpp"
-#include "PointwiseFunctions/GeneralRelativity/GeneralizedHarmonic/TimeDerivOfLapse.hpp"
-#include "PointwiseFunctions/GeneralRelativity/GeneralizedHarmonic/TimeDerivOfShift.hpp"
-#include "PointwiseFunctions/GeneralRelativity/GeneralizedHarmonic/TimeDerivOfSpatialMetric.hpp"
-#include "PointwiseFunctions/GeneralRelativity/InverseSpacetimeMetric.hpp"
-#include "PointwiseFunctions/GeneralRelativity/SpacetimeNormalVector.hpp"
-#include "PointwiseFunctions/GeneralRelativity/SpatialMetric.hpp"
 #include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Math.hpp"
 #include "Utilities/SetNumberOfGridPoints.hpp"
 #include "Utilities/TMPL.hpp"
 
@@ -66,6 +50,11 @@ double time_deriv_of_roll_on_function(const double time, const double t_start,
 }  // namespace DampedHarmonicGauge_detail
 
 namespace {
+// Evaluates the gauge source function and its spacetime derivative in a
+// single pass over the grid points. The roll-on function only depends on time
+// and is evaluated once per call, while the logarithms, the spatial weight
+// function and all products are computed for one grid point at a time, so no
+// temporary DataVectors are needed.
 template <bool UseRollon, size_t SpatialDim, typename Frame>
 void damped_harmonic_impl(
     const gsl::not_null<tnsr::a<DataVector, SpatialDim, Frame>*> gauge_h,
@@ -103,338 +92,184 @@ void damped_harmonic_impl(
            "Cannot call damped_harmonic_impl with UseRollon disabled and "
            "dgauge_h_init not being nullptr");
   }
+  set_number_of_grid_points(gauge_h, num_points);
+  set_number_of_grid_points(d4_gauge_h, num_points);
 
-  // Use a TempBuffer to reduce total number of allocations. This is especially
-  // important in a multithreaded environment.
-  TempBuffer<tmpl::list<
-      ::Tags::Tempii<1, SpatialDim, Frame>,
-      ::Tags::Tempijj<4, SpatialDim, Frame>, ::Tags::TempScalar<5>,
-      ::Tags::TempScalar<6>, ::Tags::TempScalar<7>, ::Tags::TempScalar<8>,
-      ::Tags::TempScalar<9>, ::Tags::TempScalar<10>, ::Tags::TempScalar<11>,
-      ::Tags::TempScalar<12>, ::Tags::TempScalar<13>, ::Tags::TempScalar<14>,
-      ::Tags::Tempa<15, SpatialDim, Frame>,
-      ::Tags::Tempa<16, SpatialDim, Frame>,
-      ::Tags::Tempa<17, SpatialDim, Frame>,
-      ::Tags::Tempa<18, SpatialDim, Frame>,
-      ::Tags::Tempa<19, SpatialDim, Frame>,
-      ::Tags::Tempa<20, SpatialDim, Frame>,
-      ::Tags::Tempa<21, SpatialDim, Frame>,
-      ::Tags::Tempa<22, SpatialDim, Frame>,
-      ::Tags::Tempa<23, SpatialDim, Frame>,
-      ::Tags::Tempa<24, SpatialDim, Frame>,
-      ::Tags::Tempa<27, SpatialDim, Frame>,
-      ::Tags::TempaB<30, SpatialDim, Frame>,
-      ::Tags::Tempa<31, SpatialDim, Frame>, ::Tags::TempScalar<32>,
-      ::Tags::Tempa<33, SpatialDim, Frame>,
-      ::Tags::Tempab<35, SpatialDim, Frame>,
-      ::Tags::Tempa<36, SpatialDim, Frame>,
-      ::Tags::Tempab<37, SpatialDim, Frame>, ::Tags::TempScalar<38>,
-      ::Tags::Tempa<39, SpatialDim, Frame>, ::Tags::TempScalar<40>,
-      ::Tags::Tempa<41, SpatialDim, Frame>, ::Tags::TempScalar<42>,
-      ::Tags::Tempa<43, SpatialDim, Frame>, ::Tags::TempScalar<44>,
-      ::Tags::TempScalar<45>, ::Tags::TempScalar<46>, ::Tags::TempScalar<47>>>
-      buffer(num_points);
-  auto& one_over_lapse = get<::Tags::TempScalar<5>>(buffer);
-  auto& log_fac_1 = get<::Tags::TempScalar<6>>(buffer);
-  auto& log_fac_2 = get<::Tags::TempScalar<7>>(buffer);
-  auto& weight = get<::Tags::TempScalar<8>>(buffer);
-  auto& mu_L1 = get<::Tags::TempScalar<9>>(buffer);
-  auto& mu_S = get<::Tags::TempScalar<10>>(buffer);
-  auto& mu_L2 = get<::Tags::TempScalar<11>>(buffer);
-  auto& mu_S_over_lapse = get<::Tags::TempScalar<12>>(buffer);
-  auto& mu1 = get<::Tags::TempScalar<13>>(buffer);
-  auto& mu2 = get<::Tags::TempScalar<14>>(buffer);
-  auto& d4_weight = get<::Tags::Tempa<15, SpatialDim, Frame>>(buffer);
-  auto& d4_RW_L1 = get<::Tags::Tempa<16, SpatialDim, Frame>>(buffer);
-  auto& d4_RW_S = get<::Tags::Tempa<17, SpatialDim, Frame>>(buffer);
-  auto& d4_RW_L2 = get<::Tags::Tempa<18, SpatialDim, Frame>>(buffer);
-  auto& d4_mu_S = get<::Tags::Tempa<19, SpatialDim, Frame>>(buffer);
-  auto& d4_mu1 = get<::Tags::Tempa<20, SpatialDim, Frame>>(buffer);
-  auto& d4_mu2 = get<::Tags::Tempa<21, SpatialDim, Frame>>(buffer);
-  auto& d4_log_fac_mu1 = get<::Tags::Tempa<22, SpatialDim, Frame>>(buffer);
-  auto& d4_log_fac_muS = get<::Tags::Tempa<23, SpatialDim, Frame>>(buffer);
-  auto& d4_log_fac_mu2 = get<::Tags::Tempa<24, SpatialDim, Frame>>(buffer);
-
-  auto& spacetime_metric_dot_shift =
-      get<::Tags::Tempa<31, SpatialDim, Frame>>(buffer);
-  auto& prefac = get<::Tags::TempScalar<32>>(buffer);
-  auto& d4_muS_over_lapse = get<::Tags::Tempa<33, SpatialDim, Frame>>(buffer);
-  auto& dT1 = get<::Tags::Tempab<35, SpatialDim, Frame>>(buffer);
-  auto& dT2 = get<::Tags::Tempa<36, SpatialDim, Frame>>(buffer);
-  auto& dT3 = get<::Tags::Tempab<37, SpatialDim, Frame>>(buffer);
-
-  auto& dt_lapse = get<::Tags::TempScalar<38>>(buffer);
-  auto& d_lapse_by_lapse = get<::Tags::Tempa<39, SpatialDim, Frame>>(buffer);
-  auto& det_spatial_metric = get<::Tags::TempScalar<40>>(buffer);
-  auto& d_g_by_det = get<::Tags::Tempa<41, SpatialDim, Frame>>(buffer);
-  auto& logfac = get<::Tags::TempScalar<42>>(buffer);
-  auto& d_logfac = get<::Tags::Tempa<43, SpatialDim, Frame>>(buffer);
-  auto& prefac_log = get<::Tags::TempScalar<44>>(buffer);
-
-  auto& pow1 = get<::Tags::TempScalar<45>>(buffer);
-  auto& pow2 = get<::Tags::TempScalar<46>>(buffer);
-  auto& pow3 = get<::Tags::TempScalar<47>>(buffer);
-
-  // 3+1 quantities
-  const tnsr::ii<DataVector, SpatialDim, Frame> spatial_metric{};
-  for (size_t i = 0; i < SpatialDim; ++i) {
-    for (size_t j = 0; j <= i; ++j) {
-      make_const_view(make_not_null(&spatial_metric.get(i, j)),
-                      spacetime_metric.get(i + 1, j + 1), 0, num_points);
-    }
-  }
-  // We need \f$ \partial_a g_{bi} = \partial_a \psi_{bi} \f$. Here we
-  // use `derivatives_of_spacetime_metric` to get \f$ \partial_a g_{bc}\f$
-  // instead, and use only the derivatives of \f$ g_{bi}\f$.
-  const tnsr::ii<DataVector, SpatialDim, Frame> d0_spatial_metric{};
-  for (size_t i = 0; i < SpatialDim; ++i) {
-    for (size_t j = i; j < SpatialDim; ++j) {
-      make_const_view(make_not_null(&d0_spatial_metric.get(i, j)),
-                      d4_spacetime_metric.get(0, i + 1, j + 1), 0, num_points);
-    }
-  }
-
-  // commonly used terms
-  constexpr auto exp_fac_1 = 0.5;
-  constexpr auto exp_fac_2 = 0.;
-  get(one_over_lapse) = 1. / get(lapse);
-  DampedHarmonicGauge_detail::log_factor_metric_lapse<DataVector>(
-      make_not_null(&log_fac_1), lapse, sqrt_det_spatial_metric, exp_fac_1);
-  DampedHarmonicGauge_detail::log_factor_metric_lapse<DataVector>(
-      make_not_null(&log_fac_2), lapse, sqrt_det_spatial_metric, exp_fac_2);
-
-  // Tempering functions
+  // Tempering functions of time
   const double roll_on = UseRollon
                              ? DampedHarmonicGauge_detail::roll_on_function(
                                    time, rollon_start_time, rollon_width)
                              : 1.0;
-  DampedHarmonicGauge_detail::spatial_weight_function<DataVector, SpatialDim,
-                                                      Frame>(
-      make_not_null(&weight), coords, sigma_r);
-
-  get(pow1) = integer_pow(get(log_fac_1), exp_L1);
-  get(pow2) = integer_pow(get(log_fac_1), exp_S);
-  get(pow3) = integer_pow(get(log_fac_2), exp_L2);
-
-  // coeffs that enter gauge source function
-  get(mu_L1) = amp_coef_L1 * roll_on * get(weight) * get(pow1);
-  get(mu_S) = amp_coef_S * roll_on * get(weight) * get(pow2);
-  get(mu_L2) = amp_coef_L2 * roll_on * get(weight) * get(pow3);
-  get(mu_S_over_lapse) = get(mu_S) * get(one_over_lapse);
+  const double d0_roll_on =
+      UseRollon ? DampedHarmonicGauge_detail::time_deriv_of_roll_on_function(
+                      time, rollon_start_time, rollon_width)
+                : 0.0;
+  const double one_over_sigma_r_squared = 1.0 / square(sigma_r);
 
-  // Calc \f$ \mu_1 = \mu_{L1} log(rootg/N) = R W log(rootg/N)^5\f$
-  get(mu1) = get(mu_L1) * get(log_fac_1);
+  std::array<double, SpatialDim> shift_s{};
+  std::array<double, SpatialDim + 1> spacetime_metric_dot_shift{};
+  std::array<double, SpatialDim + 1> d_lapse_by_lapse{};
+  std::array<double, SpatialDim + 1> d_g_by_det{};
 
-  // Calc \f$ \mu_2 = \mu_{L2} log(1/N) = R W log(1/N)^5\f$
-  get(mu2) = get(mu_L2) * get(log_fac_2);
+  for (size_t s = 0; s < num_points; ++s) {
+    const double lapse_s = get(lapse)[s];
+    const double one_over_lapse = 1.0 / lapse_s;
+    for (size_t i = 0; i < SpatialDim; ++i) {
+      gsl::at(shift_s, i) = shift.get(i)[s];
+    }
 
-  get(prefac) = get(mu_L1) * get(log_fac_1) + get(mu_L2) * get(log_fac_2);
+    // log(\sqrt{g}/N) and log(1/N)
+    const double log_fac_1 = log(get(sqrt_det_spatial_metric)[s] / lapse_s);
+    const double log_fac_2 = -log(lapse_s);
 
-  // Compute g_ai shift^i
-  for (size_t a = 0; a < SpatialDim + 1; ++a) {
-    spacetime_metric_dot_shift.get(a) =
-        spacetime_metric.get(a, 1) * shift.get(0);
+    // Spatial weight function W(x^i) = exp(-r^2 / sigma_r^2)
+    double r_squared = square(coords.get(0)[s]);
     for (size_t i = 1; i < SpatialDim; ++i) {
-      spacetime_metric_dot_shift.get(a) +=
-          spacetime_metric.get(a, i + 1) * shift.get(i);
+      r_squared += square(coords.get(i)[s]);
     }
-  }
-
-  // Calculate H_a
-  for (size_t a = 0; a < SpatialDim + 1; ++a) {
-    gauge_h->get(a) = -get(mu_S_over_lapse) * spacetime_metric_dot_shift.get(a);
-    if constexpr (UseRollon) {
-      gauge_h->get(a) += (1. - roll_on) * gauge_h_init->get(a);
-    }
-  }
-  // Since n_i = 0 only do H_0 term with n_0 = -lapse
-  gauge_h->get(0) -= get(prefac) * get(lapse);
-
-  [[maybe_unused]] const double d0_roll_on =
-      UseRollon ? DampedHarmonicGauge_detail::time_deriv_of_roll_on_function(
-                      time, rollon_start_time, rollon_width)
-                : 0.0;
-
-  // Calc \f$ \partial_a [R W] \f$
-  DampedHarmonicGauge_detail::spacetime_deriv_of_spatial_weight_function<
-      DataVector, SpatialDim, Frame>(make_not_null(&d4_weight), coords, sigma_r,
-                                     weight);
-  d4_RW_L1 = d4_weight;
-  d4_RW_S = d4_weight;
-  d4_RW_L2 = d4_weight;
-  if constexpr (UseRollon) {
+    const double weight = exp(-r_squared * one_over_sigma_r_squared);
+    const double roll_on_weight = roll_on * weight;
+
+    // coeffs that enter gauge source function
+    const double pow_L1 = integer_pow(log_fac_1, exp_L1);
+    const double pow_S = integer_pow(log_fac_1, exp_S);
+    const double pow_L2 = integer_pow(log_fac_2, exp_L2);
+    // \f$ \mu_1 = \mu_{L1} log(rootg/N) \f$ and
+    // \f$ \mu_2 = \mu_{L2} log(1/N) \f$
+    const double mu1 = amp_coef_L1 * roll_on_weight * pow_L1 * log_fac_1;
+    const double mu2 = amp_coef_L2 * roll_on_weight * pow_L2 * log_fac_2;
+    const double mu_S = amp_coef_S * roll_on_weight * pow_S;
+    const double mu_S_over_lapse = mu_S * one_over_lapse;
+
+    // Compute g_ai shift^i
     for (size_t a = 0; a < SpatialDim + 1; ++a) {
-      d4_RW_L1.get(a) *= roll_on;
-      d4_RW_S.get(a) *= roll_on;
-      d4_RW_L2.get(a) *= roll_on;
+      gsl::at(spacetime_metric_dot_shift, a) =
+          spacetime_metric.get(a, 1)[s] * shift_s[0];
+      for (size_t i = 1; i < SpatialDim; ++i) {
+        gsl::at(spacetime_metric_dot_shift, a) +=
+            spacetime_metric.get(a, i + 1)[s] * gsl::at(shift_s, i);
+      }
     }
-    get<0>(d4_RW_L1) += get(weight) * d0_roll_on;
-    get<0>(d4_RW_S) += get(weight) * d0_roll_on;
-    get<0>(d4_RW_L2) += get(weight) * d0_roll_on;
-  }
-  tenex::evaluate(make_not_null(&dt_lapse),
-                  lapse() * (lapse() * half_pi_two_normals() -
-                             shift(ti::I) * half_phi_two_normals(ti::i)));
-  get<0>(d_lapse_by_lapse) = get(one_over_lapse) * get(dt_lapse);
-  for (size_t i = 0; i < SpatialDim; ++i) {
-    d_lapse_by_lapse.get(i + 1) = -half_phi_two_normals.get(i);
-  }
-  get(det_spatial_metric) = square(get(sqrt_det_spatial_metric));
-  spacetime_deriv_of_det_spatial_metric<DataVector, SpatialDim, Frame>(
-      make_not_null(&d_g_by_det), sqrt_det_spatial_metric,
-      inverse_spatial_metric, d0_spatial_metric, phi);
-  for (size_t a = 0; a < SpatialDim + 1; ++a) {
-    d_g_by_det.get(a) = d_g_by_det.get(a) / get(det_spatial_metric);
-  }
-  const auto spacetime_deriv_of_power_log_factor_metric_lapse =
-      [&d_lapse_by_lapse, &d_g_by_det, &lapse, &sqrt_det_spatial_metric,
-       &prefac_log, &d_logfac,
-       &logfac](gsl::not_null<tnsr::a<DataVector, SpatialDim, Frame>*> result,
-                double g_exponent, int exponent) -> void {
+
+    // Calculate H_a. Since n_i = 0 only H_0 has the T_2 term with n_0 = -lapse
     for (size_t a = 0; a < SpatialDim + 1; ++a) {
-      d_logfac.get(a) =
-          g_exponent * d_g_by_det.get(a) - d_lapse_by_lapse.get(a);
+      gauge_h->get(a)[s] =
+          -mu_S_over_lapse * gsl::at(spacetime_metric_dot_shift, a);
+      if constexpr (UseRollon) {
+        gauge_h->get(a)[s] += (1. - roll_on) * gauge_h_init->get(a)[s];
+      }
     }
-    DampedHarmonicGauge_detail::log_factor_metric_lapse(
-        make_not_null(&logfac), lapse, sqrt_det_spatial_metric, g_exponent);
-    get(prefac_log) =
-        static_cast<double>(exponent) * integer_pow(get(logfac), exponent - 1);
-    for (size_t a = 0; a < SpatialDim + 1; ++a) {
-      result->get(a) = get(prefac_log) * d_logfac.get(a);
+    gauge_h->get(0)[s] -= (mu1 + mu2) * lapse_s;
+
+    // The derivatives of the lapse are
+    // d_t lapse / lapse = 0.5 * n^a n^b (lapse Pi_{ab} - shift^i Phi_{iab})
+    // d_i lapse / lapse = -0.5 * n^a n^b Phi_{iab}
+    //
+    // The GH RHS computes:
+    //  0.5 * n^a n^b Pi_{ab}
+    //  0.5 * n^a n^b Phi_{iab}
+    // so we reuse that work by taking them as arguments.
+    d_lapse_by_lapse[0] = lapse_s * get(half_pi_two_normals)[s];
+    for (size_t i = 0; i < SpatialDim; ++i) {
+      const double half_phi_two_normals_i = half_phi_two_normals.get(i)[s];
+      d_lapse_by_lapse[0] -= gsl::at(shift_s, i) * half_phi_two_normals_i;
+      gsl::at(d_lapse_by_lapse, i + 1) = -half_phi_two_normals_i;
     }
-  };
-  // \partial_a \mu_{S} = \partial_a(A_S R_S W
-  //                               \log(\sqrt{g}/N)^{c_{S}})
-  // \partial_a \mu_1 = \partial_a(A_L1 R_L1 W
-  //                               \log(\sqrt{g}/N)^{1+c_{L1}})
-  // \partial_a \mu_2 = \partial_a(A_L2 R_L2 W
-  //                               \log(1/N)^{1+c_{L2}})
-  spacetime_deriv_of_power_log_factor_metric_lapse(
-      make_not_null(&d4_log_fac_mu1), exp_fac_1, exp_L1 + 1);
-  spacetime_deriv_of_power_log_factor_metric_lapse(
-      make_not_null(&d4_log_fac_muS), exp_fac_1, exp_S);
-  spacetime_deriv_of_power_log_factor_metric_lapse(
-      make_not_null(&d4_log_fac_mu2), exp_fac_2, exp_L2 + 1);
-
-  get(pow1) *= get(log_fac_1) * amp_coef_L1;
-  get(pow2) *= amp_coef_S;
-  get(pow3) *= get(log_fac_2) * amp_coef_L2;
-
-  for (size_t a = 0; a < SpatialDim + 1; ++a) {
-    // \f$ \partial_a \mu_1 \f$
-    d4_mu1.get(a) = get(pow1) * d4_RW_L1.get(a) +
-                    amp_coef_L1 * roll_on * get(weight) * d4_log_fac_mu1.get(a);
-    // \f$ \partial_a \mu_{S} \f$
-    d4_mu_S.get(a) = d4_RW_S.get(a) * get(pow2) +
-                     amp_coef_S * roll_on * get(weight) * d4_log_fac_muS.get(a);
-    // \f$ \partial_a \mu_2 \f$
-    d4_mu2.get(a) = get(pow3) * d4_RW_L2.get(a) +
-                    amp_coef_L2 * roll_on * get(weight) * d4_log_fac_mu2.get(a);
-  }
 
-  const tnsr::ijj<DataVector, SpatialDim, Frame> d3_spatial_metric{};
-  for (size_t i = 0; i < SpatialDim; ++i) {
+    // \f$ \partial_a g / g = g^{jk} \partial_a g_{jk} \f$
+    d_g_by_det.fill(0.0);
     for (size_t j = 0; j < SpatialDim; ++j) {
-      for (size_t k = 0; k <= j; ++k) {
-        make_const_view(make_not_null(&d3_spatial_metric.get(i, j, k)),
-                        phi.get(i, j + 1, k + 1), 0, num_points);
-      }
-    }
-  }
-
-  // Calc \f$ \partial_a T1 \f$
-  if constexpr (UseRollon) {
-    for (size_t b = 0; b < SpatialDim + 1; ++b) {
-      dT1.get(0, b) = -gauge_h_init->get(b) * d0_roll_on;
-      for (size_t a = 0; a < SpatialDim + 1; ++a) {
-        if (a != 0) {
-          dT1.get(a, b) = (1. - roll_on) * dgauge_h_init->get(a, b);
-        } else {
-          dT1.get(a, b) += (1. - roll_on) * dgauge_h_init->get(a, b);
+      for (size_t k = 0; k < SpatialDim; ++k) {
+        const double inverse_spatial_metric_jk =
+            inverse_spatial_metric.get(j, k)[s];
+        d_g_by_det[0] += inverse_spatial_metric_jk *
+                         d4_spacetime_metric.get(0, j + 1, k + 1)[s];
+        for (size_t i = 0; i < SpatialDim; ++i) {
+          gsl::at(d_g_by_det, i + 1) +=
+              inverse_spatial_metric_jk * phi.get(i, j + 1, k + 1)[s];
         }
       }
     }
-  }
 
-  // d_t lapse = lapse * (0.5 * n^a n^b (lapse Pi_{ab} - shift^i Phi_{iab}))
-  get<0>(d4_muS_over_lapse) = -get<0>(shift) * get<0>(half_phi_two_normals);
-  for (size_t i = 1; i < SpatialDim; ++i) {
-    get<0>(d4_muS_over_lapse) -= shift.get(i) * half_phi_two_normals.get(i);
-  }
-  get<0>(d4_muS_over_lapse) += get(lapse) * get(half_pi_two_normals);
-  get<0>(d4_muS_over_lapse) *= get(lapse);
-
-  // Calc \f$ \partial_a T2 \f$
-  get<0>(dT2) = -(get<0>(d4_mu1) + get<0>(d4_mu2)) * get(lapse)
-                // Note:  \f$ \partial_a n_b = {-\partial_a lapse, 0, 0, 0} \f$
-                - (get(mu1) + get(mu2)) * get<0>(d4_muS_over_lapse);
-
-  for (size_t i = 0; i < SpatialDim; ++i) {
-    dT2.get(i + 1) =
-        -(d4_mu1.get(i + 1) + d4_mu2.get(i + 1)) * get(lapse)
-        // Note:  \f$ \partial_a n_b = {-\partial_a lapse, 0, 0, 0} \f$
-        + (get(mu1) + get(mu2)) * get(lapse) * half_phi_two_normals.get(i);
-  }
+    // Prefactors of the derivatives of log(\sqrt{g}/N)^{1+e_{L1}},
+    // log(\sqrt{g}/N)^{e_S}, and log(1/N)^{1+e_{L2}}
+    const double prefac_log_L1 = static_cast<double>(exp_L1 + 1) * pow_L1;
+    const double prefac_log_S =
+        exp_S == 0 ? 0.0
+                   : static_cast<double>(exp_S) *
+                         integer_pow(log_fac_1, exp_S - 1);
+    const double prefac_log_L2 = static_cast<double>(exp_L2 + 1) * pow_L2;
 
-  // \f[ \partial_a (\mu_S/N) = (1/N) \partial_a \mu_{S}
-  //         - (\mu_{S}/N^2) \partial_a N
-  // \f]
-  //
-  // Note that the d4_lapse terms are actually
-  // d_t lapse / lapse = 0.5 * n^a n^b (lapse Pi_{ab} - shift^i Phi_{iab})
-  // d_i lapse / lapse = -0.5 * n^a n^b Phi_{iab}
-  //
-  // The GH RHS computes:
-  //  0.5 * n^a n^b Pi_{ab}
-  //  0.5 * n^a n^b Phi_{iab}
-  // so we reuse that work by taking them as arguments.
-  get<0>(d4_muS_over_lapse) *= -get(mu_S) * get(one_over_lapse);
-  get<0>(d4_muS_over_lapse) += get<0>(d4_mu_S);
-  get<0>(d4_muS_over_lapse) *= get(one_over_lapse);
-  for (size_t i = 0; i < SpatialDim; ++i) {
-    d4_muS_over_lapse.get(i + 1) =
-        get(one_over_lapse) *
-        (d4_mu_S.get(i + 1) + get(mu_S) * half_phi_two_normals.get(i));
-  }
-
-  // Calc \f$ \partial_a T3 \f$ (note minus sign)
-  for (size_t a = 0; a < SpatialDim + 1; ++a) {
-    for (size_t j = 0; j < SpatialDim; ++j) {
-      dT3.get(a, j + 1) = d4_spacetime_metric.get(a, 0, j + 1);
-    }
-    dT3.get(a, 0) = d4_spacetime_metric.get(a, 0, 1) * get<0>(shift);
-    for (size_t j = 1; j < SpatialDim; ++j) {
-      dT3.get(a, 0) += d4_spacetime_metric.get(a, 0, j + 1) * shift.get(j);
-    }
-    for (size_t i = 0; i < SpatialDim; ++i) {
-      for (size_t j = i + 1; j < SpatialDim; ++j) {
-        dT3.get(a, 0) -= shift.get(i) * shift.get(j) *
-                         d4_spacetime_metric.get(a, i + 1, j + 1);
+    for (size_t a = 0; a < SpatialDim + 1; ++a) {
+      // \f$ \partial_a [R W] \f$
+      const double d4_roll_on_weight =
+          a == 0 ? weight * d0_roll_on
+                 : -2.0 * roll_on_weight * one_over_sigma_r_squared *
+                       coords.get(a - 1)[s];
+      const double d4_log_fac_1 =
+          0.5 * gsl::at(d_g_by_det, a) - gsl::at(d_lapse_by_lapse, a);
+      const double d4_log_fac_2 = -gsl::at(d_lapse_by_lapse, a);
+
+      // \partial_a \mu_1 = \partial_a(A_L1 R W \log(\sqrt{g}/N)^{1+e_{L1}})
+      // \partial_a \mu_2 = \partial_a(A_L2 R W \log(1/N)^{1+e_{L2}})
+      // \partial_a \mu_{S} = \partial_a(A_S R W \log(\sqrt{g}/N)^{e_{S}})
+      const double d4_mu1 =
+          amp_coef_L1 * (pow_L1 * log_fac_1 * d4_roll_on_weight +
+                         roll_on_weight * prefac_log_L1 * d4_log_fac_1);
+      const double d4_mu2 =
+          amp_coef_L2 * (pow_L2 * log_fac_2 * d4_roll_on_weight +
+                         roll_on_weight * prefac_log_L2 * d4_log_fac_2);
+      const double d4_mu_S =
+          amp_coef_S * (pow_S * d4_roll_on_weight +
+                        roll_on_weight * prefac_log_S * d4_log_fac_1);
+
+      // \f$ \partial_a T2 \f$, using
+      // \f$ \partial_a n_b = {-\partial_a lapse, 0, 0, 0} \f$
+      const double dT2 =
+          -lapse_s *
+          (d4_mu1 + d4_mu2 + (mu1 + mu2) * gsl::at(d_lapse_by_lapse, a));
+
+      // \f[ \partial_a (\mu_S/N) = (1/N) \partial_a \mu_{S}
+      //         - (\mu_{S}/N^2) \partial_a N
+      // \f]
+      const double d4_mu_S_over_lapse =
+          one_over_lapse * (d4_mu_S - mu_S * gsl::at(d_lapse_by_lapse, a));
+
+      // \f$ \partial_a (g_{0i} N^i) = 2 N^i \partial_a \psi_{0i}
+      //     - N^i N^j \partial_a g_{ij} \f$
+      double d4_metric_dot_shift_dot_shift = 0.0;
+      for (size_t i = 0; i < SpatialDim; ++i) {
+        d4_metric_dot_shift_dot_shift +=
+            2.0 * gsl::at(shift_s, i) * d4_spacetime_metric.get(a, 0, i + 1)[s];
+        for (size_t j = 0; j < SpatialDim; ++j) {
+          d4_metric_dot_shift_dot_shift -= gsl::at(shift_s, i) *
+                                           gsl::at(shift_s, j) *
+                                           d4_spacetime_metric.get(
+                                               a, i + 1, j + 1)[s];
+        }
       }
-    }
-    dT3.get(a, 0) *= 2.0;
-    for (size_t i = 0; i < SpatialDim; ++i) {
-      dT3.get(a, 0) -= shift.get(i) * shift.get(i) *
-                       d4_spacetime_metric.get(a, i + 1, i + 1);
-    }
-
-    for (size_t b = 0; b < SpatialDim + 1; ++b) {
-      dT3.get(a, b) *= -get(mu_S_over_lapse);
-      dT3.get(a, b) -=
-          d4_muS_over_lapse.get(a) * spacetime_metric_dot_shift.get(b);
-    }
-  }
 
-  // Calc \f$ \partial_a H_b = dT1_{ab} + dT2_{ab} + dT3_{ab} \f$
-  for (size_t a = 0; a < SpatialDim + 1; ++a) {
-    for (size_t b = 0; b < SpatialDim + 1; ++b) {
+      // \f$ \partial_a H_b = dT1_{ab} + dT2_{ab} + dT3_{ab} \f$
+      d4_gauge_h->get(a, 0)[s] =
+          dT2 - mu_S_over_lapse * d4_metric_dot_shift_dot_shift -
+          d4_mu_S_over_lapse * spacetime_metric_dot_shift[0];
+      for (size_t j = 0; j < SpatialDim; ++j) {
+        d4_gauge_h->get(a, j + 1)[s] =
+            -mu_S_over_lapse * d4_spacetime_metric.get(a, 0, j + 1)[s] -
+            d4_mu_S_over_lapse * gsl::at(spacetime_metric_dot_shift, j + 1);
+      }
       if constexpr (UseRollon) {
-        d4_gauge_h->get(a, b) = dT1.get(a, b) + dT3.get(a, b);
-      } else {
-        d4_gauge_h->get(a, b) = dT3.get(a, b);
+        for (size_t b = 0; b < SpatialDim + 1; ++b) {
+          d4_gauge_h->get(a, b)[s] +=
+              (1. - roll_on) * dgauge_h_init->get(a, b)[s];
+        }
+        if (a == 0) {
+          for (size_t b = 0; b < SpatialDim + 1; ++b) {
+            d4_gauge_h->get(0, b)[s] -= gauge_h_init->get(b)[s] * d0_roll_on;
+          }
+        }
       }
     }
-    d4_gauge_h->get(a, 0) += dT2.get(a);
   }
 }
 }  // namespace
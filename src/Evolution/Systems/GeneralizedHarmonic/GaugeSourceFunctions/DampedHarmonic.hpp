@@ -157,6 +157,10 @@ namespace gauges {
  *                  +& A_S \mathrm{log}(\sqrt{g} / N)^{e_S} \partial_a [R(t)
  * W(x^i)].
  * \f}
+ *
+ * The roll-on function is evaluated once per call. Everything else, including
+ * the spatial weight function, is evaluated in a single pass over the grid
+ * points without temporary `DataVector`s.
  */
 template <size_t SpatialDim, typename Frame>
 void damped_harmonic_rollon(
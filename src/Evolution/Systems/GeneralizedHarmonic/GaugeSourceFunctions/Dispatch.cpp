@@ -33,18 +33,20 @@ void dispatch(
     const InverseJacobian<DataVector, Dim, Frame::ElementLogical,
                           Frame::Inertial>& inverse_jacobian,
     const GaugeCondition& gauge_condition) {
-  if (const auto* harmonic_gauge =
-          dynamic_cast<const Harmonic*>(&gauge_condition);
-      harmonic_gauge != nullptr) {
-    harmonic_gauge->gauge_and_spacetime_derivative(gauge_h, d4_gauge_h, time,
-                                                   inertial_coords);
-  } else if (const auto* damped_harmonic_gauge =
-                 dynamic_cast<const DampedHarmonic*>(&gauge_condition);
-             damped_harmonic_gauge != nullptr) {
+  // Damped harmonic gauge is checked first since it is used for binary black
+  // hole evolutions, where the cost of the gauge matters the most.
+  if (const auto* damped_harmonic_gauge =
+          dynamic_cast<const DampedHarmonic*>(&gauge_condition);
+      damped_harmonic_gauge != nullptr) {
     damped_harmonic_gauge->gauge_and_spacetime_derivative(
         gauge_h, d4_gauge_h, lapse, shift, sqrt_det_spatial_metric,
         inverse_spatial_metric, d4_spacetime_metric, half_pi_two_normals,
         half_phi_two_normals, spacetime_metric, phi, time, inertial_coords);
+  } else if (const auto* harmonic_gauge =
+                 dynamic_cast<const Harmonic*>(&gauge_condition);
+             harmonic_gauge != nullptr) {
+    harmonic_gauge->gauge_and_spacetime_derivative(gauge_h, d4_gauge_h, time,
+                                                   inertial_coords);
   } else if (const auto* analytic_gauge =
                  dynamic_cast<const AnalyticChristoffel*>(&gauge_condition);
              analytic_gauge != nullptr) {
@@ -8,6 +8,7 @@
 #include "Evolution/Systems/GeneralizedHarmonic/BoundaryCorrections/BoundaryCorrection.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/Characteristics.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/Equations.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/FusedTimeDerivative.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/TimeDerivative.hpp"
 #include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
 #include "Utilities/TMPL.hpp"
@@ -21,7 +22,13 @@ class DataVector;
  * \brief Items related to evolving the first-order generalized harmonic system.
  */
 namespace gh {
-template <size_t Dim>
+/*!
+ * \brief The first-order generalized harmonic system.
+ *
+ * \details The volume terms are evaluated with `TimeDerivativeTerms`, which
+ * is either `gh::TimeDerivative` or `gh::FusedTimeDerivative`.
+ */
+template <size_t Dim, typename TimeDerivativeTerms = TimeDerivative<Dim>>
 struct System {
   static constexpr bool is_in_flux_conservative_form = false;
   static constexpr bool has_primitive_and_conservative_vars = false;
@@ -40,7 +47,7 @@ struct System {
                  Tags::Pi<DataVector, Dim>, Tags::Phi<DataVector, Dim>>;
   using gradients_tags = gradient_variables;
 
-  using compute_volume_time_derivative_terms = TimeDerivative<Dim>;
+  using compute_volume_time_derivative_terms = TimeDerivativeTerms;
   using normal_dot_fluxes = ComputeNormalDotFluxes<Dim>;
 
   using compute_largest_characteristic_speed =
@@ -4,6 +4,7 @@
 #include "Evolution/Systems/GeneralizedHarmonic/TimeDerivative.hpp"
 
 #include <cstddef>
+#include <optional>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/EagerMath/RaiseOrLowerIndex.hpp"
@@ -11,6 +12,7 @@
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/ConstraintDamping/Tags.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/DuDtTempTags.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/DampedHarmonic.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/Dispatch.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/Gauges.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/Harmonic.hpp"
@@ -27,6 +29,26 @@
 #include "Utilities/Gsl.hpp"
 
 namespace gh {
+template <size_t Dim>
+bool TimeDerivative<Dim>::can_be_tiled(
+    const tnsr::aa<DataVector, Dim>& /*spacetime_metric*/,
+    const tnsr::aa<DataVector, Dim>& /*pi*/,
+    const tnsr::iaa<DataVector, Dim>& /*phi*/,
+    const Scalar<DataVector>& /*gamma0*/, const Scalar<DataVector>& /*gamma1*/,
+    const Scalar<DataVector>& /*gamma2*/,
+    const gauges::GaugeCondition& gauge_condition, const Mesh<Dim>& /*mesh*/,
+    const double /*time*/,
+    const tnsr::I<DataVector, Dim, Frame::Inertial>& /*inertial_coords*/,
+    const InverseJacobian<DataVector, Dim, Frame::ElementLogical,
+                          Frame::Inertial>& /*inverse_jacobian*/,
+    const std::optional<tnsr::I<DataVector, Dim, Frame::Inertial>>&
+    /*mesh_velocity*/) {
+  // The analytic gauge takes numerical derivatives over the whole element
+  return dynamic_cast<const gauges::Harmonic*>(&gauge_condition) != nullptr or
+         dynamic_cast<const gauges::DampedHarmonic*>(&gauge_condition) !=
+             nullptr;
+}
+
 template <size_t Dim>
 void TimeDerivative<Dim>::apply(
     const gsl::not_null<tnsr::aa<DataVector, Dim>*> dt_spacetime_metric,
@@ -140,6 +140,27 @@ struct TimeDerivative {
                                                Frame::Inertial>,
                  domain::Tags::MeshVelocity<Dim, Frame::Inertial>>;
 
+  /// The number of grid points on which the DG volume terms evaluate the
+  /// time derivative at a time, see `evolution::dg::apply_on_tiles`. The
+  /// temporaries of this many points fit in the L2 cache, while those of a
+  /// whole element with 10^3 grid points don't.
+  static constexpr size_t volume_tile_size = 128;
+
+  /// Whether the time derivative may be evaluated on a subset of the grid
+  /// points, which is the case unless the gauge condition takes derivatives.
+  static bool can_be_tiled(
+      const tnsr::aa<DataVector, Dim>& spacetime_metric,
+      const tnsr::aa<DataVector, Dim>& pi,
+      const tnsr::iaa<DataVector, Dim>& phi, const Scalar<DataVector>& gamma0,
+      const Scalar<DataVector>& gamma1, const Scalar<DataVector>& gamma2,
+      const gauges::GaugeCondition& gauge_condition, const Mesh<Dim>& mesh,
+      double time,
+      const tnsr::I<DataVector, Dim, Frame::Inertial>& inertial_coords,
+      const InverseJacobian<DataVector, Dim, Frame::ElementLogical,
+                            Frame::Inertial>& inverse_jacobian,
+      const std::optional<tnsr::I<DataVector, Dim, Frame::Inertial>>&
+          mesh_velocity);
+
   static void apply(
       gsl::not_null<tnsr::aa<DataVector, Dim>*> dt_spacetime_metric,
       gsl::not_null<tnsr::aa<DataVector, Dim>*> dt_pi,
@@ -6,16 +6,18 @@
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "DataStructures/DataBox/Prefixes.hpp"
 #include "Evolution/DiscontinuousGalerkin/Actions/VolumeTermsImpl.tpp"
+#include "Evolution/Systems/GeneralizedHarmonic/FusedTimeDerivative.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/System.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/TimeDerivative.hpp"
 #include "NumericalAlgorithms/LinearOperators/PartialDerivatives.tpp"
 #include "Utilities/GenerateInstantiations.hpp"
 
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+#define TIME_DERIVATIVE(data) BOOST_PP_TUPLE_ELEM(1, data)
 
 #define INSTANTIATION(r, data)                                                 \
   template void evolution::dg::Actions::detail::volume_terms<                  \
-      ::gh::TimeDerivative<DIM(data)>>(                                        \
+      ::gh::TIME_DERIVATIVE(data)<DIM(data)>>(                                 \
       const gsl::not_null<Variables<db::wrap_tags_in<                          \
           ::Tags::dt,                                                          \
           typename ::gh::System<DIM(data)>::variables_tag::tags_list>>*>       \
@@ -28,8 +30,8 @@
           ::Tags::deriv, typename ::gh::System<DIM(data)>::gradient_variables, \
           tmpl::size_t<DIM(data)>, Frame::Inertial>>*>                         \
           partial_derivs,                                                      \
-      const gsl::not_null<Variables<typename ::gh::System<DIM(                 \
-          data)>::compute_volume_time_derivative_terms::temporary_tags>*>      \
+      const gsl::not_null<Variables<                                           \
+          typename ::gh::TIME_DERIVATIVE(data)<DIM(data)>::temporary_tags>*>   \
           temporaries,                                                         \
       const gsl::not_null<Variables<db::wrap_tags_in<                          \
           ::Tags::div,                                                         \
@@ -60,11 +62,19 @@
       const InverseJacobian<DataVector, DIM(data), Frame::ElementLogical,      \
                             Frame::Inertial>& inverse_jacobian,                \
       const std::optional<tnsr::I<DataVector, DIM(data), Frame::Inertial>>&    \
-          mesh_velocity_from_time_deriv_args);                                 \
-  INSTANTIATE_PARTIAL_DERIVATIVES_WITH_SYSTEM(gh::System<DIM(data)>,           \
+          mesh_velocity_from_time_deriv_args);
+
+GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3),
+                        (TimeDerivative, FusedTimeDerivative))
+
+#undef INSTANTIATION
+
+#define INSTANTIATION(r, data)                                       \
+  INSTANTIATE_PARTIAL_DERIVATIVES_WITH_SYSTEM(gh::System<DIM(data)>, \
                                               DIM(data), Frame::Inertial)
 
 GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
 
 #undef INSTANTIATION
+#undef TIME_DERIVATIVE
 #undef DIM
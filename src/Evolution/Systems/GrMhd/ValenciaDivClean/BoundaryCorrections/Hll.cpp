@@ -3,24 +3,23 @@
 
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/BoundaryCorrections/Hll.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <cstddef>
 #include <pup.h>
 
 #include <memory>
 #include <optional>
 
 #include "DataStructures/DataVector.hpp"
-#include "DataStructures/Tags/TempTensor.hpp"
-#include "DataStructures/Tensor/EagerMath/DotProduct.hpp"
-#include "DataStructures/Tensor/EagerMath/Magnitude.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/BoundaryCorrections/PointwiseKernels.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Formulation.hpp"
-#include "NumericalAlgorithms/DiscontinuousGalerkin/NormalDotFlux.hpp"
-#include "PointwiseFunctions/Hydro/SoundSpeedSquared.hpp"
-#include "PointwiseFunctions/Hydro/SpecificEnthalpy.hpp"
 #include "Utilities/ErrorHandling/CaptureForError.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Simd/Simd.hpp"
+#include "Utilities/TMPL.hpp"
 
 namespace grmhd::ValenciaDivClean::BoundaryCorrections {
 Hll::Hll(const double magnetic_field_magnitude_for_hydro,
@@ -90,126 +89,146 @@ double Hll::dg_package_data(
     /*mesh_velocity*/,
     const std::optional<Scalar<DataVector>>& normal_dot_mesh_velocity,
     const EquationsOfState::EquationOfState<true, 3>& equation_of_state) const {
-  {
-    Scalar<DataVector> shift_dot_normal = tilde_d;
-    dot_product(make_not_null(&shift_dot_normal), shift, normal_covector);
-
-    // Initialize characteristic speeds to light speed
-    // (default choice)
-    get(*packaged_largest_outgoing_char_speed) =
-        get(lapse) - get(shift_dot_normal);
-    get(*packaged_largest_ingoing_char_speed) =
-        -get(lapse) - get(shift_dot_normal);
-
-    if (const bool has_b_field =
-            max(get(magnitude(tilde_b))) > magnetic_field_magnitude_for_hydro_;
-        not has_b_field and
-        (max(get(rest_mass_density)) > light_speed_density_cutoff_)) {
-      // Since we have no magnetic field (and we have grid points not in the
-      // atmosphere), we can reduce the char speeds to the hydro speeds only.
-      // This makes the scheme less dissipative.
-      //
-      // Calculate sound speed squared
-      const size_t num_points = get(rest_mass_density).size();
-      Variables<tmpl::list<::Tags::TempScalar<0>, ::Tags::TempScalar<1>,
-                           ::Tags::TempScalar<2>, ::Tags::TempScalar<3>,
-                           ::Tags::TempScalar<4>, ::Tags::TempScalar<5>,
-                           ::Tags::TempScalar<6>>>
-          temp_buffer{num_points};
-      auto& v_dot_normal = get<::Tags::TempScalar<0>>(temp_buffer);
-      auto& v_squared = get<::Tags::TempScalar<1>>(temp_buffer);
-      auto& discriminant = get(get<::Tags::TempScalar<2>>(temp_buffer));
-      auto& one_minus_v2_cs2 = get<::Tags::TempScalar<3>>(temp_buffer);
-      auto& one_minus_cs2 = get<::Tags::TempScalar<4>>(temp_buffer);
-      auto& lapse_over_one_minus_v2_cs2 =
-          get<::Tags::TempScalar<5>>(temp_buffer);
-      auto& v_dot_normal_times_one_minus_cs2 =
-          get<::Tags::TempScalar<6>>(temp_buffer);
-
-      const Scalar<DataVector> specific_internal_energy =
-          equation_of_state
-              .specific_internal_energy_from_density_and_temperature(
-                  rest_mass_density, temperature, electron_fraction);
-      const Scalar<DataVector> pressure =
-          equation_of_state.pressure_from_density_and_energy(
-              rest_mass_density, specific_internal_energy, electron_fraction);
-      const Scalar<DataVector> specific_enthalpy =
-          hydro::relativistic_specific_enthalpy(
-              rest_mass_density, specific_internal_energy, pressure);
-      const Scalar<DataVector> sound_speed_squared{
-          clamp(get(equation_of_state
-                        .sound_speed_squared_from_density_and_temperature(
-                            rest_mass_density, temperature, electron_fraction)),
-                0.0, 1.0)};
-
-      // Compute v_dot_normal, v^i n_i
-      dot_product(make_not_null(&v_dot_normal), spatial_velocity,
-                  normal_covector);
-
-      // Compute v^2=v^i v_i
-      dot_product(make_not_null(&v_squared), spatial_velocity,
-                  spatial_velocity_one_form);
-      get(v_squared) = clamp(get(v_squared), 0.0, 1.0 - 1.0e-8);
-
-      // Calculate characteristic speeds in inertial frame
-      //
-      // Ideally we'd use the Lorentz factor instead of 1-v^2, but I (Nils
-      // Deppe) don't have the bandwidth to change this right now.
-      get(one_minus_v2_cs2) = 1.0 - get(v_squared) * get(sound_speed_squared);
-      get(one_minus_cs2) = 1.0 - get(sound_speed_squared);
-      discriminant =
-          get(sound_speed_squared) * (1.0 - get(v_squared)) *
-          (get(one_minus_v2_cs2) -
-           get(v_dot_normal) * get(v_dot_normal) * get(one_minus_cs2));
-      discriminant = max(discriminant, 0.0);
-      discriminant = sqrt(discriminant);
-
-      get(lapse_over_one_minus_v2_cs2) = get(lapse) / get(one_minus_v2_cs2);
-      get(v_dot_normal_times_one_minus_cs2) =
-          get(v_dot_normal) * get(one_minus_cs2);
-
-      for (size_t i = 0; i < num_points; ++i) {
-        if (get(rest_mass_density)[i] > light_speed_density_cutoff_) {
-          get(*packaged_largest_outgoing_char_speed)[i] =
-              get(lapse_over_one_minus_v2_cs2)[i] *
-                  (get(v_dot_normal_times_one_minus_cs2)[i] + discriminant[i]) -
-              get(shift_dot_normal)[i];
-          get(*packaged_largest_ingoing_char_speed)[i] =
-              get(lapse_over_one_minus_v2_cs2)[i] *
-                  (get(v_dot_normal_times_one_minus_cs2)[i] - discriminant[i]) -
-              get(shift_dot_normal)[i];
-        }
-      }
-    }
-
-    // Correct for mesh velocity
-    if (normal_dot_mesh_velocity.has_value()) {
-      get(*packaged_largest_outgoing_char_speed) -=
-          get(*normal_dot_mesh_velocity);
-      get(*packaged_largest_ingoing_char_speed) -=
-          get(*normal_dot_mesh_velocity);
-    }
+  const size_t num_points = get(tilde_d).size();
+  const double* const normal_dot_mesh_velocity_data =
+      normal_dot_mesh_velocity.has_value()
+          ? get(*normal_dot_mesh_velocity).data()
+          : nullptr;
+
+  // Find the largest magnitude of the magnetic field without computing the
+  // magnitude at all points
+  double max_tilde_b_squared = 0.0;
+  for (size_t i = 0; i < num_points; ++i) {
+    max_tilde_b_squared =
+        std::max(max_tilde_b_squared,
+                 get<0>(tilde_b)[i] * get<0>(tilde_b)[i] +
+                     get<1>(tilde_b)[i] * get<1>(tilde_b)[i] +
+                     get<2>(tilde_b)[i] * get<2>(tilde_b)[i]);
   }
+  const bool has_b_field =
+      std::sqrt(max_tilde_b_squared) > magnetic_field_magnitude_for_hydro_;
+  const bool use_hydro_speeds =
+      not has_b_field and
+      (max(get(rest_mass_density)) > light_speed_density_cutoff_);
+
+  // Since we have no magnetic field (and we have grid points not in the
+  // atmosphere), we can reduce the char speeds to the hydro speeds only. This
+  // makes the scheme less dissipative. The sound speed is the only quantity
+  // that needs the equation of state, whose interface is DataVector-based, so
+  // it is the only temporary computed for all points at once.
+  const std::optional<Scalar<DataVector>> sound_speed_squared =
+      use_hydro_speeds
+          ? std::optional{equation_of_state
+                              .sound_speed_squared_from_density_and_temperature(
+                                  rest_mass_density, temperature,
+                                  electron_fraction)}
+          : std::nullopt;
+
+  // Copy the conserved variables, compute the normal fluxes and the
+  // characteristic speeds in a single pass over the face points. The speeds
+  // are the light speeds (default choice) unless the hydro speeds are used
+  // and the point is above the light speed density cutoff.
+  const auto packaged_vars = detail::conserved_component_data(
+      *packaged_tilde_d, *packaged_tilde_ye, *packaged_tilde_tau,
+      *packaged_tilde_s, *packaged_tilde_b, *packaged_tilde_phi);
+  const auto packaged_normal_dot_fluxes = detail::conserved_component_data(
+      *packaged_normal_dot_flux_tilde_d, *packaged_normal_dot_flux_tilde_ye,
+      *packaged_normal_dot_flux_tilde_tau, *packaged_normal_dot_flux_tilde_s,
+      *packaged_normal_dot_flux_tilde_b, *packaged_normal_dot_flux_tilde_phi);
+  const auto vars = detail::conserved_component_data(
+      tilde_d, tilde_ye, tilde_tau, tilde_s, tilde_b, tilde_phi);
+  const auto fluxes = detail::flux_component_data(
+      flux_tilde_d, flux_tilde_ye, flux_tilde_tau, flux_tilde_s, flux_tilde_b,
+      flux_tilde_phi);
+  double* const outgoing_char_speed_data =
+      get(*packaged_largest_outgoing_char_speed).data();
+  double* const ingoing_char_speed_data =
+      get(*packaged_largest_ingoing_char_speed).data();
+  detail::for_each_face_point(
+      num_points, [&](const size_t grid_index, auto use_simd) {
+        using UseSimd = decltype(use_simd);
+        using SimdType = detail::SimdType<UseSimd>;
+        using detail::load;
+        detail::package_conserved_and_normal_fluxes<UseSimd>(
+            grid_index, packaged_vars, packaged_normal_dot_fluxes, vars,
+            fluxes, normal_covector);
+
+        const SimdType shift_dot_normal =
+            load<UseSimd>(get<0>(shift).data(), grid_index) *
+                load<UseSimd>(get<0>(normal_covector).data(), grid_index) +
+            load<UseSimd>(get<1>(shift).data(), grid_index) *
+                load<UseSimd>(get<1>(normal_covector).data(), grid_index) +
+            load<UseSimd>(get<2>(shift).data(), grid_index) *
+                load<UseSimd>(get<2>(normal_covector).data(), grid_index);
+        const SimdType lapse_at_point =
+            load<UseSimd>(get(lapse).data(), grid_index);
+        SimdType outgoing_char_speed = lapse_at_point - shift_dot_normal;
+        SimdType ingoing_char_speed = -lapse_at_point - shift_dot_normal;
+
+        if (sound_speed_squared.has_value()) {
+          const auto above_cutoff =
+              load<UseSimd>(get(rest_mass_density).data(), grid_index) >
+              SimdType{light_speed_density_cutoff_};
+          if (simd::any(above_cutoff)) {
+            const SimdType cs2 = simd::clip(
+                load<UseSimd>(get(*sound_speed_squared).data(), grid_index),
+                SimdType{0.0}, SimdType{1.0});
+            SimdType v_dot_normal{0.0};
+            SimdType v_squared{0.0};
+            for (size_t i = 0; i < 3; ++i) {
+              const SimdType v = load<UseSimd>(
+                  spatial_velocity.get(i).data(), grid_index);
+              v_dot_normal +=
+                  v * load<UseSimd>(normal_covector.get(i).data(), grid_index);
+              v_squared += v * load<UseSimd>(
+                                   spatial_velocity_one_form.get(i).data(),
+                                   grid_index);
+            }
+            v_squared =
+                simd::clip(v_squared, SimdType{0.0}, SimdType{1.0 - 1.0e-8});
+
+            // Ideally we'd use the Lorentz factor instead of 1-v^2, but I
+            // (Nils Deppe) don't have the bandwidth to change this right now.
+            const SimdType one_minus_v2_cs2 = 1.0 - v_squared * cs2;
+            const SimdType one_minus_cs2 = 1.0 - cs2;
+            const SimdType discriminant = simd::sqrt(simd::max(
+                SimdType{0.0}, cs2 * (1.0 - v_squared) *
+                                   (one_minus_v2_cs2 - v_dot_normal *
+                                                           v_dot_normal *
+                                                           one_minus_cs2)));
+            const SimdType lapse_over_one_minus_v2_cs2 =
+                lapse_at_point / one_minus_v2_cs2;
+            const SimdType v_dot_normal_times_one_minus_cs2 =
+                v_dot_normal * one_minus_cs2;
+            outgoing_char_speed = simd::select(
+                above_cutoff,
+                SimdType{lapse_over_one_minus_v2_cs2 *
+                             (v_dot_normal_times_one_minus_cs2 +
+                              discriminant) -
+                         shift_dot_normal},
+                outgoing_char_speed);
+            ingoing_char_speed = simd::select(
+                above_cutoff,
+                SimdType{lapse_over_one_minus_v2_cs2 *
+                             (v_dot_normal_times_one_minus_cs2 -
+                              discriminant) -
+                         shift_dot_normal},
+                ingoing_char_speed);
+          }
+        }
 
-  *packaged_tilde_d = tilde_d;
-  *packaged_tilde_ye = tilde_ye;
-  *packaged_tilde_tau = tilde_tau;
-  *packaged_tilde_s = tilde_s;
-  *packaged_tilde_b = tilde_b;
-  *packaged_tilde_phi = tilde_phi;
-
-  normal_dot_flux(packaged_normal_dot_flux_tilde_d, normal_covector,
-                  flux_tilde_d);
-  normal_dot_flux(packaged_normal_dot_flux_tilde_ye, normal_covector,
-                  flux_tilde_ye);
-  normal_dot_flux(packaged_normal_dot_flux_tilde_tau, normal_covector,
-                  flux_tilde_tau);
-  normal_dot_flux(packaged_normal_dot_flux_tilde_s, normal_covector,
-                  flux_tilde_s);
-  normal_dot_flux(packaged_normal_dot_flux_tilde_b, normal_covector,
-                  flux_tilde_b);
-  normal_dot_flux(packaged_normal_dot_flux_tilde_phi, normal_covector,
-                  flux_tilde_phi);
+        // Correct for mesh velocity
+        if (normal_dot_mesh_velocity_data != nullptr) {
+          const SimdType mesh_speed =
+              load<UseSimd>(normal_dot_mesh_velocity_data, grid_index);
+          outgoing_char_speed -= mesh_speed;
+          ingoing_char_speed -= mesh_speed;
+        }
+        detail::store<UseSimd>(outgoing_char_speed_data, grid_index,
+                               outgoing_char_speed);
+        detail::store<UseSimd>(ingoing_char_speed_data, grid_index,
+                               ingoing_char_speed);
+      });
 
   using std::max;
   return max(max(abs(get(*packaged_largest_outgoing_char_speed))),
@@ -254,98 +273,74 @@ void Hll::dg_boundary_terms(
     const Scalar<DataVector>& largest_outgoing_char_speed_ext,
     const Scalar<DataVector>& largest_ingoing_char_speed_ext,
     const dg::Formulation dg_formulation) {
-  // Allocate a temp buffer with four tags.
-  Variables<tmpl::list<::Tags::TempScalar<0>, ::Tags::TempScalar<1>,
-                       ::Tags::TempScalar<2>, ::Tags::TempScalar<3>>>
-      temps{get(tilde_d_int).size()};
-
-  // Determine lambda_max and lambda_min from the characteristic speeds info
-  // from interior and exterior
-  get(get<::Tags::TempScalar<0>>(temps)) =
-      max(0., get(largest_outgoing_char_speed_int),
-          -get(largest_ingoing_char_speed_ext));
-  const DataVector& lambda_max = get(get<::Tags::TempScalar<0>>(temps));
-  get(get<::Tags::TempScalar<1>>(temps)) =
-      min(0., get(largest_ingoing_char_speed_int),
-          -get(largest_outgoing_char_speed_ext));
-  const DataVector& lambda_min = get(get<::Tags::TempScalar<1>>(temps));
-
-  // Pre-compute two expressions made out of lambda_max and lambda_min
-  get(get<::Tags::TempScalar<2>>(temps)) = lambda_max * lambda_min;
-  const DataVector& lambdas_product = get(get<::Tags::TempScalar<2>>(temps));
-  get(get<::Tags::TempScalar<3>>(temps)) = 1. / (lambda_max - lambda_min);
-  const DataVector& one_over_lambda_max_minus_min =
-      get(get<::Tags::TempScalar<3>>(temps));
-
-  if (dg_formulation == dg::Formulation::WeakInertial) {
-    get(*boundary_correction_tilde_d) =
-        ((lambda_max * get(normal_dot_flux_tilde_d_int) +
-          lambda_min * get(normal_dot_flux_tilde_d_ext)) +
-         lambdas_product * (get(tilde_d_ext) - get(tilde_d_int))) *
-        one_over_lambda_max_minus_min;
-    get(*boundary_correction_tilde_ye) =
-        ((lambda_max * get(normal_dot_flux_tilde_ye_int) +
-          lambda_min * get(normal_dot_flux_tilde_ye_ext)) +
-         lambdas_product * (get(tilde_ye_ext) - get(tilde_ye_int))) *
-        one_over_lambda_max_minus_min;
-    get(*boundary_correction_tilde_tau) =
-        ((lambda_max * get(normal_dot_flux_tilde_tau_int) +
-          lambda_min * get(normal_dot_flux_tilde_tau_ext)) +
-         lambdas_product * (get(tilde_tau_ext) - get(tilde_tau_int))) *
-        one_over_lambda_max_minus_min;
-    get(*boundary_correction_tilde_phi) =
-        ((lambda_max * get(normal_dot_flux_tilde_phi_int) +
-          lambda_min * get(normal_dot_flux_tilde_phi_ext)) +
-         lambdas_product * (get(tilde_phi_ext) - get(tilde_phi_int))) *
-        one_over_lambda_max_minus_min;
-
-    for (size_t i = 0; i < 3; ++i) {
-      boundary_correction_tilde_s->get(i) =
-          ((lambda_max * normal_dot_flux_tilde_s_int.get(i) +
-            lambda_min * normal_dot_flux_tilde_s_ext.get(i)) +
-           lambdas_product * (tilde_s_ext.get(i) - tilde_s_int.get(i))) *
-          one_over_lambda_max_minus_min;
-      boundary_correction_tilde_b->get(i) =
-          ((lambda_max * normal_dot_flux_tilde_b_int.get(i) +
-            lambda_min * normal_dot_flux_tilde_b_ext.get(i)) +
-           lambdas_product * (tilde_b_ext.get(i) - tilde_b_int.get(i))) *
-          one_over_lambda_max_minus_min;
-    }
-  } else {
-    get(*boundary_correction_tilde_d) =
-        (lambda_min * (get(normal_dot_flux_tilde_d_int) +
-                       get(normal_dot_flux_tilde_d_ext)) +
-         lambdas_product * (get(tilde_d_ext) - get(tilde_d_int))) *
-        one_over_lambda_max_minus_min;
-    get(*boundary_correction_tilde_ye) =
-        (lambda_min * (get(normal_dot_flux_tilde_ye_int) +
-                       get(normal_dot_flux_tilde_ye_ext)) +
-         lambdas_product * (get(tilde_ye_ext) - get(tilde_ye_int))) *
-        one_over_lambda_max_minus_min;
-    get(*boundary_correction_tilde_tau) =
-        (lambda_min * (get(normal_dot_flux_tilde_tau_int) +
-                       get(normal_dot_flux_tilde_tau_ext)) +
-         lambdas_product * (get(tilde_tau_ext) - get(tilde_tau_int))) *
-        one_over_lambda_max_minus_min;
-    get(*boundary_correction_tilde_phi) =
-        (lambda_min * (get(normal_dot_flux_tilde_phi_int) +
-                       get(normal_dot_flux_tilde_phi_ext)) +
-         lambdas_product * (get(tilde_phi_ext) - get(tilde_phi_int))) *
-        one_over_lambda_max_minus_min;
-
-    for (size_t i = 0; i < 3; ++i) {
-      boundary_correction_tilde_s->get(i) =
-          (lambda_min * (normal_dot_flux_tilde_s_int.get(i) +
-                         normal_dot_flux_tilde_s_ext.get(i)) +
-           lambdas_product * (tilde_s_ext.get(i) - tilde_s_int.get(i))) *
-          one_over_lambda_max_minus_min;
-      boundary_correction_tilde_b->get(i) =
-          (lambda_min * (normal_dot_flux_tilde_b_int.get(i) +
-                         normal_dot_flux_tilde_b_ext.get(i)) +
-           lambdas_product * (tilde_b_ext.get(i) - tilde_b_int.get(i))) *
-          one_over_lambda_max_minus_min;
-    }
-  }
+  const auto corrections = detail::conserved_component_data(
+      *boundary_correction_tilde_d, *boundary_correction_tilde_ye,
+      *boundary_correction_tilde_tau, *boundary_correction_tilde_s,
+      *boundary_correction_tilde_b, *boundary_correction_tilde_phi);
+  const auto vars_int = detail::conserved_component_data(
+      tilde_d_int, tilde_ye_int, tilde_tau_int, tilde_s_int, tilde_b_int,
+      tilde_phi_int);
+  const auto vars_ext = detail::conserved_component_data(
+      tilde_d_ext, tilde_ye_ext, tilde_tau_ext, tilde_s_ext, tilde_b_ext,
+      tilde_phi_ext);
+  const auto normal_dot_fluxes_int = detail::conserved_component_data(
+      normal_dot_flux_tilde_d_int, normal_dot_flux_tilde_ye_int,
+      normal_dot_flux_tilde_tau_int, normal_dot_flux_tilde_s_int,
+      normal_dot_flux_tilde_b_int, normal_dot_flux_tilde_phi_int);
+  const auto normal_dot_fluxes_ext = detail::conserved_component_data(
+      normal_dot_flux_tilde_d_ext, normal_dot_flux_tilde_ye_ext,
+      normal_dot_flux_tilde_tau_ext, normal_dot_flux_tilde_s_ext,
+      normal_dot_flux_tilde_b_ext, normal_dot_flux_tilde_phi_ext);
+  const double* const outgoing_char_speed_int =
+      get(largest_outgoing_char_speed_int).data();
+  const double* const ingoing_char_speed_int =
+      get(largest_ingoing_char_speed_int).data();
+  const double* const outgoing_char_speed_ext =
+      get(largest_outgoing_char_speed_ext).data();
+  const double* const ingoing_char_speed_ext =
+      get(largest_ingoing_char_speed_ext).data();
+  const bool weak_form = dg_formulation == dg::Formulation::WeakInertial;
+
+  detail::for_each_face_point(
+      get(tilde_d_int).size(), [&](const size_t grid_index, auto use_simd) {
+        using UseSimd = decltype(use_simd);
+        using SimdType = detail::SimdType<UseSimd>;
+        using detail::load;
+        // Determine lambda_max and lambda_min from the characteristic speeds
+        // info from interior and exterior
+        const SimdType lambda_max = simd::max(
+            SimdType{0.},
+            simd::max(load<UseSimd>(outgoing_char_speed_int, grid_index),
+                      -load<UseSimd>(ingoing_char_speed_ext, grid_index)));
+        const SimdType lambda_min = simd::min(
+            SimdType{0.},
+            simd::min(load<UseSimd>(ingoing_char_speed_int, grid_index),
+                      -load<UseSimd>(outgoing_char_speed_ext, grid_index)));
+        // Pre-compute two expressions made out of lambda_max and lambda_min
+        const SimdType lambdas_product = lambda_max * lambda_min;
+        const SimdType one_over_lambda_max_minus_min =
+            1. / (lambda_max - lambda_min);
+
+        for (size_t c = 0; c < detail::number_of_conserved_components; ++c) {
+          const SimdType normal_dot_flux_int =
+              load<UseSimd>(gsl::at(normal_dot_fluxes_int, c), grid_index);
+          const SimdType normal_dot_flux_ext =
+              load<UseSimd>(gsl::at(normal_dot_fluxes_ext, c), grid_index);
+          const SimdType var_difference =
+              load<UseSimd>(gsl::at(vars_ext, c), grid_index) -
+              load<UseSimd>(gsl::at(vars_int, c), grid_index);
+          detail::store<UseSimd>(
+              gsl::at(corrections, c), grid_index,
+              weak_form ? SimdType{((lambda_max * normal_dot_flux_int +
+                                     lambda_min * normal_dot_flux_ext) +
+                                    lambdas_product * var_difference) *
+                                   one_over_lambda_max_minus_min}
+                        : SimdType{(lambda_min * (normal_dot_flux_int +
+                                                  normal_dot_flux_ext) +
+                                    lambdas_product * var_difference) *
+                                   one_over_lambda_max_minus_min});
+        }
+      });
 }
 
 bool operator==(const Hll& lhs, const Hll& rhs) {
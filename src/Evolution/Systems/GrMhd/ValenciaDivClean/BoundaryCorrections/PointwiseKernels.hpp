@@ -0,0 +1,137 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Utilities/ForceInline.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Simd/Simd.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+namespace grmhd::ValenciaDivClean::BoundaryCorrections::detail {
+// Helpers for evaluating the Riemann solvers one face point (or one SIMD
+// batch of face points) at a time. The conserved variables are handled as
+// the 10 independent components TildeD, TildeYe, TildeTau, TildeS, TildeB,
+// TildePhi, so the packaged data and the boundary correction of a point are
+// computed in a single pass without any temporary DataVectors. The same
+// kernels are used for the DG mortars and the FD subcell face fluxes since
+// both call `dg_package_data` and `dg_boundary_terms`.
+constexpr size_t number_of_conserved_components = 10;
+
+template <typename UseSimd>
+using SimdType =
+    tmpl::conditional_t<UseSimd::value, simd::batch<double>, double>;
+
+template <typename UseSimd>
+SPECTRE_ALWAYS_INLINE SimdType<UseSimd> load(const double* const data,
+                                             const size_t grid_index) {
+  if constexpr (UseSimd::value) {
+    return simd::load_unaligned(data + grid_index);
+  } else {
+    return data[grid_index];
+  }
+}
+
+template <typename UseSimd>
+SPECTRE_ALWAYS_INLINE void store(double* const data, const size_t grid_index,
+                                 const SimdType<UseSimd>& value) {
+  if constexpr (UseSimd::value) {
+    simd::store_unaligned(data + grid_index, value);
+  } else {
+    data[grid_index] = value;
+  }
+}
+
+// Calls `f(grid_index, std::true_type{})` for each full SIMD batch of points
+// and `f(grid_index, std::false_type{})` for the remaining points.
+template <typename F>
+void for_each_face_point(const size_t number_of_points, const F& f) {
+  size_t grid_index = 0;
+#ifdef SPECTRE_USE_XSIMD
+  constexpr size_t simd_width = simd::size<simd::batch<double>>();
+  for (; grid_index + simd_width <= number_of_points;
+       grid_index += simd_width) {
+    f(grid_index, std::true_type{});
+  }
+#endif
+  for (; grid_index < number_of_points; ++grid_index) {
+    f(grid_index, std::false_type{});
+  }
+}
+
+// The data of the independent components of the conserved variables (or of
+// their normal fluxes or boundary corrections), in the order of the variables
+// in the system.
+template <typename ScalarType, typename CovectorType, typename VectorType>
+auto conserved_component_data(ScalarType& tilde_d, ScalarType& tilde_ye,
+                              ScalarType& tilde_tau, CovectorType& tilde_s,
+                              VectorType& tilde_b, ScalarType& tilde_phi) {
+  return std::array{get(tilde_d).data(),   get(tilde_ye).data(),
+                    get(tilde_tau).data(), tilde_s.get(0).data(),
+                    tilde_s.get(1).data(), tilde_s.get(2).data(),
+                    tilde_b.get(0).data(), tilde_b.get(1).data(),
+                    tilde_b.get(2).data(), get(tilde_phi).data()};
+}
+
+// The data of the flux components F^i of each independent component of the
+// conserved variables.
+inline std::array<std::array<const double*, 3>, number_of_conserved_components>
+flux_component_data(
+    const tnsr::I<DataVector, 3, Frame::Inertial>& flux_tilde_d,
+    const tnsr::I<DataVector, 3, Frame::Inertial>& flux_tilde_ye,
+    const tnsr::I<DataVector, 3, Frame::Inertial>& flux_tilde_tau,
+    const tnsr::Ij<DataVector, 3, Frame::Inertial>& flux_tilde_s,
+    const tnsr::IJ<DataVector, 3, Frame::Inertial>& flux_tilde_b,
+    const tnsr::I<DataVector, 3, Frame::Inertial>& flux_tilde_phi) {
+  std::array<std::array<const double*, 3>, number_of_conserved_components>
+      result{};
+  for (size_t i = 0; i < 3; ++i) {
+    gsl::at(result[0], i) = flux_tilde_d.get(i).data();
+    gsl::at(result[1], i) = flux_tilde_ye.get(i).data();
+    gsl::at(result[2], i) = flux_tilde_tau.get(i).data();
+    for (size_t j = 0; j < 3; ++j) {
+      gsl::at(gsl::at(result, 3 + j), i) = flux_tilde_s.get(i, j).data();
+      gsl::at(gsl::at(result, 6 + j), i) = flux_tilde_b.get(i, j).data();
+    }
+    gsl::at(result[9], i) = flux_tilde_phi.get(i).data();
+  }
+  return result;
+}
+
+// Copies the conserved variables into the packaged data and computes their
+// normal fluxes n_i F^i at one point or SIMD batch.
+template <typename UseSimd>
+SPECTRE_ALWAYS_INLINE void package_conserved_and_normal_fluxes(
+    const size_t grid_index,
+    const std::array<double*, number_of_conserved_components>& packaged_vars,
+    const std::array<double*, number_of_conserved_components>&
+        packaged_normal_dot_fluxes,
+    const std::array<const double*, number_of_conserved_components>& vars,
+    const std::array<std::array<const double*, 3>,
+                     number_of_conserved_components>& fluxes,
+    const tnsr::i<DataVector, 3, Frame::Inertial>& normal_covector) {
+  const auto normal_x = load<UseSimd>(get<0>(normal_covector).data(),
+                                      grid_index);
+  const auto normal_y = load<UseSimd>(get<1>(normal_covector).data(),
+                                      grid_index);
+  const auto normal_z = load<UseSimd>(get<2>(normal_covector).data(),
+                                      grid_index);
+  for (size_t c = 0; c < number_of_conserved_components; ++c) {
+    store<UseSimd>(gsl::at(packaged_vars, c), grid_index,
+                   load<UseSimd>(gsl::at(vars, c), grid_index));
+    const auto& flux = gsl::at(fluxes, c);
+    store<UseSimd>(gsl::at(packaged_normal_dot_fluxes, c), grid_index,
+                   normal_x * load<UseSimd>(flux[0], grid_index) +
+                       normal_y * load<UseSimd>(flux[1], grid_index) +
+                       normal_z * load<UseSimd>(flux[2], grid_index));
+  }
+}
+}  // namespace grmhd::ValenciaDivClean::BoundaryCorrections::detail
+/// \endcond
@@ -5,16 +5,17 @@
 
 #include <pup.h>
 
+#include <cstddef>
 #include <memory>
 #include <optional>
 
 #include "DataStructures/DataVector.hpp"
-#include "DataStructures/Tensor/EagerMath/DotProduct.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/BoundaryCorrections/PointwiseKernels.hpp"
 #include "NumericalAlgorithms/DiscontinuousGalerkin/Formulation.hpp"
-#include "NumericalAlgorithms/DiscontinuousGalerkin/NormalDotFlux.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Simd/Simd.hpp"
 
 namespace grmhd::ValenciaDivClean::BoundaryCorrections {
 Rusanov::Rusanov(CkMigrateMessage* /*unused*/) {}
@@ -74,42 +75,56 @@ double Rusanov::dg_package_data(
     const std::optional<Scalar<DataVector>>& normal_dot_mesh_velocity,
     const EquationsOfState::EquationOfState<true, 3>&
     /*equation_of_state*/) {
-  {
-    // Compute max abs char speed
-    Scalar<DataVector>& shift_dot_normal = *packaged_tilde_d;
-    dot_product(make_not_null(&shift_dot_normal), shift, normal_covector);
-    if (normal_dot_mesh_velocity.has_value()) {
-      get(*packaged_abs_char_speed) =
-          max(abs(-get(lapse) - get(shift_dot_normal) -
-                  get(*normal_dot_mesh_velocity)),
-              abs(get(lapse) - get(shift_dot_normal) -
-                  get(*normal_dot_mesh_velocity)));
-    } else {
-      get(*packaged_abs_char_speed) =
-          max(abs(-get(lapse) - get(shift_dot_normal)),
-              abs(get(lapse) - get(shift_dot_normal)));
-    }
-  }
-
-  *packaged_tilde_d = tilde_d;
-  *packaged_tilde_ye = tilde_ye;
-  *packaged_tilde_tau = tilde_tau;
-  *packaged_tilde_s = tilde_s;
-  *packaged_tilde_b = tilde_b;
-  *packaged_tilde_phi = tilde_phi;
-
-  normal_dot_flux(packaged_normal_dot_flux_tilde_d, normal_covector,
-                  flux_tilde_d);
-  normal_dot_flux(packaged_normal_dot_flux_tilde_ye, normal_covector,
-                  flux_tilde_ye);
-  normal_dot_flux(packaged_normal_dot_flux_tilde_tau, normal_covector,
-                  flux_tilde_tau);
-  normal_dot_flux(packaged_normal_dot_flux_tilde_s, normal_covector,
-                  flux_tilde_s);
-  normal_dot_flux(packaged_normal_dot_flux_tilde_b, normal_covector,
-                  flux_tilde_b);
-  normal_dot_flux(packaged_normal_dot_flux_tilde_phi, normal_covector,
-                  flux_tilde_phi);
+  const auto packaged_vars = detail::conserved_component_data(
+      *packaged_tilde_d, *packaged_tilde_ye, *packaged_tilde_tau,
+      *packaged_tilde_s, *packaged_tilde_b, *packaged_tilde_phi);
+  const auto packaged_normal_dot_fluxes = detail::conserved_component_data(
+      *packaged_normal_dot_flux_tilde_d, *packaged_normal_dot_flux_tilde_ye,
+      *packaged_normal_dot_flux_tilde_tau, *packaged_normal_dot_flux_tilde_s,
+      *packaged_normal_dot_flux_tilde_b, *packaged_normal_dot_flux_tilde_phi);
+  const auto vars = detail::conserved_component_data(
+      tilde_d, tilde_ye, tilde_tau, tilde_s, tilde_b, tilde_phi);
+  const auto fluxes = detail::flux_component_data(
+      flux_tilde_d, flux_tilde_ye, flux_tilde_tau, flux_tilde_s, flux_tilde_b,
+      flux_tilde_phi);
+  const double* const normal_dot_mesh_velocity_data =
+      normal_dot_mesh_velocity.has_value()
+          ? get(*normal_dot_mesh_velocity).data()
+          : nullptr;
+  double* const abs_char_speed_data = get(*packaged_abs_char_speed).data();
+
+  detail::for_each_face_point(
+      get(tilde_d).size(), [&](const size_t grid_index, auto use_simd) {
+        using UseSimd = decltype(use_simd);
+        using SimdType = detail::SimdType<UseSimd>;
+        using detail::load;
+        detail::package_conserved_and_normal_fluxes<UseSimd>(
+            grid_index, packaged_vars, packaged_normal_dot_fluxes, vars,
+            fluxes, normal_covector);
+
+        // Compute max abs char speed
+        SimdType shift_dot_normal =
+            load<UseSimd>(get<0>(shift).data(), grid_index) *
+                load<UseSimd>(get<0>(normal_covector).data(), grid_index) +
+            load<UseSimd>(get<1>(shift).data(), grid_index) *
+                load<UseSimd>(get<1>(normal_covector).data(), grid_index) +
+            load<UseSimd>(get<2>(shift).data(), grid_index) *
+                load<UseSimd>(get<2>(normal_covector).data(), grid_index);
+        const SimdType lapse_at_point =
+            load<UseSimd>(get(lapse).data(), grid_index);
+        SimdType minus_lapse_speed = -lapse_at_point - shift_dot_normal;
+        SimdType plus_lapse_speed = lapse_at_point - shift_dot_normal;
+        if (normal_dot_mesh_velocity_data != nullptr) {
+          const SimdType mesh_speed =
+              load<UseSimd>(normal_dot_mesh_velocity_data, grid_index);
+          minus_lapse_speed -= mesh_speed;
+          plus_lapse_speed -= mesh_speed;
+        }
+        detail::store<UseSimd>(
+            abs_char_speed_data, grid_index,
+            simd::max(simd::abs(minus_lapse_speed),
+                      simd::abs(plus_lapse_speed)));
+      });
 
   return max(get(*packaged_abs_char_speed));
 }
@@ -150,75 +165,55 @@ void Rusanov::dg_boundary_terms(
     const Scalar<DataVector>& normal_dot_flux_tilde_phi_ext,
     const Scalar<DataVector>& abs_char_speed_ext,
     const dg::Formulation dg_formulation) {
-  if (dg_formulation == dg::Formulation::WeakInertial) {
-    get(*boundary_correction_tilde_d) =
-        0.5 * (get(normal_dot_flux_tilde_d_int) -
-               get(normal_dot_flux_tilde_d_ext)) -
-        0.5 * max(get(abs_char_speed_int), get(abs_char_speed_ext)) *
-            (get(tilde_d_ext) - get(tilde_d_int));
-    get(*boundary_correction_tilde_ye) =
-        0.5 * (get(normal_dot_flux_tilde_ye_int) -
-               get(normal_dot_flux_tilde_ye_ext)) -
-        0.5 * max(get(abs_char_speed_int), get(abs_char_speed_ext)) *
-            (get(tilde_ye_ext) - get(tilde_ye_int));
-    get(*boundary_correction_tilde_tau) =
-        0.5 * (get(normal_dot_flux_tilde_tau_int) -
-               get(normal_dot_flux_tilde_tau_ext)) -
-        0.5 * max(get(abs_char_speed_int), get(abs_char_speed_ext)) *
-            (get(tilde_tau_ext) - get(tilde_tau_int));
-    get(*boundary_correction_tilde_phi) =
-        0.5 * (get(normal_dot_flux_tilde_phi_int) -
-               get(normal_dot_flux_tilde_phi_ext)) -
-        0.5 * max(get(abs_char_speed_int), get(abs_char_speed_ext)) *
-            (get(tilde_phi_ext) - get(tilde_phi_int));
-
-    for (size_t i = 0; i < 3; ++i) {
-      boundary_correction_tilde_s->get(i) =
-          0.5 * (normal_dot_flux_tilde_s_int.get(i) -
-                 normal_dot_flux_tilde_s_ext.get(i)) -
-          0.5 * max(get(abs_char_speed_int), get(abs_char_speed_ext)) *
-              (tilde_s_ext.get(i) - tilde_s_int.get(i));
-      boundary_correction_tilde_b->get(i) =
-          0.5 * (normal_dot_flux_tilde_b_int.get(i) -
-                 normal_dot_flux_tilde_b_ext.get(i)) -
-          0.5 * max(get(abs_char_speed_int), get(abs_char_speed_ext)) *
-              (tilde_b_ext.get(i) - tilde_b_int.get(i));
-    }
-  } else {
-    get(*boundary_correction_tilde_d) =
-        -0.5 * (get(normal_dot_flux_tilde_d_int) +
-                get(normal_dot_flux_tilde_d_ext)) -
-        0.5 * max(get(abs_char_speed_int), get(abs_char_speed_ext)) *
-            (get(tilde_d_ext) - get(tilde_d_int));
-    get(*boundary_correction_tilde_ye) =
-        -0.5 * (get(normal_dot_flux_tilde_ye_int) +
-                get(normal_dot_flux_tilde_ye_ext)) -
-        0.5 * max(get(abs_char_speed_int), get(abs_char_speed_ext)) *
-            (get(tilde_ye_ext) - get(tilde_ye_int));
-    get(*boundary_correction_tilde_tau) =
-        -0.5 * (get(normal_dot_flux_tilde_tau_int) +
-                get(normal_dot_flux_tilde_tau_ext)) -
-        0.5 * max(get(abs_char_speed_int), get(abs_char_speed_ext)) *
-            (get(tilde_tau_ext) - get(tilde_tau_int));
-    get(*boundary_correction_tilde_phi) =
-        -0.5 * (get(normal_dot_flux_tilde_phi_int) +
-                get(normal_dot_flux_tilde_phi_ext)) -
-        0.5 * max(get(abs_char_speed_int), get(abs_char_speed_ext)) *
-            (get(tilde_phi_ext) - get(tilde_phi_int));
-
-    for (size_t i = 0; i < 3; ++i) {
-      boundary_correction_tilde_s->get(i) =
-          -0.5 * (normal_dot_flux_tilde_s_int.get(i) +
-                  normal_dot_flux_tilde_s_ext.get(i)) -
-          0.5 * max(get(abs_char_speed_int), get(abs_char_speed_ext)) *
-              (tilde_s_ext.get(i) - tilde_s_int.get(i));
-      boundary_correction_tilde_b->get(i) =
-          -0.5 * (normal_dot_flux_tilde_b_int.get(i) +
-                  normal_dot_flux_tilde_b_ext.get(i)) -
-          0.5 * max(get(abs_char_speed_int), get(abs_char_speed_ext)) *
-              (tilde_b_ext.get(i) - tilde_b_int.get(i));
-    }
-  }
+  const auto corrections = detail::conserved_component_data(
+      *boundary_correction_tilde_d, *boundary_correction_tilde_ye,
+      *boundary_correction_tilde_tau, *boundary_correction_tilde_s,
+      *boundary_correction_tilde_b, *boundary_correction_tilde_phi);
+  const auto vars_int = detail::conserved_component_data(
+      tilde_d_int, tilde_ye_int, tilde_tau_int, tilde_s_int, tilde_b_int,
+      tilde_phi_int);
+  const auto vars_ext = detail::conserved_component_data(
+      tilde_d_ext, tilde_ye_ext, tilde_tau_ext, tilde_s_ext, tilde_b_ext,
+      tilde_phi_ext);
+  const auto normal_dot_fluxes_int = detail::conserved_component_data(
+      normal_dot_flux_tilde_d_int, normal_dot_flux_tilde_ye_int,
+      normal_dot_flux_tilde_tau_int, normal_dot_flux_tilde_s_int,
+      normal_dot_flux_tilde_b_int, normal_dot_flux_tilde_phi_int);
+  const auto normal_dot_fluxes_ext = detail::conserved_component_data(
+      normal_dot_flux_tilde_d_ext, normal_dot_flux_tilde_ye_ext,
+      normal_dot_flux_tilde_tau_ext, normal_dot_flux_tilde_s_ext,
+      normal_dot_flux_tilde_b_ext, normal_dot_flux_tilde_phi_ext);
+  const double* const abs_char_speed_int_data = get(abs_char_speed_int).data();
+  const double* const abs_char_speed_ext_data = get(abs_char_speed_ext).data();
+  const bool weak_form = dg_formulation == dg::Formulation::WeakInertial;
+
+  detail::for_each_face_point(
+      get(tilde_d_int).size(), [&](const size_t grid_index, auto use_simd) {
+        using UseSimd = decltype(use_simd);
+        using SimdType = detail::SimdType<UseSimd>;
+        using detail::load;
+        const SimdType half_max_abs_char_speed =
+            0.5 * simd::max(load<UseSimd>(abs_char_speed_int_data, grid_index),
+                            load<UseSimd>(abs_char_speed_ext_data, grid_index));
+
+        for (size_t c = 0; c < detail::number_of_conserved_components; ++c) {
+          const SimdType normal_dot_flux_int =
+              load<UseSimd>(gsl::at(normal_dot_fluxes_int, c), grid_index);
+          const SimdType normal_dot_flux_ext =
+              load<UseSimd>(gsl::at(normal_dot_fluxes_ext, c), grid_index);
+          const SimdType var_difference =
+              load<UseSimd>(gsl::at(vars_ext, c), grid_index) -
+              load<UseSimd>(gsl::at(vars_int, c), grid_index);
+          detail::store<UseSimd>(
+              gsl::at(corrections, c), grid_index,
+              weak_form ? SimdType{0.5 * (normal_dot_flux_int -
+                                          normal_dot_flux_ext) -
+                                   half_max_abs_char_speed * var_difference}
+                        : SimdType{-0.5 * (normal_dot_flux_int +
+                                           normal_dot_flux_ext) -
+                                   half_max_abs_char_speed * var_difference});
+        }
+      });
 }
 
 bool operator==(const Rusanov& /*lhs*/, const Rusanov& /*rhs*/) { return true; }
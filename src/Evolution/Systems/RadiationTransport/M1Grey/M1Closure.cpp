@@ -7,7 +7,8 @@
 #include <array>
 #include <cmath>
 #include <cstddef>
-#include <utility>
+#include <type_traits>
+#include <vector>
 
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
@@ -19,6 +20,7 @@
 #include "PointwiseFunctions/Hydro/Tags.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Simd/Simd.hpp"
 #include "Utilities/TMPL.hpp"
 
 namespace {
@@ -29,15 +31,204 @@ struct MomentumSquared : db::SimpleTag {
   using type = Scalar<DataVector>;
 };
 
+// Small number used to avoid divisions by zero
+constexpr double avoid_divisions_by_zero = 1.e-150;
+// Below small_velocity, we use the v=0 closure,
+// and we do not differentiate between fluid/inertial frames
+constexpr double small_velocity = 1.e-15;
+// Dimension of spatial tensors
+constexpr size_t spatial_dim = 3;
+// Tolerance used in the rootfinding used to find the closure factor
+constexpr double root_find_tolerance = 1.e-14;
+
 // Minerbo (maximum entropy) closure for the M1 scheme
-double minerbo_closure_function(const double zeta) {
+template <typename T>
+T minerbo_closure_function(const T& zeta) {
   return 1.0 / 3.0 +
          square(zeta) * (0.4 - 2.0 / 15.0 * zeta + 0.4 * square(zeta));
 }
+
+// Decomposition of the fluid-frame moments at one grid point into parts that
+// are independent of the closure factor.
+struct ClosureCoefficients {
+  // Decomposition of the fluid-frame energy density:
+  // J = J0 + d_thin * JThin + d_thick * JThick
+  // with d_thin, d_thick=1-d_thin coefficients
+  // obtained from the M1 closure.
+  double j_0;
+  double j_thin;
+  double j_thick;
+  // Decomposition of the fluid-frame momentum density:
+  // H_a = -( h0T + d_thick hThickT + d_thin hThinT) t_a
+  //  - ( h0V + d_thick hThickV + d_thin hThinV) v_a
+  //  - ( h0F + d_thick hThickF + d_thin hThinF) F_a
+  // with t_a the unit normal, v_a the 3-velocity, and F_a the
+  // inertial frame momentum density. This is a decomposition of
+  // convenience, which is not unique: F_a and v_a are not
+  // orthogonal vectors, but both are normal to t_a.
+  double h_0_t;
+  double h_0_v;
+  double h_0_f;
+  double h_thin_t;
+  double h_thin_v;
+  double h_thin_f;
+  double h_thick_t;
+  double h_thick_v;
+  double h_thick_f;
+};
+
+ClosureCoefficients closure_coefficients(const double e_pt,
+                                         const double s_sqr_pt,
+                                         const double v_dot_f_pt,
+                                         const double v_sqr_pt,
+                                         const double w_sqr_pt,
+                                         const double w_pt) {
+  ClosureCoefficients c{};
+  c.j_0 = w_sqr_pt * (e_pt - 2. * v_dot_f_pt);
+  c.j_thin = w_sqr_pt * e_pt * square(v_dot_f_pt) / s_sqr_pt;
+  c.j_thick = (w_sqr_pt - 1.) / (1. + 2. * w_sqr_pt) *
+              (4. * w_sqr_pt * v_dot_f_pt + e_pt * (3. - 2. * w_sqr_pt));
+  c.h_0_t = w_pt * (c.j_0 + v_dot_f_pt - e_pt);
+  c.h_0_v = w_pt * c.j_0;
+  c.h_0_f = -w_pt;
+  c.h_thin_t = w_pt * c.j_thin;
+  c.h_thin_v = c.h_thin_t;
+  c.h_thin_f = w_pt * e_pt * v_dot_f_pt / s_sqr_pt;
+  c.h_thick_t = w_pt * c.j_thick;
+  c.h_thick_v =
+      c.h_thick_t +
+      w_pt / (2. * w_sqr_pt + 1.) *
+          ((3. - 2. * w_sqr_pt) * e_pt + (2. * w_sqr_pt - 1.) * v_dot_f_pt);
+  c.h_thick_f = w_pt * v_sqr_pt;
+  return c;
+}
+
+// The function (zeta^2 J^2 - H^a H_a) / E^2 whose root is the closure factor.
+// The members are the coefficients of J and H^2 = H^a H_a, independent of
+// zeta. We write:
+// H^2 = h_sqr_0 + h_sqr_thin * d_thin + h_sqr_thick*d_thick
+// + h_sqr_thin_thin * d_thin^2 + h_sqr_thick_thick * d_thick^2
+// + h_sqr_thin_thick * d_thin * d_thick;
+//
+// `T` is either `double` or a SIMD batch, in which case each lane holds the
+// coefficients of a different grid point.
+template <typename T>
+struct ZetaJSqrMinusHSqr {
+  static constexpr size_t number_of_coefficients = 10;
+
+  T e;
+  T j_0;
+  T j_thin;
+  T j_thick;
+  T h_sqr_0;
+  T h_sqr_thin;
+  T h_sqr_thick;
+  T h_sqr_thin_thick;
+  T h_sqr_thick_thick;
+  T h_sqr_thin_thin;
+
+  T operator()(const T& local_zeta) const {
+    const T chi = minerbo_closure_function(local_zeta);
+    const T d_thin = 1.5 * chi - 0.5;
+    const T d_thick = 1. - d_thin;
+
+    const T e_fluid = j_0 + j_thin * d_thin + j_thick * d_thick;
+    const T h_sqr = h_sqr_0 + h_sqr_thick * d_thick + h_sqr_thin * d_thin +
+                    h_sqr_thin_thin * square(d_thin) +
+                    h_sqr_thick_thick * square(d_thick) +
+                    h_sqr_thin_thick * d_thin * d_thick;
+    return (square(e_fluid * local_zeta) - h_sqr) / square(e);
+  }
+};
+
+ZetaJSqrMinusHSqr<double> zeta_j_sqr_minus_h_sqr(
+    const double e_pt, const double s_sqr_pt, const double v_dot_f_pt,
+    const double v_sqr_pt, const ClosureCoefficients& c) {
+  return {
+      e_pt,
+      c.j_0,
+      c.j_thin,
+      c.j_thick,
+      -square(c.h_0_t) + square(c.h_0_v) * v_sqr_pt +
+          square(c.h_0_f) * s_sqr_pt + 2. * c.h_0_v * c.h_0_f * v_dot_f_pt,
+      2. * (c.h_0_v * c.h_thin_v * v_sqr_pt + c.h_0_f * c.h_thin_f * s_sqr_pt +
+            c.h_0_v * c.h_thin_f * v_dot_f_pt +
+            c.h_0_f * c.h_thin_v * v_dot_f_pt - c.h_0_t * c.h_thin_t),
+      2. *
+          (c.h_0_v * c.h_thick_v * v_sqr_pt + c.h_0_f * c.h_thick_f * s_sqr_pt +
+           c.h_0_v * c.h_thick_f * v_dot_f_pt +
+           c.h_0_f * c.h_thick_v * v_dot_f_pt - c.h_0_t * c.h_thick_t),
+      2. * (c.h_thin_v * c.h_thick_v * v_sqr_pt +
+            c.h_thin_f * c.h_thick_f * s_sqr_pt +
+            c.h_thin_v * c.h_thick_f * v_dot_f_pt +
+            c.h_thin_f * c.h_thick_v * v_dot_f_pt - c.h_thin_t * c.h_thick_t),
+      square(c.h_thick_v) * v_sqr_pt + square(c.h_thick_f) * s_sqr_pt +
+          2. * c.h_thick_v * c.h_thick_f * v_dot_f_pt - square(c.h_thick_t),
+      square(c.h_thin_v) * v_sqr_pt + square(c.h_thin_f) * s_sqr_pt +
+          2. * c.h_thin_v * c.h_thin_f * v_dot_f_pt - square(c.h_thin_t)};
+}
+
+// Root finding on `number_of_roots` points whose coefficients are stored
+// contiguously in `coefficients`, with a stride of `stride` between the
+// different coefficients. Full SIMD batches of points are solved together;
+// the TOMS748 solver tracks the convergence of each lane separately.
+void find_closure_factors(const gsl::not_null<double*> zeta,
+                          const double* const coefficients,
+                          const size_t stride, const size_t number_of_roots) {
+  const auto root_find = [&coefficients, &stride, &zeta](const size_t n,
+                                                         auto use_simd) {
+    using T = tmpl::conditional_t<decltype(use_simd)::value,
+                                  simd::batch<double>, double>;
+    const auto load = [&coefficients, &stride, &n](const size_t c) -> T {
+      if constexpr (std::is_same_v<T, double>) {
+        return coefficients[c * stride + n];
+      } else {
+        return simd::load_unaligned(coefficients + c * stride + n);
+      }
+    };
+    const ZetaJSqrMinusHSqr<T> f{load(0), load(1), load(2), load(3), load(4),
+                                 load(5), load(6), load(7), load(8), load(9)};
+    const T result = RootFinder::toms748(f, T(1.e-15), T(1.),
+                                         root_find_tolerance, 1.0e-15);
+    if constexpr (std::is_same_v<T, double>) {
+      zeta.get()[n] = result;
+    } else {
+      simd::store_unaligned(zeta.get() + n, result);
+    }
+  };
+  size_t n = 0;
+#ifdef SPECTRE_USE_XSIMD
+  constexpr size_t simd_width = simd::size<simd::batch<double>>();
+  for (; n + simd_width <= number_of_roots; n += simd_width) {
+    root_find(n, std::true_type{});
+  }
+#endif
+  for (; n < number_of_roots; ++n) {
+    root_find(n, std::false_type{});
+  }
+}
 }  // namespace
 
 namespace RadiationTransport::M1Grey::detail {
 
+void compute_closure_fluid_quantities(
+    const gsl::not_null<Variables<closure_fluid_tags>*> fluid_quantities,
+    const tnsr::I<DataVector, 3, Frame::Inertial>& fluid_velocity,
+    const Scalar<DataVector>& fluid_lorentz_factor,
+    const tnsr::ii<DataVector, 3, Frame::Inertial>& spatial_metric) {
+  fluid_quantities->initialize(get(fluid_lorentz_factor).size());
+  auto& w_sqr =
+      get<hydro::Tags::LorentzFactorSquared<DataVector>>(*fluid_quantities);
+  get(w_sqr) = square(get(fluid_lorentz_factor));
+  get(get<hydro::Tags::SpatialVelocitySquared<DataVector>>(
+      *fluid_quantities)) = 1. - 1. / get(w_sqr);
+  // v_i, the spatial velocity one-form of the fluid
+  raise_or_lower_index(
+      make_not_null(&get<hydro::Tags::SpatialVelocityOneForm<DataVector, 3>>(
+          *fluid_quantities)),
+      fluid_velocity, spatial_metric);
+}
+
 void compute_closure_impl(
     const gsl::not_null<Scalar<DataVector>*> closure_factor,
     const gsl::not_null<tnsr::II<DataVector, 3, Frame::Inertial>*>
@@ -50,35 +241,25 @@ void compute_closure_impl(
     const tnsr::i<DataVector, 3, Frame::Inertial>& momentum_density,
     const tnsr::I<DataVector, 3, Frame::Inertial>& fluid_velocity,
     const Scalar<DataVector>& fluid_lorentz_factor,
-    const tnsr::ii<DataVector, 3, Frame::Inertial>& spatial_metric,
+    const Variables<closure_fluid_tags>& fluid_quantities,
     const tnsr::II<DataVector, 3, Frame::Inertial>& inv_spatial_metric) {
-  // Small number used to avoid divisions by zero
-  static constexpr double avoid_divisions_by_zero = 1.e-150;
-  // Below small_velocity, we use the v=0 closure,
-  // and we do not differentiate between fluid/inertial frames
-  static constexpr double small_velocity = 1.e-15;
-  // Dimension of spatial tensors
-  constexpr size_t spatial_dim = 3;
-  // Tolerance used in the rootfinding used to find the closure factor
-  constexpr double root_find_tolerance = 1.e-14;
-  Variables<
-      tmpl::list<hydro::Tags::LorentzFactorSquared<DataVector>, MomentumSquared,
-                 MomentumUp, hydro::Tags::SpatialVelocityOneForm<DataVector, 3>,
-                 hydro::Tags::SpatialVelocitySquared<DataVector>>>
-      temp_closure_tensors(get(energy_density).size());
+  const size_t number_of_points = get(energy_density).size();
+  const auto& w_sqr =
+      get<hydro::Tags::LorentzFactorSquared<DataVector>>(fluid_quantities);
+  const auto& v_sqr =
+      get<hydro::Tags::SpatialVelocitySquared<DataVector>>(fluid_quantities);
+  const auto& v_m =
+      get<hydro::Tags::SpatialVelocityOneForm<DataVector, 3>>(fluid_quantities);
 
   // The main calculation needed for the M1 closure is to find the
   // roots of J^2 zeta^2 = H^a H_a, with J the fluid-frame energy density
   // and H^a the fluid-frame momentum density (0th and 1st moments).
-
-  // We first compute various fluid quantities and contractions
-  // with inertial moments needed even if v^2 is small
-  auto& w_sqr =
-      get<hydro::Tags::LorentzFactorSquared<DataVector>>(temp_closure_tensors);
-  get(w_sqr) = square(get(fluid_lorentz_factor));
-  auto& v_sqr = get<hydro::Tags::SpatialVelocitySquared<DataVector>>(
-      temp_closure_tensors);
-  get(v_sqr) = 1. - 1. / get(w_sqr);
+  // This is done in three passes over the grid points: the first computes the
+  // coefficients of the root finding function and gathers the points that
+  // need a root find, the second finds the roots, and the third assembles the
+  // output quantities.
+  Variables<tmpl::list<MomentumSquared, MomentumUp>> temp_closure_tensors(
+      number_of_points);
   // S^i, the neutrino momentum tensor
   auto& s_M = get<MomentumUp>(temp_closure_tensors);
   raise_or_lower_index(make_not_null(&s_M), momentum_density,
@@ -86,19 +267,32 @@ void compute_closure_impl(
   // S^i S_i
   auto& s_sqr = get<MomentumSquared>(temp_closure_tensors);
   dot_product(make_not_null(&s_sqr), s_M, momentum_density);
-  // v_i, the spatial velocity one-form of the fluid
-  auto& v_m = get<hydro::Tags::SpatialVelocityOneForm<DataVector, 3>>(
-      temp_closure_tensors);
-  raise_or_lower_index(make_not_null(&v_m), fluid_velocity, spatial_metric);
+  for (size_t s = 0; s < number_of_points; ++s) {
+    get(s_sqr)[s] = std::max(get(s_sqr)[s], avoid_divisions_by_zero);
+  }
+  const auto v_dot_f_at = [&fluid_velocity, &momentum_density](const size_t s) {
+    double v_dot_f_pt = 0.;
+    for (size_t m = 0; m < spatial_dim; m++) {
+      v_dot_f_pt += fluid_velocity.get(m)[s] * momentum_density.get(m)[s];
+    }
+    return v_dot_f_pt;
+  };
 
-  // Allocate memory for H^i
-  tnsr::I<double, 3, Frame::Inertial> H_M(0.);
-  // Loop over points
-  for (size_t s = 0; s < get(v_sqr).size(); ++s) {
-    const double& v_sqr_pt = get(v_sqr)[s];
-    const double& w_sqr_pt = get(w_sqr)[s];
-    const double& e_pt = get(energy_density)[s];
-    const double& s_sqr_pt = std::max(get(s_sqr)[s], avoid_divisions_by_zero);
+  // Coefficients of the root finding function of the points that need a
+  // root find, stored contiguously for each coefficient.
+  constexpr size_t number_of_coefficients =
+      ZetaJSqrMinusHSqr<double>::number_of_coefficients;
+  DataVector root_find_buffer{(number_of_coefficients + 1) * number_of_points};
+  double* const root_find_coefficients = root_find_buffer.data();
+  double* const root_find_zeta =
+      root_find_buffer.data() + number_of_coefficients * number_of_points;
+  std::vector<size_t> root_find_indices{};
+  root_find_indices.reserve(number_of_points);
+
+  for (size_t s = 0; s < number_of_points; ++s) {
+    const double v_sqr_pt = get(v_sqr)[s];
+    const double e_pt = get(energy_density)[s];
+    const double s_sqr_pt = get(s_sqr)[s];
     // Ignore complicated closure calculations
     // if the fluid velocity is very small
     if (v_sqr_pt < small_velocity) {
@@ -122,143 +316,119 @@ void compute_closure_impl(
               d_thin_e_pt_over_s_sqr * s_M.get(i)[s] * s_M.get(j)[s];
         }
       }
+      continue;
     }
     // If the fluid velocity cannot be ignored, we need to
     // go through a more expensive closure calculation
-    else {
-      // Compute useful intermediate quantities from v^i, F_i
-      double v_dot_f_pt = 0.;
-      for (size_t m = 0; m < spatial_dim; m++) {
-        v_dot_f_pt += fluid_velocity.get(m)[s] * momentum_density.get(m)[s];
+    const double v_dot_f_pt = v_dot_f_at(s);
+    const auto f = zeta_j_sqr_minus_h_sqr(
+        e_pt, s_sqr_pt, v_dot_f_pt, v_sqr_pt,
+        closure_coefficients(e_pt, s_sqr_pt, v_dot_f_pt, v_sqr_pt,
+                             get(w_sqr)[s], get(fluid_lorentz_factor)[s]));
+    // To avoid failures in the root find at the boundary of
+    // the allowed domain for zeta, test the edge values first.
+    if (fabs(f(0.)) < root_find_tolerance) {
+      get(*closure_factor)[s] = 0.;
+    } else if (fabs(f(1.)) < root_find_tolerance) {
+      get(*closure_factor)[s] = 1.;
+    } else {
+      const size_t n = root_find_indices.size();
+      const std::array<double, number_of_coefficients> coefficients{
+          {f.e, f.j_0, f.j_thin, f.j_thick, f.h_sqr_0, f.h_sqr_thin,
+           f.h_sqr_thick, f.h_sqr_thin_thick, f.h_sqr_thick_thick,
+           f.h_sqr_thin_thin}};
+      for (size_t c = 0; c < number_of_coefficients; ++c) {
+        root_find_coefficients[c * number_of_points + n] =
+            gsl::at(coefficients, c);
       }
-      // Decomposition of the fluid-frame energy density:
-      // J = J0 + d_thin * JThin + d_thick * JThick
-      // with d_thin, d_thick=1-d_thin coefficients
-      // obtained from the M1 closure.
-      const double j_0 = w_sqr_pt * (e_pt - 2. * v_dot_f_pt);
-      const double j_thin = w_sqr_pt * e_pt * square(v_dot_f_pt) / s_sqr_pt;
-      const double j_thick =
-          (w_sqr_pt - 1.) / (1. + 2. * w_sqr_pt) *
-          (4. * w_sqr_pt * v_dot_f_pt + e_pt * (3. - 2. * w_sqr_pt));
-      // Decomposition of the fluid-frame momentum density:
-      // H_a = -( h0T + d_thick hThickT + d_thin hThinT) t_a
-      //  - ( h0V + d_thick hThickV + d_thin hThinV) v_a
-      //  - ( h0F + d_thick hThickF + d_thin hThinF) F_a
-      // with t_a the unit normal, v_a the 3-velocity, and F_a the
-      // inertial frame momentum density. This is a decomposition of
-      // convenience, which is not unique: F_a and v_a are not
-      // orthogonal vectors, but both are normal to t_a.
-      const double& w_pt = get(fluid_lorentz_factor)[s];
-      const double h_0_t = w_pt * (j_0 + v_dot_f_pt - e_pt);
-      const double h_0_v = w_pt * j_0;
-      const double h_0_f = -w_pt;
-      const double h_thin_t = w_pt * j_thin;
-      const double h_thin_v = h_thin_t;
-      const double h_thin_f = w_pt * e_pt * v_dot_f_pt / s_sqr_pt;
-      const double h_thick_t = w_pt * j_thick;
-      const double h_thick_v =
-          h_thick_t +
-          w_pt / (2. * w_sqr_pt + 1.) *
-              ((3. - 2. * w_sqr_pt) * e_pt + (2. * w_sqr_pt - 1.) * v_dot_f_pt);
-      const double h_thick_f = w_pt * v_sqr_pt;
-      // Quantities needed for the computation of H^2 = H^a H_a,
-      // independent of zeta. We write:
-      // H^2 = h_sqr_0 + h_sqr_thin * d_thin + h_sqr_thick*d_thick
-      // + h_sqr_thin_thin * d_thin^2 + h_sqr_thick_thick * d_thick^2
-      // + h_sqr_thin_thick * d_thin * d_thick;
-      const double h_sqr_0 = -square(h_0_t) + square(h_0_v) * v_sqr_pt +
-                             square(h_0_f) * s_sqr_pt +
-                             2. * h_0_v * h_0_f * v_dot_f_pt;
-      const double h_sqr_thin =
-          2. * (h_0_v * h_thin_v * v_sqr_pt + h_0_f * h_thin_f * s_sqr_pt +
-                h_0_v * h_thin_f * v_dot_f_pt + h_0_f * h_thin_v * v_dot_f_pt -
-                h_0_t * h_thin_t);
-      const double h_sqr_thick =
-          2. * (h_0_v * h_thick_v * v_sqr_pt + h_0_f * h_thick_f * s_sqr_pt +
-                h_0_v * h_thick_f * v_dot_f_pt +
-                h_0_f * h_thick_v * v_dot_f_pt - h_0_t * h_thick_t);
-      const double h_sqr_thin_thick =
-          2. *
-          (h_thin_v * h_thick_v * v_sqr_pt + h_thin_f * h_thick_f * s_sqr_pt +
-           h_thin_v * h_thick_f * v_dot_f_pt +
-           h_thin_f * h_thick_v * v_dot_f_pt - h_thin_t * h_thick_t);
-      const double h_sqr_thick_thick =
-          square(h_thick_v) * v_sqr_pt + square(h_thick_f) * s_sqr_pt +
-          2. * h_thick_v * h_thick_f * v_dot_f_pt - square(h_thick_t);
-      const double h_sqr_thin_thin =
-          square(h_thin_v) * v_sqr_pt + square(h_thin_f) * s_sqr_pt +
-          2. * h_thin_v * h_thin_f * v_dot_f_pt - square(h_thin_t);
+      root_find_indices.push_back(s);
+    }
+  }
 
-      // Root finding function
-      const auto zeta_j_sqr_minus_h_sqr =
-          [&e_pt, &j_0, &j_thin, &j_thick, &h_sqr_0, &h_sqr_thick, &h_sqr_thin,
-           &h_sqr_thin_thin, &h_sqr_thick_thick,
-           &h_sqr_thin_thick](const double local_zeta) {
-            const double chi = minerbo_closure_function(local_zeta);
-            const double d_thin = 1.5 * chi - 0.5;
-            const double d_thick = 1. - d_thin;
+  find_closure_factors(make_not_null(root_find_zeta), root_find_coefficients,
+                       number_of_points, root_find_indices.size());
+  for (size_t n = 0; n < root_find_indices.size(); ++n) {
+    get(*closure_factor)[root_find_indices[n]] = root_find_zeta[n];
+  }
 
-            const double e_fluid = j_0 + j_thin * d_thin + j_thick * d_thick;
-            const double h_sqr = h_sqr_0 + h_sqr_thick * d_thick +
-                                 h_sqr_thin * d_thin +
-                                 h_sqr_thin_thin * square(d_thin) +
-                                 h_sqr_thick_thick * square(d_thick) +
-                                 h_sqr_thin_thick * d_thin * d_thick;
-            return (square(e_fluid * local_zeta) - h_sqr) / square(e_pt);
-          };
-      // To avoid failures in the root find at the boundary of
-      // the allowed domain for zeta, test the edge values first.
-      if (fabs(zeta_j_sqr_minus_h_sqr(0.)) < root_find_tolerance) {
-        get(*closure_factor)[s] = 0.;
-      } else if (fabs(zeta_j_sqr_minus_h_sqr(1.)) < root_find_tolerance) {
-        get(*closure_factor)[s] = 1.;
-      } else {
-        get(*closure_factor)[s] = RootFinder::toms748(
-            zeta_j_sqr_minus_h_sqr, 1.e-15, 1., root_find_tolerance, 1.0e-15);
-      }
-      const double& zeta = get(*closure_factor)[s];
+  // Assemble output quantities:
+  for (size_t s = 0; s < number_of_points; ++s) {
+    const double v_sqr_pt = get(v_sqr)[s];
+    if (v_sqr_pt < small_velocity) {
+      continue;
+    }
+    const double e_pt = get(energy_density)[s];
+    const double s_sqr_pt = get(s_sqr)[s];
+    const double w_sqr_pt = get(w_sqr)[s];
+    const double w_pt = get(fluid_lorentz_factor)[s];
+    const double v_dot_f_pt = v_dot_f_at(s);
+    const ClosureCoefficients c = closure_coefficients(
+        e_pt, s_sqr_pt, v_dot_f_pt, v_sqr_pt, w_sqr_pt, w_pt);
+    const double zeta = get(*closure_factor)[s];
 
-      // Assemble output quantities:
-      const double chi = minerbo_closure_function(zeta);
-      const double d_thin = 1.5 * chi - 0.5;
-      const double d_thick = 1. - d_thin;
-      get(*comoving_energy_density)[s] =
-          j_0 + j_thin * d_thin + j_thick * d_thick;
-      get(*comoving_momentum_density_normal)[s] =
-          h_0_t + h_thin_t * d_thin + h_thick_t * d_thick;
-      for (size_t i = 0; i < spatial_dim; i++) {
-        comoving_momentum_density_spatial->get(i)[s] =
-            -(h_0_v + h_thin_v * d_thin + h_thick_v * d_thick) * v_m.get(i)[s] -
-            (h_0_f + h_thin_f * d_thin + h_thick_f * d_thick) *
-                momentum_density.get(i)[s];
-        for (size_t j = i; j < spatial_dim; j++) {
-          // Optically thin part of pressure tensor
-          pressure_tensor->get(i, j)[s] =
-              d_thin * e_pt * s_M.get(i)[s] * s_M.get(j)[s] / s_sqr_pt;
-        }
-      }
-      // Optically thick limit
-      for (size_t i = 0; i < spatial_dim; i++) {
-        H_M.get(i) =
-            s_M.get(i)[s] / w_pt +
-            fluid_velocity.get(i)[s] * w_pt / (2. * w_sqr_pt + 1.) *
-                ((4. * w_sqr_pt + 1.) * v_dot_f_pt - 4. * w_sqr_pt * e_pt);
-      }
-      const double J_over_3 =
-          1. / (2. * w_sqr_pt + 1.) *
-          ((2. * w_sqr_pt - 1.) * e_pt - 2. * w_sqr_pt * v_dot_f_pt);
-      for (size_t i = 0; i < spatial_dim; i++) {
-        for (size_t j = i; j < spatial_dim; j++) {
-          pressure_tensor->get(i, j)[s] +=
-              d_thick * (J_over_3 * (4. * w_sqr_pt * fluid_velocity.get(i)[s] *
-                                         fluid_velocity.get(j)[s] +
-                                     inv_spatial_metric.get(i, j)[s]) +
-                         w_pt * (H_M.get(i) * fluid_velocity.get(j)[s] +
-                                 H_M.get(j) * fluid_velocity.get(i)[s]));
-        }
+    const double chi = minerbo_closure_function(zeta);
+    const double d_thin = 1.5 * chi - 0.5;
+    const double d_thick = 1. - d_thin;
+    get(*comoving_energy_density)[s] =
+        c.j_0 + c.j_thin * d_thin + c.j_thick * d_thick;
+    get(*comoving_momentum_density_normal)[s] =
+        c.h_0_t + c.h_thin_t * d_thin + c.h_thick_t * d_thick;
+    for (size_t i = 0; i < spatial_dim; i++) {
+      comoving_momentum_density_spatial->get(i)[s] =
+          -(c.h_0_v + c.h_thin_v * d_thin + c.h_thick_v * d_thick) *
+              v_m.get(i)[s] -
+          (c.h_0_f + c.h_thin_f * d_thin + c.h_thick_f * d_thick) *
+              momentum_density.get(i)[s];
+    }
+    // Optically thick limit
+    std::array<double, spatial_dim> H_M{};
+    for (size_t i = 0; i < spatial_dim; i++) {
+      gsl::at(H_M, i) =
+          s_M.get(i)[s] / w_pt +
+          fluid_velocity.get(i)[s] * w_pt / (2. * w_sqr_pt + 1.) *
+              ((4. * w_sqr_pt + 1.) * v_dot_f_pt - 4. * w_sqr_pt * e_pt);
+    }
+    const double J_over_3 =
+        1. / (2. * w_sqr_pt + 1.) *
+        ((2. * w_sqr_pt - 1.) * e_pt - 2. * w_sqr_pt * v_dot_f_pt);
+    for (size_t i = 0; i < spatial_dim; i++) {
+      for (size_t j = i; j < spatial_dim; j++) {
+        // Optically thin part of pressure tensor
+        pressure_tensor->get(i, j)[s] =
+            d_thin * e_pt * s_M.get(i)[s] * s_M.get(j)[s] / s_sqr_pt +
+            d_thick * (J_over_3 * (4. * w_sqr_pt * fluid_velocity.get(i)[s] *
+                                       fluid_velocity.get(j)[s] +
+                                   inv_spatial_metric.get(i, j)[s]) +
+                       w_pt * (gsl::at(H_M, i) * fluid_velocity.get(j)[s] +
+                               gsl::at(H_M, j) * fluid_velocity.get(i)[s]));
       }
     }
   }
 }
 
+void compute_closure_impl(
+    const gsl::not_null<Scalar<DataVector>*> closure_factor,
+    const gsl::not_null<tnsr::II<DataVector, 3, Frame::Inertial>*>
+        pressure_tensor,
+    const gsl::not_null<Scalar<DataVector>*> comoving_energy_density,
+    const gsl::not_null<Scalar<DataVector>*> comoving_momentum_density_normal,
+    const gsl::not_null<tnsr::i<DataVector, 3, Frame::Inertial>*>
+        comoving_momentum_density_spatial,
+    const Scalar<DataVector>& energy_density,
+    const tnsr::i<DataVector, 3, Frame::Inertial>& momentum_density,
+    const tnsr::I<DataVector, 3, Frame::Inertial>& fluid_velocity,
+    const Scalar<DataVector>& fluid_lorentz_factor,
+    const tnsr::ii<DataVector, 3, Frame::Inertial>& spatial_metric,
+    const tnsr::II<DataVector, 3, Frame::Inertial>& inv_spatial_metric) {
+  Variables<closure_fluid_tags> fluid_quantities{
+      get(fluid_lorentz_factor).size()};
+  compute_closure_fluid_quantities(make_not_null(&fluid_quantities),
+                                   fluid_velocity, fluid_lorentz_factor,
+                                   spatial_metric);
+  compute_closure_impl(closure_factor, pressure_tensor, comoving_energy_density,
+                       comoving_momentum_density_normal,
+                       comoving_momentum_density_spatial, energy_density,
+                       momentum_density, fluid_velocity, fluid_lorentz_factor,
+                       fluid_quantities, inv_spatial_metric);
+}
 }  // namespace RadiationTransport::M1Grey::detail
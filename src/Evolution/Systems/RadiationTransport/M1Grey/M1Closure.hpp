@@ -7,6 +7,7 @@
 #pragma once
 
 #include "DataStructures/Tensor/TypeAliases.hpp"
+#include "DataStructures/Variables.hpp"
 #include "Evolution/Systems/RadiationTransport/M1Grey/Tags.hpp"
 #include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
 #include "PointwiseFunctions/Hydro/Tags.hpp"
@@ -23,6 +24,33 @@ namespace M1Grey {
 // Implementation of the M1 closure for an
 // individual species
 namespace detail {
+// Fluid quantities needed by the closure, which are computed once and shared
+// by all neutrino species
+using closure_fluid_tags =
+    tmpl::list<hydro::Tags::LorentzFactorSquared<DataVector>,
+               hydro::Tags::SpatialVelocitySquared<DataVector>,
+               hydro::Tags::SpatialVelocityOneForm<DataVector, 3>>;
+
+void compute_closure_fluid_quantities(
+    gsl::not_null<Variables<closure_fluid_tags>*> fluid_quantities,
+    const tnsr::I<DataVector, 3, Frame::Inertial>& fluid_velocity,
+    const Scalar<DataVector>& fluid_lorentz_factor,
+    const tnsr::ii<DataVector, 3, Frame::Inertial>& spatial_metric);
+
+void compute_closure_impl(
+    gsl::not_null<Scalar<DataVector>*> closure_factor,
+    gsl::not_null<tnsr::II<DataVector, 3, Frame::Inertial>*> pressure_tensor,
+    gsl::not_null<Scalar<DataVector>*> comoving_energy_density,
+    gsl::not_null<Scalar<DataVector>*> comoving_momentum_density_normal,
+    gsl::not_null<tnsr::i<DataVector, 3, Frame::Inertial>*>
+        comoving_momentum_density_spatial,
+    const Scalar<DataVector>& energy_density,
+    const tnsr::i<DataVector, 3, Frame::Inertial>& momentum_density,
+    const tnsr::I<DataVector, 3, Frame::Inertial>& fluid_velocity,
+    const Scalar<DataVector>& fluid_lorentz_factor,
+    const Variables<closure_fluid_tags>& fluid_quantities,
+    const tnsr::II<DataVector, 3, Frame::Inertial>& inv_spatial_metric);
+
 void compute_closure_impl(
     gsl::not_null<Scalar<DataVector>*> closure_factor,
     gsl::not_null<tnsr::II<DataVector, 3, Frame::Inertial>*> pressure_tensor,
@@ -98,9 +126,11 @@ struct ComputeM1Closure;
  * \f}
  * for a given \f$\xi\f$ only requires recomputing \f$d_{\rm thin,thick}\f$
  * and their derivatives with respect to \f$\xi\f$.
- * We perform the root-finding using a Newton-Raphson algorithm, with the
- * accuracy set by the variable root_find_number_of_digits (6 significant digits
- * at the moment).
+ * We perform the root-finding using the TOMS748 algorithm. The points that
+ * need a root find are gathered into contiguous arrays and solved a SIMD
+ * batch at a time, with each lane of a batch converging independently. The
+ * fluid quantities that do not depend on the neutrino moments are computed
+ * once and shared by all species.
  *
  * The function returns the closure factors \f$\xi\f$ (to be used as initial
  * guess for this function at the next step), the pressure tensor \f$P_{ij}\f$,
@@ -145,9 +175,15 @@ struct ComputeM1Closure<tmpl::list<NeutrinoSpecies...>> {
       const Scalar<DataVector>& lorentz_factor,
       const tnsr::ii<DataVector, 3>& spatial_metric,
       const tnsr::II<DataVector, 3>& inv_spatial_metric) {
+    Variables<detail::closure_fluid_tags> fluid_quantities{
+        get(lorentz_factor).size()};
+    detail::compute_closure_fluid_quantities(make_not_null(&fluid_quantities),
+                                             spatial_velocity, lorentz_factor,
+                                             spatial_metric);
     EXPAND_PACK_LEFT_TO_RIGHT(detail::compute_closure_impl(
         closure_factor, tilde_p, tilde_j, tilde_hn, tilde_hi, tilde_e, tilde_s,
-        spatial_velocity, lorentz_factor, spatial_metric, inv_spatial_metric));
+        spatial_velocity, lorentz_factor, fluid_quantities,
+        inv_spatial_metric));
   }
 };
 
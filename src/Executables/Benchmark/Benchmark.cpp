@@ -5,12 +5,19 @@
 #pragma GCC diagnostic ignored "-Wredundant-decls"
 #include <benchmark/benchmark.h>
 #pragma GCC diagnostic pop
+#include <array>
 #include <charm++.h>
+#include <cmath>
+#include <cstddef>
+#include <optional>
 #include <string>
+#include <type_traits>
 #include <vector>
 
+#include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
 #include "Domain/CoordinateMaps/Affine.hpp"
@@ -18,12 +25,41 @@
 #include "Domain/CoordinateMaps/CoordinateMap.tpp"
 #include "Domain/CoordinateMaps/ProductMaps.hpp"
 #include "Domain/CoordinateMaps/ProductMaps.tpp"
+#include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/DirectionMap.hpp"
 #include "Domain/Structure/Element.hpp"
+#include "Domain/Structure/Side.hpp"
+#include "Evolution/DiscontinuousGalerkin/ApplyOnTiles.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/BoundaryCorrections/Hll.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/BoundaryCorrections/Rusanov.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/System.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/Tags.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/Constraints.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/DampedHarmonic.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/Tags.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/TimeDerivative.hpp"
+#include "Evolution/Systems/RadiationTransport/M1Grey/M1Closure.hpp"
+#include "Evolution/Systems/RadiationTransport/M1Grey/Tags.hpp"
+#include "Evolution/Systems/RadiationTransport/Tags.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/Formulation.hpp"
+#include "NumericalAlgorithms/FiniteDifference/AoWeno.hpp"
+#include "NumericalAlgorithms/FiniteDifference/Minmod.hpp"
+#include "NumericalAlgorithms/FiniteDifference/MonotonicityPreserving5.hpp"
+#include "NumericalAlgorithms/FiniteDifference/MonotonisedCentral.hpp"
+#include "NumericalAlgorithms/FiniteDifference/PositivityPreservingAdaptiveOrder.hpp"
+#include "NumericalAlgorithms/FiniteDifference/Wcns5z.hpp"
 #include "NumericalAlgorithms/LinearOperators/PartialDerivatives.tpp"
 #include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "NumericalAlgorithms/SphericalHarmonics/Spherepack.hpp"
+#include "PointwiseFunctions/GeneralRelativity/Christoffel.hpp"
+#include "PointwiseFunctions/GeneralRelativity/GeneralizedHarmonic/SpacetimeDerivativeOfSpacetimeMetric.hpp"
+#include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
+#include "PointwiseFunctions/Hydro/Tags.hpp"
 #include "PointwiseFunctions/MathFunctions/PowX.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
 
 // Charm looks for this function but since we build without a main function or
 // main module we just have it be empty
@@ -108,6 +144,519 @@ void bench_all_gradient(benchmark::State& state) {  // NOLINT
 BENCHMARK(bench_all_gradient);  // NOLINT
 }  // namespace
 
+namespace {
+// In this anonymous namespace are microbenchmarks of the FD reconstruction
+// schemes used on the DG-subcell grid. The bulk of the reconstruction is
+// vectorized for the reconstructors that support it when SpECTRE is built with
+// xsimd.
+
+// Sets up the volume and ghost data of an element with `pts_1d`^3 cells and
+// five reconstructed variables, then times the `reconstruct` invocable.
+template <size_t StencilWidth, typename F>
+void bench_fd_reconstruction(benchmark::State& state,  // NOLINT
+                             const F& reconstruct) {
+  constexpr size_t Dim = 3;
+  constexpr size_t number_of_variables = 5;
+  constexpr size_t ghost_zone_size = (StencilWidth - 1) / 2 + 1;
+  const size_t pts_1d = static_cast<size_t>(state.range(0));
+  const Index<Dim> extents{pts_1d};
+  const size_t volume_size = extents.product() * number_of_variables;
+  const size_t ghost_size =
+      extents.slice_away(0).product() * ghost_zone_size * number_of_variables;
+  const size_t face_size =
+      extents.slice_away(0).product() * (pts_1d + 1) * number_of_variables;
+
+  // Smooth data with a few extrema so that the limiters do some work
+  const auto make_data = [](const size_t size, const double offset) {
+    DataVector data(size);
+    for (size_t i = 0; i < size; ++i) {
+      data[i] = 2.0 + sin(0.3 * static_cast<double>(i) + offset);
+    }
+    return data;
+  };
+  const DataVector volume_vars = make_data(volume_size, 0.0);
+  DirectionMap<Dim, DataVector> ghost_data{};
+  DirectionMap<Dim, gsl::span<const double>> ghost_cell_vars{};
+  for (const auto& direction : Direction<Dim>::all_directions()) {
+    ghost_data[direction] = make_data(
+        ghost_size, 1.0 + static_cast<double>(direction.dimension()) +
+                        (direction.side() == Side::Upper ? 0.5 : 0.0));
+    const DataVector& data = ghost_data.at(direction);
+    ghost_cell_vars[direction] = gsl::make_span(data.data(), data.size());
+  }
+  DataVector upper_buffer(Dim * face_size);
+  DataVector lower_buffer(Dim * face_size);
+  std::array<gsl::span<double>, Dim> upper{};
+  std::array<gsl::span<double>, Dim> lower{};
+  for (size_t d = 0; d < Dim; ++d) {
+    gsl::at(upper, d) =
+        gsl::make_span(upper_buffer.data() + d * face_size, face_size);
+    gsl::at(lower, d) =
+        gsl::make_span(lower_buffer.data() + d * face_size, face_size);
+  }
+
+  while (state.KeepRunning()) {
+    reconstruct(make_not_null(&upper), make_not_null(&lower),
+                gsl::make_span(volume_vars.data(), volume_vars.size()),
+                ghost_cell_vars, extents, number_of_variables);
+    benchmark::DoNotOptimize(upper_buffer.data());
+    benchmark::DoNotOptimize(lower_buffer.data());
+    benchmark::ClobberMemory();
+  }
+}
+
+void bench_minmod(benchmark::State& state) {  // NOLINT
+  bench_fd_reconstruction<3>(state, [](const auto&... args) {
+    fd::reconstruction::minmod(args...);
+  });
+}
+BENCHMARK(bench_minmod)->Arg(6)->Arg(12);  // NOLINT
+
+void bench_monotonised_central(benchmark::State& state) {  // NOLINT
+  bench_fd_reconstruction<3>(state, [](const auto&... args) {
+    fd::reconstruction::monotonised_central(args...);
+  });
+}
+BENCHMARK(bench_monotonised_central)->Arg(6)->Arg(12);  // NOLINT
+
+void bench_mp5(benchmark::State& state) {  // NOLINT
+  bench_fd_reconstruction<5>(state, [](const auto&... args) {
+    fd::reconstruction::monotonicity_preserving_5(args..., 4.0, 1.0e-10);
+  });
+}
+BENCHMARK(bench_mp5)->Arg(6)->Arg(12);  // NOLINT
+
+void bench_wcns5z(benchmark::State& state) {  // NOLINT
+  bench_fd_reconstruction<5>(state, [](const auto&... args) {
+    fd::reconstruction::wcns5z<2, fd::reconstruction::detail::
+                                      MonotonisedCentralReconstructor>(
+        args..., 1.0e-42, 1);
+  });
+}
+BENCHMARK(bench_wcns5z)->Arg(6)->Arg(12);  // NOLINT
+
+void bench_aoweno_53(benchmark::State& state) {  // NOLINT
+  bench_fd_reconstruction<5>(state, [](const auto&... args) {
+    fd::reconstruction::aoweno_53<2>(args..., 0.85, 0.999, 1.0e-12);
+  });
+}
+BENCHMARK(bench_aoweno_53)->Arg(6)->Arg(12);  // NOLINT
+
+void bench_positivity_preserving_adaptive_order(  // NOLINT
+    benchmark::State& state) {
+  bench_fd_reconstruction<5>(state, [](const auto&... args) {
+    fd::reconstruction::positivity_preserving_adaptive_order<
+        fd::reconstruction::detail::MonotonisedCentralReconstructor, true,
+        false, false>(args..., 4.0, 6.0, 8.0);
+  });
+}
+BENCHMARK(bench_positivity_preserving_adaptive_order)  // NOLINT
+    ->Arg(6)
+    ->Arg(12);
+}  // namespace
+
+namespace {
+// In this anonymous namespace is a microbenchmark of the GH volume time
+// derivative on an element with 10^3 grid points, evaluated on the whole
+// element (argument 0) or on tiles of the given number of grid points. The
+// difference in memory bandwidth can be measured with e.g.
+// `perf stat -e LLC-load-misses`.
+void bench_gh_time_derivative(benchmark::State& state) {  // NOLINT
+  constexpr size_t Dim = 3;
+  const Mesh<Dim> mesh{10, Spectral::Basis::Legendre,
+                       Spectral::Quadrature::GaussLobatto};
+  const size_t number_of_points = mesh.number_of_grid_points();
+  const size_t tile_size = static_cast<size_t>(state.range(0));
+
+  using gh_tags = tmpl::list<gr::Tags::SpacetimeMetric<DataVector, Dim>,
+                             gh::Tags::Pi<DataVector, Dim>,
+                             gh::Tags::Phi<DataVector, Dim>>;
+  using deriv_tags =
+      db::wrap_tags_in<::Tags::deriv, gh_tags, tmpl::size_t<Dim>,
+                       Frame::Inertial>;
+  using dt_tags = db::wrap_tags_in<::Tags::dt, gh_tags>;
+  using temporary_tags = typename gh::TimeDerivative<Dim>::temporary_tags;
+
+  // A perturbed Minkowski spacetime
+  Variables<gh_tags> vars(number_of_points, 0.0);
+  Variables<deriv_tags> deriv_vars(number_of_points, 0.0);
+  for (size_t i = 0; i < number_of_points; ++i) {
+    const double perturbation = 1.0e-3 * sin(static_cast<double>(i));
+    for (size_t c = 0; c < vars.number_of_independent_components; ++c) {
+      vars.data()[c * number_of_points + i] =
+          perturbation * static_cast<double>(c % 7);
+    }
+    for (size_t c = 0; c < deriv_vars.number_of_independent_components; ++c) {
+      deriv_vars.data()[c * number_of_points + i] =
+          perturbation * static_cast<double>(c % 5);
+    }
+  }
+  auto& spacetime_metric =
+      get<gr::Tags::SpacetimeMetric<DataVector, Dim>>(vars);
+  get<0, 0>(spacetime_metric) -= 1.0;
+  for (size_t i = 0; i < Dim; ++i) {
+    spacetime_metric.get(i + 1, i + 1) += 1.0;
+  }
+  const Scalar<DataVector> gamma{number_of_points, 1.0};
+  const gh::gauges::DampedHarmonic gauge_condition{
+      100., std::array{1.2, 1.5, 1.7}, std::array{2, 4, 6}};
+  const auto logical_coords = logical_coordinates(mesh);
+  tnsr::I<DataVector, Dim, Frame::Inertial> inertial_coords{};
+  for (size_t i = 0; i < Dim; ++i) {
+    inertial_coords.get(i) = 10.0 + logical_coords.get(i);
+  }
+  InverseJacobian<DataVector, Dim, Frame::ElementLogical, Frame::Inertial>
+      inv_jac{number_of_points, 0.0};
+  for (size_t i = 0; i < Dim; ++i) {
+    inv_jac.get(i, i) = 1.0;
+  }
+  const std::optional<tnsr::I<DataVector, Dim, Frame::Inertial>>
+      mesh_velocity{};
+
+  Variables<dt_tags> dt_vars(number_of_points);
+  Variables<temporary_tags> temporaries(number_of_points);
+  const auto apply = [](const auto&... args) {
+    gh::TimeDerivative<Dim>::apply(args...);
+  };
+  const auto evaluate = [&](const auto& call, auto... temporary_tags_v) {
+    call(make_not_null(
+             &get<::Tags::dt<gr::Tags::SpacetimeMetric<DataVector, Dim>>>(
+                 dt_vars)),
+         make_not_null(
+             &get<::Tags::dt<gh::Tags::Pi<DataVector, Dim>>>(dt_vars)),
+         make_not_null(
+             &get<::Tags::dt<gh::Tags::Phi<DataVector, Dim>>>(dt_vars)),
+         make_not_null(
+             &get<tmpl::type_from<decltype(temporary_tags_v)>>(temporaries))...,
+         get<tmpl::at_c<deriv_tags, 0>>(deriv_vars),
+         get<tmpl::at_c<deriv_tags, 1>>(deriv_vars),
+         get<tmpl::at_c<deriv_tags, 2>>(deriv_vars), spacetime_metric,
+         get<gh::Tags::Pi<DataVector, Dim>>(vars),
+         get<gh::Tags::Phi<DataVector, Dim>>(vars), gamma, gamma, gamma,
+         gauge_condition, mesh, 0.0, inertial_coords, inv_jac, mesh_velocity);
+  };
+  const auto evaluate_all = [&evaluate](const auto& call) {
+    tmpl::as_pack<temporary_tags>([&evaluate, &call](auto... tags_v) {
+      evaluate(call, tags_v...);
+    });
+  };
+
+  while (state.KeepRunning()) {
+    if (tile_size == 0) {
+      evaluate_all(apply);
+    } else {
+      evaluate_all([&apply, &number_of_points, &tile_size](
+                       const auto&... args) {
+        evolution::dg::apply_on_tiles(apply, number_of_points, tile_size,
+                                      args...);
+      });
+    }
+    benchmark::DoNotOptimize(dt_vars.data());
+    benchmark::ClobberMemory();
+  }
+}
+BENCHMARK(bench_gh_time_derivative)  // NOLINT
+    ->Arg(0)
+    ->Arg(64)
+    ->Arg(128)
+    ->Arg(256);
+}  // namespace
+
+namespace {
+// In this anonymous namespace is a microbenchmark of the GRMHD Riemann solvers
+// on the faces of an FD subcell grid with `state.range(0)`^3 cells in one
+// direction, i.e. (n + 1) n^2 face points. The second argument selects the
+// Rusanov (0) or HLL (1) boundary correction.
+template <typename BoundaryCorrection>
+void bench_grmhd_boundary_terms_impl(benchmark::State& state,  // NOLINT
+                                     const size_t number_of_points) {
+  using field_tags = typename BoundaryCorrection::dg_package_field_tags;
+  Variables<field_tags> interior(number_of_points);
+  Variables<field_tags> exterior(number_of_points);
+  for (size_t i = 0; i < number_of_points; ++i) {
+    const double perturbation = 1.0e-3 * sin(static_cast<double>(i));
+    for (size_t c = 0; c < interior.number_of_independent_components; ++c) {
+      interior.data()[c * number_of_points + i] =
+          1.0 + perturbation * static_cast<double>(c % 7);
+      exterior.data()[c * number_of_points + i] =
+          1.0 - perturbation * static_cast<double>(c % 5);
+    }
+  }
+  if constexpr (std::is_same_v<BoundaryCorrection,
+                               grmhd::ValenciaDivClean::BoundaryCorrections::
+                                   Hll>) {
+    // Ingoing speeds must be negative
+    get(get<typename BoundaryCorrection::LargestIngoingCharSpeed>(interior)) *=
+        -1.0;
+    get(get<typename BoundaryCorrection::LargestIngoingCharSpeed>(exterior)) *=
+        -1.0;
+  }
+  Variables<typename grmhd::ValenciaDivClean::System::variables_tag::tags_list>
+      corrections(number_of_points);
+
+  while (state.KeepRunning()) {
+    tmpl::as_pack<field_tags>([&](auto... tags_v) {
+      BoundaryCorrection::dg_boundary_terms(
+          make_not_null(
+              &get<grmhd::ValenciaDivClean::Tags::TildeD>(corrections)),
+          make_not_null(
+              &get<grmhd::ValenciaDivClean::Tags::TildeYe>(corrections)),
+          make_not_null(
+              &get<grmhd::ValenciaDivClean::Tags::TildeTau>(corrections)),
+          make_not_null(
+              &get<grmhd::ValenciaDivClean::Tags::TildeS<>>(corrections)),
+          make_not_null(
+              &get<grmhd::ValenciaDivClean::Tags::TildeB<>>(corrections)),
+          make_not_null(
+              &get<grmhd::ValenciaDivClean::Tags::TildePhi>(corrections)),
+          get<tmpl::type_from<decltype(tags_v)>>(interior)...,
+          get<tmpl::type_from<decltype(tags_v)>>(exterior)...,
+          ::dg::Formulation::StrongInertial);
+    });
+    benchmark::DoNotOptimize(corrections.data());
+    benchmark::ClobberMemory();
+  }
+}
+
+void bench_grmhd_boundary_terms(benchmark::State& state) {  // NOLINT
+  const size_t cells_1d = static_cast<size_t>(state.range(0));
+  const size_t number_of_points = (cells_1d + 1) * cells_1d * cells_1d;
+  if (state.range(1) == 0) {
+    bench_grmhd_boundary_terms_impl<
+        grmhd::ValenciaDivClean::BoundaryCorrections::Rusanov>(
+        state, number_of_points);
+  } else {
+    bench_grmhd_boundary_terms_impl<
+        grmhd::ValenciaDivClean::BoundaryCorrections::Hll>(state,
+                                                           number_of_points);
+  }
+}
+BENCHMARK(bench_grmhd_boundary_terms)  // NOLINT
+    ->Args({6, 0})
+    ->Args({6, 1})
+    ->Args({12, 0})
+    ->Args({12, 1});
+}  // namespace
+
+namespace {
+// In this anonymous namespace are microbenchmarks of GR functions contracting
+// tensors that are symmetric in their last two indices, on an element with
+// `state.range(0)`^3 grid points: the first kind Christoffel symbols (second
+// argument 0), the spacetime derivative of the spacetime metric (1), and the
+// GH gauge constraint (2).
+void bench_symmetric_contractions(benchmark::State& state) {  // NOLINT
+  constexpr size_t Dim = 3;
+  const size_t pts_1d = static_cast<size_t>(state.range(0));
+  const size_t number_of_points = pts_1d * pts_1d * pts_1d;
+
+  using tags = tmpl::list<
+      gr::Tags::Lapse<DataVector>, gr::Tags::Shift<DataVector, Dim>,
+      gr::Tags::SpacetimeNormalOneForm<DataVector, Dim>,
+      gr::Tags::SpacetimeNormalVector<DataVector, Dim>,
+      gr::Tags::InverseSpatialMetric<DataVector, Dim>,
+      gr::Tags::InverseSpacetimeMetric<DataVector, Dim>,
+      gh::Tags::Pi<DataVector, Dim>, gh::Tags::Phi<DataVector, Dim>,
+      gh::Tags::GaugeH<DataVector, Dim>>;
+  Variables<tags> vars(number_of_points);
+  for (size_t i = 0; i < number_of_points; ++i) {
+    const double perturbation = 1.0e-3 * sin(static_cast<double>(i));
+    for (size_t c = 0; c < vars.number_of_independent_components; ++c) {
+      vars.data()[c * number_of_points + i] =
+          1.0 + perturbation * static_cast<double>(c % 7);
+    }
+  }
+  tnsr::abb<DataVector, Dim> d_spacetime_metric(number_of_points);
+  tnsr::abb<DataVector, Dim> christoffel(number_of_points);
+  tnsr::a<DataVector, Dim> gauge_constraint(number_of_points);
+  gh::spacetime_derivative_of_spacetime_metric(
+      make_not_null(&d_spacetime_metric),
+      get<gr::Tags::Lapse<DataVector>>(vars),
+      get<gr::Tags::Shift<DataVector, Dim>>(vars),
+      get<gh::Tags::Pi<DataVector, Dim>>(vars),
+      get<gh::Tags::Phi<DataVector, Dim>>(vars));
+
+  const auto function = state.range(1);
+  while (state.KeepRunning()) {
+    if (function == 0) {
+      gr::christoffel_first_kind(make_not_null(&christoffel),
+                                 d_spacetime_metric);
+      benchmark::DoNotOptimize(christoffel[0].data());
+    } else if (function == 1) {
+      gh::spacetime_derivative_of_spacetime_metric(
+          make_not_null(&d_spacetime_metric),
+          get<gr::Tags::Lapse<DataVector>>(vars),
+          get<gr::Tags::Shift<DataVector, Dim>>(vars),
+          get<gh::Tags::Pi<DataVector, Dim>>(vars),
+          get<gh::Tags::Phi<DataVector, Dim>>(vars));
+      benchmark::DoNotOptimize(d_spacetime_metric[0].data());
+    } else {
+      gh::gauge_constraint(
+          make_not_null(&gauge_constraint),
+          get<gh::Tags::GaugeH<DataVector, Dim>>(vars),
+          get<gr::Tags::SpacetimeNormalOneForm<DataVector, Dim>>(vars),
+          get<gr::Tags::SpacetimeNormalVector<DataVector, Dim>>(vars),
+          get<gr::Tags::InverseSpatialMetric<DataVector, Dim>>(vars),
+          get<gr::Tags::InverseSpacetimeMetric<DataVector, Dim>>(vars),
+          get<gh::Tags::Pi<DataVector, Dim>>(vars),
+          get<gh::Tags::Phi<DataVector, Dim>>(vars));
+      benchmark::DoNotOptimize(gauge_constraint[0].data());
+    }
+    benchmark::ClobberMemory();
+  }
+}
+BENCHMARK(bench_symmetric_contractions)  // NOLINT
+    ->Args({5, 0})
+    ->Args({5, 1})
+    ->Args({5, 2})
+    ->Args({10, 0})
+    ->Args({10, 1})
+    ->Args({10, 2});
+}  // namespace
+
+namespace {
+// In this anonymous namespace is a microbenchmark of the grey M1 closure on an
+// element with `state.range(0)`^3 grid points, for one species (second
+// argument 1) or three species (3). The fluid moves, so every point that is
+// not in the optically thin or thick limit needs a root find.
+template <typename... Species>
+void bench_m1_closure_impl(benchmark::State& state,  // NOLINT
+                           const size_t number_of_points,
+                           tmpl::list<Species...> /*meta*/) {
+  using closure = RadiationTransport::M1Grey::ComputeM1Closure<
+      tmpl::list<Species...>>;
+  using tags = tmpl::append<typename closure::return_tags,
+                            typename closure::argument_tags>;
+  Variables<tags> vars(number_of_points, 0.0);
+  auto& spatial_metric = get<gr::Tags::SpatialMetric<DataVector, 3>>(vars);
+  auto& inv_spatial_metric =
+      get<gr::Tags::InverseSpatialMetric<DataVector, 3>>(vars);
+  auto& fluid_velocity = get<hydro::Tags::SpatialVelocity<DataVector, 3>>(vars);
+  for (size_t i = 0; i < 3; ++i) {
+    spatial_metric.get(i, i) = 1.0;
+    inv_spatial_metric.get(i, i) = 1.0;
+  }
+  for (size_t s = 0; s < number_of_points; ++s) {
+    const double x = static_cast<double>(s);
+    fluid_velocity.get(0)[s] = 0.3 * sin(x);
+    fluid_velocity.get(1)[s] = 0.2 * cos(x);
+    fluid_velocity.get(2)[s] = 0.1;
+    const double v_sqr = square(fluid_velocity.get(0)[s]) +
+                         square(fluid_velocity.get(1)[s]) +
+                         square(fluid_velocity.get(2)[s]);
+    get(get<hydro::Tags::LorentzFactor<DataVector>>(vars))[s] =
+        1.0 / sqrt(1.0 - v_sqr);
+  }
+  tmpl::for_each<tmpl::list<Species...>>([&vars, &number_of_points](
+                                             auto species_v) {
+    using species = tmpl::type_from<decltype(species_v)>;
+    auto& tilde_e =
+        get<RadiationTransport::M1Grey::Tags::TildeE<Frame::Inertial, species>>(
+            vars);
+    auto& tilde_s =
+        get<RadiationTransport::M1Grey::Tags::TildeS<Frame::Inertial, species>>(
+            vars);
+    for (size_t s = 0; s < number_of_points; ++s) {
+      // |S| / E varies between 0.1 and 0.9
+      const double flux_factor = 0.5 + 0.4 * sin(0.7 * static_cast<double>(s));
+      get(tilde_e)[s] = 1.0;
+      get<0>(tilde_s)[s] = 0.6 * flux_factor;
+      get<1>(tilde_s)[s] = 0.8 * flux_factor;
+    }
+  });
+
+  while (state.KeepRunning()) {
+    tmpl::as_pack<tags>([&vars](auto... tags_v) {
+      const auto arguments = [&vars](auto tag_v) -> decltype(auto) {
+        using tag = tmpl::type_from<decltype(tag_v)>;
+        if constexpr (tmpl::list_contains_v<typename closure::return_tags,
+                                            tag>) {
+          return make_not_null(&get<tag>(vars));
+        } else {
+          return std::as_const(get<tag>(vars));
+        }
+      };
+      closure::apply(arguments(tags_v)...);
+    });
+    benchmark::DoNotOptimize(vars.data());
+    benchmark::ClobberMemory();
+  }
+}
+
+void bench_m1_closure(benchmark::State& state) {  // NOLINT
+  const size_t pts_1d = static_cast<size_t>(state.range(0));
+  const size_t number_of_points = pts_1d * pts_1d * pts_1d;
+  if (state.range(1) == 1) {
+    bench_m1_closure_impl(state, number_of_points,
+                          tmpl::list<neutrinos::ElectronNeutrinos<1>>{});
+  } else {
+    bench_m1_closure_impl(
+        state, number_of_points,
+        tmpl::list<neutrinos::ElectronNeutrinos<1>,
+                   neutrinos::ElectronAntiNeutrinos<1>,
+                   neutrinos::HeavyLeptonNeutrinos<0>>{});
+  }
+}
+BENCHMARK(bench_m1_closure)  // NOLINT
+    ->Args({6, 1})
+    ->Args({6, 3})
+    ->Args({8, 1})
+    ->Args({8, 3})
+    ->Args({10, 1})
+    ->Args({10, 3});
+}  // namespace
+
+namespace {
+// In this anonymous namespace is a microbenchmark of Spherepack transforms of
+// several fields at resolution `state.range(0)`, transforming
+// `state.range(1)` fields to spectral space and back either one field at a
+// time (third argument 0) or in a single batched transform (1).
+void bench_spherepack_transforms(benchmark::State& state) {  // NOLINT
+  const auto l_max = static_cast<size_t>(state.range(0));
+  const auto number_of_fields = static_cast<size_t>(state.range(1));
+  const bool batched = state.range(2) == 1;
+  const ylm::Spherepack ylm{l_max, l_max};
+
+  const DataVector theta = ylm.theta_phi_points()[0];
+  std::vector<DataVector> values(number_of_fields);
+  std::vector<DataVector> coefs(number_of_fields,
+                                DataVector(ylm.spectral_size()));
+  std::vector<double*> values_ptrs(number_of_fields);
+  std::vector<const double*> const_values_ptrs(number_of_fields);
+  std::vector<double*> coefs_ptrs(number_of_fields);
+  std::vector<const double*> const_coefs_ptrs(number_of_fields);
+  for (size_t field = 0; field < number_of_fields; ++field) {
+    values[field] = 1.0 + 0.1 * cos(static_cast<double>(field + 1) * theta);
+    values_ptrs[field] = values[field].data();
+    const_values_ptrs[field] = values[field].data();
+    coefs_ptrs[field] = coefs[field].data();
+    const_coefs_ptrs[field] = coefs[field].data();
+  }
+
+  while (state.KeepRunning()) {
+    if (batched) {
+      ylm.phys_to_spec(coefs_ptrs, const_values_ptrs);
+      ylm.spec_to_phys(values_ptrs, const_coefs_ptrs);
+    } else {
+      for (size_t field = 0; field < number_of_fields; ++field) {
+        ylm.phys_to_spec(make_not_null(coefs_ptrs[field]),
+                         make_not_null(const_values_ptrs[field]));
+        ylm.spec_to_phys(make_not_null(values_ptrs[field]),
+                         make_not_null(const_coefs_ptrs[field]));
+      }
+    }
+    benchmark::DoNotOptimize(values.data());
+    benchmark::ClobberMemory();
+  }
+}
+BENCHMARK(bench_spherepack_transforms)  // NOLINT
+    ->Args({12, 3, 0})
+    ->Args({12, 3, 1})
+    ->Args({24, 3, 0})
+    ->Args({24, 3, 1})
+    ->Args({24, 8, 0})
+    ->Args({24, 8, 1});
+}  // namespace
+
 // Ignore the warning about an extra ';' because some versions of benchmark
 // require it
 #pragma GCC diagnostic push
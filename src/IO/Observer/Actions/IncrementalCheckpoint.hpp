@@ -0,0 +1,252 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "IO/Observer/IncrementalCheckpoint.hpp"
+#include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
+#include "IO/Observer/Tags.hpp"
+#include "Parallel/ArrayComponentId.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/Local.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Parallel/Tags/ArrayIndex.hpp"
+#include "Parallel/Tags/DistributedObjectTags.hpp"
+#include "Parallel/Tags/Metavariables.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/ErrorHandling/ExpectsAndEnsures.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace observers {
+/// The mutable DataBox items of an element that are owned by the parallel
+/// runtime, so they are neither written to nor restored from incremental
+/// checkpoints
+template <typename Metavariables, typename ArrayIndex>
+using incremental_checkpoint_excluded_tags =
+    tmpl::push_back<Parallel::Tags::distributed_object_tags<Metavariables,
+                                                            ArrayIndex>,
+                    Parallel::Tags::GlobalCacheImpl<Metavariables>>;
+
+namespace ThreadedActions {
+/*!
+ * \brief Commit the incremental checkpoint at `observation_id` to the file
+ * `file_name` once all contributors registered with this node for the
+ * observation have written their snapshot.
+ *
+ * \details The contributors are the `observers::Observer` branches on this
+ * node, or the elements themselves for nodegroup element collections. Since
+ * the contributors are the ones registered for the observation, elements may
+ * be created and destroyed, e.g. by mesh refinement, between snapshots.
+ */
+struct CommitIncrementalCheckpoint {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const gsl::not_null<Parallel::NodeLock*> node_lock,
+                    const ObservationId& observation_id,
+                    const Parallel::ArrayComponentId& sender_array_id,
+                    const std::string& file_name) {
+    const std::lock_guard hold_lock(*node_lock);
+    // Only access the tags through the node lock so we don't lock the whole
+    // DataBox
+    auto& contributors =
+        db::get_mutable_reference<Tags::ContributorsOfIncrementalCheckpoint>(
+            make_not_null(&box));
+    const auto& expected_contributors =
+        db::get<Tags::ExpectedContributorsForObservations>(box);
+    auto& contributed = contributors[observation_id];
+    if (UNLIKELY(not contributed.insert(sender_array_id).second)) {
+      ERROR("Already received the incremental checkpoint at "
+            << observation_id << " from array component id "
+            << sender_array_id);
+    }
+    const auto expected =
+        expected_contributors.find(observation_id.observation_key());
+    if (UNLIKELY(expected == expected_contributors.end())) {
+      ERROR("Couldn't find registration key "
+            << observation_id.observation_key()
+            << " for the incremental checkpoint in the registered observers.");
+    }
+    if (contributed.size() == expected->second.size()) {
+      db::get_mutable_reference<Tags::IncrementalCheckpointWriters>(
+          make_not_null(&box))
+          .at(file_name)
+          .commit(observation_id.value());
+      contributors.erase(observation_id);
+    }
+  }
+};
+}  // namespace ThreadedActions
+
+namespace Actions {
+/*!
+ * \brief Local synchronous action on the `observers::ObserverWriter` that
+ * returns a pointer to the `observers::IncrementalCheckpointWriter` of this
+ * node writing to `file_name`, creating it if necessary.
+ *
+ * \details The writer is thread-safe, so the pointer can be used without
+ * holding any lock. The pointer must only be treated as 'good' during the
+ * execution of the action from which this synchronous action is called, for the
+ * same reasons as for `observers::Actions::GetLockPointer`.
+ */
+struct GetIncrementalCheckpointWriter {
+  using return_type = IncrementalCheckpointWriter*;
+
+  template <typename ParallelComponent, typename DbTagList>
+  static return_type apply(db::DataBox<DbTagList>& box,
+                           const gsl::not_null<Parallel::NodeLock*> node_lock,
+                           const std::string& file_name) {
+    const std::lock_guard hold_lock(*node_lock);
+    // Only access the writers through the node lock so we don't lock the
+    // whole DataBox
+    auto& writers =
+        db::get_mutable_reference<Tags::IncrementalCheckpointWriters>(
+            make_not_null(&box));
+    auto writer = writers.find(file_name);
+    if (writer == writers.end()) {
+      writer =
+          writers.emplace(file_name, IncrementalCheckpointWriter{file_name})
+              .first;
+    }
+    return &writer->second;
+  }
+};
+
+/*!
+ * \brief Report to the `observers::Observer` that the element
+ * `sender_array_id` has written its incremental checkpoint at
+ * `observation_id` to the file `file_name`.
+ *
+ * \details Once all elements registered with this branch have written their
+ * snapshot, the branch reports to the local `observers::ObserverWriter` with
+ * `observers::ThreadedActions::CommitIncrementalCheckpoint`.
+ */
+struct ContributeIncrementalCheckpoint {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& array_index,
+                    const ObservationId& observation_id,
+                    const Parallel::ArrayComponentId& sender_array_id,
+                    const std::string& file_name) {
+    bool complete = false;
+    db::mutate<Tags::ContributorsOfIncrementalCheckpoint>(
+        [&complete, &observation_id, &sender_array_id](
+            const gsl::not_null<std::unordered_map<
+                ObservationId, std::unordered_set<Parallel::ArrayComponentId>>*>
+                contributors,
+            const std::unordered_map<
+                ObservationKey,
+                std::unordered_set<Parallel::ArrayComponentId>>&
+                observations_registered) {
+          auto& contributed = (*contributors)[observation_id];
+          if (UNLIKELY(not contributed.insert(sender_array_id).second)) {
+            ERROR("Already received the incremental checkpoint at "
+                  << observation_id << " from array component id "
+                  << sender_array_id);
+          }
+          const auto expected =
+              observations_registered.find(observation_id.observation_key());
+          if (UNLIKELY(expected == observations_registered.end())) {
+            ERROR("Couldn't find registration key "
+                  << observation_id.observation_key()
+                  << " for the incremental checkpoint in the registered "
+                     "observers.");
+          }
+          complete = contributed.size() == expected->second.size();
+          if (complete) {
+            contributors->erase(observation_id);
+          }
+        },
+        make_not_null(&box),
+        db::get<Tags::ExpectedContributorsForObservations>(box));
+    if (complete) {
+      auto& local_writer = *Parallel::local_branch(
+          Parallel::get_parallel_component<ObserverWriter<Metavariables>>(
+              cache));
+      Parallel::threaded_action<ThreadedActions::CommitIncrementalCheckpoint>(
+          local_writer, observation_id,
+          Parallel::make_array_component_id<ParallelComponent>(array_index),
+          file_name);
+    }
+  }
+};
+
+/*!
+ * \brief Local synchronous action on the `observers::ObserverWriter` that
+ * returns the items of the object `key` restored from the incremental
+ * checkpoint files with prefix `file_prefix`.
+ *
+ * \details The file of this node is read the first time this action is called
+ * on this node, using the most recent snapshot that was committed on all
+ * `number_of_nodes` nodes. The items are removed from the node once they have
+ * been returned, so every object can only be restored once.
+ */
+struct TakeRestoredItems {
+  using return_type = SerializedItems;
+
+  template <typename ParallelComponent, typename DbTagList>
+  static return_type apply(db::DataBox<DbTagList>& box,
+                           const gsl::not_null<Parallel::NodeLock*> node_lock,
+                           const std::string& file_prefix,
+                           const size_t number_of_nodes, const size_t node,
+                           const std::string& key) {
+    const std::lock_guard hold_lock(*node_lock);
+    const std::string file_name =
+        incremental_checkpoint_file_name(file_prefix, node);
+    auto& checkpoints =
+        db::get_mutable_reference<Tags::RestoredIncrementalCheckpoints>(
+            make_not_null(&box));
+    auto checkpoint = checkpoints.find(file_name);
+    if (checkpoint == checkpoints.end()) {
+      std::vector<std::string> file_names(number_of_nodes);
+      for (size_t i = 0; i < number_of_nodes; ++i) {
+        file_names[i] = incremental_checkpoint_file_name(file_prefix, i);
+      }
+      const std::optional<double> observation_value =
+          latest_committed_observation(file_names);
+      if (not observation_value.has_value()) {
+        ERROR("The incremental checkpoint files with prefix "
+              << file_prefix
+              << " don't hold a snapshot that is complete on all "
+              << number_of_nodes << " nodes.");
+      }
+      checkpoint =
+          checkpoints
+              .emplace(file_name,
+                       read_incremental_checkpoint(file_name,
+                                                   *observation_value))
+              .first;
+    }
+    auto& items = checkpoint->second.items;
+    const auto object_items = items.find(key);
+    if (object_items == items.end()) {
+      ERROR("The incremental checkpoint file "
+            << file_name << " doesn't hold a snapshot of " << key
+            << " at observation " << checkpoint->second.observation_value
+            << ". Restoring is only possible with the same elements on the "
+               "same nodes as when the snapshot was taken.");
+    }
+    SerializedItems result = std::move(object_items->second);
+    items.erase(object_items);
+    return result;
+  }
+};
+}  // namespace Actions
+}  // namespace observers
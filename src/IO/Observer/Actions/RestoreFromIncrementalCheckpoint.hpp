@@ -0,0 +1,75 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/SerializeItems.hpp"
+#include "IO/Observer/Actions/IncrementalCheckpoint.hpp"
+#include "IO/Observer/IncrementalCheckpoint.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
+#include "IO/Observer/Tags.hpp"
+#include "Parallel/AlgorithmExecution.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Info.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Utilities/GetOutput.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace observers::Actions {
+/*!
+ * \brief Restore the mutable items of the element's DataBox from the
+ * incremental checkpoint written by `Events::WriteIncrementalCheckpoint`.
+ *
+ * \details If `observers::Tags::RestoreFromIncrementalCheckpoint` holds a file
+ * prefix, the items of the element are read from the file of this node and
+ * replace the items in the DataBox. The most recent snapshot that was committed
+ * on all nodes is used, so a snapshot that was only partially written, e.g.
+ * because the run was killed, is ignored. Otherwise this action does nothing,
+ * so it can always be placed in the action list.
+ *
+ * All mutable items are replaced, including the time, the time stepper history
+ * and the mortar data, so this action must run after the initialization of the
+ * element and after self-starting the time stepper, which would otherwise
+ * overwrite the restored state. The items of the element are matched by the
+ * element's index, so the run must have the same elements on the same nodes as
+ * the run that wrote the checkpoint at the time of the snapshot.
+ */
+struct RestoreFromIncrementalCheckpoint {
+  using const_global_cache_tags =
+      tmpl::list<Tags::RestoreFromIncrementalCheckpoint>;
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ActionList,
+            typename ParallelComponent>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTagsList>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ArrayIndex& array_index, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    const std::optional<std::string>& file_prefix =
+        db::get<Tags::RestoreFromIncrementalCheckpoint>(box);
+    if (file_prefix.has_value()) {
+      auto& observer_writer =
+          Parallel::get_parallel_component<ObserverWriter<Metavariables>>(
+              cache);
+      const SerializedItems items =
+          Parallel::local_synchronous_action<TakeRestoredItems>(
+              observer_writer, *file_prefix,
+              Parallel::number_of_nodes<size_t>(cache),
+              Parallel::my_node<size_t>(cache), get_output(array_index));
+      db::deserialize_mutable_items<
+          incremental_checkpoint_excluded_tags<Metavariables, ArrayIndex>>(
+          make_not_null(&box), items);
+    }
+    return {Parallel::AlgorithmExecution::Continue, std::nullopt};
+  }
+};
+}  // namespace observers::Actions
@@ -0,0 +1,133 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <pup.h>
+#include <pup_stl.h>
+#include <string>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/Dat.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/Observer/Helpers.hpp"
+#include "IO/Observer/Tags.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Info.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace observers {
+/*!
+ * \brief The traced events of one action (or inbox tag, or phase) of one
+ * parallel component on one processing element (PE) `proc`, see
+ * `Parallel::tracing`.
+ *
+ * \details `summary` holds the columns of `summary_legend` except for the time
+ * and the PE, and each entry in `events` holds the columns of `events_legend`
+ * except for the node.
+ */
+struct ActionTrace {
+  std::string component{};
+  std::string name{};
+  size_t proc{};
+  std::vector<double> summary{};
+  std::vector<std::vector<double>> events{};
+
+  static std::vector<std::string> summary_legend() {
+    return {"Time",           "Proc",          "Calls",
+            "Retries",        "Messages",      "TotalWallTime",
+            "MaxWallTime",    "TotalQueueWait"};
+  }
+  static std::vector<std::string> events_legend() {
+    return {"Start", "Duration", "QueueWait", "Node", "Core", "Type"};
+  }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) {
+    p | component;
+    p | name;
+    p | proc;
+    p | summary;
+    p | events;
+  }
+};
+
+namespace ThreadedActions {
+/*!
+ * \brief Write the traces of the actions of the PEs of one process to the
+ * reduction file.
+ *
+ * \details For each trace, a row is appended to the dat file
+ * `/ActionTraces/<Component>/<Name>/Summary` and the events are appended to
+ * `/ActionTraces/<Component>/<Name>/Events`, with the columns listed in
+ * `observers::ActionTrace`. For each PE in `dropped_events`, the number of
+ * events that were dropped on the PE since the start of the run is appended
+ * to `/ActionTraces/DroppedEvents`.
+ */
+struct WriteActionTraces {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const gsl::not_null<Parallel::NodeLock*> /*node_lock*/,
+                    const double observation_value,
+                    const std::map<size_t, size_t>& dropped_events,
+                    const std::vector<ActionTrace>& traces) {
+    auto& reduction_file_lock =
+        db::get_mutable_reference<Tags::H5FileLock>(make_not_null(&box));
+    const std::lock_guard hold_lock(reduction_file_lock);
+    h5::H5File<h5::AccessType::ReadWrite> h5file(
+        Parallel::get<Tags::ReductionFileName>(cache) + ".h5", true,
+        observers::input_source_from_cache(cache));
+    constexpr size_t version_number = 0;
+    for (const ActionTrace& trace : traces) {
+      const std::string group =
+          "/ActionTraces/" + trace.component + "/" + trace.name;
+      std::vector<double> summary{observation_value,
+                                  static_cast<double>(trace.proc)};
+      summary.insert(summary.end(), trace.summary.begin(),
+                     trace.summary.end());
+      h5file.try_insert<h5::Dat>(group + "/Summary",
+                                 ActionTrace::summary_legend(), version_number)
+          .append(summary);
+      h5file.close_current_object();
+      if (not trace.events.empty()) {
+        const auto node =
+            static_cast<double>(Parallel::node_of<size_t>(trace.proc, cache));
+        std::vector<std::vector<double>> events = trace.events;
+        for (auto& event : events) {
+          // Insert the node after start, duration and queue wait
+          event.insert(event.begin() + 3, node);
+        }
+        h5file.try_insert<h5::Dat>(group + "/Events",
+                                   ActionTrace::events_legend(),
+                                   version_number)
+            .append(events);
+        h5file.close_current_object();
+      }
+    }
+    if (not dropped_events.empty()) {
+      std::vector<std::vector<double>> rows{};
+      for (const auto& [proc, number_of_dropped_events] : dropped_events) {
+        rows.push_back({observation_value, static_cast<double>(proc),
+                        static_cast<double>(number_of_dropped_events)});
+      }
+      h5file
+          .try_insert<h5::Dat>("/ActionTraces/DroppedEvents",
+                               std::vector<std::string>{"Time", "Proc",
+                                                        "DroppedEvents"},
+                               version_number)
+          .append(rows);
+      h5file.close_current_object();
+    }
+  }
+};
+}  // namespace ThreadedActions
+}  // namespace observers
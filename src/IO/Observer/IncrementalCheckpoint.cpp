@@ -0,0 +1,511 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "IO/Observer/IncrementalCheckpoint.hpp"
+
+#include <algorithm>
+#include <array>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <pup.h>
+#include <pup_stl.h>
+#include <set>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/FileSystem.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace observers {
+namespace {
+// The file starts with `file_magic` followed by the format version
+constexpr std::array<char, 8> file_magic{'S', 'p', 'E', 'C', 'T', 'R',
+                                          'E', 'I'};
+constexpr uint64_t file_version = 1;
+constexpr size_t file_header_size = file_magic.size() + sizeof(uint64_t);
+
+// Every record starts with the record type, the observation value and the size
+// of the payload that follows
+enum class RecordType : uint64_t { Items = 0, Commit = 1 };
+constexpr size_t record_header_size = 3 * sizeof(uint64_t);
+
+struct Record {
+  RecordType type{RecordType::Items};
+  double observation_value{};
+  std::string key{};
+  SerializedItems items{};
+};
+
+void append_uint64(const gsl::not_null<std::vector<char>*> buffer,
+                   const uint64_t value) {
+  for (size_t i = 0; i < sizeof(uint64_t); ++i) {
+    buffer->push_back(static_cast<char>((value >> (8 * i)) & 0xffU));
+  }
+}
+
+void append_string(const gsl::not_null<std::vector<char>*> buffer,
+                   const std::string& value) {
+  append_uint64(buffer, value.size());
+  buffer->insert(buffer->end(), value.begin(), value.end());
+}
+
+uint64_t double_to_bits(const double value) {
+  uint64_t bits = 0;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return bits;
+}
+
+double bits_to_double(const uint64_t bits) {
+  double value = 0.0;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+// Reads the payload of a record in the order it was written by
+// `append_record`
+class PayloadReader {
+ public:
+  PayloadReader(std::string file_name, const std::vector<char>& payload)
+      : file_name_(std::move(file_name)), payload_(payload) {}
+
+  uint64_t read_uint64() {
+    check_size(sizeof(uint64_t));
+    uint64_t value = 0;
+    for (size_t i = 0; i < sizeof(uint64_t); ++i) {
+      value |= static_cast<uint64_t>(
+                   static_cast<unsigned char>(payload_[position_ + i]))
+               << (8 * i);
+    }
+    position_ += sizeof(uint64_t);
+    return value;
+  }
+
+  std::vector<char> read_bytes() {
+    const size_t size = read_uint64();
+    check_size(size);
+    const auto begin =
+        std::next(payload_.begin(), static_cast<std::ptrdiff_t>(position_));
+    position_ += size;
+    return {begin, std::next(begin, static_cast<std::ptrdiff_t>(size))};
+  }
+
+  std::string read_string() {
+    const std::vector<char> bytes = read_bytes();
+    return {bytes.begin(), bytes.end()};
+  }
+
+ private:
+  void check_size(const size_t size) const {
+    if (size > payload_.size() - position_) {
+      ERROR("Corrupt record in incremental checkpoint file " << file_name_);
+    }
+  }
+
+  std::string file_name_;
+  const std::vector<char>& payload_;
+  size_t position_{0};
+};
+
+void append_record(const gsl::not_null<std::vector<char>*> buffer,
+                   const Record& record) {
+  append_uint64(buffer, static_cast<uint64_t>(record.type));
+  append_uint64(buffer, double_to_bits(record.observation_value));
+  const size_t size_position = buffer->size();
+  append_uint64(buffer, 0);
+  if (record.type == RecordType::Items) {
+    append_string(buffer, record.key);
+    append_uint64(buffer, record.items.size());
+    for (const auto& [name, data] : record.items) {
+      append_string(buffer, name);
+      append_uint64(buffer, data.size());
+      buffer->insert(buffer->end(), data.begin(), data.end());
+    }
+  }
+  // Fill in the size of the payload
+  std::vector<char> size_bytes{};
+  append_uint64(make_not_null(&size_bytes),
+                buffer->size() - size_position - sizeof(uint64_t));
+  std::copy(size_bytes.begin(), size_bytes.end(),
+            std::next(buffer->begin(),
+                      static_cast<std::ptrdiff_t>(size_position)));
+}
+
+// Calls `process(type, observation_value, read_payload)` for every complete
+// record in the file, where `read_payload()` returns the payload of the
+// record. Payloads that aren't read are skipped without reading them.
+template <typename F>
+void for_each_record(const std::string& file_name, F&& process) {
+  std::ifstream file(file_name, std::ios::binary);
+  if (not file) {
+    ERROR("Could not open incremental checkpoint file " << file_name);
+  }
+  file.seekg(0, std::ios::end);
+  const auto file_size = static_cast<size_t>(file.tellg());
+  file.seekg(0, std::ios::beg);
+
+  std::vector<char> header(file_header_size);
+  if (not file.read(header.data(), static_cast<std::streamsize>(
+                                       header.size()))) {
+    // The run was killed before anything was written
+    return;
+  }
+  const std::vector<char> expected_header = []() {
+    std::vector<char> result(file_magic.begin(), file_magic.end());
+    append_uint64(make_not_null(&result), file_version);
+    return result;
+  }();
+  if (header != expected_header) {
+    ERROR("The file " << file_name
+                      << " is not an incremental checkpoint file of version "
+                      << file_version);
+  }
+
+  std::vector<char> record_header(record_header_size);
+  while (file.read(record_header.data(),
+                   static_cast<std::streamsize>(record_header.size()))) {
+    PayloadReader header_reader{file_name, record_header};
+    const auto type = static_cast<RecordType>(header_reader.read_uint64());
+    const double observation_value =
+        bits_to_double(header_reader.read_uint64());
+    const size_t payload_size = header_reader.read_uint64();
+    const auto payload_position = static_cast<size_t>(file.tellg());
+    if (payload_size > file_size - payload_position) {
+      // The last record was only partially written
+      return;
+    }
+    const auto read_payload = [&file, &payload_size]() {
+      std::vector<char> payload(payload_size);
+      file.read(payload.data(), static_cast<std::streamsize>(payload_size));
+      return payload;
+    };
+    process(type, observation_value, read_payload);
+    file.seekg(static_cast<std::streamoff>(payload_position + payload_size));
+  }
+}
+}  // namespace
+
+struct IncrementalCheckpointWriter::State {
+  explicit State(std::string file_name_in)
+      : file_name(std::move(file_name_in)), thread([this]() { run(); }) {}
+
+  State(const State& /*rhs*/) = delete;
+  State& operator=(const State& /*rhs*/) = delete;
+  State(State&& /*rhs*/) = delete;
+  State& operator=(State&& /*rhs*/) = delete;
+
+  ~State() {
+    {
+      const std::lock_guard lock(mutex);
+      stop = true;
+    }
+    queue_changed.notify_all();
+    thread.join();
+  }
+
+  // Runs on the background thread until `stop` is set and the queue is empty.
+  // Errors are stored in `error` instead of being raised, because `ERROR`
+  // must only be called from a thread managed by Charm++.
+  void run();
+
+  const std::string file_name;
+  std::mutex mutex{};
+  std::condition_variable queue_changed{};
+  // Guarded by `mutex`
+  std::deque<Record> queue{};
+  size_t records_being_written{0};
+  bool stop{false};
+  std::optional<std::string> error{};
+  std::unordered_map<std::string, ItemFingerprints> fingerprints{};
+  size_t items_written{0};
+  size_t items_unchanged{0};
+  size_t bytes_written{0};
+  // Must be initialized last because it accesses the other members
+  std::thread thread;
+};
+
+void IncrementalCheckpointWriter::State::run() {
+  std::unique_lock lock(mutex);
+  while (true) {
+    queue_changed.wait(lock, [this]() { return stop or not queue.empty(); });
+    if (queue.empty()) {
+      return;
+    }
+    std::deque<Record> records = std::move(queue);
+    queue.clear();
+    records_being_written = records.size();
+    const bool failed_before = error.has_value();
+    lock.unlock();
+
+    size_t items = 0;
+    std::vector<char> buffer{};
+    std::optional<std::string> new_error{};
+    // After a failure nothing more is written, so the file doesn't hold
+    // records that are missing some of the records before them.
+    if (not failed_before) {
+      for (const Record& record : records) {
+        items += record.items.size();
+        append_record(make_not_null(&buffer), record);
+      }
+      std::ofstream file(file_name, std::ios::binary | std::ios::app);
+      file.seekp(0, std::ios::end);
+      if (file and file.tellp() == 0) {
+        std::vector<char> header(file_magic.begin(), file_magic.end());
+        append_uint64(make_not_null(&header), file_version);
+        file.write(header.data(), static_cast<std::streamsize>(header.size()));
+      }
+      file.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+      file.flush();
+      if (not file) {
+        new_error = "Failed to write incremental checkpoint to file " +
+                    file_name;
+      }
+    }
+
+    lock.lock();
+    records_being_written = 0;
+    if (new_error.has_value()) {
+      error = std::move(new_error);
+    } else if (not failed_before) {
+      items_written += items;
+      bytes_written += buffer.size();
+    }
+    queue_changed.notify_all();
+  }
+}
+
+IncrementalCheckpointWriter::IncrementalCheckpointWriter(std::string file_name)
+    : file_name_(std::move(file_name)),
+      state_(std::make_unique<State>(file_name_)) {}
+
+IncrementalCheckpointWriter::IncrementalCheckpointWriter(
+    IncrementalCheckpointWriter&& /*rhs*/) noexcept = default;
+
+IncrementalCheckpointWriter& IncrementalCheckpointWriter::operator=(
+    IncrementalCheckpointWriter&& /*rhs*/) noexcept = default;
+
+IncrementalCheckpointWriter::~IncrementalCheckpointWriter() = default;
+
+void IncrementalCheckpointWriter::check_for_errors() const {
+  if (state_ == nullptr) {
+    ERROR("Cannot write an incremental checkpoint without a file name.");
+  }
+  std::optional<std::string> error{};
+  {
+    const std::lock_guard lock(state_->mutex);
+    error = state_->error;
+  }
+  if (error.has_value()) {
+    ERROR(*error);
+  }
+}
+
+std::vector<std::string> IncrementalCheckpointWriter::changed_items(
+    const std::string& key, const ItemFingerprints& fingerprints) {
+  check_for_errors();
+  std::vector<std::string> result{};
+  const std::lock_guard lock(state_->mutex);
+  ItemFingerprints& previous = state_->fingerprints[key];
+  for (const auto& [name, fingerprint] : fingerprints) {
+    const auto previous_fingerprint = previous.find(name);
+    if (previous_fingerprint != previous.end() and
+        previous_fingerprint->second == fingerprint) {
+      ++state_->items_unchanged;
+    } else {
+      result.push_back(name);
+    }
+  }
+  previous = fingerprints;
+  return result;
+}
+
+void IncrementalCheckpointWriter::write(const double observation_value,
+                                        std::string key,
+                                        SerializedItems items) {
+  check_for_errors();
+  {
+    const std::lock_guard lock(state_->mutex);
+    state_->queue.push_back(Record{RecordType::Items, observation_value,
+                                   std::move(key), std::move(items)});
+  }
+  state_->queue_changed.notify_all();
+}
+
+void IncrementalCheckpointWriter::commit(const double observation_value) {
+  check_for_errors();
+  {
+    const std::lock_guard lock(state_->mutex);
+    state_->queue.push_back(
+        Record{RecordType::Commit, observation_value, {}, {}});
+  }
+  state_->queue_changed.notify_all();
+}
+
+void IncrementalCheckpointWriter::wait() const {
+  if (state_ == nullptr) {
+    return;
+  }
+  {
+    std::unique_lock lock(state_->mutex);
+    state_->queue_changed.wait(lock, [this]() {
+      return state_->queue.empty() and state_->records_being_written == 0;
+    });
+  }
+  check_for_errors();
+}
+
+size_t IncrementalCheckpointWriter::number_of_items_written() const {
+  if (state_ == nullptr) {
+    return 0;
+  }
+  const std::lock_guard lock(state_->mutex);
+  return state_->items_written;
+}
+
+size_t IncrementalCheckpointWriter::number_of_items_unchanged() const {
+  if (state_ == nullptr) {
+    return 0;
+  }
+  const std::lock_guard lock(state_->mutex);
+  return state_->items_unchanged;
+}
+
+size_t IncrementalCheckpointWriter::number_of_bytes_written() const {
+  if (state_ == nullptr) {
+    return 0;
+  }
+  const std::lock_guard lock(state_->mutex);
+  return state_->bytes_written;
+}
+
+void IncrementalCheckpointWriter::pup(PUP::er& p) {
+  // Only the file name is serialized. Queued records are still written by the
+  // background thread of this writer, and the next snapshot of every object
+  // written by the unpacked writer is written in full.
+  p | file_name_;
+  if (p.isUnpacking()) {
+    state_ = file_name_.empty() ? nullptr : std::make_unique<State>(file_name_);
+  }
+}
+
+std::string incremental_checkpoint_file_name(const std::string& file_prefix,
+                                             const size_t node) {
+  return file_prefix + "Node" + std::to_string(node) + ".bin";
+}
+
+void IncrementalCheckpoint::pup(PUP::er& p) {
+  p | observation_value;
+  p | items;
+}
+
+std::vector<double> committed_observation_values(
+    const std::string& file_name) {
+  std::vector<double> result{};
+  for_each_record(file_name, [&result](const RecordType type,
+                                       const double observation_value,
+                                       const auto& /*read_payload*/) {
+    if (type == RecordType::Commit) {
+      result.push_back(observation_value);
+    }
+  });
+  return result;
+}
+
+std::optional<double> latest_committed_observation(
+    const std::vector<std::string>& file_names) {
+  std::optional<std::set<double>> common{};
+  for (const auto& file_name : file_names) {
+    if (not file_system::check_if_file_exists(file_name)) {
+      continue;
+    }
+    const std::vector<double> committed =
+        committed_observation_values(file_name);
+    std::set<double> values(committed.begin(), committed.end());
+    if (common.has_value()) {
+      std::set<double> intersection{};
+      std::set_intersection(
+          common->begin(), common->end(), values.begin(), values.end(),
+          std::inserter(intersection, intersection.begin()));
+      values = std::move(intersection);
+    }
+    common = std::move(values);
+  }
+  if (not common.has_value() or common->empty()) {
+    return std::nullopt;
+  }
+  return *common->rbegin();
+}
+
+IncrementalCheckpoint read_incremental_checkpoint(
+    const std::string& file_name, const double observation_value) {
+  // Every object writes its record at an observation before the observation is
+  // committed, but objects may write records of later observations before
+  // that. So the state at the observation is given by the records of earlier
+  // or equal observations that come before the last commit record of the
+  // observation.
+  size_t number_of_records = 0;
+  std::optional<size_t> commit_position{};
+  for_each_record(file_name, [&number_of_records, &commit_position,
+                              &observation_value](
+                                 const RecordType type, const double value,
+                                 const auto& /*read_payload*/) {
+    if (type == RecordType::Commit and value == observation_value) {
+      commit_position = number_of_records;
+    }
+    ++number_of_records;
+  });
+  if (not commit_position.has_value()) {
+    ERROR("The incremental checkpoint file "
+          << file_name << " doesn't hold a complete snapshot at observation "
+          << observation_value);
+  }
+
+  IncrementalCheckpoint result{observation_value, {}};
+  std::unordered_set<std::string> keys_at_observation{};
+  size_t position = 0;
+  for_each_record(file_name, [&file_name, &position, &commit_position,
+                              &observation_value, &result,
+                              &keys_at_observation](
+                                 const RecordType type, const double value,
+                                 const auto& read_payload) {
+    if (position++ >= *commit_position or type != RecordType::Items or
+        value > observation_value) {
+      return;
+    }
+    const std::vector<char> payload = read_payload();
+    PayloadReader reader{file_name, payload};
+    std::string key = reader.read_string();
+    if (value == observation_value) {
+      keys_at_observation.insert(key);
+    }
+    auto& items = result.items[std::move(key)];
+    const size_t number_of_items = reader.read_uint64();
+    for (size_t i = 0; i < number_of_items; ++i) {
+      std::string name = reader.read_string();
+      items.insert_or_assign(std::move(name), reader.read_bytes());
+    }
+  });
+  // Objects that didn't write a snapshot at the observation didn't exist then
+  for (auto it = result.items.begin(); it != result.items.end();) {
+    if (keys_at_observation.count(it->first) == 0) {
+      it = result.items.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  return result;
+}
+}  // namespace observers
@@ -0,0 +1,162 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <optional>
+#include <pup.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Utilities/Serialization/Fingerprint.hpp"
+
+namespace observers {
+/// The serialized items of one object, keyed by item name
+using SerializedItems = std::map<std::string, std::vector<char>>;
+
+/// The fingerprints of the items of one object, keyed by item name
+using ItemFingerprints = std::map<std::string, Fingerprint>;
+
+/*!
+ * \brief Writes incremental snapshots of many objects, e.g. all elements on a
+ * node, to a file in a background thread.
+ *
+ * \details A snapshot of an object is taken in three steps:
+ * 1. The object passes the fingerprints of its items, e.g. as returned by
+ *    `db::fingerprint_mutable_items`, to `changed_items()`, which returns the
+ *    names of the items that changed since the previous snapshot of the same
+ *    object. Only the fingerprints of the previous snapshot are kept in memory,
+ *    not the items themselves.
+ * 2. The object serializes only the changed items, e.g. with
+ *    `db::serialize_mutable_items`, and passes them to `write()`. This only
+ *    queues the items and returns immediately, so the caller can continue
+ *    while a background thread appends them to the file. Since most items of
+ *    an element (mesh, coordinates, Jacobians, ...) don't change during an
+ *    evolution, this makes snapshots much smaller than a full checkpoint.
+ * 3. Once all objects have written their snapshot at an observation,
+ *    `commit()` appends a commit record for the observation to the file. The
+ *    set of objects is decided by the caller, e.g. by the elements registered
+ *    with the observers, so objects may come and go between snapshots. A
+ *    snapshot without a commit record is incomplete and is ignored when
+ *    restoring. Use `observers::read_incremental_checkpoint` to restore
+ *    complete snapshots.
+ *
+ * The file starts with a header identifying the format, followed by records
+ * with a fixed-size header (record type, observation value and payload size,
+ * all as little-endian 64-bit integers) and a payload. The item data are
+ * stored as serialized by PUP, so they must be restored on a machine with the
+ * same architecture.
+ *
+ * Errors in the background thread, e.g. a full disk, are reported by the next
+ * call to `changed_items()`, `write()`, `commit()` or `wait()`.
+ *
+ * Serializing the writer with Charm++ doesn't wait for the queued snapshots to
+ * be written, and the fingerprints aren't serialized, so after a restart the
+ * next snapshot of every object is written in full. The file is appended to.
+ */
+class IncrementalCheckpointWriter {
+ public:
+  IncrementalCheckpointWriter() = default;
+  explicit IncrementalCheckpointWriter(std::string file_name);
+
+  IncrementalCheckpointWriter(const IncrementalCheckpointWriter& /*rhs*/) =
+      delete;
+  IncrementalCheckpointWriter& operator=(
+      const IncrementalCheckpointWriter& /*rhs*/) = delete;
+  IncrementalCheckpointWriter(IncrementalCheckpointWriter&& /*rhs*/) noexcept;
+  IncrementalCheckpointWriter& operator=(
+      IncrementalCheckpointWriter&& /*rhs*/) noexcept;
+  /// Waits for all queued snapshots to be written
+  ~IncrementalCheckpointWriter();
+
+  const std::string& file_name() const { return file_name_; }
+
+  /// \brief The names of the items of the object identified by `key` whose
+  /// fingerprint changed since the previous call for the same object.
+  ///
+  /// The `fingerprints` are stored for the next call, so the returned items
+  /// must be passed to `write()`.
+  std::vector<std::string> changed_items(const std::string& key,
+                                         const ItemFingerprints& fingerprints);
+
+  /// \brief Queue the changed `items` of the object identified by `key` to be
+  /// written for the observation `observation_value`.
+  ///
+  /// Every object that is part of the snapshot must call this, even if no
+  /// items changed, and before the snapshot is committed.
+  void write(double observation_value, std::string key, SerializedItems items);
+
+  /// Queue a commit record marking the snapshot at `observation_value` as
+  /// complete. It is written after all snapshots queued before.
+  void commit(double observation_value);
+
+  /// Block until all queued records are written to the file
+  void wait() const;
+
+  /// @{
+  /// Statistics of the snapshots that were written
+  size_t number_of_items_written() const;
+  size_t number_of_items_unchanged() const;
+  size_t number_of_bytes_written() const;
+  /// @}
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+
+ private:
+  struct State;
+
+  // Raises an `ERROR` if writing in the background thread failed
+  void check_for_errors() const;
+
+  std::string file_name_{};
+  std::unique_ptr<State> state_{};
+};
+
+/// The name of the incremental checkpoint file written by node `node`
+std::string incremental_checkpoint_file_name(const std::string& file_prefix,
+                                             size_t node);
+
+/// The state of all objects in an incremental checkpoint file at one
+/// observation
+struct IncrementalCheckpoint {
+  double observation_value{};
+  std::unordered_map<std::string, SerializedItems> items{};
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+};
+
+/// The observation values of the snapshots that were committed to the
+/// incremental checkpoint file, in the order they were committed
+std::vector<double> committed_observation_values(const std::string& file_name);
+
+/*!
+ * \brief The most recent observation that was committed to all of the
+ * incremental checkpoint files `file_names` that exist.
+ *
+ * \details Every node writes its own file and commits independently, so the
+ * most recent snapshot that is complete on all nodes may be older than the
+ * most recent one of a single node. Returns `std::nullopt` if there is no such
+ * observation.
+ */
+std::optional<double> latest_committed_observation(
+    const std::vector<std::string>& file_names);
+
+/*!
+ * \brief Read the snapshots written by an `IncrementalCheckpointWriter` and
+ * combine them into the state of all objects at the committed observation
+ * `observation_value`.
+ *
+ * \details The result only holds the objects that wrote a snapshot at
+ * `observation_value`, so objects that were removed before, e.g. by mesh
+ * refinement, are not restored. An incomplete record at the end of the file is
+ * ignored.
+ */
+IncrementalCheckpoint read_incremental_checkpoint(const std::string& file_name,
+                                                  double observation_value);
+}  // namespace observers
@@ -33,7 +33,8 @@ struct Initialize {
   using simple_tags = tmpl::append<
       tmpl::list<Tags::ExpectedContributorsForObservations,
                  Tags::ContributorsOfReductionData,
-                 Tags::ContributorsOfTensorData, Tags::TensorData>,
+                 Tags::ContributorsOfTensorData, Tags::TensorData,
+                 Tags::ContributorsOfIncrementalCheckpoint>,
       typename Metavariables::observed_reduction_data_tags,
       tmpl::transform<
           typename Metavariables::observed_reduction_data_tags,
@@ -71,7 +72,10 @@ struct InitializeWriter {
                  Tags::ContributorsOfTensorData, Tags::VolumeDataLock,
                  Tags::TensorData, Tags::InterpolatorTensorData,
                  Tags::NodesExpectedToContributeReductions,
-                 Tags::NodesThatContributedReductions, Tags::H5FileLock>,
+                 Tags::NodesThatContributedReductions, Tags::H5FileLock,
+                 Tags::IncrementalCheckpointWriters,
+                 Tags::ContributorsOfIncrementalCheckpoint,
+                 Tags::RestoredIncrementalCheckpoints>,
       typename Metavariables::observed_reduction_data_tags,
       tmpl::transform<
           typename Metavariables::observed_reduction_data_tags,
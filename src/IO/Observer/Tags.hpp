@@ -7,6 +7,7 @@
 #include <converse.h>
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
 #include <unordered_map>
@@ -16,7 +17,9 @@
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "IO/H5/TensorData.hpp"
+#include "IO/Observer/IncrementalCheckpoint.hpp"
 #include "IO/Observer/ObservationId.hpp"
+#include "Options/Auto.hpp"
 #include "Options/String.hpp"
 #include "Parallel/ArrayComponentId.hpp"
 #include "Parallel/NodeLock.hpp"
@@ -151,6 +154,31 @@ struct H5FileLock : db::SimpleTag {
   using type = Parallel::NodeLock;
 };
 
+/// The writers of incremental checkpoints on this node, keyed by file name.
+///
+/// \see observers::IncrementalCheckpointWriter
+struct IncrementalCheckpointWriters : db::SimpleTag {
+  using type = std::unordered_map<std::string, IncrementalCheckpointWriter>;
+};
+
+/// \brief The set of `ArrayComponentId`s that have written their incremental
+/// checkpoint at each `ObservationId`
+///
+/// The tag is used both on the `Observer` and on the `ObserverWriter`
+/// components, like `ContributorsOfReductionData`.
+struct ContributorsOfIncrementalCheckpoint : db::SimpleTag {
+  using type =
+      std::unordered_map<ObservationId,
+                         std::unordered_set<Parallel::ArrayComponentId>>;
+};
+
+/// The incremental checkpoints read on this node to restore the elements on
+/// it, keyed by file name. The items of an element are removed once they have
+/// been restored.
+struct RestoredIncrementalCheckpoints : db::SimpleTag {
+  using type = std::unordered_map<std::string, IncrementalCheckpoint>;
+};
+
 /*!
  * \brief A string identifying observations related to the `Tag`.
  *
@@ -205,6 +233,18 @@ struct SurfaceFileName {
       "Name of the surface data file without extension"};
   using group = Group;
 };
+
+/// The prefix of the incremental checkpoint files from which the elements are
+/// restored, or `std::nullopt` to start from initial data.
+///
+/// \see Events::WriteIncrementalCheckpoint
+struct RestoreFromIncrementalCheckpoint {
+  using type = Options::Auto<std::string, Options::AutoLabel::None>;
+  static constexpr Options::String help = {
+      "Prefix of the incremental checkpoint files to restore the elements "
+      "from, or 'None' to start from the initial data"};
+  using group = Group;
+};
 }  // namespace OptionTags
 
 namespace Tags {
@@ -264,5 +304,21 @@ struct SurfaceFileName : db::SimpleTag {
     return surface_file_name;
   }
 };
+
+/// \brief The prefix of the incremental checkpoint files from which the
+/// elements are restored, or `std::nullopt` to start from initial data.
+///
+/// \see Actions::RestoreFromIncrementalCheckpoint
+struct RestoreFromIncrementalCheckpoint : db::SimpleTag {
+  using type = std::optional<std::string>;
+  using option_tags =
+      tmpl::list<::observers::OptionTags::RestoreFromIncrementalCheckpoint>;
+
+  static constexpr bool pass_metavariables = false;
+  static std::optional<std::string> create_from_options(
+      const std::optional<std::string>& file_prefix) {
+    return file_prefix;
+  }
+};
 }  // namespace Tags
 }  // namespace observers
@@ -12,6 +12,7 @@
 #include "Utilities/ForceInline.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Math.hpp"
+#include "Utilities/Simd/Simd.hpp"
 #include "Utilities/TMPL.hpp"
 
 /// \cond
@@ -37,6 +38,19 @@ struct MinmodReconstructor {
     return {{q[0] - 0.5 * slope, q[0] + 0.5 * slope}};
   }
 
+#ifdef SPECTRE_USE_XSIMD
+  SPECTRE_ALWAYS_INLINE static std::array<simd::batch<double>, 2> pointwise(
+      const simd::batch<double>* const q, const int stride) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const simd::batch<double> a = q[stride] - q[0];
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    const simd::batch<double> b = q[0] - q[-stride];
+    const simd::batch<double> slope =
+        0.5 * (simd::sign(a) + simd::sign(b)) * simd::min(abs(a), abs(b));
+    return {{q[0] - 0.5 * slope, q[0] + 0.5 * slope}};
+  }
+#endif  // SPECTRE_USE_XSIMD
+
   SPECTRE_ALWAYS_INLINE static constexpr size_t stencil_width() { return 3; }
 };
 }  // namespace detail
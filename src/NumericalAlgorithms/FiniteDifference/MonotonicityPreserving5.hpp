@@ -14,6 +14,7 @@
 #include "Utilities/ForceInline.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Math.hpp"
+#include "Utilities/Simd/Simd.hpp"
 
 /// \cond
 class DataVector;
@@ -102,6 +103,85 @@ struct MonotonicityPreserving5Reconstructor {
     return result;
   }
 
+#ifdef SPECTRE_USE_XSIMD
+  SPECTRE_ALWAYS_INLINE static std::array<simd::batch<double>, 2> pointwise(
+      const simd::batch<double>* const q, const int stride, const double alpha,
+      const double epsilon) {
+    using batch = simd::batch<double>;
+
+    const auto minmod2 = [](const batch& x, const batch& y) {
+      return 0.5 * (simd::sign(x) + simd::sign(y)) *
+             simd::min(abs(x), abs(y));
+    };
+    const auto minmod4 = [](const batch& w, const batch& x, const batch& y,
+                            const batch& z) {
+      const batch sign_w = simd::sign(w);
+      return 0.125 * (sign_w + simd::sign(x)) *
+             abs((sign_w + simd::sign(y)) * (sign_w + simd::sign(z))) *
+             simd::min(abs(w),
+                       simd::min(abs(x), simd::min(abs(y), abs(z))));
+    };
+
+    auto result = UnlimitedReconstructor<4>::pointwise(q, stride);
+
+    const batch q_mp_plus =
+        q[0] + minmod2(q[stride] - q[0], alpha * (q[0] - q[-stride]));
+    const batch q_mp_minus =
+        q[0] + minmod2(q[-stride] - q[0], alpha * (q[0] - q[stride]));
+
+    const auto limit_q_plus =
+        ((result[1] - q[0]) * (result[1] - q_mp_plus) > batch(epsilon));
+    const auto limit_q_minus =
+        ((result[0] - q[0]) * (result[0] - q_mp_minus) > batch(epsilon));
+
+    // The limiter only changes the result, so it is skipped if no cell in
+    // the batch needs it. Otherwise it is applied to all cells and blended.
+    if (simd::any(limit_q_plus or limit_q_minus)) {
+      const batch dp = q[2 * stride] + q[0] - 2.0 * q[stride];
+      const batch dj = q[stride] + q[-stride] - 2.0 * q[0];
+      const batch dm = q[0] + q[-2 * stride] - 2.0 * q[-stride];
+      const batch dm4_plus = minmod4(4.0 * dj - dp, 4.0 * dp - dj, dj, dp);
+      const batch dm4_minus = minmod4(4.0 * dj - dm, 4.0 * dm - dj, dj, dm);
+
+      {
+        const batch q_ul = q[0] + alpha * (q[0] - q[-stride]);
+        const batch q_md = 0.5 * (q[0] + q[stride] - dm4_plus);
+        const batch q_lc =
+            q[0] + 0.5 * (q[0] - q[-stride]) + 1.3333333333333333 * dm4_minus;
+        const batch q_min =
+            simd::max(simd::min(q[0], simd::min(q[stride], q_md)),
+                      simd::min(q[0], simd::min(q_ul, q_lc)));
+        const batch q_max =
+            simd::min(simd::max(q[0], simd::max(q[stride], q_md)),
+                      simd::max(q[0], simd::max(q_ul, q_lc)));
+        result[1] = simd::select(
+            limit_q_plus,
+            result[1] + minmod2(q_min - result[1], q_max - result[1]),
+            result[1]);
+      }
+
+      {
+        const batch q_ul = q[0] + alpha * (q[0] - q[stride]);
+        const batch q_md = 0.5 * (q[0] + q[-stride] - dm4_minus);
+        const batch q_lc =
+            q[0] + 0.5 * (q[0] - q[stride]) + 1.3333333333333333 * dm4_plus;
+        const batch q_min =
+            simd::max(simd::min(q[0], simd::min(q[-stride], q_md)),
+                      simd::min(q[0], simd::min(q_ul, q_lc)));
+        const batch q_max =
+            simd::min(simd::max(q[0], simd::max(q[-stride], q_md)),
+                      simd::max(q[0], simd::max(q_ul, q_lc)));
+        result[0] = simd::select(
+            limit_q_minus,
+            result[0] + minmod2(q_min - result[0], q_max - result[0]),
+            result[0]);
+      }
+    }
+
+    return result;
+  }
+#endif  // SPECTRE_USE_XSIMD
+
   SPECTRE_ALWAYS_INLINE static constexpr size_t stencil_width() { return 5; }
 };
 }  // namespace detail
@@ -12,6 +12,7 @@
 #include "Utilities/ForceInline.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Math.hpp"
+#include "Utilities/Simd/Simd.hpp"
 #include "Utilities/TMPL.hpp"
 
 /// \cond
@@ -44,6 +45,32 @@ struct MonotonisedCentralReconstructor {
     }
   }
 
+#ifdef SPECTRE_USE_XSIMD
+  SPECTRE_ALWAYS_INLINE static std::array<simd::batch<double>, 2> pointwise(
+      const simd::batch<double>* const q, const int stride) {
+    using batch = simd::batch<double>;
+    const batch a = q[stride] - q[0];
+    const batch b = q[0] - q[-stride];
+    const batch abs_a = abs(a);
+    const batch abs_b = abs(b);
+
+    // Same branches as the scalar version, evaluated for all cells and
+    // then blended, with the earlier branches taking precedence.
+    const batch slope = 0.5 * (q[stride] - q[-stride]);
+    batch upper = q[0] - 0.5 * slope;
+    batch lower = q[0] + 0.5 * slope;
+    const auto b_steep = 3.0 * abs_b <= abs_a;
+    upper = simd::select(b_steep, q[-stride], upper);
+    lower = simd::select(b_steep, q[0] + b, lower);
+    const auto a_steep = 3.0 * abs_a <= abs_b;
+    upper = simd::select(a_steep, q[0] - a, upper);
+    lower = simd::select(a_steep, q[stride], lower);
+    const auto extremum = simd::sign(a) != simd::sign(b);
+    return {{simd::select(extremum, q[0], upper),
+             simd::select(extremum, q[0], lower)}};
+  }
+#endif  // SPECTRE_USE_XSIMD
+
   SPECTRE_ALWAYS_INLINE static constexpr size_t stencil_width() { return 3; }
 };
 }  // namespace detail
@@ -5,7 +5,10 @@
 
 #include "NumericalAlgorithms/FiniteDifference/Reconstruct.hpp"
 
+#include <array>
 #include <cstddef>
+#include <type_traits>
+#include <utility>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Index.hpp"
@@ -16,9 +19,28 @@
 #include "Domain/Structure/Side.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Simd/Simd.hpp"
 
 namespace fd::reconstruction {
 namespace detail {
+#ifdef SPECTRE_USE_XSIMD
+// Detects whether the reconstructor has an overload of `pointwise` that
+// reconstructs a `simd::batch<double>` of cells at once.
+template <typename Reconstructor, typename... ArgsForReconstructor>
+auto has_simd_pointwise_impl(int) -> decltype(
+    Reconstructor::pointwise(std::declval<const simd::batch<double>*>(), 1,
+                             std::declval<const ArgsForReconstructor&>()...),
+    std::true_type{});
+
+template <typename Reconstructor, typename... ArgsForReconstructor>
+auto has_simd_pointwise_impl(...) -> std::false_type;
+
+template <typename Reconstructor, typename... ArgsForReconstructor>
+constexpr bool has_simd_pointwise_v =
+    decltype(has_simd_pointwise_impl<Reconstructor, ArgsForReconstructor...>(
+        0))::value;
+#endif  // SPECTRE_USE_XSIMD
+
 template <size_t IndexToSet, size_t DimToReplace, size_t... Is,
           size_t Dim = sizeof...(Is)>
 auto generate_index_for_u_to_reconstruct_impl(
@@ -183,8 +205,37 @@ void reconstruct_impl(
 
     // Reconstruct in the bulk
     const size_t slice_end = volume_extents[0] - ghost_zone_for_stencil;
-    for (size_t vars_index = vars_slice_offset + ghost_zone_for_stencil,
-                i = ghost_zone_for_stencil;
+    size_t bulk_start = ghost_zone_for_stencil;
+#ifdef SPECTRE_USE_XSIMD
+    if constexpr (not ReturnReconstructionOrder and
+                  has_simd_pointwise_v<Reconstructor,
+                                       ArgsForReconstructor...>) {
+      // Reconstruct `batch_size` neighboring cells at once. The stencil of
+      // each cell is loaded as `stencil_width` batches, the j-th of which
+      // holds the j-th stencil point of every cell in the batch.
+      using batch = simd::batch<double>;
+      constexpr size_t batch_size = simd::size<batch>();
+      std::array<batch, stencil_width> q_batch{};
+      for (; bulk_start + batch_size <= slice_end; bulk_start += batch_size) {
+        const size_t vars_index =
+            vars_slice_offset + bulk_start - ghost_zone_for_stencil;
+        for (size_t j = 0; j < stencil_width; ++j) {
+          gsl::at(q_batch, j) =
+              simd::load_unaligned(&volume_vars[vars_index + j]);
+        }
+        const auto upper_lower = Reconstructor::pointwise(
+            q_batch.data() + ghost_zone_for_stencil, 1,
+            args_for_reconstructor...);
+        simd::store_unaligned(
+            &(*recons_upper)[recons_slice_offset + bulk_start],
+            get<0>(upper_lower));
+        simd::store_unaligned(
+            &(*recons_lower)[recons_slice_offset + 1 + bulk_start],
+            get<1>(upper_lower));
+      }
+    }
+#endif  // SPECTRE_USE_XSIMD
+    for (size_t vars_index = vars_slice_offset + bulk_start, i = bulk_start;
          i < slice_end; ++vars_index, ++i) {
       // Note: we keep the `stride` here because we may want to
       // experiment/support non-unit strides in the bulk in the future. For
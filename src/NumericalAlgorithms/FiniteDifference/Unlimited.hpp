@@ -22,8 +22,11 @@ namespace detail {
 template <size_t Degree>
 struct UnlimitedReconstructor {
   static_assert(Degree == 2 or Degree == 4 or Degree == 6 or Degree == 8);
-  SPECTRE_ALWAYS_INLINE static std::array<double, 2> pointwise(
-      const double* const q, const int stride) {
+  // Templated so that a `simd::batch<double>` of cells can be reconstructed
+  // at once.
+  template <typename T>
+  SPECTRE_ALWAYS_INLINE static std::array<T, 2> pointwise(const T* const q,
+                                                          const int stride) {
     if constexpr (Degree == 2) {
       // quadratic polynomial
       return {{0.375 * q[-stride] + 0.75 * q[0] - 0.125 * q[stride],
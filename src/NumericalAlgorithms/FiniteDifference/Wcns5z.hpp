@@ -14,6 +14,7 @@
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ForceInline.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Simd/Simd.hpp"
 
 /// \cond
 class DataVector;
@@ -30,8 +31,11 @@ namespace detail {
 // pointwise reconstruction routine for the original Wcns5z scheme
 template <size_t NonlinearWeightExponent>
 struct Wcns5zWork {
-  SPECTRE_ALWAYS_INLINE static std::array<double, 2> pointwise(
-      const double* const q, const int stride, const double epsilon) {
+  // Templated so that a `simd::batch<double>` of cells can be reconstructed
+  // at once.
+  template <typename T>
+  SPECTRE_ALWAYS_INLINE static std::array<T, 2> pointwise(
+      const T* const q, const int stride, const double epsilon) {
     ASSERT(epsilon > 0.0,
            "epsilon must be greater than zero but is " << epsilon);
 
@@ -45,7 +49,7 @@ struct Wcns5zWork {
         1.0833333333333333 * square(q[2 * stride] - 2.0 * q[stride] + q[0]) +
             0.25 * square(q[2 * stride] - 4.0 * q[stride] + 3.0 * q[0])};
 
-    const double tau5{abs(beta[2] - beta[0])};
+    const T tau5{abs(beta[2] - beta[0])};
 
     const std::array epsilon_k{
         epsilon * (1.0 + abs(q[0]) + abs(q[-stride]) + abs(q[-2 * stride])),
@@ -65,9 +69,9 @@ struct Wcns5zWork {
                                  5.0 * nw_buffer[2]};
     const std::array alpha_lower{nw_buffer[2], 10.0 * nw_buffer[1],
                                  5.0 * nw_buffer[0]};
-    const double alpha_norm_upper =
+    const T alpha_norm_upper =
         alpha_upper[0] + alpha_upper[1] + alpha_upper[2];
-    const double alpha_norm_lower =
+    const T alpha_norm_lower =
         alpha_lower[0] + alpha_lower[1] + alpha_lower[2];
 
     // reconstruction stencils
@@ -118,13 +122,42 @@ struct Wcns5zReconstructor {
     }
   }
 
+#ifdef SPECTRE_USE_XSIMD
+  SPECTRE_ALWAYS_INLINE static std::array<simd::batch<double>, 2> pointwise(
+      const simd::batch<double>* const q, const int stride,
+      const double epsilon, const size_t max_number_of_extrema) {
+    using batch = simd::batch<double>;
+    // count the number of extrema in the given FD stencil of each cell
+    batch n_extrema(0.0);
+    for (int i = -1; i < 2; ++i) {
+      const batch& center = q[i * stride];
+      const batch& left = q[(i - 1) * stride];
+      const batch& right = q[(i + 1) * stride];
+      n_extrema += simd::select(((center > left) and (center > right)) or
+                                    ((center < left) and (center < right)),
+                                batch(1.0), batch(0.0));
+    }
+
+    // Both reconstructions are computed for all cells and the result is
+    // chosen per cell
+    const auto use_wcns5z =
+        n_extrema < batch(static_cast<double>(max_number_of_extrema) + 0.5);
+    const auto wcns5z =
+        Wcns5zWork<NonlinearWeightExponent>::pointwise(q, stride, epsilon);
+    const auto fallback = FallbackReconstructor::pointwise(q, stride);
+    return {{simd::select(use_wcns5z, wcns5z[0], fallback[0]),
+             simd::select(use_wcns5z, wcns5z[1], fallback[1])}};
+  }
+#endif  // SPECTRE_USE_XSIMD
+
   SPECTRE_ALWAYS_INLINE static constexpr size_t stencil_width() { return 5; }
 };
 
 template <size_t NonlinearWeightExponent>
 struct Wcns5zReconstructor<NonlinearWeightExponent, void> {
-  SPECTRE_ALWAYS_INLINE static std::array<double, 2> pointwise(
-      const double* const q, const int stride, const double epsilon,
+  template <typename T>
+  SPECTRE_ALWAYS_INLINE static std::array<T, 2> pointwise(
+      const T* const q, const int stride, const double epsilon,
       const size_t /*max_number_of_extrema*/) {
     return Wcns5zWork<NonlinearWeightExponent>::pointwise(q, stride, epsilon);
   }
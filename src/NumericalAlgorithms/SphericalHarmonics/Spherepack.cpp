@@ -161,6 +161,118 @@ void Spherepack::spec_to_phys_impl(
   memory_pool_.free(work);
 }
 
+void Spherepack::phys_to_spec(
+    const gsl::span<double* const> spectral_coefs,
+    const gsl::span<const double* const> collocation_values) const {
+  ASSERT(spectral_coefs.size() == collocation_values.size(),
+         "Number of fields don't match: " << spectral_coefs.size() << " vs "
+                                          << collocation_values.size());
+  const size_t num_fields = collocation_values.size();
+  if (num_fields == 0) {
+    return;
+  }
+  if (num_fields == 1) {
+    phys_to_spec_impl(spectral_coefs[0], collocation_values[0], 1, 0, 1, 0,
+                      false);
+    return;
+  }
+  // Interleave the fields so that a single SPHEREPACK call with
+  // stride num_fields transforms all of them at once.
+  auto& interleaved_values = memory_pool_.get(num_fields * physical_size());
+  auto& interleaved_coefs = memory_pool_.get(num_fields * spectral_size());
+  for (size_t field = 0; field < num_fields; ++field) {
+    const double* const values = collocation_values[field];
+    for (size_t s = 0; s < physical_size(); ++s) {
+      // clang-tidy: 'do not use pointer arithmetic'
+      interleaved_values[s * num_fields + field] = values[s];  // NOLINT
+    }
+  }
+  phys_to_spec_impl(interleaved_coefs.data(), interleaved_values.data(),
+                    num_fields, 0, num_fields, 0, true);
+  for (size_t field = 0; field < num_fields; ++field) {
+    double* const coefs = spectral_coefs[field];
+    for (size_t s = 0; s < spectral_size(); ++s) {
+      // clang-tidy: 'do not use pointer arithmetic'
+      coefs[s] = interleaved_coefs[s * num_fields + field];  // NOLINT
+    }
+  }
+  memory_pool_.free(interleaved_coefs);
+  memory_pool_.free(interleaved_values);
+}
+
+void Spherepack::spec_to_phys(
+    const gsl::span<double* const> collocation_values,
+    const gsl::span<const double* const> spectral_coefs) const {
+  ASSERT(spectral_coefs.size() == collocation_values.size(),
+         "Number of fields don't match: " << spectral_coefs.size() << " vs "
+                                          << collocation_values.size());
+  const size_t num_fields = spectral_coefs.size();
+  if (num_fields == 0) {
+    return;
+  }
+  if (num_fields == 1) {
+    spec_to_phys_impl(collocation_values[0], spectral_coefs[0], 1, 0, 1, 0,
+                      false);
+    return;
+  }
+  auto& interleaved_coefs = memory_pool_.get(num_fields * spectral_size());
+  auto& interleaved_values = memory_pool_.get(num_fields * physical_size());
+  for (size_t field = 0; field < num_fields; ++field) {
+    const double* const coefs = spectral_coefs[field];
+    for (size_t s = 0; s < spectral_size(); ++s) {
+      // clang-tidy: 'do not use pointer arithmetic'
+      interleaved_coefs[s * num_fields + field] = coefs[s];  // NOLINT
+    }
+  }
+  spec_to_phys_impl(interleaved_values.data(), interleaved_coefs.data(),
+                    num_fields, 0, num_fields, 0, true);
+  for (size_t field = 0; field < num_fields; ++field) {
+    double* const values = collocation_values[field];
+    for (size_t s = 0; s < physical_size(); ++s) {
+      // clang-tidy: 'do not use pointer arithmetic'
+      values[s] = interleaved_values[s * num_fields + field];  // NOLINT
+    }
+  }
+  memory_pool_.free(interleaved_values);
+  memory_pool_.free(interleaved_coefs);
+}
+
+std::vector<DataVector> Spherepack::phys_to_spec(
+    const std::vector<DataVector>& collocation_values) const {
+  std::vector<DataVector> result(collocation_values.size(),
+                                 DataVector(spectral_size()));
+  std::vector<double*> result_ptrs(result.size());
+  std::vector<const double*> values_ptrs(result.size());
+  for (size_t i = 0; i < result.size(); ++i) {
+    ASSERT(collocation_values[i].size() == physical_size(),
+           "Sizes don't match for field " << i << ": "
+                                          << collocation_values[i].size()
+                                          << " vs " << physical_size());
+    result_ptrs[i] = result[i].data();
+    values_ptrs[i] = collocation_values[i].data();
+  }
+  phys_to_spec(result_ptrs, values_ptrs);
+  return result;
+}
+
+std::vector<DataVector> Spherepack::spec_to_phys(
+    const std::vector<DataVector>& spectral_coefs) const {
+  std::vector<DataVector> result(spectral_coefs.size(),
+                                 DataVector(physical_size()));
+  std::vector<double*> result_ptrs(result.size());
+  std::vector<const double*> coefs_ptrs(result.size());
+  for (size_t i = 0; i < result.size(); ++i) {
+    ASSERT(spectral_coefs[i].size() == spectral_size(),
+           "Sizes don't match for field " << i << ": "
+                                          << spectral_coefs[i].size() << " vs "
+                                          << spectral_size());
+    result_ptrs[i] = result[i].data();
+    coefs_ptrs[i] = spectral_coefs[i].data();
+  }
+  spec_to_phys(result_ptrs, coefs_ptrs);
+  return result;
+}
+
 DataVector Spherepack::phys_to_spec(const DataVector& collocation_values,
                                     const size_t physical_stride,
                                     const size_t physical_offset) const {
@@ -231,6 +343,47 @@ void Spherepack::gradient_all_offsets(
   memory_pool_.free(f_k);
 }
 
+void Spherepack::gradient(
+    const gsl::span<const std::array<double*, 2>> df,
+    const gsl::span<const double* const> collocation_values) const {
+  ASSERT(df.size() == collocation_values.size(),
+         "Number of fields don't match: " << df.size() << " vs "
+                                          << collocation_values.size());
+  const size_t num_fields = collocation_values.size();
+  if (num_fields == 0) {
+    return;
+  }
+  if (num_fields == 1) {
+    gradient(df[0], collocation_values[0]);
+    return;
+  }
+  auto& interleaved_values = memory_pool_.get(num_fields * physical_size());
+  for (size_t field = 0; field < num_fields; ++field) {
+    const double* const values = collocation_values[field];
+    for (size_t s = 0; s < physical_size(); ++s) {
+      // clang-tidy: 'do not use pointer arithmetic'
+      interleaved_values[s * num_fields + field] = values[s];  // NOLINT
+    }
+  }
+  auto& interleaved_df_theta = memory_pool_.get(num_fields * physical_size());
+  auto& interleaved_df_phi = memory_pool_.get(num_fields * physical_size());
+  gradient_all_offsets(
+      {{interleaved_df_theta.data(), interleaved_df_phi.data()}},
+      interleaved_values.data(), num_fields);
+  for (size_t field = 0; field < num_fields; ++field) {
+    const auto& df_field = df[field];
+    for (size_t s = 0; s < physical_size(); ++s) {
+      const size_t interleaved_index = s * num_fields + field;
+      // clang-tidy: 'do not use pointer arithmetic'
+      df_field[0][s] = interleaved_df_theta[interleaved_index];  // NOLINT
+      df_field[1][s] = interleaved_df_phi[interleaved_index];    // NOLINT
+    }
+  }
+  memory_pool_.free(interleaved_df_phi);
+  memory_pool_.free(interleaved_df_theta);
+  memory_pool_.free(interleaved_values);
+}
+
 void Spherepack::gradient_from_coefs_impl(
     const std::array<double*, 2>& df,
     const gsl::not_null<const double*> spectral_coefs,
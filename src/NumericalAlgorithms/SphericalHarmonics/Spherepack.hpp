@@ -260,6 +260,23 @@ class Spherepack {
   };
   /// @}
 
+  /// @{
+  /// Batched spectral transformations of several unit-stride scalar
+  /// fields at once.
+  ///
+  /// The fields are interleaved into a single buffer and transformed by
+  /// one SPHEREPACK call (as in `phys_to_spec_all_offsets`), so the
+  /// Legendre tables and FFT work arrays are traversed once for the
+  /// whole batch instead of once per field.  `spectral_coefs[i]` must
+  /// point to `spectral_size()` doubles and `collocation_values[i]` to
+  /// `physical_size()` doubles.  The input and output pointers may not
+  /// alias each other.
+  void phys_to_spec(gsl::span<double* const> spectral_coefs,
+                    gsl::span<const double* const> collocation_values) const;
+  void spec_to_phys(gsl::span<double* const> collocation_values,
+                    gsl::span<const double* const> spectral_coefs) const;
+  /// @}
+
   /// @{
   /// Simpler, less general interfaces to `phys_to_spec` and `spec_to_phys`.
   /// Acts on a slice of the input and returns a unit-stride result.
@@ -271,6 +288,15 @@ class Spherepack {
                           size_t spectral_offset = 0) const;
   /// @}
 
+  /// @{
+  /// Simpler, less general interfaces to the batched `phys_to_spec` and
+  /// `spec_to_phys`.  Each input must be unit-stride.
+  std::vector<DataVector> phys_to_spec(
+      const std::vector<DataVector>& collocation_values) const;
+  std::vector<DataVector> spec_to_phys(
+      const std::vector<DataVector>& spectral_coefs) const;
+  /// @}
+
   /// @{
   /// Simpler, less general interfaces to `phys_to_spec_all_offsets`
   /// and `spec_to_phys_all_offsets`.  Result has the same stride as
@@ -322,6 +348,13 @@ class Spherepack {
   }
   /// @}
 
+  /// Batched `gradient` of several unit-stride scalar fields, which are
+  /// interleaved and differentiated by one SPHEREPACK call like the batched
+  /// `phys_to_spec`.  `df[i]` must point to two arrays of `physical_size()`
+  /// doubles and `collocation_values[i]` to `physical_size()` doubles.
+  void gradient(gsl::span<const std::array<double*, 2>> df,
+                gsl::span<const double* const> collocation_values) const;
+
   /// @{
   /// Simpler, less general interfaces to `gradient`.
   /// Acts on a slice of the input and returns a unit-stride result.
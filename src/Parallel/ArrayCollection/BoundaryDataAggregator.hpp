@@ -0,0 +1,261 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <pup.h>
+#include <pup_stl.h>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "Domain/Structure/DirectionalId.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Evolution/DiscontinuousGalerkin/BoundaryData.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+
+namespace Parallel {
+/*!
+ * \brief Coalesces the DG boundary data that elements of a
+ * `Parallel::DgElementCollection` send to elements on other nodes into one
+ * message per destination node.
+ *
+ * Without aggregation every element sends one message per off-node neighbor
+ * and substep, so the interconnect sees many small messages. Instead,
+ * `Parallel::Actions::SendDataToElement` appends the data to the buffer of the
+ * destination node. A buffer is sent as a single message to the destination
+ * node, where it is unpacked into the inboxes of the receiving elements, when
+ * either
+ * - the buffer holds `max_entries` pieces of data or `max_bytes` bytes of
+ *   `DataVector` payload, or
+ * - the nodegroup processes the flush message that was sent to this node when
+ *   the first piece of data was appended to an empty buffer. This bounds the
+ *   aggregation window by the time it takes the runtime system to get to that
+ *   message, so data is never held back indefinitely.
+ *
+ * Setting `max_entries` to 1 disables aggregation. The limits are set in the
+ * input file with the options of the
+ * `Parallel::OptionTags::BoundaryDataAggregation` group.
+ *
+ * The number of pieces of data, messages, and payload bytes that were sent
+ * are recorded. They are written by
+ * `Events::ObserveElementCollectionStatistics`.
+ */
+template <size_t Dim>
+class BoundaryDataAggregator {
+ public:
+  /// The data sent to one element
+  struct Entry {
+    ElementId<Dim> receiver{};
+    TimeStepId time_step_id{};
+    std::pair<DirectionalId<Dim>, evolution::dg::BoundaryData<Dim>> data{};
+    /// The priority with which `receiver` is queued on the destination node,
+    /// see `Parallel::ElementReadyQueues`
+    int priority{0};
+
+    // NOLINTNEXTLINE(google-runtime-references)
+    void pup(PUP::er& p);
+  };
+  /// The data sent to one node in a single message
+  using Bundle = std::vector<Entry>;
+
+  /// What was handed out to be sent since the last `take_statistics()`
+  struct Statistics {
+    size_t number_of_entries_sent{0};
+    size_t number_of_messages_sent{0};
+    size_t number_of_bytes_sent{0};
+  };
+
+  /// What the caller of `append()` must send
+  struct AppendResult {
+    /// A full buffer that must be sent to the destination node now
+    std::optional<Bundle> bundle_to_send{};
+    /// Whether a flush message must be sent to this node, because the data
+    /// was the first appended to an empty buffer and is still buffered
+    bool send_flush_message{false};
+  };
+
+  static constexpr size_t default_max_entries = 64;
+  static constexpr size_t default_max_bytes = 1 << 20;
+
+  BoundaryDataAggregator() = default;
+  explicit BoundaryDataAggregator(size_t max_entries,
+                                  size_t max_bytes = default_max_bytes);
+
+  BoundaryDataAggregator(const BoundaryDataAggregator& /*rhs*/) = delete;
+  BoundaryDataAggregator& operator=(const BoundaryDataAggregator& /*rhs*/) =
+      delete;
+  BoundaryDataAggregator(BoundaryDataAggregator&& /*rhs*/) = default;
+  BoundaryDataAggregator& operator=(BoundaryDataAggregator&& /*rhs*/) =
+      default;
+  ~BoundaryDataAggregator() = default;
+
+  size_t max_entries() const { return max_entries_; }
+  size_t max_bytes() const { return max_bytes_; }
+
+  /// \brief Append `entry` to the buffer of `destination_node`.
+  AppendResult append(size_t destination_node, Entry entry);
+
+  /// \brief Remove and return the buffers of all destination nodes that have
+  /// data.
+  std::vector<std::pair<size_t, Bundle>> take_all();
+
+  /// @{
+  /// Statistics of the data that was handed out to be sent.
+  size_t number_of_entries_sent() const;
+  size_t number_of_messages_sent() const;
+  size_t number_of_bytes_sent() const;
+  /// @}
+
+  /// Return the statistics and reset them.
+  Statistics take_statistics();
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+
+ private:
+  struct Buffer {
+    Bundle entries{};
+    size_t bytes{0};
+  };
+
+  // Must be called with the lock held
+  Bundle take(Buffer& buffer);
+
+  size_t max_entries_{default_max_entries};
+  size_t max_bytes_{default_max_bytes};
+  mutable Parallel::NodeLock lock_{};
+  std::unordered_map<size_t, Buffer> buffers_{};
+  size_t number_of_entries_sent_{0};
+  size_t number_of_messages_sent_{0};
+  size_t number_of_bytes_sent_{0};
+};
+
+template <size_t Dim>
+void BoundaryDataAggregator<Dim>::Entry::pup(PUP::er& p) {
+  p | receiver;
+  p | time_step_id;
+  p | data;
+  p | priority;
+}
+
+template <size_t Dim>
+BoundaryDataAggregator<Dim>::BoundaryDataAggregator(const size_t max_entries,
+                                                    const size_t max_bytes)
+    : max_entries_(max_entries), max_bytes_(max_bytes) {
+  ASSERT(max_entries_ > 0, "Must allow at least one entry per message.");
+}
+
+template <size_t Dim>
+typename BoundaryDataAggregator<Dim>::AppendResult
+BoundaryDataAggregator<Dim>::append(const size_t destination_node,
+                                    Entry entry) {
+  const auto& boundary_data = entry.data.second;
+  const auto size = [](const std::optional<DataVector>& data) -> size_t {
+    return data.has_value() ? data->size() : 0;
+  };
+  const size_t bytes =
+      sizeof(double) * (size(boundary_data.ghost_cell_data) +
+                        size(boundary_data.boundary_correction_data));
+
+  AppendResult result{};
+  const std::lock_guard lock(lock_);
+  auto& buffer = buffers_[destination_node];
+  const bool buffer_was_empty = buffer.entries.empty();
+  buffer.entries.push_back(std::move(entry));
+  buffer.bytes += bytes;
+  if (buffer.entries.size() >= max_entries_ or buffer.bytes >= max_bytes_) {
+    result.bundle_to_send = take(buffer);
+  } else {
+    result.send_flush_message = buffer_was_empty;
+  }
+  return result;
+}
+
+template <size_t Dim>
+std::vector<std::pair<size_t, typename BoundaryDataAggregator<Dim>::Bundle>>
+BoundaryDataAggregator<Dim>::take_all() {
+  std::vector<std::pair<size_t, Bundle>> result{};
+  const std::lock_guard lock(lock_);
+  for (auto& [node, buffer] : buffers_) {
+    if (not buffer.entries.empty()) {
+      result.emplace_back(node, take(buffer));
+    }
+  }
+  return result;
+}
+
+template <size_t Dim>
+typename BoundaryDataAggregator<Dim>::Bundle BoundaryDataAggregator<Dim>::take(
+    Buffer& buffer) {
+  ++number_of_messages_sent_;
+  number_of_entries_sent_ += buffer.entries.size();
+  number_of_bytes_sent_ += buffer.bytes;
+  Bundle result = std::move(buffer.entries);
+  buffer.entries.clear();
+  buffer.bytes = 0;
+  return result;
+}
+
+template <size_t Dim>
+size_t BoundaryDataAggregator<Dim>::number_of_entries_sent() const {
+  const std::lock_guard lock(lock_);
+  return number_of_entries_sent_;
+}
+
+template <size_t Dim>
+size_t BoundaryDataAggregator<Dim>::number_of_messages_sent() const {
+  const std::lock_guard lock(lock_);
+  return number_of_messages_sent_;
+}
+
+template <size_t Dim>
+size_t BoundaryDataAggregator<Dim>::number_of_bytes_sent() const {
+  const std::lock_guard lock(lock_);
+  return number_of_bytes_sent_;
+}
+
+template <size_t Dim>
+typename BoundaryDataAggregator<Dim>::Statistics
+BoundaryDataAggregator<Dim>::take_statistics() {
+  const std::lock_guard lock(lock_);
+  return {std::exchange(number_of_entries_sent_, 0),
+          std::exchange(number_of_messages_sent_, 0),
+          std::exchange(number_of_bytes_sent_, 0)};
+}
+
+template <size_t Dim>
+void BoundaryDataAggregator<Dim>::pup(PUP::er& p) {
+  // Node locks are default-constructed, which is fine
+  p | max_entries_;
+  p | max_bytes_;
+  size_t number_of_buffers = buffers_.size();
+  p | number_of_buffers;
+  if (p.isUnpacking()) {
+    buffers_.clear();
+    for (size_t i = 0; i < number_of_buffers; ++i) {
+      size_t node = 0;
+      p | node;
+      auto& buffer = buffers_[node];
+      p | buffer.entries;
+      p | buffer.bytes;
+    }
+  } else {
+    for (auto& [node, buffer] : buffers_) {
+      size_t node_to_pup = node;
+      p | node_to_pup;
+      p | buffer.entries;
+      p | buffer.bytes;
+    }
+  }
+  p | number_of_entries_sent_;
+  p | number_of_messages_sent_;
+  p | number_of_bytes_sent_;
+}
+}  // namespace Parallel
@@ -21,8 +21,10 @@
 #include "Evolution/DiscontinuousGalerkin/Initialization/QuadratureTag.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
 #include "Parallel/ArrayCollection/SpawnInitializeElementsInCollection.hpp"
+#include "Parallel/ArrayCollection/Tags/BoundaryDataAggregator.hpp"
 #include "Parallel/ArrayCollection/Tags/ElementCollection.hpp"
 #include "Parallel/ArrayCollection/Tags/ElementLocations.hpp"
+#include "Parallel/ArrayCollection/Tags/ElementReadyQueues.hpp"
 #include "Parallel/ArrayCollection/Tags/NumberOfElementsTerminated.hpp"
 #include "Parallel/CreateElementsUsingDistribution.hpp"
 #include "Parallel/GlobalCache.hpp"
@@ -54,16 +56,22 @@ namespace Parallel::Actions {
  *   - `domain::Tags::InitialExtents<Dim>`
  *   - `evolution::dg::Tags::Quadrature`
  *   - `domain::Tags::ElementDistribution`
+ *   - `Parallel::Tags::BoundaryDataAggregationMaxEntries`
+ *   - `Parallel::Tags::BoundaryDataAggregationMaxBytes`
  *
  * DataBox changes:
  * - Adds:
  *   - `Parallel::Tags::ElementCollection`
  *   - `Parallel::Tags::ElementLocations<Dim>`
+ *   - `Parallel::Tags::ElementReadyQueues<Dim>`
+ *   - `Parallel::Tags::BoundaryDataAggregator<Dim>`
  *   - `Parallel::Tags::NumberOfElementsTerminated`
  * - Removes: nothing
  * - Modifies:
  *   - `Parallel::Tags::ElementCollection`
  *   - `Parallel::Tags::ElementLocations<Dim>`
+ *   - `Parallel::Tags::ElementReadyQueues<Dim>`
+ *   - `Parallel::Tags::BoundaryDataAggregator<Dim>`
  *   - `Parallel::Tags::NumberOfElementsTerminated`
  */
 template <size_t Dim, class Metavariables, class PhaseDepActionList,
@@ -72,11 +80,16 @@ struct CreateElementCollection {
   using simple_tags = tmpl::list<
       Parallel::Tags::ElementCollection<Dim, Metavariables, PhaseDepActionList,
                                         SimpleTagsFromOptions>,
-      Parallel::Tags::ElementLocations<Dim>, Tags::NumberOfElementsTerminated>;
+      Parallel::Tags::ElementLocations<Dim>,
+      Parallel::Tags::ElementReadyQueues<Dim>,
+      Parallel::Tags::BoundaryDataAggregator<Dim>,
+      Tags::NumberOfElementsTerminated>;
   using compute_tags = tmpl::list<>;
   using const_global_cache_tags =
       tmpl::list<::domain::Tags::Domain<Dim>,
-                 ::domain::Tags::ElementDistribution>;
+                 ::domain::Tags::ElementDistribution,
+                 Parallel::Tags::BoundaryDataAggregationMaxEntries,
+                 Parallel::Tags::BoundaryDataAggregationMaxBytes>;
 
   using return_tag_list = tmpl::append<simple_tags, compute_tags>;
 
@@ -147,12 +160,24 @@ struct CreateElementCollection {
     db::mutate<Tags::ElementLocations<Dim>,
                Tags::ElementCollection<Dim, Metavariables, PhaseDepActionList,
                                        SimpleTagsFromOptions>,
+               Tags::ElementReadyQueues<Dim>, Tags::BoundaryDataAggregator<Dim>,
                Tags::NumberOfElementsTerminated>(
         [&local_cache, &initialization_items, &my_elements_and_cores,
-         &node_of_elements](
+         &node_of_elements, my_node](
             const auto element_locations_ptr, const auto collection_ptr,
+            const gsl::not_null<Parallel::ElementReadyQueues<Dim>*>
+                ready_queues,
+            const gsl::not_null<Parallel::BoundaryDataAggregator<Dim>*>
+                boundary_data_aggregator,
             const gsl::not_null<size_t*> number_of_elements_terminated) {
           *number_of_elements_terminated = 0;
+          *ready_queues = Parallel::ElementReadyQueues<Dim>{
+              Parallel::procs_on_node<size_t>(my_node, local_cache)};
+          *boundary_data_aggregator = Parallel::BoundaryDataAggregator<Dim>{
+              Parallel::get<Tags::BoundaryDataAggregationMaxEntries>(
+                  local_cache),
+              Parallel::get<Tags::BoundaryDataAggregationMaxBytes>(
+                  local_cache)};
           const auto serialized_initialization_items =
               serialize(initialization_items);
           *element_locations_ptr = std::move(node_of_elements);
@@ -6,6 +6,7 @@
 #include <charm++.h>
 #include <cstddef>
 #include <exception>
+#include <optional>
 #include <pup.h>
 #include <string>
 #include <type_traits>
@@ -13,11 +14,13 @@
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
+#include "DataStructures/MemoryTracking.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
 #include "Parallel/AlgorithmMetafunctions.hpp"
 #include "Parallel/ArrayCollection/DgElementArrayMemberBase.hpp"
 #include "Parallel/ArrayCollection/SetTerminateOnElement.hpp"
+#include "Parallel/ElementCosts.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Info.hpp"
 #include "Parallel/Invoke.hpp"
@@ -26,6 +29,7 @@
 #include "Parallel/Phase.hpp"
 #include "Parallel/Tags/ArrayIndex.hpp"
 #include "Parallel/Tags/Metavariables.hpp"
+#include "Parallel/Tracing.hpp"
 #include "ParallelAlgorithms/Initialization/MutateAssign.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
@@ -34,6 +38,7 @@
 #include "Utilities/PrettyType.hpp"
 #include "Utilities/Serialization/CharmPupable.hpp"
 #include "Utilities/System/Abort.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
 
@@ -449,12 +454,34 @@ bool DgElementArrayMember<Dim, Metavariables,
   }
 #endif  // SPECTRE_CHARM_PROJECTIONS
 
+#ifdef SPECTRE_ACTION_TRACING
+  std::optional<Parallel::tracing::ScopedEvent> trace_event{};
+  trace_event.emplace(Parallel::tracing::EventType::IterableAction,
+                      Parallel::tracing::name_id<ParallelComponent>(),
+                      Parallel::tracing::name_id<ThisAction>());
+#endif  // SPECTRE_ACTION_TRACING
+  const bool measure_cost = Parallel::element_costs::enabled();
+  const double action_start_time = measure_cost ? sys::wall_time() : 0.0;
+  std::optional<memory_tracking::ScopedComponent> tracked_component{};
+  tracked_component.emplace(memory_tracking::component_id<ParallelComponent>());
   const auto& [requested_execution_return, next_action_step] =
       ThisAction::apply(box_, inboxes_,
                         *Parallel::local_branch(global_cache_proxy_),
                         std::as_const(this->element_id_), actions_list{},
                         std::add_pointer_t<ParallelComponent>{});
+  tracked_component.reset();
+  if (measure_cost) {
+    this->iterable_action_wall_time_ += sys::wall_time() - action_start_time;
+  }
   const auto& requested_execution = requested_execution_return;
+#ifdef SPECTRE_ACTION_TRACING
+  if (requested_execution == AlgorithmExecution::Retry) {
+    trace_event->set_type(Parallel::tracing::EventType::RetriedIterableAction);
+  }
+  // Record the event before handling the requested execution, which may call
+  // into the nodegroup
+  trace_event.reset();
+#endif  // SPECTRE_ACTION_TRACING
 
   if (next_action_step.has_value()) {
     ASSERT(
@@ -7,6 +7,7 @@
 #include <pup.h>
 #include <sstream>
 #include <string>
+#include <utility>
 
 #include "Domain/Structure/ElementId.hpp"
 #include "Parallel/NodeLock.hpp"
@@ -102,6 +103,11 @@ size_t DgElementArrayMemberBase<Dim>::get_core() const {
   return my_core_;
 }
 
+template <size_t Dim>
+double DgElementArrayMemberBase<Dim>::take_iterable_action_wall_time() {
+  return std::exchange(iterable_action_wall_time_, 0.0);
+}
+
 template <size_t Dim>
 void DgElementArrayMemberBase<Dim>::pup(PUP::er& p) {
   PUP::able::pup(p);
@@ -111,6 +111,14 @@ class DgElementArrayMemberBase : PUP::able {
   /// \brief Get which core this element should pretend to be bound to.
   size_t get_core() const;
 
+  /// \brief The wall time in seconds spent executing iterable actions since
+  /// the last call to this function.
+  ///
+  /// Used to measure the computational cost of the elements, e.g. by
+  /// `Events::ObserveElementCosts`. Retried actions are included. The actions
+  /// are only timed while `Parallel::element_costs::enabled()`.
+  double take_iterable_action_wall_time();
+
   /// Returns the name of the last "next iterable action" to be run before a
   /// deadlock occurred.
   const std::string& deadlock_analysis_next_iterable_action() const {
@@ -141,5 +149,7 @@ class DgElementArrayMemberBase : PUP::able {
   // interoperating with core-aware concepts like the interpolation
   // framework. Once that framework is core-agnostic we will remove my_core_.
   size_t my_core_{std::numeric_limits<size_t>::max()};
+  // Not serialized, so the measurement restarts after migration
+  double iterable_action_wall_time_{0.0};
 };
 }  // namespace Parallel
@@ -0,0 +1,278 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Parallel/ArrayCollection/ElementReadyQueues.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <mutex>
+#include <optional>
+#include <pup.h>
+#include <pup_stl.h>
+#include <utility>
+
+#include "Domain/Structure/ElementId.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+
+namespace Parallel {
+template <size_t Dim>
+ElementReadyQueues<Dim>::ElementReadyQueues(const size_t number_of_cores)
+    : queues_(number_of_cores), element_states_(number_of_cores) {
+  ASSERT(number_of_cores > 0, "There must be at least one core on the node.");
+}
+
+template <size_t Dim>
+typename ElementReadyQueues<Dim>::ElementStates&
+ElementReadyQueues<Dim>::states_of(const ElementId<Dim>& element_id) {
+  return element_states_[std::hash<ElementId<Dim>>{}(element_id) %
+                         element_states_.size()];
+}
+
+template <size_t Dim>
+bool ElementReadyQueues<Dim>::insert(const ElementId<Dim>& element_id,
+                                     const size_t home_core, const int priority,
+                                     const bool is_retry) {
+  ASSERT(home_core < queues_.size(),
+         "Home core " << home_core << " of element " << element_id
+                      << " is out of range, there are only " << queues_.size()
+                      << " cores on the node.");
+  auto& element_states = states_of(element_id);
+  // The queue lock is taken while holding the lock of the element states, so
+  // that the entry is queued before it can be claimed. `pop()` never holds a
+  // queue lock while taking the lock of the element states.
+  const std::lock_guard states_lock(element_states.lock);
+  auto& state = element_states.states[element_id];
+  const bool newly_queued = not state.queued;
+  if (not newly_queued and priority >= state.priority) {
+    if (is_retry) {
+      // New data arrived and queued the element again already.
+      auto& queue = queues_[home_core];
+      const std::lock_guard queue_lock(queue.lock);
+      ++queue.statistics.number_of_retries;
+    }
+    return false;
+  }
+  if (newly_queued) {
+    state.queued = true;
+    ++element_states.number_of_queued_elements;
+  }
+  state.priority = priority;
+  ++state.entry_number;
+  auto& queue = queues_[state.last_core.value_or(home_core)];
+  const std::lock_guard queue_lock(queue.lock);
+  queue.buckets[priority].push_back(Entry{element_id, state.entry_number});
+  if (is_retry) {
+    ++queue.statistics.number_of_retries;
+  } else if (not newly_queued) {
+    ++queue.statistics.number_of_promotions;
+  }
+  return newly_queued;
+}
+
+template <size_t Dim>
+bool ElementReadyQueues<Dim>::push(const ElementId<Dim>& element_id,
+                                   const size_t home_core,
+                                   const int priority) {
+  return insert(element_id, home_core, priority, false);
+}
+
+template <size_t Dim>
+void ElementReadyQueues<Dim>::retry(const ElementId<Dim>& element_id,
+                                    const size_t home_core,
+                                    const int priority) {
+  insert(element_id, home_core, priority, true);
+}
+
+template <size_t Dim>
+std::optional<std::pair<ElementId<Dim>, int>> ElementReadyQueues<Dim>::claim(
+    const Entry& entry, const size_t core) {
+  auto& element_states = states_of(entry.element_id);
+  const std::lock_guard states_lock(element_states.lock);
+  auto& state = element_states.states.at(entry.element_id);
+  if (not state.queued or state.entry_number != entry.number) {
+    // The element was moved forward and this entry was left behind.
+    return std::nullopt;
+  }
+  state.queued = false;
+  state.last_core = core;
+  --element_states.number_of_queued_elements;
+  return std::pair{entry.element_id, state.priority};
+}
+
+template <size_t Dim>
+std::optional<std::pair<ElementId<Dim>, int>> ElementReadyQueues<Dim>::pop(
+    const size_t core) {
+  ASSERT(core < queues_.size(), "Core " << core
+                                        << " is out of range, there are only "
+                                        << queues_.size()
+                                        << " cores on the node.");
+  // Take the most urgent entry from the own queue, or otherwise the least
+  // urgent entry from another queue since that is the one its own core would
+  // get to last. Each entry is taken out under the queue lock and claimed
+  // after releasing it, skipping entries that were left behind.
+  for (size_t offset = 0; offset < queues_.size(); ++offset) {
+    auto& queue = queues_[(core + offset) % queues_.size()];
+    while (true) {
+      std::optional<Entry> entry{};
+      {
+        const std::lock_guard queue_lock(queue.lock);
+        if (queue.buckets.empty()) {
+          break;
+        }
+        const auto bucket = offset == 0 ? queue.buckets.begin()
+                                        : std::prev(queue.buckets.end());
+        if (offset == 0) {
+          entry = bucket->second.front();
+          bucket->second.pop_front();
+        } else {
+          entry = bucket->second.back();
+          bucket->second.pop_back();
+        }
+        if (bucket->second.empty()) {
+          queue.buckets.erase(bucket);
+        }
+      }
+      auto result = claim(*entry, core);
+      if (result.has_value()) {
+        if (offset != 0) {
+          const std::lock_guard queue_lock(queue.lock);
+          ++queue.statistics.number_of_steals;
+        }
+        return result;
+      }
+    }
+  }
+  auto& queue = queues_[core];
+  const std::lock_guard queue_lock(queue.lock);
+  ++queue.statistics.number_of_idle_pops;
+  return std::nullopt;
+}
+
+template <size_t Dim>
+void ElementReadyQueues<Dim>::start_running() {
+  const std::lock_guard runners_lock(runners_lock_);
+  ++number_of_runners_;
+}
+
+template <size_t Dim>
+bool ElementReadyQueues<Dim>::stop_running() {
+  const std::lock_guard runners_lock(runners_lock_);
+  ASSERT(number_of_runners_ > 0,
+         "stop_running() was called more often than start_running().");
+  --number_of_runners_;
+  return number_of_runners_ == 0;
+}
+
+template <size_t Dim>
+template <typename F>
+size_t ElementReadyQueues<Dim>::sum_over_queues(const F& f) const {
+  size_t result = 0;
+  for (const auto& queue : queues_) {
+    const std::lock_guard queue_lock(queue.lock);
+    result += f(queue);
+  }
+  return result;
+}
+
+template <size_t Dim>
+size_t ElementReadyQueues<Dim>::size() const {
+  size_t result = 0;
+  for (const auto& element_states : element_states_) {
+    const std::lock_guard states_lock(element_states.lock);
+    result += element_states.number_of_queued_elements;
+  }
+  return result;
+}
+
+template <size_t Dim>
+size_t ElementReadyQueues<Dim>::number_of_steals() const {
+  return sum_over_queues(
+      [](const Queue& queue) { return queue.statistics.number_of_steals; });
+}
+
+template <size_t Dim>
+size_t ElementReadyQueues<Dim>::number_of_retries() const {
+  return sum_over_queues(
+      [](const Queue& queue) { return queue.statistics.number_of_retries; });
+}
+
+template <size_t Dim>
+size_t ElementReadyQueues<Dim>::number_of_idle_pops() const {
+  return sum_over_queues(
+      [](const Queue& queue) { return queue.statistics.number_of_idle_pops; });
+}
+
+template <size_t Dim>
+size_t ElementReadyQueues<Dim>::number_of_promotions() const {
+  return sum_over_queues(
+      [](const Queue& queue) { return queue.statistics.number_of_promotions; });
+}
+
+template <size_t Dim>
+typename ElementReadyQueues<Dim>::Statistics
+ElementReadyQueues<Dim>::take_statistics() {
+  Statistics result{};
+  for (auto& queue : queues_) {
+    const std::lock_guard queue_lock(queue.lock);
+    result.number_of_steals += queue.statistics.number_of_steals;
+    result.number_of_retries += queue.statistics.number_of_retries;
+    result.number_of_idle_pops += queue.statistics.number_of_idle_pops;
+    result.number_of_promotions += queue.statistics.number_of_promotions;
+    queue.statistics = Statistics{};
+  }
+  return result;
+}
+
+template <size_t Dim>
+void ElementReadyQueues<Dim>::Statistics::pup(PUP::er& p) {
+  p | number_of_steals;
+  p | number_of_retries;
+  p | number_of_idle_pops;
+  p | number_of_promotions;
+}
+
+template <size_t Dim>
+void ElementReadyQueues<Dim>::Entry::pup(PUP::er& p) {
+  p | element_id;
+  p | number;
+}
+
+template <size_t Dim>
+void ElementReadyQueues<Dim>::ElementState::pup(PUP::er& p) {
+  p | queued;
+  p | priority;
+  p | entry_number;
+  p | last_core;
+}
+
+template <size_t Dim>
+void ElementReadyQueues<Dim>::pup(PUP::er& p) {
+  size_t number_of_cores = queues_.size();
+  p | number_of_cores;
+  if (p.isUnpacking()) {
+    // Node locks are default-constructed, which is fine
+    queues_ = std::vector<Queue>(number_of_cores);
+    element_states_ = std::vector<ElementStates>(number_of_cores);
+  }
+  for (auto& queue : queues_) {
+    p | queue.buckets;
+    p | queue.statistics;
+  }
+  for (auto& element_states : element_states_) {
+    p | element_states.states;
+    p | element_states.number_of_queued_elements;
+  }
+  // Threads don't run elements while the queues are serialized.
+}
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATION(r, data) template class ElementReadyQueues<DIM(data)>;
+
+GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
+
+#undef INSTANTIATION
+#undef DIM
+}  // namespace Parallel
@@ -0,0 +1,187 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <deque>
+#include <map>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Domain/Structure/ElementId.hpp"
+#include "Parallel/NodeLock.hpp"
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace Parallel {
+/*!
+ * \brief Node-local queues of the elements in a `Parallel::DgElementCollection`
+ * that have received data and need to run `perform_algorithm()`.
+ *
+ * There is one queue per core on the node. An element is pushed onto the
+ * queue of the core that last ran it, so that it preferentially runs on the
+ * core whose caches hold its data. Elements that haven't run yet are pushed
+ * onto the queue of the `home_core` passed to `push()`. An element is queued
+ * at most once on the node: pushing an element that is already queued does
+ * nothing, which replaces the one Charm++ message per neighbor send that was
+ * used previously with one message per element that becomes ready.
+ *
+ * Each queue is ordered by the priority passed to `push()`, where smaller
+ * values run first like Charm++ message priorities, and is first-in first-out
+ * among elements of equal priority. The queue keeps one first-in first-out
+ * bucket per priority, so pushing and popping take logarithmic time in the
+ * number of distinct priorities. Pushing an element that is already queued
+ * with a smaller priority moves it forward by queueing it again in the more
+ * urgent bucket. The entry left behind is skipped when it is reached.
+ *
+ * `pop()` first takes the most urgent element from the calling core's own
+ * queue and, if that is empty, steals the least urgent element from the other
+ * queues on the node. Elements that could not be run because another thread
+ * currently holds their `element_lock()` are put back with `retry()`.
+ *
+ * Each queue is guarded by its own lock. The state of the elements, i.e.
+ * whether and with which priority they are queued and which core ran them
+ * last, is split into as many parts as there are cores, each with its own
+ * lock, so cores only contend when they access the same queue or part. The
+ * state of an element is only kept while it is queued and to remember its
+ * core.
+ *
+ * The number of steals, retries, idle pops (calls to `pop()` that found no
+ * work on the node), and promotions (pushes that moved a queued element
+ * forward) are recorded for diagnosing load imbalance. They are written by
+ * `Events::ObserveElementCollectionStatistics`.
+ */
+template <size_t Dim>
+class ElementReadyQueues {
+ public:
+  /// Counters of the queues since the last `take_statistics()`
+  struct Statistics {
+    size_t number_of_steals{0};
+    size_t number_of_retries{0};
+    size_t number_of_idle_pops{0};
+    size_t number_of_promotions{0};
+
+    // NOLINTNEXTLINE(google-runtime-references)
+    void pup(PUP::er& p);
+  };
+
+  ElementReadyQueues() = default;
+  explicit ElementReadyQueues(size_t number_of_cores);
+
+  ElementReadyQueues(const ElementReadyQueues& /*rhs*/) = delete;
+  ElementReadyQueues& operator=(const ElementReadyQueues& /*rhs*/) = delete;
+  ElementReadyQueues(ElementReadyQueues&& /*rhs*/) = default;
+  ElementReadyQueues& operator=(ElementReadyQueues&& /*rhs*/) = default;
+  ~ElementReadyQueues() = default;
+
+  size_t number_of_cores() const { return queues_.size(); }
+
+  /// \brief Queue `element_id` with `priority` on the core that last ran it,
+  /// or on `home_core` if it hasn't run yet. Returns `false` if the element
+  /// was already queued, in which case it is only moved forward if `priority`
+  /// is smaller than its queued priority.
+  bool push(const ElementId<Dim>& element_id, size_t home_core,
+            int priority = 0);
+
+  /// \brief Put back an element that was popped with `priority` but could
+  /// not be run because its `element_lock()` was held by another thread.
+  void retry(const ElementId<Dim>& element_id, size_t home_core, int priority);
+
+  /// \brief Get the next element to run on `core` and the priority it was
+  /// queued with, stealing from the other cores on the node if `core` has no
+  /// queued elements.
+  ///
+  /// The element is assumed to run on `core`, so it is queued there the next
+  /// time it is pushed.
+  std::optional<std::pair<ElementId<Dim>, int>> pop(size_t core);
+
+  /// The total number of queued elements.
+  size_t size() const;
+
+  /// @{
+  /// \brief Count the threads that are running elements from the queues.
+  ///
+  /// `stop_running()` returns `true` for the last thread to stop, which must
+  /// make sure that the elements left in the queues are run eventually.
+  void start_running();
+  bool stop_running();
+  /// @}
+
+  /// @{
+  /// Counters summed over all cores on the node.
+  size_t number_of_steals() const;
+  size_t number_of_retries() const;
+  size_t number_of_idle_pops() const;
+  size_t number_of_promotions() const;
+  /// @}
+
+  /// Return the counters summed over all cores on the node and reset them.
+  Statistics take_statistics();
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+
+ private:
+  struct Entry {
+    ElementId<Dim> element_id{};
+    // Only the entry with the number of the latest push of a queued element
+    // is run, the others were left behind when the element was moved forward.
+    size_t number{0};
+
+    // NOLINTNEXTLINE(google-runtime-references)
+    void pup(PUP::er& p);
+  };
+
+  struct Queue {
+    // The lock is mutable so that the counters can be read from const
+    // member functions.
+    mutable Parallel::NodeLock lock{};
+    // The entries by priority, first-in first-out within each priority
+    std::map<int, std::deque<Entry>> buckets{};
+    Statistics statistics{};
+  };
+
+  struct ElementState {
+    bool queued{false};
+    int priority{0};
+    // The number of the live entry of the element
+    size_t entry_number{0};
+    std::optional<size_t> last_core{};
+
+    // NOLINTNEXTLINE(google-runtime-references)
+    void pup(PUP::er& p);
+  };
+
+  struct ElementStates {
+    mutable Parallel::NodeLock lock{};
+    std::unordered_map<ElementId<Dim>, ElementState> states{};
+    size_t number_of_queued_elements{0};
+  };
+
+  ElementStates& states_of(const ElementId<Dim>& element_id);
+
+  // Queue the element, or move it forward. Returns `true` if it wasn't
+  // queued before.
+  bool insert(const ElementId<Dim>& element_id, size_t home_core,
+              int priority, bool is_retry);
+
+  // Mark the element of `entry` as popped by `core` if the entry is live
+  std::optional<std::pair<ElementId<Dim>, int>> claim(const Entry& entry,
+                                                      size_t core);
+
+  template <typename F>
+  size_t sum_over_queues(const F& f) const;
+
+  std::vector<Queue> queues_{};
+  std::vector<ElementStates> element_states_{};
+  Parallel::NodeLock runners_lock_{};
+  size_t number_of_runners_{0};
+};
+}  // namespace Parallel
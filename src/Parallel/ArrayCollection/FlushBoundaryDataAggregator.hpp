@@ -0,0 +1,49 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "Parallel/ArrayCollection/ReceiveDataForElement.hpp"
+#include "Parallel/ArrayCollection/Tags/BoundaryDataAggregator.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace Parallel::Actions {
+/// \brief A threaded action that sends all data buffered in the
+/// `Parallel::Tags::BoundaryDataAggregator` of the node to the destination
+/// nodes, one message per node.
+///
+/// This message is sent to the node itself when data is appended to an empty
+/// buffer, which bounds how long data is held back. See
+/// `Parallel::BoundaryDataAggregator` for details.
+struct FlushBoundaryDataAggregator {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex,
+            typename DistributedObject, typename ReceiveTag>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const gsl::not_null<Parallel::NodeLock*> /*node_lock*/,
+                    const DistributedObject* /*distributed_object*/,
+                    const ReceiveTag& /*meta*/) {
+    constexpr size_t Dim = ParallelComponent::element_collection_tag::type::
+        key_type::volume_dim;
+    auto& my_proxy = Parallel::get_parallel_component<ParallelComponent>(cache);
+    // The aggregator has its own lock, so we avoid locking the DataBox and the
+    // nodegroup.
+    for (auto& [node, bundle] :
+         db::get_mutable_reference<Parallel::Tags::BoundaryDataAggregator<Dim>>(
+             make_not_null(&box))
+             .take_all()) {
+      Parallel::threaded_action<Parallel::Actions::ReceiveDataForElement<>>(
+          my_proxy[node], ReceiveTag{}, std::move(bundle));
+    }
+  }
+};
+}  // namespace Parallel::Actions
@@ -5,9 +5,12 @@
 
 #include <cstddef>
 #include <mutex>
+#include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "Domain/Structure/ElementId.hpp"
+#include "Parallel/ArrayCollection/RunReadyElements.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
 #include "Parallel/Local.hpp"
@@ -21,8 +24,10 @@ namespace Parallel::Actions {
 /// \brief Receive data for a specific element on the nodegroup.
 ///
 /// If `StartPhase` is `true` then `start_phase(phase)` is called on the
-/// `element_to_execute_on`, otherwise `perform_algorithm()` is called on the
-/// `element_to_execute_on`.
+/// `element_to_execute_on`, otherwise the `element_to_execute_on` is queued in
+/// the `Parallel::Tags::ElementReadyQueues` with the priority that was sent
+/// along with the data and the queued elements are run with
+/// `Parallel::Actions::RunReadyElements`.
 template <bool StartPhase = false>
 struct ReceiveDataForElement {
   /// \brief Entry method called when receiving data from another node.
@@ -37,7 +42,7 @@ struct ReceiveDataForElement {
                     const ReceiveTag& /*meta*/,
                     const ElementId<Dim>& element_to_execute_on,
                     typename ReceiveTag::temporal_id instance,
-                    ReceiveData receive_data) {
+                    ReceiveData receive_data, const int priority = 0) {
     [[maybe_unused]] const size_t my_node = Parallel::my_node<size_t>(cache);
     auto& element_collection = db::get_mutable_reference<
         typename ParallelComponent::element_collection_tag>(
@@ -51,8 +56,42 @@ struct ReceiveDataForElement {
             element_collection.at(element_to_execute_on).inboxes())),
         instance, std::move(receive_data));
 
-    apply_impl<ParallelComponent>(cache, element_to_execute_on,
-                                  make_not_null(&element_collection));
+    apply_impl<ParallelComponent>(make_not_null(&box), cache,
+                                  element_to_execute_on, priority);
+  }
+
+  /// \brief Entry method called when receiving data from another node that
+  /// was aggregated by a `Parallel::BoundaryDataAggregator`, i.e. `Entry` is
+  /// `Parallel::BoundaryDataAggregator<Dim>::Entry`.
+  ///
+  /// The data is inserted into the inboxes of all receiving elements before
+  /// any of them are run.
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex, typename ReceiveTag,
+            typename DistributedObject, typename Entry>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const gsl::not_null<Parallel::NodeLock*> /*node_lock*/,
+                    const DistributedObject* /*distributed_object*/,
+                    const ReceiveTag& /*meta*/, std::vector<Entry> bundle) {
+    static_assert(not StartPhase,
+                  "Aggregated data can't be used to start a phase.");
+    auto& element_collection = db::get_mutable_reference<
+        typename ParallelComponent::element_collection_tag>(
+        make_not_null(&box));
+    for (auto& entry : bundle) {
+      ASSERT(element_collection.count(entry.receiver) == 1,
+             "ElementId " << entry.receiver << " is not on node "
+                          << Parallel::my_node<size_t>(cache));
+      ReceiveTag::insert_into_inbox(
+          make_not_null(&tuples::get<ReceiveTag>(
+              element_collection.at(entry.receiver).inboxes())),
+          entry.time_step_id, std::move(entry.data));
+      RunReadyElements::push<ParallelComponent>(make_not_null(&box), cache,
+                                                entry.receiver, entry.priority);
+    }
+    RunReadyElements::run<ParallelComponent>(make_not_null(&box), cache);
   }
 
   /// \brief Entry method call when receiving from same node.
@@ -65,29 +104,28 @@ struct ReceiveDataForElement {
                     const gsl::not_null<Parallel::NodeLock*> /*node_lock*/,
                     const DistributedObject* /*distributed_object*/,
                     const ElementId<Dim>& element_to_execute_on) {
-    auto& element_collection = db::get_mutable_reference<
-        typename ParallelComponent::element_collection_tag>(
-        make_not_null(&box));
-    apply_impl<ParallelComponent>(cache, element_to_execute_on,
-                                  make_not_null(&element_collection));
+    apply_impl<ParallelComponent>(make_not_null(&box), cache,
+                                  element_to_execute_on);
   }
 
  private:
-  template <typename ParallelComponent, typename Metavariables,
-            typename ElementCollection, size_t Dim>
-  static void apply_impl(
-      Parallel::GlobalCache<Metavariables>& cache,
-      const ElementId<Dim>& element_to_execute_on,
-      const gsl::not_null<ElementCollection*> element_collection) {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, size_t Dim>
+  static void apply_impl(const gsl::not_null<db::DataBox<DbTagsList>*> box,
+                         Parallel::GlobalCache<Metavariables>& cache,
+                         const ElementId<Dim>& element_to_execute_on,
+                         [[maybe_unused]] const int priority = 0) {
     if constexpr (StartPhase) {
+      auto& element_collection = db::get_mutable_reference<
+          typename ParallelComponent::element_collection_tag>(box);
       const Phase current_phase =
           Parallel::local_branch(
               Parallel::get_parallel_component<ParallelComponent>(cache))
               ->phase();
-      ASSERT(element_collection->count(element_to_execute_on) == 1,
+      ASSERT(element_collection.count(element_to_execute_on) == 1,
              "ElementId " << element_to_execute_on << " is not on node "
                           << Parallel::my_node<size_t>(cache););
-      auto& element = element_collection->at(element_to_execute_on);
+      auto& element = element_collection.at(element_to_execute_on);
       const std::lock_guard element_lock(element.element_lock());
       // We always force the phase to start because if a previous phase
       // terminated properly, then this does nothing. But if a phase didn't
@@ -96,17 +134,8 @@ struct ReceiveDataForElement {
       // failure, so we must force the phase to start.
       element.start_phase(current_phase, true);
     } else {
-      auto& element = element_collection->at(element_to_execute_on);
-      std::unique_lock element_lock(element.element_lock(), std::defer_lock);
-      if (element_lock.try_lock()) {
-        element.perform_algorithm();
-      } else {
-        const size_t my_node = Parallel::my_node<size_t>(cache);
-        auto& my_proxy =
-            Parallel::get_parallel_component<ParallelComponent>(cache);
-        Parallel::threaded_action<Parallel::Actions::ReceiveDataForElement<>>(
-            my_proxy[my_node], element_to_execute_on);
-      }
+      Parallel::Actions::RunReadyElements::enqueue_and_run<ParallelComponent>(
+          box, cache, element_to_execute_on, priority);
     }
   }
 };
@@ -0,0 +1,157 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Parallel/ArrayCollection/ElementReadyQueues.hpp"
+#include "Parallel/ArrayCollection/Tags/ElementReadyQueues.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Info.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace Parallel::Actions {
+/*!
+ * \brief A threaded action that runs `perform_algorithm()` on the elements in
+ * the `Parallel::Tags::ElementReadyQueues` of the node until the queues are
+ * empty.
+ *
+ * Elements are queued with `Parallel::Actions::RunReadyElements::enqueue()`,
+ * which only sends a message to the nodegroup if the element was not already
+ * queued. The core that runs this action pops elements from its own queue
+ * first, most urgent priority first, and steals from the other cores on the
+ * node once its own queue is empty.
+ *
+ * If an element can't be run because another thread holds its
+ * `element_lock()` it is queued again. Once more consecutive elements than
+ * there are cores on the node couldn't be run, this action returns so that
+ * the core is not spinning while other threads finish running those elements.
+ * The elements are left for the threads that are still running queued
+ * elements, which usually includes the thread holding the lock. Only the last
+ * thread to stop running sends a new message to the nodegroup if elements are
+ * still queued, e.g. because their locks are held by an action that is not
+ * run from the queues.
+ */
+struct RunReadyElements {
+  /// \brief Run queued elements until the queues on the node are empty
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex,
+            typename DistributedObject>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const gsl::not_null<Parallel::NodeLock*> /*node_lock*/,
+                    const DistributedObject* /*distributed_object*/) {
+    run<ParallelComponent>(make_not_null(&box), cache);
+  }
+
+  /// \brief Queue `element_id` and, if it wasn't already queued, send a
+  /// message to the nodegroup to run it.
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, size_t Dim>
+  static void enqueue(const gsl::not_null<db::DataBox<DbTagsList>*> box,
+                      Parallel::GlobalCache<Metavariables>& cache,
+                      const ElementId<Dim>& element_id,
+                      const int priority = 0) {
+    if (push<ParallelComponent>(box, cache, element_id, priority)) {
+      const size_t my_node = Parallel::my_node<size_t>(cache);
+      auto& my_proxy =
+          Parallel::get_parallel_component<ParallelComponent>(cache);
+      Parallel::threaded_action<RunReadyElements>(my_proxy[my_node]);
+    }
+  }
+
+  /// \brief Queue `element_id` and run the queued elements on the calling
+  /// core.
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, size_t Dim>
+  static void enqueue_and_run(
+      const gsl::not_null<db::DataBox<DbTagsList>*> box,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ElementId<Dim>& element_id, const int priority = 0) {
+    push<ParallelComponent>(box, cache, element_id, priority);
+    run<ParallelComponent>(box, cache);
+  }
+
+  /// \brief Queue `element_id` without sending a message. Returns `false` if
+  /// the element was already queued.
+  ///
+  /// Elements with smaller `priority` run first, see
+  /// `Parallel::ElementReadyQueues`.
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, size_t Dim>
+  static bool push(const gsl::not_null<db::DataBox<DbTagsList>*> box,
+                   Parallel::GlobalCache<Metavariables>& cache,
+                   const ElementId<Dim>& element_id, const int priority = 0) {
+    // The queues and the collection are only accessed through their own locks,
+    // so we avoid locking the DataBox and the nodegroup.
+    const auto& element_collection = db::get_mutable_reference<
+        typename ParallelComponent::element_collection_tag>(box);
+    ASSERT(element_collection.count(element_id) == 1,
+           "ElementId " << element_id << " is not on node "
+                        << Parallel::my_node<size_t>(cache));
+    return db::get_mutable_reference<Parallel::Tags::ElementReadyQueues<Dim>>(
+               box)
+        .push(element_id, home_core(element_collection, cache, element_id),
+              priority);
+  }
+
+  /// \brief Run the queued elements on the calling core until the queues on
+  /// the node are empty.
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables>
+  static void run(const gsl::not_null<db::DataBox<DbTagsList>*> box,
+                  Parallel::GlobalCache<Metavariables>& cache) {
+    auto& element_collection = db::get_mutable_reference<
+        typename ParallelComponent::element_collection_tag>(box);
+    constexpr size_t Dim = ParallelComponent::element_collection_tag::type::
+        key_type::volume_dim;
+    auto& queues =
+        db::get_mutable_reference<Parallel::Tags::ElementReadyQueues<Dim>>(box);
+    const size_t core = Parallel::my_local_rank<size_t>(cache);
+
+    queues.start_running();
+    size_t consecutive_retries = 0;
+    while (const auto popped = queues.pop(core)) {
+      const auto& [element_id, priority] = *popped;
+      auto& element = element_collection.at(element_id);
+      std::unique_lock element_lock(element.element_lock(), std::defer_lock);
+      if (element_lock.try_lock()) {
+        consecutive_retries = 0;
+        element.perform_algorithm();
+      } else {
+        queues.retry(element_id,
+                     home_core(element_collection, cache, element_id),
+                     priority);
+        if (++consecutive_retries > queues.number_of_cores()) {
+          break;
+        }
+      }
+    }
+    // The elements left in the queues are run by the threads that are still
+    // running. Only the last thread to stop has to make sure they run later.
+    if (queues.stop_running() and queues.size() > 0) {
+      auto& my_proxy =
+          Parallel::get_parallel_component<ParallelComponent>(cache);
+      Parallel::threaded_action<RunReadyElements>(
+          my_proxy[Parallel::my_node<size_t>(cache)]);
+    }
+  }
+
+ private:
+  template <typename ElementCollection, typename Metavariables, size_t Dim>
+  static size_t home_core(const ElementCollection& element_collection,
+                          const Parallel::GlobalCache<Metavariables>& cache,
+                          const ElementId<Dim>& element_id) {
+    return Parallel::local_rank_of<size_t>(
+        element_collection.at(element_id).get_core(), cache);
+  }
+};
+}  // namespace Parallel::Actions
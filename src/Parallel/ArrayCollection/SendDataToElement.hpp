@@ -11,7 +11,10 @@
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Evolution/DiscontinuousGalerkin/AtomicInboxBoundaryData.hpp"
+#include "Parallel/ArrayCollection/FlushBoundaryDataAggregator.hpp"
 #include "Parallel/ArrayCollection/ReceiveDataForElement.hpp"
+#include "Parallel/ArrayCollection/RunReadyElements.hpp"
+#include "Parallel/ArrayCollection/Tags/BoundaryDataAggregator.hpp"
 #include "Parallel/ArrayCollection/Tags/ElementLocations.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Info.hpp"
@@ -30,11 +33,20 @@ namespace Parallel::Actions {
  * between the sender and receiver elements, and in a wait-free manner between
  * different sender elements to the same receiver element.
  *
- * The number of messages needed to take the next time step on the receiver
- * element is kept track of and a message is sent to the parallel runtime
- * system (e.g. Charm++) only when the receiver/neighbor element has all the
- * data it needs to take the next time step. This is done so as to reduce
- * pressure on the runtime system by sending fewer messages.
+ * Receiver elements on the same node are queued in the
+ * `Parallel::Tags::ElementReadyQueues` with
+ * `Parallel::Actions::RunReadyElements::enqueue()`, which sends a message to
+ * the parallel runtime system (e.g. Charm++) only if the receiver isn't already
+ * queued. This is done so as to reduce pressure on the runtime system by
+ * sending fewer messages.
+ *
+ * `evolution::dg::AtomicInboxBoundaryData` for elements on other nodes is
+ * buffered in the `Parallel::Tags::BoundaryDataAggregator` and sent with one
+ * message per destination node. See `Parallel::BoundaryDataAggregator` for when
+ * the buffers are sent.
+ *
+ * The receiver is queued with `priority` both on this node and on other nodes,
+ * so elements with smaller priority run first.
  */
 struct SendDataToElement {
   using return_type = void;
@@ -46,7 +58,8 @@ struct SendDataToElement {
       const gsl::not_null<Parallel::NodeLock*> /*node_lock*/,
       const gsl::not_null<Parallel::GlobalCache<Metavariables>*> cache,
       const ReceiveTag& /*meta*/, const ElementId<Dim>& element_to_execute_on,
-      typename ReceiveTag::temporal_id instance, ReceiveData&& receive_data) {
+      typename ReceiveTag::temporal_id instance, ReceiveData&& receive_data,
+      const int priority = 0) {
     const size_t my_node = Parallel::my_node<size_t>(*cache);
     // While we don't mutate the value, we want to avoid locking the DataBox
     // and the nodegroup by using `db::get_mutable_reference`. If/when we
@@ -89,20 +102,36 @@ struct SendDataToElement {
             make_not_null(&tuples::get<ReceiveTag>(element.inboxes())),
             instance, std::forward<ReceiveData>(receive_data));
       }
-      // A lower bound for the number of neighbors is
-      // `2 * Dim - number_of_block_boundaries`, which doesn't give us the
-      // exact minimum number of sends we need to do, but gets us close in most
-      // cases. If we really wanted to we could also add the number of
-      // directions that don't have external boundaries in our neighbors block.
-      // if (count >=
-      //     (2 * Dim - element_to_execute_on.number_of_block_boundaries())) {
-      Parallel::threaded_action<Parallel::Actions::ReceiveDataForElement<>>(
-          my_proxy[node_of_element], element_to_execute_on);
-      // }
+      // Only a message for the first send to an element that isn't already
+      // queued is sent to the runtime system. Any further data that arrives
+      // before the element runs is processed by the same run.
+      Parallel::Actions::RunReadyElements::enqueue<ParallelComponent>(
+          make_not_null(&box), *cache, element_to_execute_on, priority);
+    } else if constexpr (std::is_same_v<
+                             evolution::dg::AtomicInboxBoundaryData<Dim>,
+                             typename ReceiveTag::type>) {
+      // The aggregator has its own lock, so we avoid locking the DataBox and
+      // the nodegroup.
+      auto& aggregator = db::get_mutable_reference<
+          Parallel::Tags::BoundaryDataAggregator<Dim>>(make_not_null(&box));
+      auto [bundle_to_send, send_flush_message] = aggregator.append(
+          node_of_element,
+          {element_to_execute_on, instance,
+           std::forward<ReceiveData>(receive_data), priority});
+      if (bundle_to_send.has_value()) {
+        Parallel::threaded_action<Parallel::Actions::ReceiveDataForElement<>>(
+            my_proxy[node_of_element], ReceiveTag{},
+            std::move(*bundle_to_send));
+      }
+      if (send_flush_message) {
+        Parallel::threaded_action<
+            Parallel::Actions::FlushBoundaryDataAggregator>(my_proxy[my_node],
+                                                            ReceiveTag{});
+      }
     } else {
       Parallel::threaded_action<Parallel::Actions::ReceiveDataForElement<>>(
           my_proxy[node_of_element], ReceiveTag{}, element_to_execute_on,
-          instance, std::forward<ReceiveData>(receive_data));
+          instance, std::forward<ReceiveData>(receive_data), priority);
     }
   }
 };
@@ -0,0 +1,95 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Options/String.hpp"
+#include "Parallel/ArrayCollection/BoundaryDataAggregator.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+namespace Parallel::OptionTags {
+struct Parallelization;
+}  // namespace Parallel::OptionTags
+/// \endcond
+
+namespace Parallel {
+namespace OptionTags {
+/// \brief Option group for when the DG boundary data sent to other nodes by a
+/// `Parallel::DgElementCollection` is flushed, see
+/// `Parallel::BoundaryDataAggregator`.
+struct BoundaryDataAggregation {
+  static constexpr Options::String help = {
+      "When the DG boundary data of a nodegroup element collection that is "
+      "sent to other nodes is flushed."};
+  using group = Parallelization;
+};
+
+/// \brief The number of pieces of boundary data after which the buffer of a
+/// destination node is sent.
+struct BoundaryDataAggregationMaxEntries {
+  static std::string name() { return "MaxEntries"; }
+  using type = size_t;
+  static constexpr Options::String help = {
+      "Send the buffer of a destination node once it holds this many pieces "
+      "of boundary data. Set to 1 to disable aggregation."};
+  static type lower_bound() { return 1; }
+  static type suggested_value() {
+    return BoundaryDataAggregator<1>::default_max_entries;
+  }
+  using group = BoundaryDataAggregation;
+};
+
+/// \brief The payload size in bytes after which the buffer of a destination
+/// node is sent.
+struct BoundaryDataAggregationMaxBytes {
+  static std::string name() { return "MaxBytes"; }
+  using type = size_t;
+  static constexpr Options::String help = {
+      "Send the buffer of a destination node once its payload reaches this "
+      "many bytes."};
+  static type lower_bound() { return 1; }
+  static type suggested_value() {
+    return BoundaryDataAggregator<1>::default_max_bytes;
+  }
+  using group = BoundaryDataAggregation;
+};
+}  // namespace OptionTags
+
+namespace Tags {
+/// \brief The buffers of DG boundary data that are sent to other nodes.
+///
+/// This should be in the nodegroup's DataBox.
+template <size_t Dim>
+struct BoundaryDataAggregator : db::SimpleTag {
+  using type = Parallel::BoundaryDataAggregator<Dim>;
+};
+
+/// \brief The number of pieces of boundary data after which the
+/// `Parallel::BoundaryDataAggregator` sends the buffer of a destination node.
+struct BoundaryDataAggregationMaxEntries : db::SimpleTag {
+  using type = size_t;
+  using option_tags =
+      tmpl::list<OptionTags::BoundaryDataAggregationMaxEntries>;
+
+  static constexpr bool pass_metavariables = false;
+  static type create_from_options(const type max_entries) {
+    return max_entries;
+  }
+};
+
+/// \brief The payload size in bytes after which the
+/// `Parallel::BoundaryDataAggregator` sends the buffer of a destination node.
+struct BoundaryDataAggregationMaxBytes : db::SimpleTag {
+  using type = size_t;
+  using option_tags = tmpl::list<OptionTags::BoundaryDataAggregationMaxBytes>;
+
+  static constexpr bool pass_metavariables = false;
+  static type create_from_options(const type max_bytes) { return max_bytes; }
+};
+}  // namespace Tags
+}  // namespace Parallel
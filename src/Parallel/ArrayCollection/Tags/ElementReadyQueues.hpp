@@ -0,0 +1,19 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Parallel/ArrayCollection/ElementReadyQueues.hpp"
+
+namespace Parallel::Tags {
+/// \brief The queues of elements on the node that are ready to run.
+///
+/// This should be in the nodegroup's DataBox.
+template <size_t Dim>
+struct ElementReadyQueues : db::SimpleTag {
+  using type = Parallel::ElementReadyQueues<Dim>;
+};
+}  // namespace Parallel::Tags
@@ -0,0 +1,73 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Parallel/CacheStalls.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+#include "Parallel/ArrayComponentId.hpp"
+
+namespace Parallel::cache_stalls {
+namespace {
+using Clock = std::chrono::steady_clock;
+
+// The cache item and the start of each pending wait
+using Stall = std::pair<std::string, Clock::time_point>;
+
+struct PendingStalls {
+  std::mutex mutex{};
+  std::unordered_map<ArrayComponentId, Stall> stalls{};
+};
+
+PendingStalls& pending_stalls() {
+  static PendingStalls pending{};
+  return pending;
+}
+
+// Lets `end_stall` skip the lock in the common case that no object waits
+std::atomic<size_t> number_of_pending_stalls{0};
+
+thread_local std::unordered_map<std::string, Statistics> statistics{};
+}  // namespace
+
+void begin_stall(const ArrayComponentId& waiter, const std::string& name) {
+  auto& pending = pending_stalls();
+  const std::lock_guard lock(pending.mutex);
+  if (pending.stalls.try_emplace(waiter, name, Clock::now()).second) {
+    number_of_pending_stalls.fetch_add(1, std::memory_order_acq_rel);
+  }
+}
+
+void end_stall(const ArrayComponentId& waiter) {
+  if (number_of_pending_stalls.load(std::memory_order_acquire) == 0) {
+    return;
+  }
+  const auto now = Clock::now();
+  Stall stall{};
+  {
+    auto& pending = pending_stalls();
+    const std::lock_guard lock(pending.mutex);
+    const auto it = pending.stalls.find(waiter);
+    if (it == pending.stalls.end()) {
+      return;
+    }
+    stall = std::move(it->second);
+    pending.stalls.erase(it);
+    number_of_pending_stalls.fetch_sub(1, std::memory_order_acq_rel);
+  }
+  auto& item_statistics = statistics[stall.first];
+  ++item_statistics.number_of_stalls;
+  item_statistics.stall_wall_time +=
+      std::chrono::duration<double>(now - stall.second).count();
+}
+
+std::unordered_map<std::string, Statistics> take_statistics() {
+  return std::exchange(statistics, {});
+}
+}  // namespace Parallel::cache_stalls
@@ -0,0 +1,48 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <unordered_map>
+
+/// \cond
+namespace Parallel {
+class ArrayComponentId;
+}  // namespace Parallel
+/// \endcond
+
+/*!
+ * \brief Statistics of how long distributed objects waited for items in the
+ * mutable global cache, e.g. for the control system to update a function of
+ * time.
+ *
+ * \details A wait starts when a readiness check registers a callback with the
+ * mutable cache and ends with the first readiness check of the same object
+ * that succeeds. Waits are matched by `Parallel::ArrayComponentId`, so a wait
+ * may start and end on different threads, but the finished waits are
+ * accumulated on the thread that ends them. `take_statistics` only returns
+ * the statistics of the calling thread, so no lock is taken when no object
+ * waits. All functions are thread-safe.
+ */
+namespace Parallel::cache_stalls {
+/// \brief Record that `waiter` starts waiting for the cache item `name`.
+///
+/// \details If `waiter` is already waiting, the earlier start is kept, so the
+/// readiness check may be repeated.
+void begin_stall(const ArrayComponentId& waiter, const std::string& name);
+
+/// Record that `waiter` stopped waiting, if it was.
+void end_stall(const ArrayComponentId& waiter);
+
+/// Statistics of one cache item since the last `take_statistics`.
+struct Statistics {
+  size_t number_of_stalls{0};
+  double stall_wall_time{0.0};
+};
+
+/// Return the statistics of all waits that ended on the calling thread and
+/// reset them.
+std::unordered_map<std::string, Statistics> take_statistics();
+}  // namespace Parallel::cache_stalls
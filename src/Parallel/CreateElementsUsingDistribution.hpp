@@ -12,10 +12,14 @@
 #include <vector>
 
 #include "Domain/Block.hpp"
+#include "Domain/ElementCostModel.hpp"
 #include "Domain/ElementDistribution.hpp"
 #include "Domain/Structure/ElementId.hpp"
+#include "Domain/Tags/ElementCostModel.hpp"
 #include "Parallel/DomainDiagnosticInfo.hpp"
 #include "Parallel/GlobalCache.hpp"
+#include "Parallel/ParallelComponentHelpers.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/Numeric.hpp"
 
 namespace Parallel {
@@ -25,6 +29,10 @@ namespace Parallel {
  * The `func` is called with `(element_id, target_proc, target_node)` allowing
  * the `func` to insert the element with `element_id` on the target processor
  * and node.
+ *
+ * If `domain::Tags::ElementCostModel<Dim>` is in the global cache and holds
+ * the element costs measured in a previous run, the elements are distributed
+ * by their measured costs instead of the `element_weight`.
  */
 template <typename F, size_t Dim, typename Metavariables>
 void create_elements_using_distribution(
@@ -43,11 +51,28 @@ void create_elements_using_distribution(
   // because then we have to use the space filling curve and not just use round
   // robin.
   domain::BlockZCurveProcDistribution<Dim> element_distribution{};
+  const domain::ElementCostModel<Dim>* cost_model = nullptr;
+  if constexpr (Parallel::is_in_global_cache<
+                    Metavariables, domain::Tags::ElementCostModel<Dim>>) {
+    const auto& optional_cost_model =
+        Parallel::get<domain::Tags::ElementCostModel<Dim>>(local_cache);
+    if (optional_cost_model.has_value()) {
+      if (not element_weight.has_value()) {
+        ERROR(
+            "The measured element costs can only be used with a ZCurve "
+            "ElementDistribution, not with RoundRobin.");
+      }
+      cost_model = &optional_cost_model.value();
+    }
+  }
   if (element_weight.has_value()) {
     const std::unordered_map<ElementId<Dim>, double> element_costs =
-        domain::get_element_costs(blocks, initial_refinement_levels,
-                                  initial_extents, element_weight.value(),
-                                  quadrature);
+        cost_model == nullptr
+            ? domain::get_element_costs(blocks, initial_refinement_levels,
+                                        initial_extents, element_weight.value(),
+                                        quadrature)
+            : domain::get_element_costs(blocks, initial_refinement_levels,
+                                        initial_extents, *cost_model);
     element_distribution = domain::BlockZCurveProcDistribution<Dim>{
         element_costs,   num_of_procs_to_use, blocks, initial_refinement_levels,
         initial_extents, procs_to_ignore};
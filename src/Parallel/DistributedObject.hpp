@@ -22,6 +22,7 @@
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
+#include "DataStructures/MemoryTracking.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
 #include "Parallel/AlgorithmMetafunctions.hpp"
 #include "Parallel/Algorithms/AlgorithmArrayDeclarations.hpp"
@@ -31,6 +32,7 @@
 #include "Parallel/ArrayCollection/IsDgElementCollection.hpp"
 #include "Parallel/Callback.hpp"
 #include "Parallel/CharmRegistration.hpp"
+#include "Parallel/ElementCosts.hpp"
 #include "Parallel/ElementRegistration.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Info.hpp"
@@ -43,6 +45,7 @@
 #include "Parallel/Tags/ArrayIndex.hpp"
 #include "Parallel/Tags/DistributedObjectTags.hpp"
 #include "Parallel/Tags/Metavariables.hpp"
+#include "Parallel/Tracing.hpp"
 #include "Parallel/TypeTraits.hpp"
 #include "ParallelAlgorithms/Initialization/MutateAssign.hpp"
 #include "Utilities/Algorithm.hpp"
@@ -423,6 +426,18 @@ class DistributedObject<ParallelComponent,
     return deadlock_analysis_next_iterable_action_;
   }
 
+  /// \brief The wall time in seconds spent executing iterable actions since
+  /// the last call to this function.
+  ///
+  /// Used to measure the computational cost of array elements, e.g. by
+  /// `Events::ObserveElementCosts`. Retried actions are included. The actions
+  /// are only timed while `Parallel::element_costs::enabled()`.
+  double take_iterable_action_wall_time() {
+    const double result = iterable_action_wall_time_;
+    iterable_action_wall_time_ = 0.0;
+    return result;
+  }
+
  private:
   void set_array_index();
 
@@ -446,12 +461,19 @@ class DistributedObject<ParallelComponent,
 #ifdef SPECTRE_CHARM_PROJECTIONS
   double non_action_time_start_;
 #endif
+#ifdef SPECTRE_ACTION_TRACING
+  // The arrival time of the oldest message that no iterable action has run
+  // since. Not serialized since it is only used for tracing.
+  std::optional<double> oldest_unprocessed_message_time_{};
+#endif  // SPECTRE_ACTION_TRACING
 
   Parallel::CProxy_GlobalCache<metavariables> global_cache_proxy_;
   bool performing_action_ = false;
   Parallel::Phase phase_{Parallel::Phase::Initialization};
   std::unordered_map<Parallel::Phase, size_t> phase_bookmarks_{};
   std::size_t algorithm_step_ = 0;
+  // Not serialized, so the measurement restarts after migration
+  double iterable_action_wall_time_ = 0.0;
   tmpl::conditional_t<Parallel::is_node_group_proxy<cproxy_type>::value,
                       Parallel::NodeLock, NoSuchType>
       node_lock_;
@@ -867,6 +889,17 @@ void DistributedObject<ParallelComponent,
       if (enable_if_disabled) {
         set_terminate(false);
       }
+#ifdef SPECTRE_ACTION_TRACING
+      const Parallel::tracing::ScopedEvent trace_event{
+          Parallel::tracing::EventType::ReceiveData,
+          Parallel::tracing::name_id<ParallelComponent>(),
+          Parallel::tracing::name_id<ReceiveTag>()};
+      if (not oldest_unprocessed_message_time_.has_value()) {
+        oldest_unprocessed_message_time_ = sys::wall_time();
+      }
+#endif  // SPECTRE_ACTION_TRACING
+      const memory_tracking::ScopedComponent tracked_component{
+          memory_tracking::component_id<ParallelComponent>()};
       ReceiveTag::insert_into_inbox(
           make_not_null(&tuples::get<ReceiveTag>(inboxes_)), instance,
           std::forward<ReceiveDataType>(t));
@@ -893,6 +926,17 @@ void DistributedObject<ParallelComponent,
       if (message->enable_if_disabled) {
         set_terminate(false);
       }
+#ifdef SPECTRE_ACTION_TRACING
+      const Parallel::tracing::ScopedEvent trace_event{
+          Parallel::tracing::EventType::ReceiveData,
+          Parallel::tracing::name_id<ParallelComponent>(),
+          Parallel::tracing::name_id<ReceiveTag>()};
+      if (not oldest_unprocessed_message_time_.has_value()) {
+        oldest_unprocessed_message_time_ = sys::wall_time();
+      }
+#endif  // SPECTRE_ACTION_TRACING
+      const memory_tracking::ScopedComponent tracked_component{
+          memory_tracking::component_id<ParallelComponent>()};
       ReceiveTag::insert_into_inbox(
           make_not_null(&tuples::get<ReceiveTag>(inboxes_)), message);
       // Cannot use message after this call because a std::unique_ptr now owns
@@ -1089,6 +1133,12 @@ void DistributedObject<ParallelComponent,
                        tmpl::list<PhaseDepActionListsPack...>>::
     forward_tuple_to_action(std::tuple<Args...>&& args,
                             std::index_sequence<Is...> /*meta*/) {
+#ifdef SPECTRE_ACTION_TRACING
+  const Parallel::tracing::ScopedEvent trace_event{
+      Parallel::tracing::EventType::SimpleAction,
+      Parallel::tracing::name_id<ParallelComponent>(),
+      Parallel::tracing::name_id<Action>()};
+#endif  // SPECTRE_ACTION_TRACING
   Action::template apply<ParallelComponent>(
       box_, *Parallel::local_branch(global_cache_proxy_),
       static_cast<const array_index&>(array_index_),
@@ -1102,6 +1152,12 @@ void DistributedObject<ParallelComponent,
     forward_tuple_to_threaded_action(std::tuple<Args...>&& args,
                                      std::index_sequence<Is...> /*meta*/) {
   const gsl::not_null<Parallel::NodeLock*> node_lock{&node_lock_};
+#ifdef SPECTRE_ACTION_TRACING
+  const Parallel::tracing::ScopedEvent trace_event{
+      Parallel::tracing::EventType::ThreadedAction,
+      Parallel::tracing::name_id<ParallelComponent>(),
+      Parallel::tracing::name_id<Action>()};
+#endif  // SPECTRE_ACTION_TRACING
   if constexpr (Parallel::is_dg_element_collection_v<parallel_component>) {
     Action::template apply<ParallelComponent>(
         box_, *Parallel::local_branch(global_cache_proxy_),
@@ -1147,10 +1203,38 @@ bool DistributedObject<
 
   AlgorithmExecution requested_execution{};
   std::optional<std::size_t> next_action_step{};
-  std::tie(requested_execution, next_action_step) = ThisAction::apply(
-      box_, inboxes_, *Parallel::local_branch(global_cache_proxy_),
-      std::as_const(array_index_), actions_list{},
-      std::add_pointer_t<ParallelComponent>{});
+  const bool measure_cost = Parallel::element_costs::enabled();
+  const double action_start_time = measure_cost ? sys::wall_time() : 0.0;
+  {
+    const memory_tracking::ScopedComponent tracked_component{
+        memory_tracking::component_id<ParallelComponent>()};
+#ifdef SPECTRE_ACTION_TRACING
+    Parallel::tracing::ScopedEvent trace_event{
+        Parallel::tracing::EventType::IterableAction,
+        Parallel::tracing::name_id<ParallelComponent>(),
+        Parallel::tracing::name_id<ThisAction>(),
+        oldest_unprocessed_message_time_.has_value()
+            ? sys::wall_time() - *oldest_unprocessed_message_time_
+            : 0.0};
+#endif  // SPECTRE_ACTION_TRACING
+    std::tie(requested_execution, next_action_step) = ThisAction::apply(
+        box_, inboxes_, *Parallel::local_branch(global_cache_proxy_),
+        std::as_const(array_index_), actions_list{},
+        std::add_pointer_t<ParallelComponent>{});
+#ifdef SPECTRE_ACTION_TRACING
+    // The queue wait is attributed to the first action that doesn't retry
+    // after the messages arrived, which is usually the one that needs them.
+    if (requested_execution == AlgorithmExecution::Retry) {
+      trace_event.set_type(
+          Parallel::tracing::EventType::RetriedIterableAction);
+    } else {
+      oldest_unprocessed_message_time_.reset();
+    }
+#endif  // SPECTRE_ACTION_TRACING
+  }
+  if (measure_cost) {
+    iterable_action_wall_time_ += sys::wall_time() - action_start_time;
+  }
 
   if (next_action_step.has_value()) {
     ASSERT(
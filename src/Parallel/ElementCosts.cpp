@@ -0,0 +1,16 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Parallel/ElementCosts.hpp"
+
+#include <atomic>
+
+namespace Parallel::element_costs {
+namespace {
+std::atomic<bool> measuring{false};
+}  // namespace
+
+bool enabled() { return measuring.load(std::memory_order_relaxed); }
+
+void enable() { measuring.store(true, std::memory_order_relaxed); }
+}  // namespace Parallel::element_costs
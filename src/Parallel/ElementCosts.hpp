@@ -0,0 +1,22 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+/*!
+ * \brief Whether array elements measure the wall time they spend in iterable
+ * actions.
+ *
+ * \details The elements of a `DgElementArray` and of a `DgElementCollection`
+ * only read the clock around their iterable actions once `enable` was called,
+ * which `Events::ObserveElementCosts` does when it is constructed. Runs that
+ * don't observe the element costs therefore don't pay for the measurement.
+ * All functions are thread-safe.
+ */
+namespace Parallel::element_costs {
+/// Whether the elements in this process measure their iterable actions.
+bool enabled();
+
+/// Measure the iterable actions of all elements in this process from now on.
+void enable();
+}  // namespace Parallel::element_costs
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <charm++.h>
 #include <cstddef>
 #include <type_traits>
 #include <utility>
@@ -45,6 +46,36 @@ void receive_data(Proxy&& proxy, typename ReceiveTag::temporal_id temporal_id,
   }
 }
 
+/*!
+ * \ingroup ParallelGroup
+ * \brief Send the data `args...` to the algorithm running on `proxy` with the
+ * Charm++ message priority `priority`, and tag the message with the identifier
+ * `temporal_id`.
+ *
+ * Messages with smaller priority are delivered first by the runtime system,
+ * the default priority is zero. Messages to array elements on the same core
+ * are delivered immediately since the entry method is `[inline]`, so the
+ * priority only matters for messages that are queued.
+ */
+template <typename ReceiveTag, typename Proxy, typename ReceiveDataType>
+void receive_data(Proxy&& proxy, typename ReceiveTag::temporal_id temporal_id,
+                  ReceiveDataType&& receive_data,
+                  const bool enable_if_disabled, const int priority) {
+  CkEntryOptions options{};
+  options.setPriority(priority);
+  // See the function above for why the `ReceiveDataType` is specified for
+  // array chares.
+  if constexpr (is_array_proxy<std::decay_t<Proxy>>::value) {
+    proxy.template receive_data<ReceiveTag, std::decay_t<ReceiveDataType>>(
+        std::move(temporal_id), std::forward<ReceiveDataType>(receive_data),
+        enable_if_disabled, &options);
+  } else {
+    proxy.template receive_data<ReceiveTag>(
+        std::move(temporal_id), std::forward<ReceiveDataType>(receive_data),
+        enable_if_disabled, &options);
+  }
+}
+
 /*!
  * \ingroup ParallelGroup
  * \brief Send a pointer `message` to the algorithm running on `proxy`.
@@ -35,11 +35,14 @@
 #include "Parallel/Printf/Printf.hpp"
 #include "Parallel/Reduction.hpp"
 #include "Parallel/ResourceInfo.hpp"
+#include "Parallel/SingletonLocality.hpp"
 #include "Parallel/Tags/ResourceInfo.hpp"
+#include "Parallel/Tracing.hpp"
 #include "Parallel/TypeTraits.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/FileSystem.hpp"
+#include "Utilities/GetOutput.hpp"
 #include "Utilities/Formaline.hpp"
 #include "Utilities/Kokkos/KokkosCore.hpp"
 #include "Utilities/MakeString.hpp"
@@ -226,6 +229,9 @@ class Main : public CBase_Main<Metavariables> {
   size_t current_termination_check_index_{0};
   std::vector<std::string> components_that_did_not_terminate_{};
   bool just_restored_from_checkpoint_ = false;
+#ifdef SPECTRE_ACTION_TRACING
+  double current_phase_start_time_{sys::wall_time()};
+#endif  // SPECTRE_ACTION_TRACING
 };
 
 namespace detail {
@@ -491,9 +497,12 @@ Main<Metavariables>::Main(CkArgMsg* msg) {
   // because the parallel components have not been set at this point, so if we
   // try to Parallel::get_parallel_component here, an error will occur. This
   // call is OK though because build_singleton_map() only uses the parallel info
-  // functions from the GlobalCache (like cache.number_of_procs()).
+  // functions from the GlobalCache (like cache.number_of_procs()) and, to
+  // place singletons close to the elements they communicate with, the domain.
+  const auto& local_cache = *Parallel::local_branch(global_cache_proxy_);
   resource_info_.build_singleton_map(
-      *Parallel::local_branch(global_cache_proxy_));
+      local_cache,
+      Parallel::element_costs_on_nodes<Metavariables>(options_, local_cache));
 
   // Now that the singleton map has been built, set the resource info in the
   // GlobalCache (if the tags exist). Since this info will be constant
@@ -720,6 +729,17 @@ void Main<Metavariables>::
 
 template <typename Metavariables>
 void Main<Metavariables>::execute_next_phase() {
+#ifdef SPECTRE_ACTION_TRACING
+  {
+    const double now = sys::wall_time();
+    Parallel::tracing::record(Parallel::tracing::Event{
+        current_phase_start_time_, now - current_phase_start_time_, 0.0,
+        Parallel::tracing::name_id<Main>(),
+        Parallel::tracing::register_name(get_output(current_phase_)),
+        sys::my_proc(), Parallel::tracing::EventType::Phase});
+    current_phase_start_time_ = now;
+  }
+#endif  // SPECTRE_ACTION_TRACING
   if (not exception_messages_.empty()) {
     // Print exceptions whether we errored during execution or cleanup
     Parallel::printf(
@@ -5,19 +5,24 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <functional>
 #include <ios>
+#include <numeric>
 #include <optional>
 #include <pup.h>
 #include <set>
 #include <sstream>
 #include <string>
 #include <type_traits>
+#include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "Options/Auto.hpp"
 #include "Options/Context.hpp"
+#include "Options/Options.hpp"
 #include "Options/ParseError.hpp"
 #include "Options/String.hpp"
 #include "Parallel/Algorithms/AlgorithmSingletonDeclarations.hpp"
@@ -47,6 +52,13 @@ struct ResourceInfo;
 /// \endcond
 
 namespace Parallel {
+/// \brief A function that returns the cost of the elements in the blocks (or
+/// block groups) `block_names` on each node when no elements are placed on the
+/// `procs_to_ignore`, see `Parallel::element_costs_on_nodes()`.
+using ElementCostsOnNodes = std::function<std::vector<double>(
+    const std::vector<std::string>& block_names,
+    const std::unordered_set<size_t>& procs_to_ignore)>;
+
 /*!
  * \ingroup ParallelGroup
  * \brief Holds resource info for a single singleton component
@@ -56,6 +68,13 @@ namespace Parallel {
  * singletons placed on that proc. Instead of specifying a proc, the proc can be
  * chosen automatically by using the `Options::Auto` option.
  *
+ * Alternatively, the singleton can be placed close to the elements it
+ * communicates with by specifying the `NearBlocks` option instead of `Proc` and
+ * `Exclusive`, e.g. the blocks that intersect the horizon that an
+ * interpolation target or horizon finder needs data from. The singleton is
+ * then placed exclusively on a proc of the node that is expected to hold most
+ * of the elements of these blocks, see `Parallel::ResourceInfo`.
+ *
  * The template parameter `Component` is only used to identify which singleton
  * component this SingletonInfoHolder belongs to.
  */
@@ -75,7 +94,16 @@ struct SingletonInfoHolder {
         "other singleton components will be placed on this proc."};
   };
 
-  using options = tmpl::list<Proc, Exclusive>;
+  struct NearBlocks {
+    using type = std::vector<std::string>;
+    static constexpr Options::String help = {
+        "Blocks or block groups whose elements this singleton communicates "
+        "with. The singleton is placed exclusively on a proc of the node that "
+        "is expected to hold most of the elements of these blocks."};
+  };
+
+  using options = tmpl::list<Options::Alternatives<tmpl::list<Proc, Exclusive>,
+                                                   tmpl::list<NearBlocks>>>;
   static constexpr Options::String help = {
       "Resource options for a single singleton."};
 
@@ -95,6 +123,14 @@ struct SingletonInfoHolder {
                 : std::nullopt;
   }
 
+  SingletonInfoHolder(std::vector<std::string> input_near_blocks,
+                      const Options::Context& context = {})
+      : exclusive_(true), near_blocks_(std::move(input_near_blocks)) {
+    if (near_blocks_.empty()) {
+      PARSE_ERROR(context, "NearBlocks must contain at least one block.");
+    }
+  }
+
   SingletonInfoHolder() = default;
   SingletonInfoHolder(const SingletonInfoHolder& /*rhs*/) = default;
   SingletonInfoHolder& operator=(const SingletonInfoHolder& /*rhs*/) = default;
@@ -106,6 +142,7 @@ struct SingletonInfoHolder {
   void pup(PUP::er& p) {
     p | proc_;
     p | exclusive_;
+    p | near_blocks_;
   };
 
   /// Proc that singleton is to be placed on. If the optional is a std::nullopt,
@@ -115,6 +152,10 @@ struct SingletonInfoHolder {
   /// Whether or not the singleton wants to be exclusive on the proc.
   bool is_exclusive() const { return exclusive_; }
 
+  /// The blocks or block groups that the singleton should be placed close to.
+  /// Empty if the singleton should not be placed by locality.
+  const std::vector<std::string>& near_blocks() const { return near_blocks_; }
+
  private:
   template <typename ParallelComponent>
   friend bool operator==(const SingletonInfoHolder<ParallelComponent>& lhs,
@@ -124,12 +165,14 @@ struct SingletonInfoHolder {
   // negative size_t is actually a really large value (it wraps around)
   std::optional<size_t> proc_{std::nullopt};
   bool exclusive_{false};
+  std::vector<std::string> near_blocks_{};
 };
 
 template <typename ParallelComponent>
 bool operator==(const SingletonInfoHolder<ParallelComponent>& lhs,
                 const SingletonInfoHolder<ParallelComponent>& rhs) {
-  return lhs.proc_ == rhs.proc_ and lhs.exclusive_ == rhs.exclusive_;
+  return lhs.proc_ == rhs.proc_ and lhs.exclusive_ == rhs.exclusive_ and
+         lhs.near_blocks_ == rhs.near_blocks_;
 }
 
 template <typename ParallelComponent>
@@ -268,6 +311,8 @@ using singleton_components =
  *       Proc: 2
  *       Exclusive: true
  *     MySingleton2: Auto
+ *     MySingleton3:
+ *       NearBlocks: [InnerShell]
  * \endcode
  *
  * where `MySingleton1` is the `pretty_type::name` of the singleton component
@@ -299,24 +344,42 @@ using singleton_components =
  *
  * 1. Allocate all singletons that `requested` specific processors, both
  *    `exclusive` and `nonexclusive`. This is done during option parsing.
- * 2. Allocate `auto exclusive` singletons, distributing the total number of
- *    `exclusive` singletons (`auto` + `requested`) as evenly as possibly over
- *    the number of nodes. We say "as evenly as possible" because this depends
- *    on the `requested exclusive` singletons. For example, if we have 4 nodes
+ * 2. Allocate `near-blocks` singletons, i.e. singletons that specified the
+ *    `NearBlocks` option. These are exclusive singletons that are placed on
+ *    the first free proc of the node that is expected to hold the largest
+ *    share of the elements of the requested blocks. Where the elements will be
+ *    placed is predicted by distributing the elements of the initial domain
+ *    over the procs that aren't ignored so far, see
+ *    `Parallel::element_costs_on_nodes()`. If the node has no free proc left,
+ *    the node with the next-largest share is used. This requires the
+ *    `element_costs_on_nodes` argument of `build_singleton_map()`.
+ * 3. Allocate the remaining `auto exclusive` singletons, distributing the
+ *    total number of `exclusive` singletons (`auto`, `near-blocks` and
+ *    `requested`) as evenly as possibly over the number of nodes. We say "as
+ *    evenly as possible" because this depends on the `requested exclusive`
+ *    and `near-blocks` singletons. For example, if we have 4 nodes
  *    and 5 cores per node, the number of `requested exclusive` singletons on
  *    each node is (0, 1, 4, 1), and we have 3 `auto exclusive` singletons to
  *    place, the best distribution of `exclusive` singletons we can achieve
  *    given our constraints is (2, 2, 4, 1). Clearly this is not the *most*
  *    evenly distributed the `exclusive` singletons could be. However, this *is*
  *    the most evenly distributed they could be given the starting distribution
- *    from the input file.
- * 3. Allocate `auto nonexclusive` singletons, distributing the total number of
+ *    from the input file. Once the procs of all exclusive singletons are
+ *    known, the placement of the elements is predicted again and each
+ *    `near-blocks` singleton is moved to a free proc on another node if that
+ *    node will hold a larger share of the elements of its blocks.
+ * 4. Allocate `auto nonexclusive` singletons, distributing the total number of
  *    `nonexclusive` singletons (`auto` + `requested`): First, as evenly as
  *    possibly over the number of nodes. Then, on each node, distributing the
  *    singletons as evenly as possibly over the number of processors on that
  *    node. The same disclaimer about "as evenly as possibly" from the previous
  *    step applies here.
  *
+ * The chosen procs are printed to stdout, including the share of the elements
+ * of the requested blocks on the node of each `near-blocks` singleton. The
+ * latency of the messages that the singletons receive can be measured with
+ * action tracing, see `Parallel::tracing`.
+ *
  * The goal of this algorithm is to mimic, as best as possible, how a human
  * would distribute this workload. It isn't perfect, but is a significant
  * improvement over placing singletons on one proc after another starting from
@@ -335,6 +398,13 @@ struct ResourceInfo {
   using local_tags =
       tmpl::transform<singletons, tmpl::bind<LocalTag, tmpl::_1>>;
 
+  template <typename Component>
+  struct LocalNearBlocksTag {
+    using type = std::vector<std::string>;
+  };
+  using local_near_blocks_tags =
+      tmpl::transform<singletons, tmpl::bind<LocalNearBlocksTag, tmpl::_1>>;
+
  public:
   struct Singletons {
     using type = Options::Auto<SingletonPack<singletons>>;
@@ -418,9 +488,16 @@ struct ResourceInfo {
   /// template this function rather than explicitly use the GlobalCache because
   /// the GlobalCache depends on ResourceInfo
   ///
+  /// The `element_costs_on_nodes` are used to place the singletons that
+  /// requested to be near some blocks, see
+  /// `Parallel::element_costs_on_nodes()`. It may be empty if no singleton
+  /// requested this.
+  ///
   /// This function should only be called once.
   template <typename Cache>
-  void build_singleton_map(const Cache& cache);
+  void build_singleton_map(
+      const Cache& cache,
+      const ElementCostsOnNodes& element_costs_on_nodes = {});
 
  private:
   template <typename Metavars>
@@ -440,6 +517,7 @@ struct ResourceInfo {
   size_t num_procs_to_ignore_{};
   size_t num_requested_exclusive_singletons_{};
   size_t num_requested_nonexclusive_singletons_{};
+  size_t num_near_blocks_singletons_{};
   std::unordered_multiset<size_t> requested_nonexclusive_procs_{};
   // Procs that are exclusive. These may or may not be specifically requested
   std::unordered_set<size_t> procs_to_ignore_{};
@@ -447,6 +525,9 @@ struct ResourceInfo {
   // For each singleton (whether it has a SingletonInfo or not), maps whether
   // it's exclusive and what proc it is on.
   tuples::tagged_tuple_from_typelist<local_tags> singleton_map_{};
+  // For each singleton, the blocks it should be placed close to. Empty if it
+  // should not be placed by locality.
+  tuples::tagged_tuple_from_typelist<local_near_blocks_tags> near_blocks_{};
 };
 
 template <typename Metavariables>
@@ -483,6 +564,11 @@ ResourceInfo<Metavariables>::ResourceInfo(
         // through everything once
         const auto proc = info_holder.proc();
         singleton_map.second = proc;
+        tuples::get<LocalNearBlocksTag<component>>(near_blocks_) =
+            info_holder.near_blocks();
+        if (not info_holder.near_blocks().empty()) {
+          ++num_near_blocks_singletons_;
+        }
 
         if (proc.has_value()) {
           requested_procs.insert(*proc);
@@ -568,10 +654,12 @@ void ResourceInfo<Metavariables>::pup(PUP::er& p) {
   p | num_procs_to_ignore_;
   p | num_requested_exclusive_singletons_;
   p | num_requested_nonexclusive_singletons_;
+  p | num_near_blocks_singletons_;
   p | requested_nonexclusive_procs_;
   p | procs_to_ignore_;
   p | procs_available_for_elements_;
   p | singleton_map_;
+  p | near_blocks_;
 }
 
 template <typename Metavariables>
@@ -624,12 +712,14 @@ bool operator==(const ResourceInfo<Metavars>& lhs,
              rhs.num_requested_exclusive_singletons_ and
          lhs.num_requested_nonexclusive_singletons_ ==
              rhs.num_requested_nonexclusive_singletons_ and
+         lhs.num_near_blocks_singletons_ == rhs.num_near_blocks_singletons_ and
          lhs.requested_nonexclusive_procs_ ==
              rhs.requested_nonexclusive_procs_ and
          lhs.procs_to_ignore_ == rhs.procs_to_ignore_ and
          lhs.procs_available_for_elements_ ==
              rhs.procs_available_for_elements_ and
-         lhs.singleton_map_ == rhs.singleton_map_;
+         lhs.singleton_map_ == rhs.singleton_map_ and
+         lhs.near_blocks_ == rhs.near_blocks_;
 }
 
 template <typename Metavars>
@@ -640,7 +730,8 @@ bool operator!=(const ResourceInfo<Metavars>& lhs,
 
 template <typename Metavariables>
 template <typename Cache>
-void ResourceInfo<Metavariables>::build_singleton_map(const Cache& cache) {
+void ResourceInfo<Metavariables>::build_singleton_map(
+    const Cache& cache, const ElementCostsOnNodes& element_costs_on_nodes) {
   const size_t num_procs = Parallel::number_of_procs<size_t>(cache);
   const size_t num_nodes = Parallel::number_of_nodes<size_t>(cache);
 
@@ -699,8 +790,68 @@ void ResourceInfo<Metavariables>::build_singleton_map(const Cache& cache) {
         }
       });
 
+  // Next allocate the singletons that should be close to the elements of some
+  // blocks, before the other auto exclusive singletons take the procs on the
+  // nodes they need. For each of them we keep the share of the cost of the
+  // elements of the requested blocks that is on the chosen node so we can
+  // print it below.
+  std::unordered_map<std::string, double> near_blocks_cost_fractions{};
+  tmpl::for_each<singletons>([this, &cache, &element_costs_on_nodes, &num_nodes,
+                              &singletons_on_each_node,
+                              &near_blocks_cost_fractions](
+                                 const auto component_v) {
+    using component = tmpl::type_from<decltype(component_v)>;
+    const auto& near_blocks =
+        tuples::get<LocalNearBlocksTag<component>>(near_blocks_);
+    if (near_blocks.empty()) {
+      return;
+    }
+    if (not element_costs_on_nodes) {
+      ERROR("Singleton " << pretty_type::name<component>()
+                         << " requested to be placed near the blocks "
+                         << near_blocks
+                         << ", but it is not known where the elements are "
+                            "placed. This requires a domain.");
+    }
+    const std::vector<double> costs_on_nodes =
+        element_costs_on_nodes(near_blocks, procs_to_ignore_);
+    ASSERT(costs_on_nodes.size() == num_nodes,
+           "Expected the element costs on " << num_nodes << " nodes, not "
+                                            << costs_on_nodes.size());
+    std::vector<size_t> nodes_by_cost(num_nodes);
+    std::iota(nodes_by_cost.begin(), nodes_by_cost.end(), 0_st);
+    std::stable_sort(nodes_by_cost.begin(), nodes_by_cost.end(),
+                     [&costs_on_nodes](const size_t a, const size_t b) {
+                       return costs_on_nodes[a] > costs_on_nodes[b];
+                     });
+    for (const size_t node : nodes_by_cost) {
+      const size_t first_proc =
+          Parallel::first_proc_on_node<size_t>(node, cache);
+      const size_t first_proc_next_node =
+          first_proc + Parallel::procs_on_node<size_t>(node, cache);
+      // Same conditions as for the other auto exclusive singletons below
+      for (size_t proc = first_proc; proc < first_proc_next_node; ++proc) {
+        if (procs_to_ignore_.find(proc) != procs_to_ignore_.end() or
+            requested_nonexclusive_procs_.count(proc) > 0) {
+          continue;
+        }
+        tuples::get<LocalTag<component>>(singleton_map_).second = proc;
+        procs_to_ignore_.insert(proc);
+        ++singletons_on_each_node[node];
+        const double total_cost = alg::accumulate(costs_on_nodes, 0.0);
+        near_blocks_cost_fractions[pretty_type::name<component>()] =
+            total_cost > 0.0 ? costs_on_nodes[node] / total_cost : 0.0;
+        return;
+      }
+    }
+    ERROR("No free proc is left to place singleton "
+          << pretty_type::name<component>() << " near the blocks "
+          << near_blocks << ".");
+  });
+
   size_t remaining_auto_exclusive_singletons =
-      num_exclusive_singletons_ - num_requested_exclusive_singletons_;
+      num_exclusive_singletons_ - num_requested_exclusive_singletons_ -
+      num_near_blocks_singletons_;
   // Start with the min number of singletons on a node as our baseline. Then,
   // while we still have auto exclusive singletons to place, we loop over all
   // nodes and place singletons on nodes with this minimum number. Once all
@@ -781,6 +932,64 @@ break_auto_exclusive_loops:
          "number of auto exclusive singletons to be allocated is "
              << alg::accumulate(auto_exclusive_singletons_on_each_node, 0_st));
 
+  // The near-blocks singletons were placed with a prediction that didn't
+  // ignore the procs of the auto exclusive singletons yet. Now that
+  // procs_to_ignore_ is complete, predict once more where the elements will be
+  // placed and move a near-blocks singleton if another node with a free proc
+  // will hold a larger share of the elements of its blocks. Moving a singleton
+  // only swaps one ignored proc for another, so one pass is enough to correct
+  // the predictions up to the elements at the boundaries between nodes.
+  tmpl::for_each<singletons>([this, &cache, &element_costs_on_nodes,
+                              &singletons_on_each_node,
+                              &near_blocks_cost_fractions](
+                                 const auto component_v) {
+    using component = tmpl::type_from<decltype(component_v)>;
+    const auto& near_blocks =
+        tuples::get<LocalNearBlocksTag<component>>(near_blocks_);
+    if (near_blocks.empty()) {
+      return;
+    }
+    auto& proc = *tuples::get<LocalTag<component>>(singleton_map_).second;
+    const size_t node = Parallel::node_of<size_t>(proc, cache);
+    std::vector<double> costs_on_nodes =
+        element_costs_on_nodes(near_blocks, procs_to_ignore_);
+    std::optional<size_t> better_proc{};
+    double better_cost = costs_on_nodes[node];
+    for (size_t other_node = 0; other_node < costs_on_nodes.size();
+         ++other_node) {
+      if (costs_on_nodes[other_node] <= better_cost) {
+        continue;
+      }
+      const size_t first_proc =
+          Parallel::first_proc_on_node<size_t>(other_node, cache);
+      const size_t first_proc_next_node =
+          first_proc + Parallel::procs_on_node<size_t>(other_node, cache);
+      for (size_t other_proc = first_proc; other_proc < first_proc_next_node;
+           ++other_proc) {
+        if (procs_to_ignore_.find(other_proc) == procs_to_ignore_.end() and
+            requested_nonexclusive_procs_.count(other_proc) == 0) {
+          better_proc = other_proc;
+          better_cost = costs_on_nodes[other_node];
+          break;
+        }
+      }
+    }
+    if (better_proc.has_value()) {
+      procs_to_ignore_.erase(proc);
+      --singletons_on_each_node[node];
+      proc = *better_proc;
+      procs_to_ignore_.insert(proc);
+      ++singletons_on_each_node[Parallel::node_of<size_t>(proc, cache)];
+      costs_on_nodes = element_costs_on_nodes(near_blocks, procs_to_ignore_);
+    }
+    const double total_cost = alg::accumulate(costs_on_nodes, 0.0);
+    near_blocks_cost_fractions[pretty_type::name<component>()] =
+        total_cost > 0.0
+            ? costs_on_nodes[Parallel::node_of<size_t>(proc, cache)] /
+                  total_cost
+            : 0.0;
+  });
+
   // procs_to_ignore_ is now complete. Now construct
   // procs_available_for_elements_
   for (size_t i = 0; i < num_procs; i++) {
@@ -907,7 +1116,8 @@ break_auto_nonexclusive_loops:
   ss << "\nAllocating Singletons:\n";
   size_t current_proc = 0;
   tmpl::for_each<singletons>([this, &current_proc, &cache, &ss,
-                              &auto_nonexclusive_singletons_on_each_proc](
+                              &auto_nonexclusive_singletons_on_each_proc,
+                              &near_blocks_cost_fractions](
                                  const auto component_v) {
     using component = tmpl::type_from<decltype(component_v)>;
     auto& singleton_map = tuples::get<LocalTag<component>>(singleton_map_);
@@ -934,7 +1144,16 @@ break_auto_nonexclusive_loops:
     ss << pretty_type::name<component>();
     ss << " on node " << Parallel::node_of<int>(*singleton_map.second, cache);
     ss << ", global proc " << *singleton_map.second;
-    ss << ", exclusive = " << std::boolalpha << singleton_map.first << "\n";
+    ss << ", exclusive = " << std::boolalpha << singleton_map.first;
+    const auto& near_blocks =
+        tuples::get<LocalNearBlocksTag<component>>(near_blocks_);
+    if (not near_blocks.empty()) {
+      ss << ", near blocks " << near_blocks << " ("
+         << 100.0 *
+                near_blocks_cost_fractions.at(pretty_type::name<component>())
+         << "% of their grid points on this node)";
+    }
+    ss << "\n";
   });
 
   ss << "\n";
@@ -0,0 +1,169 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "Domain/Block.hpp"
+#include "Domain/Creators/OptionTags.hpp"
+#include "Domain/Creators/Tags/Domain.hpp"
+#include "Domain/Creators/Tags/InitialExtents.hpp"
+#include "Domain/Creators/Tags/InitialRefinementLevels.hpp"
+#include "Domain/Domain.hpp"
+#include "Domain/ElementCostModel.hpp"
+#include "Domain/ElementDistribution.hpp"
+#include "Domain/Structure/BlockGroups.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Tags/ElementCostModel.hpp"
+#include "Domain/Tags/ElementDistribution.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
+#include "Parallel/CreateElementsUsingDistribution.hpp"
+#include "Parallel/CreateFromOptions.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Info.hpp"
+#include "Parallel/ParallelComponentHelpers.hpp"
+#include "Parallel/ResourceInfo.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace Parallel {
+namespace detail {
+// The quadrature of the elements, which only enters the element costs for the
+// `NumGridPointsAndGridSpacing` weight. The DG quadrature is the only option
+// of this type in the evolution executables.
+template <typename... OptionTags>
+Spectral::Quadrature quadrature_from_options(
+    const tuples::TaggedTuple<OptionTags...>& options) {
+  using quadrature_option_tags =
+      tmpl::filter<tmpl::list<OptionTags...>,
+                   std::is_same<tmpl::pin<Spectral::Quadrature>,
+                                tmpl::bind<tmpl::type_from, tmpl::_1>>>;
+  if constexpr (tmpl::size<quadrature_option_tags>::value > 0) {
+    return get<tmpl::front<quadrature_option_tags>>(options);
+  } else {
+    (void)options;
+    return Spectral::Quadrature::GaussLobatto;
+  }
+}
+
+template <size_t Dim, typename Metavariables, typename... OptionTags>
+ElementCostsOnNodes element_costs_on_nodes(
+    const tuples::TaggedTuple<OptionTags...>& options,
+    const Parallel::GlobalCache<Metavariables>& cache) {
+  auto items = Parallel::create_from_options<Metavariables>(
+      options, tmpl::list<domain::Tags::InitialRefinementLevels<Dim>,
+                          domain::Tags::InitialExtents<Dim>>{});
+  return [&cache,
+          refinement_levels = std::move(
+              get<domain::Tags::InitialRefinementLevels<Dim>>(items)),
+          extents = std::move(get<domain::Tags::InitialExtents<Dim>>(items)),
+          quadrature = quadrature_from_options(options)](
+             const std::vector<std::string>& block_names,
+             const std::unordered_set<size_t>& procs_to_ignore) {
+    const auto& domain = Parallel::get<domain::Tags::Domain<Dim>>(cache);
+    const auto& blocks = domain.blocks();
+    const std::optional<domain::ElementWeight>& element_weight =
+        Parallel::get<domain::Tags::ElementDistribution>(cache);
+    const std::unordered_set<std::string> expanded_block_names =
+        domain::expand_block_groups_to_block_names(
+            block_names, domain.block_names(), domain.block_groups());
+    const size_t number_of_procs = Parallel::number_of_procs<size_t>(cache);
+    const size_t number_of_nodes = Parallel::number_of_nodes<size_t>(cache);
+    if (procs_to_ignore.size() >= number_of_procs) {
+      ERROR("All procs are ignored, so no elements can be placed.");
+    }
+    // The costs that are summed on each node. The measured costs if the
+    // elements are distributed by them, else the weight of the distribution.
+    // Round robin distributions are weighted by the number of grid points.
+    const domain::ElementCostModel<Dim>* cost_model = nullptr;
+    if constexpr (Parallel::is_in_global_cache<
+                      Metavariables, domain::Tags::ElementCostModel<Dim>>) {
+      const auto& optional_cost_model =
+          Parallel::get<domain::Tags::ElementCostModel<Dim>>(cache);
+      if (optional_cost_model.has_value()) {
+        cost_model = &optional_cost_model.value();
+      }
+    }
+    const std::unordered_map<ElementId<Dim>, double> element_costs =
+        cost_model == nullptr
+            ? domain::get_element_costs(
+                  blocks, refinement_levels, extents,
+                  element_weight.value_or(domain::ElementWeight::NumGridPoints),
+                  quadrature)
+            : domain::get_element_costs(blocks, refinement_levels, extents,
+                                        *cost_model);
+    std::vector<double> costs_on_nodes(number_of_nodes, 0.0);
+    // Place the elements exactly as the element arrays do
+    Parallel::create_elements_using_distribution(
+        [&blocks, &expanded_block_names, &element_costs, &costs_on_nodes](
+            const ElementId<Dim>& element_id, const size_t /*target_proc*/,
+            const size_t target_node) {
+          if (expanded_block_names.count(
+                  blocks[element_id.block_id()].name()) > 0) {
+            costs_on_nodes[target_node] += element_costs.at(element_id);
+          }
+        },
+        element_weight, blocks, extents, refinement_levels, quadrature,
+        procs_to_ignore, number_of_procs, number_of_nodes,
+        number_of_procs - procs_to_ignore.size(), cache, false);
+    return costs_on_nodes;
+  };
+}
+}  // namespace detail
+
+/*!
+ * \brief Predict on which nodes the elements of the initial domain will be
+ * placed, so singletons can be placed close to the elements they communicate
+ * with.
+ *
+ * \details The returned function places the elements of the initial domain
+ * with `Parallel::create_elements_using_distribution()` on the procs that
+ * aren't ignored, exactly as `DgElementArray` does. So it uses the configured
+ * `domain::Tags::ElementDistribution` and, if it is in the global cache, the
+ * `domain::Tags::ElementCostModel` measured in a previous run. It sums the
+ * costs of the elements in the requested blocks on each node. These are the
+ * measured costs, or else the weights of the distribution, where a round
+ * robin distribution is weighted by the number of grid points. The quadrature
+ * for the `NumGridPointsAndGridSpacing` weight is the option of type
+ * `Spectral::Quadrature` in the `options`, or Gauss-Lobatto if there is none.
+ *
+ * The returned function refers to the `cache`, so it must not outlive the
+ * `cache`. If the executable has no domain or doesn't distribute elements,
+ * i.e. `domain::Tags::Domain` or `domain::Tags::ElementDistribution` isn't in
+ * the global cache or there is no `domain::OptionTags::DomainCreator` in the
+ * `options`, the returned function is empty.
+ */
+template <typename Metavariables, typename... OptionTags>
+ElementCostsOnNodes element_costs_on_nodes(
+    const tuples::TaggedTuple<OptionTags...>& options,
+    const Parallel::GlobalCache<Metavariables>& cache) {
+  ElementCostsOnNodes result{};
+  tmpl::for_each<tmpl::integral_list<size_t, 1, 2, 3>>(
+      [&options, &cache, &result](auto dim_v) {
+        constexpr size_t dim = tmpl::type_from<decltype(dim_v)>::value;
+        if constexpr (Parallel::is_in_global_cache<
+                          Metavariables, domain::Tags::Domain<dim>> and
+                      Parallel::is_in_global_cache<
+                          Metavariables, domain::Tags::ElementDistribution> and
+                      tmpl::list_contains_v<
+                          tmpl::list<OptionTags...>,
+                          domain::OptionTags::DomainCreator<dim>>) {
+          result = detail::element_costs_on_nodes<dim>(options, cache);
+        } else {
+          (void)options;
+          (void)cache;
+          (void)result;
+        }
+      });
+  return result;
+}
+}  // namespace Parallel
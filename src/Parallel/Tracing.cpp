@@ -0,0 +1,204 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Parallel/Tracing.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "Parallel/StaticSpscQueue.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
+
+namespace Parallel::tracing {
+namespace {
+using Buffer = StaticSpscQueue<Event, buffer_capacity>;
+
+struct Registry {
+  std::mutex mutex{};
+  std::unordered_map<std::string, size_t> ids{};
+  // A deque so references to the names stay valid when registering more
+  std::deque<std::string> names{};
+};
+
+Registry& registry() {
+  static Registry registry{};
+  return registry;
+}
+
+// The buffer of one thread and the number of events it dropped
+struct ThreadBuffer {
+  Buffer events{};
+  size_t proc{};
+  std::atomic<size_t> dropped{0};
+};
+
+struct Buffers {
+  // Guards `buffers` and `last_observation_value` and serializes the consumers
+  // of the buffers
+  std::mutex mutex{};
+  std::vector<std::unique_ptr<ThreadBuffer>> buffers{};
+  // The observation value the buffers were last drained for
+  std::optional<double> last_observation_value{};
+};
+
+Buffers& buffers() {
+  static Buffers buffers{};
+  return buffers;
+}
+
+// The buffers are never deallocated, so events recorded by a thread are kept
+// until they are drained, even if the thread exits.
+ThreadBuffer& buffer_of_this_thread() {
+  thread_local ThreadBuffer* const buffer = []() {
+    auto& all_buffers = buffers();
+    const std::lock_guard lock(all_buffers.mutex);
+    auto& new_buffer =
+        all_buffers.buffers.emplace_back(std::make_unique<ThreadBuffer>());
+    new_buffer->proc = static_cast<size_t>(sys::my_proc());
+    return new_buffer.get();
+  }();
+  return *buffer;
+}
+
+// Drain the buffers. The caller must hold the lock.
+std::vector<Event> drain_locked(Buffers& all_buffers) {
+  std::vector<Event> result{};
+  for (const auto& buffer : all_buffers.buffers) {
+    while (const Event* const event = buffer->events.front()) {
+      result.push_back(*event);
+      buffer->events.pop();
+    }
+  }
+  std::sort(result.begin(), result.end(),
+            [](const Event& lhs, const Event& rhs) {
+              return lhs.start < rhs.start;
+            });
+  return result;
+}
+}  // namespace
+
+std::ostream& operator<<(std::ostream& os, const EventType event_type) {
+  switch (event_type) {
+    case EventType::IterableAction:
+      return os << "IterableAction";
+    case EventType::RetriedIterableAction:
+      return os << "RetriedIterableAction";
+    case EventType::SimpleAction:
+      return os << "SimpleAction";
+    case EventType::ThreadedAction:
+      return os << "ThreadedAction";
+    case EventType::ReceiveData:
+      return os << "ReceiveData";
+    case EventType::Phase:
+      return os << "Phase";
+    default:
+      ERROR("Unknown Parallel::tracing::EventType "
+            << static_cast<int>(event_type));
+  }
+}
+
+size_t register_name(const std::string& name) {
+  auto& names = registry();
+  const std::lock_guard lock(names.mutex);
+  const auto [it, inserted] = names.ids.emplace(name, names.names.size());
+  if (inserted) {
+    names.names.push_back(name);
+  }
+  return it->second;
+}
+
+const std::string& registered_name(const size_t id) {
+  auto& names = registry();
+  const std::lock_guard lock(names.mutex);
+  ASSERT(id < names.names.size(), "No name is registered for the ID " << id);
+  return names.names[id];
+}
+
+void record(const Event& event) {
+  ThreadBuffer& buffer = buffer_of_this_thread();
+  if (not buffer.events.try_emplace(event)) {
+    buffer.dropped.fetch_add(1, std::memory_order_relaxed);
+  }
+}
+
+std::vector<Event> drain() {
+  auto& all_buffers = buffers();
+  const std::lock_guard lock(all_buffers.mutex);
+  return drain_locked(all_buffers);
+}
+
+std::optional<std::vector<Event>> drain(const double observation_value) {
+  auto& all_buffers = buffers();
+  const std::lock_guard lock(all_buffers.mutex);
+  if (all_buffers.last_observation_value.has_value() and
+      *all_buffers.last_observation_value >= observation_value) {
+    return std::nullopt;
+  }
+  all_buffers.last_observation_value = observation_value;
+  return drain_locked(all_buffers);
+}
+
+std::map<size_t, size_t> number_of_dropped_events() {
+  auto& all_buffers = buffers();
+  const std::lock_guard lock(all_buffers.mutex);
+  std::map<size_t, size_t> result{};
+  for (const auto& buffer : all_buffers.buffers) {
+    result[buffer->proc] += buffer->dropped.load(std::memory_order_relaxed);
+  }
+  return result;
+}
+
+ScopedEvent::ScopedEvent(const EventType type, const size_t component,
+                         const size_t name, const double queue_wait) {
+  event_.component = component;
+  event_.name = name;
+  event_.queue_wait = queue_wait;
+  event_.core = sys::my_proc();
+  event_.type = type;
+  // Read the clock last so the setup isn't part of the event
+  event_.start = sys::wall_time();
+}
+
+ScopedEvent::~ScopedEvent() {
+  event_.duration = sys::wall_time() - event_.start;
+  record(event_);
+}
+
+std::map<std::pair<std::string, std::string>, Summary> summarize(
+    const std::vector<Event>& events) {
+  std::map<std::pair<std::string, std::string>, Summary> result{};
+  for (const Event& event : events) {
+    auto& summary = result[std::pair{registered_name(event.component),
+                                     registered_name(event.name)}];
+    switch (event.type) {
+      case EventType::RetriedIterableAction:
+        // The messages are still waiting, so don't count their queue wait
+        // until the action that processes them
+        ++summary.retries;
+        break;
+      case EventType::ReceiveData:
+        ++summary.messages;
+        break;
+      default:
+        ++summary.calls;
+        summary.total_queue_wait += event.queue_wait;
+    }
+    summary.total_wall_time += event.duration;
+    summary.max_wall_time = std::max(summary.max_wall_time, event.duration);
+  }
+  return result;
+}
+}  // namespace Parallel::tracing
@@ -0,0 +1,158 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Utilities/PrettyType.hpp"
+
+/*!
+ * \brief Lightweight tracing of the actions executed by the parallel
+ * components.
+ *
+ * \details When SpECTRE is configured with `-D SPECTRE_ACTION_TRACING=ON`, the
+ * parallel components record an `Event` for every iterable, simple and threaded
+ * action they execute, for every message they receive into an inbox, and
+ * `Parallel::Main` records an `Event` for every phase. Without this option no
+ * events are recorded and there is no overhead.
+ *
+ * Events are recorded into a fixed-size lock-free ring buffer owned by the
+ * recording thread, so recording an event never blocks and never allocates.
+ * When the buffer of a thread is full, new events of that thread are dropped
+ * until the buffer is drained, so periodically call `drain()`, e.g. with
+ * `Events::ObserveActionTraces`, which writes the events and a per-action
+ * summary to disk.
+ */
+namespace Parallel::tracing {
+/// The kind of work an `Event` records
+enum class EventType : uint8_t {
+  IterableAction,
+  /// An iterable action that returned `Parallel::AlgorithmExecution::Retry`
+  RetriedIterableAction,
+  SimpleAction,
+  ThreadedAction,
+  /// Inserting a message into an inbox
+  ReceiveData,
+  Phase
+};
+
+std::ostream& operator<<(std::ostream& os, EventType event_type);
+
+/// The capacity of the buffer of each thread
+constexpr size_t buffer_capacity = 16384;
+
+/*!
+ * \brief A unit of work executed by a parallel component.
+ *
+ * \details `component` and `name` are the IDs of the names of the parallel
+ * component and of the action, inbox tag or phase, see `register_name()`. The
+ * `queue_wait` of an iterable action is the time between the arrival of the
+ * oldest message that wasn't yet processed by the parallel component and the
+ * start of the action, i.e., the time the message waited in the inbox and in
+ * the Charm++ queue. All times are wall times in seconds.
+ */
+struct Event {
+  double start{};
+  double duration{};
+  double queue_wait{};
+  size_t component{};
+  size_t name{};
+  int core{};
+  EventType type{};
+};
+
+/// \brief Get the ID for the `name`, registering it if necessary.
+///
+/// IDs are only unique within a process, so use `registered_name()` to
+/// identify events across processes.
+size_t register_name(const std::string& name);
+
+/// The name registered for the `id`
+const std::string& registered_name(size_t id);
+
+/// The ID for the name of the type `T`, see `pretty_type::name()`
+template <typename T>
+size_t name_id() {
+  static const size_t id = register_name(pretty_type::name<T>());
+  return id;
+}
+
+/// \brief Record the `event` in the buffer of the calling thread.
+///
+/// This doesn't lock or allocate. If the buffer is full the event is dropped.
+void record(const Event& event);
+
+/// \brief Remove all events recorded by all threads in this process and return
+/// them.
+///
+/// Can be called concurrently with `record()`. Calls to `drain()` are
+/// serialized.
+std::vector<Event> drain();
+
+/// \brief Drain the events for the observation at `observation_value`.
+///
+/// Returns `std::nullopt` without draining if the events of this process were
+/// already drained for this or a later observation value. This way only the
+/// first of the elements in a process that run an observation reports the
+/// events.
+std::optional<std::vector<Event>> drain(double observation_value);
+
+/// \brief The number of events dropped because a buffer was full since the
+/// start of the run, for each processing element (PE) of this process that
+/// recorded events.
+///
+/// The events dropped by a thread are attributed to the PE the thread ran on
+/// when it recorded its first event.
+std::map<size_t, size_t> number_of_dropped_events();
+
+/*!
+ * \brief Record an `Event` of the time from the construction of this object
+ * to its destruction.
+ */
+class ScopedEvent {
+ public:
+  ScopedEvent(EventType type, size_t component, size_t name,
+              double queue_wait = 0.0);
+
+  ScopedEvent(const ScopedEvent& /*rhs*/) = delete;
+  ScopedEvent& operator=(const ScopedEvent& /*rhs*/) = delete;
+  ScopedEvent(ScopedEvent&& /*rhs*/) = delete;
+  ScopedEvent& operator=(ScopedEvent&& /*rhs*/) = delete;
+  ~ScopedEvent();
+
+  /// Change the type of the event, e.g. when an iterable action retries
+  void set_type(const EventType type) { event_.type = type; }
+
+ private:
+  Event event_{};
+};
+
+/// The statistics of all events of one parallel component and one name
+struct Summary {
+  size_t calls{0};
+  size_t retries{0};
+  size_t messages{0};
+  double total_wall_time{0.0};
+  double max_wall_time{0.0};
+  double total_queue_wait{0.0};
+};
+
+/// \brief Combine the `events` into a `Summary` for each pair of registered
+/// parallel component and action (or inbox tag, or phase) names.
+///
+/// Retried iterable actions count towards `Summary::retries` and messages
+/// towards `Summary::messages`. The wall time of all events is added to the
+/// `Summary::total_wall_time`, but the queue wait of retried iterable actions
+/// isn't added to `Summary::total_queue_wait` since it is counted again when
+/// the action runs.
+std::map<std::pair<std::string, std::string>, Summary> summarize(
+    const std::vector<Event>& events);
+}  // namespace Parallel::tracing
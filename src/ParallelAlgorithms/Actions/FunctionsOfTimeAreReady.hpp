@@ -20,6 +20,7 @@
 #include "Parallel/ArrayCollection/PerformAlgorithmOnElement.hpp"
 #include "Parallel/ArrayCollection/Tags/ElementLocations.hpp"
 #include "Parallel/ArrayComponentId.hpp"
+#include "Parallel/CacheStalls.hpp"
 #include "Parallel/Callback.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Info.hpp"
@@ -77,9 +78,9 @@ bool functions_of_time_are_ready_impl(
       }
     }();
 
-    return Parallel::mutable_cache_item_is_ready<CacheTag>(
+    const bool ready = Parallel::mutable_cache_item_is_ready<CacheTag>(
         cache, array_component_id,
-        [&functions_to_check, &proxy, &time,
+        [&functions_to_check, &proxy, &time, &array_component_id,
          &args...](const std::unordered_map<
                    std::string,
                    std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
@@ -102,12 +103,17 @@ bool functions_of_time_are_ready_impl(
             }
             const double expiration_time = f_of_t->time_bounds()[1];
             if (time > expiration_time) {
+              Parallel::cache_stalls::begin_stall(array_component_id, name);
               return std::unique_ptr<Parallel::Callback>(
                   new Callback(proxy, std::forward<Args>(args)...));
             }
           }
           return std::unique_ptr<Parallel::Callback>{};
         });
+    if (ready) {
+      Parallel::cache_stalls::end_stall(array_component_id);
+    }
+    return ready;
   } else {
     (void)cache;
     (void)array_index;
@@ -180,6 +186,9 @@ bool functions_of_time_are_ready_threaded_action_callback(
 /// not ready, schedules a `Parallel::PerformAlgorithmCallback` or
 /// `Parallel::Actions::PerformAlgorithmOnElement<false>` callback with the
 /// GlobalCache.
+///
+/// The wall time spent waiting for each function of time is recorded in
+/// `Parallel::cache_stalls`.
 template <typename CacheTag, size_t Dim, typename Metavariables,
           typename ArrayIndex, typename Component>
 bool functions_of_time_are_ready_algorithm_callback(
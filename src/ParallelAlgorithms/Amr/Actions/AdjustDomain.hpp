@@ -5,9 +5,11 @@
 
 #include <array>
 #include <cstddef>
+#include <optional>
 #include <unordered_set>
 
 #include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/TagTraits.hpp"
 #include "Domain/Amr/Flag.hpp"
 #include "Domain/Amr/Helpers.hpp"
 #include "Domain/Amr/NewNeighborIds.hpp"
@@ -32,6 +34,7 @@
 #include "Parallel/Tags/DistributedObjectTags.hpp"
 #include "ParallelAlgorithms/Amr/Actions/CreateChild.hpp"
 #include "ParallelAlgorithms/Amr/Actions/CreateParent.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/Tags/AccumulatedFlags.hpp"
 #include "ParallelAlgorithms/Amr/Projectors/Mesh.hpp"
 #include "ParallelAlgorithms/Amr/Protocols/Projector.hpp"
 #include "ParallelAlgorithms/Amr/Tags.hpp"
@@ -77,6 +80,7 @@ namespace amr::Actions {
 /// - Updates the Neighbors of the Element
 /// - Resets amr::Tags::Flag%s to amr::Flag::Undefined
 /// - Resets amr::Tags::NeighborInfo to an empty map
+/// - Resets amr::Criteria::Tags::AccumulatedFlags (if present)
 /// - Mutates all return_tags of Metavariables::amr::projectors
 struct AdjustDomain {
   template <typename ParallelComponent, typename DbTagList,
@@ -106,7 +110,8 @@ struct AdjustDomain {
       using tags_mutated_by_this_action = tmpl::list<
           ::domain::Tags::Element<volume_dim>, ::domain::Tags::Mesh<volume_dim>,
           ::domain::Tags::NeighborMesh<volume_dim>, amr::Tags::Info<volume_dim>,
-          amr::Tags::NeighborInfo<volume_dim>>;
+          amr::Tags::NeighborInfo<volume_dim>,
+          amr::Criteria::Tags::AccumulatedFlags<volume_dim>>;
       using mutated_tags =
           tmpl::append<distributed_object_tags, tags_mutated_by_this_action,
                        typename detail::GetMutatedTags<amr_projectors>::type>;
@@ -270,6 +275,19 @@ struct AdjustDomain {
               }
             },
             make_not_null(&box));
+
+        // Clear the flags accumulated by amr::Events::SampleCriteria, so
+        // that flags sampled before this AMR phase don't carry over into the
+        // next one
+        if constexpr (db::tag_is_retrievable_v<
+                          amr::Criteria::Tags::AccumulatedFlags<volume_dim>,
+                          db::DataBox<DbTagList>>) {
+          db::mutate<amr::Criteria::Tags::AccumulatedFlags<volume_dim>>(
+              [](const gsl::not_null<
+                  std::optional<std::array<amr::Flag, volume_dim>>*>
+                     accumulated_flags) { accumulated_flags->reset(); },
+              make_not_null(&box));
+        }
       }
     }
   }
@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <array>
 #include <cstddef>
+#include <optional>
 #include <tuple>
 #include <utility>
 
@@ -26,6 +27,7 @@
 #include "ParallelAlgorithms/Actions/GetItemFromDistributedObject.hpp"
 #include "ParallelAlgorithms/Amr/Actions/UpdateAmrDecision.hpp"
 #include "ParallelAlgorithms/Amr/Criteria/Criterion.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/Tags/AccumulatedFlags.hpp"
 #include "ParallelAlgorithms/Amr/Criteria/Tags/Criteria.hpp"
 #include "ParallelAlgorithms/Amr/Policies/EnforcePolicies.hpp"
 #include "ParallelAlgorithms/Amr/Policies/Policies.hpp"
@@ -62,6 +64,7 @@ namespace amr::Actions {
 ///   * amr::Tags::NeighborInfo<volume_dim>
 ///   * amr::Criteria::Tags::Criteria (from GlobalCache)
 ///   * amr::Tags::Policies (from GlobalCache)
+///   * amr::Criteria::Tags::AccumulatedFlags<volume_dim> (if present)
 ///   * any tags requested by the refinement criteria
 /// - Modifies:
 ///   * amr::Tags::Info<volume_dim>
@@ -72,7 +75,12 @@ namespace amr::Actions {
 /// \details
 /// - Evaluates each refinement criteria held by amr::Criteria::Tags::Criteria,
 ///   and in each dimension selects the amr::Flag with the highest
-///   priority (i.e the highest integral value).
+///   priority (i.e the highest integral value).  The criteria share an
+///   amr::Criteria::MonitorCache, so quantities needed by several criteria are
+///   computed only once.
+/// - If refinement criteria were sampled since the last AMR phase (see
+///   amr::Events::SampleCriteria), the accumulated decision is combined with
+///   the current one in the same way.
 /// - If necessary, changes the refinement decision in order to satisfy the
 ///   amr::Policies
 /// - An Element that is splitting in one dimension is not allowed to join
@@ -107,6 +115,22 @@ struct EvaluateRefinementCriteria {
       }
     }
 
+    // Combine with the decision accumulated by amr::Events::SampleCriteria
+    // since the last AMR phase. The accumulated flags are cleared by
+    // amr::Actions::AdjustDomain at the end of the AMR phase.
+    if constexpr (db::tag_is_retrievable_v<
+                      amr::Criteria::Tags::AccumulatedFlags<volume_dim>,
+                      db::DataBox<DbTagList>>) {
+      const auto& accumulated_flags =
+          db::get<amr::Criteria::Tags::AccumulatedFlags<volume_dim>>(box);
+      if (accumulated_flags.has_value()) {
+        for (size_t d = 0; d < volume_dim; ++d) {
+          overall_decision[d] = std::max(overall_decision[d],
+                                         gsl::at(accumulated_flags.value(), d));
+        }
+      }
+    }
+
     const auto& policies = db::get<amr::Tags::Policies>(box);
     amr::enforce_policies(make_not_null(&overall_decision), policies,
                           element_id,
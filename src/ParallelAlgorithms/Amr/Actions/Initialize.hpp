@@ -10,6 +10,7 @@
 #include "Domain/Amr/Info.hpp"
 #include "Domain/Amr/Tags/Flags.hpp"
 #include "Domain/Amr/Tags/NeighborFlags.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/Tags/AccumulatedFlags.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeArray.hpp"
 #include "Utilities/TMPL.hpp"
@@ -28,7 +29,8 @@ struct Initialize {
   using argument_tags = tmpl::list<>;
   using return_tags = tmpl::list<amr::Tags::Info<Dim>>;
   using simple_tags =
-      tmpl::push_back<return_tags, amr::Tags::NeighborInfo<Dim>>;
+      tmpl::push_back<return_tags, amr::Tags::NeighborInfo<Dim>,
+                      amr::Criteria::Tags::AccumulatedFlags<Dim>>;
 
   using compute_tags = tmpl::list<>;
 
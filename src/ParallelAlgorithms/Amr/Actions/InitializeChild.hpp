@@ -69,8 +69,8 @@ struct InitializeChild {
     Mesh<volume_dim> child_mesh =
         amr::projectors::mesh(parent_mesh, parent_info.flags);
 
-    // Default initialization of amr::Tags::Info and amr::Tags::NeighborInfo
-    // is okay
+    // Default initialization of amr::Tags::Info, amr::Tags::NeighborInfo, and
+    // amr::Criteria::Tags::AccumulatedFlags is okay
     ::Initialization::mutate_assign<tmpl::list<
         ::domain::Tags::Element<volume_dim>, ::domain::Tags::Mesh<volume_dim>,
         ::domain::Tags::NeighborMesh<volume_dim>>>(
@@ -87,8 +87,8 @@ struct InitializeParent {
     Mesh<volume_dim> parent_mesh =
         amr::projectors::parent_mesh(projected_children_meshes);
 
-    // Default initialization of amr::Tags::Info and amr::Tags::NeighborInfo
-    // is okay
+    // Default initialization of amr::Tags::Info, amr::Tags::NeighborInfo, and
+    // amr::Criteria::Tags::AccumulatedFlags is okay
     ::Initialization::mutate_assign<tmpl::list<
         ::domain::Tags::Element<volume_dim>, ::domain::Tags::Mesh<volume_dim>,
         ::domain::Tags::NeighborMesh<volume_dim>>>(
@@ -5,6 +5,7 @@
 
 #include <array>
 #include <cstddef>
+#include <string>
 
 #include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataVector.hpp"
@@ -12,6 +13,7 @@
 #include "Domain/Amr/Flag.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/MonitorCache.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/SetNumberOfGridPoints.hpp"
 
@@ -60,22 +62,24 @@ std::array<double, Dim> loehner_smoothness_indicator(
 namespace Loehner_detail {
 
 template <size_t Dim>
-void max_over_components(
-    const gsl::not_null<std::array<Flag, Dim>*> result,
-    const gsl::not_null<std::array<DataVector, 2>*> deriv_buffers,
-    const DataVector& tensor_component, const Mesh<Dim>& mesh,
-    const double relative_tolerance, const double absolute_tolerance,
-    const double coarsening_factor) {
-  const double umax = max(abs(tensor_component));
+void max_over_components(const gsl::not_null<std::array<Flag, Dim>*> result,
+                         const MonitorCache<Dim>& monitor_cache,
+                         const std::string& tensor_name,
+                         const size_t component_index,
+                         const DataVector& tensor_component,
+                         const double relative_tolerance,
+                         const double absolute_tolerance,
+                         const double coarsening_factor) {
+  const double umax =
+      monitor_cache.max_abs(tensor_name, component_index, tensor_component);
   for (size_t d = 0; d < Dim; ++d) {
     // Skip this dimension if we have already decided to refine it
     if (gsl::at(*result, d) == Flag::Split) {
       continue;
     }
     const double indicator =
-        loehner_smoothness_indicator(make_not_null(&(*deriv_buffers)[0]),
-                                     make_not_null(&(*deriv_buffers)[1]),
-                                     tensor_component, mesh, d) /
+        monitor_cache.loehner_indicator(tensor_name, component_index,
+                                        tensor_component, d) /
         (relative_tolerance * umax + absolute_tolerance);
     if (indicator > 1.) {
       gsl::at(*result, d) = Flag::Split;
@@ -108,10 +112,10 @@ void max_over_components(
       const DataVector& tensor_component, const Mesh<DIM(data)>& mesh); \
   template void Loehner_detail::max_over_components(                    \
       gsl::not_null<std::array<Flag, DIM(data)>*> result,               \
-      gsl::not_null<std::array<DataVector, 2>*> deriv_buffers,          \
-      const DataVector& tensor_component, const Mesh<DIM(data)>& mesh,  \
-      double relative_tolerance, double absolute_tolerance,             \
-      double coarsening_factor);
+      const MonitorCache<DIM(data)>& monitor_cache,                     \
+      const std::string& tensor_name, size_t component_index,           \
+      const DataVector& tensor_component, double relative_tolerance,    \
+      double absolute_tolerance, double coarsening_factor);
 
 GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
 
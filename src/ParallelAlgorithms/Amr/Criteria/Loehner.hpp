@@ -22,6 +22,8 @@
 #include "Options/ParseError.hpp"
 #include "Options/String.hpp"
 #include "ParallelAlgorithms/Amr/Criteria/Criterion.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/MonitorCache.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/Tags/MonitorCache.hpp"
 #include "Utilities/TMPL.hpp"
 
 /// \cond
@@ -103,12 +105,13 @@ std::array<double, Dim> loehner_smoothness_indicator(
 
 namespace Loehner_detail {
 template <size_t Dim>
-void max_over_components(
-    gsl::not_null<std::array<Flag, Dim>*> result,
-    gsl::not_null<std::array<DataVector, 2>*> deriv_buffers,
-    const DataVector& tensor_component, const Mesh<Dim>& mesh,
-    double relative_tolerance, double absolute_tolerance,
-    double coarsening_factor);
+void max_over_components(gsl::not_null<std::array<Flag, Dim>*> result,
+                         const MonitorCache<Dim>& monitor_cache,
+                         const std::string& tensor_name,
+                         size_t component_index,
+                         const DataVector& tensor_component,
+                         double relative_tolerance, double absolute_tolerance,
+                         double coarsening_factor);
 }
 
 /*!
@@ -118,6 +121,10 @@ void max_over_components(
  * derivatives. See `amr::Criteria::loehner_smoothness_indicator` for details
  * and caveats.
  *
+ * The smoothness indicators are retrieved from the
+ * amr::Criteria::MonitorCache, so they are shared with other criteria
+ * monitoring the same tensors.
+ *
  * \see amr::Criteria::loehner_smoothness_indicator
  */
 template <size_t Dim, typename TensorTags>
@@ -179,12 +186,14 @@ class Loehner : public Criterion {
 
   std::string observation_name() override { return "Loehner"; }
 
-  using compute_tags_for_observation_box = tmpl::list<>;
+  using compute_tags_for_observation_box =
+      tmpl::list<Tags::MonitorCacheCompute<Dim>>;
 
-  using argument_tags = tmpl::list<::Tags::DataBox>;
+  using argument_tags = tmpl::list<::Tags::DataBox, Tags::MonitorCache<Dim>>;
 
   template <typename DbTagsList, typename Metavariables>
   std::array<Flag, Dim> operator()(const db::DataBox<DbTagsList>& box,
+                                   const MonitorCache<Dim>& monitor_cache,
                                    Parallel::GlobalCache<Metavariables>& cache,
                                    const ElementId<Dim>& element_id) const;
 
@@ -224,19 +233,17 @@ Loehner<Dim, TensorTags>::Loehner(CkMigrateMessage* msg) : Criterion(msg) {}
 template <size_t Dim, typename TensorTags>
 template <typename DbTagsList, typename Metavariables>
 std::array<Flag, Dim> Loehner<Dim, TensorTags>::operator()(
-    const db::DataBox<DbTagsList>& box,
+    const db::DataBox<DbTagsList>& box, const MonitorCache<Dim>& monitor_cache,
     Parallel::GlobalCache<Metavariables>& /*cache*/,
     const ElementId<Dim>& /*element_id*/) const {
   auto result = make_array<Dim>(Flag::Undefined);
-  const auto& mesh = db::get<domain::Tags::Mesh<Dim>>(box);
   // Check all tensors and all tensor components in turn. We take the
   // highest-priority refinement flag in each dimension, so if any tensor
   // component is non-smooth, the element will split in that dimension. And only
   // if all tensor components are smooth enough will elements join in that
   // dimension.
-  std::array<DataVector, 2> deriv_buffers{};
   tmpl::for_each<TensorTags>(
-      [&result, &box, &mesh, &deriv_buffers, this](const auto tag_v) {
+      [&result, &box, &monitor_cache, this](const auto tag_v) {
         // Stop if we have already decided to refine every dimension
         if (result == make_array<Dim>(Flag::Split)) {
           return;
@@ -248,11 +255,10 @@ std::array<Flag, Dim> Loehner<Dim, TensorTags>::operator()(
           return;
         }
         const auto& tensor = db::get<tag>(box);
-        for (const DataVector& tensor_component : tensor) {
+        for (size_t i = 0; i < tensor.size(); ++i) {
           Loehner_detail::max_over_components(
-              make_not_null(&result), make_not_null(&deriv_buffers),
-              tensor_component, mesh, relative_tolerance_, absolute_tolerance_,
-              coarsening_factor_);
+              make_not_null(&result), monitor_cache, tag_name, i, tensor[i],
+              relative_tolerance_, absolute_tolerance_, coarsening_factor_);
         }
       });
   return result;
@@ -0,0 +1,112 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "ParallelAlgorithms/Amr/Criteria/MonitorCache.hpp"
+
+#include <array>
+#include <cstddef>
+#include <string>
+
+#include "DataStructures/DataVector.hpp"
+#include "NumericalAlgorithms/LinearOperators/PowerMonitors.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/Loehner.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/Persson.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace amr::Criteria {
+
+template <size_t Dim>
+MonitorCache<Dim>::MonitorCache(const Mesh<Dim>& mesh) : mesh_(mesh) {}
+
+template <size_t Dim>
+typename MonitorCache<Dim>::ComponentMonitors& MonitorCache<Dim>::monitors(
+    const std::string& tensor_name, const size_t component_index) const {
+  return monitors_[std::make_pair(tensor_name, component_index)];
+}
+
+template <size_t Dim>
+double MonitorCache<Dim>::max_abs(const std::string& tensor_name,
+                                  const size_t component_index,
+                                  const DataVector& tensor_component) const {
+  auto& cached = monitors(tensor_name, component_index).max_abs;
+  if (cached.has_value()) {
+    ++number_of_cache_hits_;
+  } else {
+    ++number_of_evaluations_;
+    cached = max(abs(tensor_component));
+  }
+  return cached.value();
+}
+
+template <size_t Dim>
+const std::array<DataVector, Dim>& MonitorCache<Dim>::power_monitors(
+    const std::string& tensor_name, const size_t component_index,
+    const DataVector& tensor_component) const {
+  ASSERT(tensor_component.size() == mesh_.number_of_grid_points(),
+         "The tensor component has " << tensor_component.size()
+                                     << " points, but the mesh has "
+                                     << mesh_.number_of_grid_points());
+  auto& cached = monitors(tensor_name, component_index).power_monitors;
+  if (cached.has_value()) {
+    ++number_of_cache_hits_;
+  } else {
+    ++number_of_evaluations_;
+    cached.emplace();
+    PowerMonitors::power_monitors(make_not_null(&cached.value()),
+                                  tensor_component, mesh_);
+  }
+  return cached.value();
+}
+
+template <size_t Dim>
+double MonitorCache<Dim>::persson_indicator(
+    const std::string& tensor_name, const size_t component_index,
+    const DataVector& tensor_component, const size_t dimension,
+    const size_t num_highest_modes) const {
+  ASSERT(dimension < Dim, "Dimension " << dimension << " out of range.");
+  auto& cached = gsl::at(monitors(tensor_name, component_index)
+                             .persson_indicators[num_highest_modes],
+                         dimension);
+  if (cached.has_value()) {
+    ++number_of_cache_hits_;
+  } else {
+    ++number_of_evaluations_;
+    cached = persson_smoothness_indicator(make_not_null(&buffers_[0]),
+                                          tensor_component, mesh_, dimension,
+                                          num_highest_modes);
+  }
+  return cached.value();
+}
+
+template <size_t Dim>
+double MonitorCache<Dim>::loehner_indicator(const std::string& tensor_name,
+                                            const size_t component_index,
+                                            const DataVector& tensor_component,
+                                            const size_t dimension) const {
+  ASSERT(dimension < Dim, "Dimension " << dimension << " out of range.");
+  auto& cached = gsl::at(
+      monitors(tensor_name, component_index).loehner_indicators, dimension);
+  if (cached.has_value()) {
+    ++number_of_cache_hits_;
+  } else {
+    ++number_of_evaluations_;
+    cached = loehner_smoothness_indicator(
+        make_not_null(&buffers_[0]), make_not_null(&buffers_[1]),
+        tensor_component, mesh_, dimension);
+  }
+  return cached.value();
+}
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATE(_, data) template class MonitorCache<DIM(data)>;
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
+
+#undef INSTANTIATE
+#undef DIM
+
+}  // namespace amr::Criteria
@@ -0,0 +1,107 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "DataStructures/DataVector.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+
+namespace amr::Criteria {
+/*!
+ * \brief Per-element cache of the smoothness monitors that refinement criteria
+ * compute from tensor components
+ *
+ * \details Several refinement criteria (`amr::Criteria::Persson`,
+ * `amr::Criteria::Loehner` and `amr::Criteria::TruncationError`) transform the
+ * same monitored tensor components to their modal representation, compute
+ * derivatives, or compute power monitors. When more than one criterion
+ * monitors the same variable, or the same criterion is listed more than once
+ * with different thresholds, this work would be repeated. The `MonitorCache`
+ * computes each quantity on first request and returns the stored value on
+ * subsequent requests.
+ *
+ * Entries are keyed on the name of the tensor (as returned by `db::tag_name`)
+ * and the storage index of the tensor component, so the caller must pass the
+ * same data for the same key. The cache is created empty by
+ * `amr::Criteria::Tags::MonitorCacheCompute` every time an `ObservationBox` is
+ * built for evaluating the criteria, so cached values never outlive a single
+ * AMR evaluation.
+ *
+ * \note The accessors are `const` because the cache is retrieved as a compute
+ * item from an `ObservationBox`. The memoized values are held in `mutable`
+ * storage.
+ */
+template <size_t Dim>
+class MonitorCache {
+ public:
+  MonitorCache() = default;
+  explicit MonitorCache(const Mesh<Dim>& mesh);
+
+  const Mesh<Dim>& mesh() const { return mesh_; }
+
+  /// The maximum of the absolute value of the tensor component
+  double max_abs(const std::string& tensor_name, size_t component_index,
+                 const DataVector& tensor_component) const;
+
+  /// The power monitors of the tensor component in every dimension
+  ///
+  /// \see PowerMonitors::power_monitors
+  const std::array<DataVector, Dim>& power_monitors(
+      const std::string& tensor_name, size_t component_index,
+      const DataVector& tensor_component) const;
+
+  /// The Persson smoothness indicator in the given dimension
+  ///
+  /// \see amr::Criteria::persson_smoothness_indicator
+  double persson_indicator(const std::string& tensor_name,
+                           size_t component_index,
+                           const DataVector& tensor_component, size_t dimension,
+                           size_t num_highest_modes) const;
+
+  /// The Loehner smoothness indicator in the given dimension
+  ///
+  /// \see amr::Criteria::loehner_smoothness_indicator
+  double loehner_indicator(const std::string& tensor_name,
+                           size_t component_index,
+                           const DataVector& tensor_component,
+                           size_t dimension) const;
+
+  /// @{
+  /// Number of quantities computed, and number of requests answered from the
+  /// cache
+  size_t number_of_evaluations() const { return number_of_evaluations_; }
+  size_t number_of_cache_hits() const { return number_of_cache_hits_; }
+  /// @}
+
+ private:
+  struct ComponentMonitors {
+    std::optional<double> max_abs{};
+    std::optional<std::array<DataVector, Dim>> power_monitors{};
+    std::array<std::optional<double>, Dim> loehner_indicators{};
+    // Keyed on the number of highest modes
+    std::map<size_t, std::array<std::optional<double>, Dim>>
+        persson_indicators{};
+  };
+
+  ComponentMonitors& monitors(const std::string& tensor_name,
+                              size_t component_index) const;
+
+  Mesh<Dim> mesh_{};
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable std::map<std::pair<std::string, size_t>, ComponentMonitors>
+      monitors_{};
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable std::array<DataVector, 2> buffers_{};
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable size_t number_of_evaluations_{0};
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable size_t number_of_cache_hits_{0};
+};
+}  // namespace amr::Criteria
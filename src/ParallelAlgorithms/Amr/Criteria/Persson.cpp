@@ -5,6 +5,7 @@
 
 #include <array>
 #include <cstddef>
+#include <string>
 
 #include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataVector.hpp"
@@ -12,6 +13,7 @@
 #include "Domain/Amr/Flag.hpp"
 #include "NumericalAlgorithms/Spectral/Filtering.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/MonitorCache.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/SetNumberOfGridPoints.hpp"
@@ -55,12 +57,16 @@ namespace Persson_detail {
 
 template <size_t Dim>
 void max_over_components(const gsl::not_null<std::array<Flag, Dim>*> result,
-                         const gsl::not_null<DataVector*> buffer,
+                         const MonitorCache<Dim>& monitor_cache,
+                         const std::string& tensor_name,
+                         const size_t component_index,
                          const DataVector& tensor_component,
-                         const Mesh<Dim>& mesh, const size_t num_highest_modes,
-                         const double alpha, const double absolute_tolerance,
+                         const size_t num_highest_modes, const double alpha,
+                         const double absolute_tolerance,
                          const double coarsening_factor) {
-  const double umax = max(abs(tensor_component));
+  const auto& mesh = monitor_cache.mesh();
+  const double umax =
+      monitor_cache.max_abs(tensor_name, component_index, tensor_component);
   for (size_t d = 0; d < Dim; ++d) {
     // Skip this dimension if we have already decided to refine it
     if (gsl::at(*result, d) == Flag::Split) {
@@ -69,8 +75,9 @@ void max_over_components(const gsl::not_null<std::array<Flag, Dim>*> result,
     const double relative_tolerance =
         pow(mesh.extents(d) - num_highest_modes, -alpha);
     const double indicator =
-        persson_smoothness_indicator(buffer, tensor_component, mesh, d,
-                                     num_highest_modes) /
+        monitor_cache.persson_indicator(tensor_name, component_index,
+                                        tensor_component, d,
+                                        num_highest_modes) /
         (relative_tolerance * umax + absolute_tolerance);
     if (indicator > 1.) {
       gsl::at(*result, d) = Flag::Split;
@@ -103,9 +110,10 @@ void max_over_components(const gsl::not_null<std::array<Flag, Dim>*> result,
       size_t num_highest_modes);                                             \
   template void Persson_detail::max_over_components(                         \
       gsl::not_null<std::array<Flag, DIM(data)>*> result,                    \
-      gsl::not_null<DataVector*> buffer, const DataVector& tensor_component, \
-      const Mesh<DIM(data)>& mesh, size_t num_highest_modes, double alpha,   \
-      double absolute_tolerance, double coarsening_factor);
+      const MonitorCache<DIM(data)>& monitor_cache,                          \
+      const std::string& tensor_name, size_t component_index,                \
+      const DataVector& tensor_component, size_t num_highest_modes,          \
+      double alpha, double absolute_tolerance, double coarsening_factor);
 
 GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
 
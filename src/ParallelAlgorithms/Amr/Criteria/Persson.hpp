@@ -22,6 +22,8 @@
 #include "Options/ParseError.hpp"
 #include "Options/String.hpp"
 #include "ParallelAlgorithms/Amr/Criteria/Criterion.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/MonitorCache.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/Tags/MonitorCache.hpp"
 #include "Utilities/TMPL.hpp"
 
 /// \cond
@@ -63,16 +65,21 @@ std::array<double, Dim> persson_smoothness_indicator(
 namespace Persson_detail {
 template <size_t Dim>
 void max_over_components(gsl::not_null<std::array<Flag, Dim>*> result,
-                         gsl::not_null<DataVector*> buffer,
+                         const MonitorCache<Dim>& monitor_cache,
+                         const std::string& tensor_name,
+                         size_t component_index,
                          const DataVector& tensor_component,
-                         const Mesh<Dim>& mesh, size_t num_highest_modes,
-                         double alpha, double absolute_tolerance,
-                         double coarsening_factor);
+                         size_t num_highest_modes, double alpha,
+                         double absolute_tolerance, double coarsening_factor);
 }
 
 /*!
  * \brief h-refine the grid based on power in the highest modes
  *
+ * The smoothness indicators are retrieved from the
+ * amr::Criteria::MonitorCache, so they are shared with other criteria
+ * monitoring the same tensors.
+ *
  * \see persson_smoothness_indicator
  */
 template <size_t Dim, typename TensorTags>
@@ -143,12 +150,14 @@ class Persson : public Criterion {
 
   std::string observation_name() override { return "Persson"; }
 
-  using compute_tags_for_observation_box = tmpl::list<>;
+  using compute_tags_for_observation_box =
+      tmpl::list<Tags::MonitorCacheCompute<Dim>>;
 
-  using argument_tags = tmpl::list<::Tags::DataBox>;
+  using argument_tags = tmpl::list<::Tags::DataBox, Tags::MonitorCache<Dim>>;
 
   template <typename DbTagsList, typename Metavariables>
   std::array<Flag, Dim> operator()(const db::DataBox<DbTagsList>& box,
+                                   const MonitorCache<Dim>& monitor_cache,
                                    Parallel::GlobalCache<Metavariables>& cache,
                                    const ElementId<Dim>& element_id) const;
 
@@ -186,19 +195,17 @@ Persson<Dim, TensorTags>::Persson(CkMigrateMessage* msg) : Criterion(msg) {}
 template <size_t Dim, typename TensorTags>
 template <typename DbTagsList, typename Metavariables>
 std::array<Flag, Dim> Persson<Dim, TensorTags>::operator()(
-    const db::DataBox<DbTagsList>& box,
+    const db::DataBox<DbTagsList>& box, const MonitorCache<Dim>& monitor_cache,
     Parallel::GlobalCache<Metavariables>& /*cache*/,
     const ElementId<Dim>& /*element_id*/) const {
   auto result = make_array<Dim>(Flag::Undefined);
-  const auto& mesh = db::get<domain::Tags::Mesh<Dim>>(box);
   // Check all tensors and all tensor components in turn. We take the
   // highest-priority refinement flag in each dimension, so if any tensor
   // component is non-smooth, the element will split in that dimension. And only
   // if all tensor components are smooth enough will elements join in that
   // dimension.
-  DataVector buffer(mesh.number_of_grid_points());
   tmpl::for_each<TensorTags>(
-      [&result, &box, &mesh, &buffer, this](const auto tag_v) {
+      [&result, &box, &monitor_cache, this](const auto tag_v) {
         // Stop if we have already decided to refine every dimension
         if (result == make_array<Dim>(Flag::Split)) {
           return;
@@ -210,10 +217,10 @@ std::array<Flag, Dim> Persson<Dim, TensorTags>::operator()(
           return;
         }
         const auto& tensor = db::get<tag>(box);
-        for (const DataVector& tensor_component : tensor) {
+        for (size_t i = 0; i < tensor.size(); ++i) {
           Persson_detail::max_over_components(
-              make_not_null(&result), make_not_null(&buffer), tensor_component,
-              mesh, num_highest_modes_, alpha_, absolute_tolerance_,
+              make_not_null(&result), monitor_cache, tag_name, i, tensor[i],
+              num_highest_modes_, alpha_, absolute_tolerance_,
               coarsening_factor_);
         }
       });
@@ -0,0 +1,26 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <optional>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Domain/Amr/Flag.hpp"
+
+namespace amr::Criteria::Tags {
+/// \brief The refinement decision accumulated by sampling the refinement
+/// criteria between AMR phases
+///
+/// \details In each dimension this holds the highest-priority amr::Flag
+/// requested by any sample since the last AMR evaluation, or `std::nullopt` if
+/// the criteria have not been sampled since then.
+///
+/// \see amr::Events::SampleCriteria
+template <size_t Dim>
+struct AccumulatedFlags : db::SimpleTag {
+  using type = std::optional<std::array<amr::Flag, Dim>>;
+};
+}  // namespace amr::Criteria::Tags
@@ -0,0 +1,40 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Domain/Tags.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/MonitorCache.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace amr::Criteria::Tags {
+/// The amr::Criteria::MonitorCache shared by all refinement criteria
+/// evaluated on an element
+template <size_t Dim>
+struct MonitorCache : db::SimpleTag {
+  using type = amr::Criteria::MonitorCache<Dim>;
+};
+
+/// \brief Creates an empty amr::Criteria::MonitorCache for the current mesh
+///
+/// \details This compute tag is meant to be added to the `ObservationBox` that
+/// the refinement criteria are evaluated on (criteria list it in their
+/// `compute_tags_for_observation_box`). Since the `ObservationBox` is rebuilt
+/// for every AMR evaluation, the cache is filled only with quantities for the
+/// current data.
+template <size_t Dim>
+struct MonitorCacheCompute : MonitorCache<Dim>, db::ComputeTag {
+  using base = MonitorCache<Dim>;
+  using return_type = amr::Criteria::MonitorCache<Dim>;
+  using argument_tags = tmpl::list<::domain::Tags::Mesh<Dim>>;
+  static void function(const gsl::not_null<return_type*> result,
+                       const ::Mesh<Dim>& mesh) {
+    *result = return_type{mesh};
+  }
+};
+}  // namespace amr::Criteria::Tags
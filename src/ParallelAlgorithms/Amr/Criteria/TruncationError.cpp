@@ -6,11 +6,13 @@
 #include <array>
 #include <cstddef>
 #include <optional>
+#include <string>
 
 #include "DataStructures/DataVector.hpp"
 #include "Domain/Amr/Flag.hpp"
 #include "NumericalAlgorithms/LinearOperators/PowerMonitors.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/MonitorCache.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
 
@@ -19,8 +21,8 @@ namespace amr::Criteria::TruncationError_detail {
 template <size_t Dim>
 void max_over_components(
     const gsl::not_null<std::array<Flag, Dim>*> result,
-    const gsl::not_null<std::array<DataVector, Dim>*> power_monitors_buffer,
-    const DataVector& tensor_component, const Mesh<Dim>& mesh,
+    const MonitorCache<Dim>& monitor_cache, const std::string& tensor_name,
+    const size_t component_index, const DataVector& tensor_component,
     const std::optional<double> target_abs_truncation_error,
     const std::optional<double> target_rel_truncation_error) {
   // We take the highest-priority refinement flag in each dimension, so if any
@@ -28,14 +30,16 @@ void max_over_components(
   // increase p refinement in that dimension. And only if all tensor components
   // still satisfy the target with the highest mode removed will the element
   // decrease p refinement in that dimension.
-  PowerMonitors::power_monitors(power_monitors_buffer, tensor_component, mesh);
-  const double umax = max(abs(tensor_component));
+  const auto& power_monitors = monitor_cache.power_monitors(
+      tensor_name, component_index, tensor_component);
+  const double umax =
+      monitor_cache.max_abs(tensor_name, component_index, tensor_component);
   for (size_t d = 0; d < Dim; ++d) {
     // Skip this dimension if we have already decided to refine it
     if (gsl::at(*result, d) == Flag::IncreaseResolution) {
       continue;
     }
-    const auto& modes = gsl::at(*power_monitors_buffer, d);
+    const auto& modes = gsl::at(power_monitors, d);
     // Increase p refinement if the truncation error exceeds the target
     const double rel_truncation_error =
         pow(10, -PowerMonitors::relative_truncation_error(modes, modes.size()));
@@ -84,9 +88,9 @@ void max_over_components(
 #define INSTANTIATION(_, data)                                         \
   template void max_over_components(                                   \
       gsl::not_null<std::array<Flag, DIM(data)>*> result,              \
-      const gsl::not_null<std::array<DataVector, DIM(data)>*>          \
-          power_monitors_buffer,                                       \
-      const DataVector& tensor_component, const Mesh<DIM(data)>& mesh, \
+      const MonitorCache<DIM(data)>& monitor_cache,                    \
+      const std::string& tensor_name, size_t component_index,          \
+      const DataVector& tensor_component,                              \
       std::optional<double> target_abs_truncation_error,               \
       std::optional<double> target_rel_truncation_error);
 
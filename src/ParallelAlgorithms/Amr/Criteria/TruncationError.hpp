@@ -22,6 +22,8 @@
 #include "Options/ParseError.hpp"
 #include "Options/String.hpp"
 #include "ParallelAlgorithms/Amr/Criteria/Criterion.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/MonitorCache.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/Tags/MonitorCache.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/TMPL.hpp"
 
@@ -43,12 +45,13 @@ namespace TruncationError_detail {
  * `Flag::DecreaseResolution`.
  */
 template <size_t Dim>
-void max_over_components(
-    gsl::not_null<std::array<Flag, Dim>*> result,
-    const gsl::not_null<std::array<DataVector, Dim>*> power_monitors_buffer,
-    const DataVector& tensor_component, const Mesh<Dim>& mesh,
-    std::optional<double> target_abs_truncation_error,
-    std::optional<double> target_rel_truncation_error);
+void max_over_components(gsl::not_null<std::array<Flag, Dim>*> result,
+                         const MonitorCache<Dim>& monitor_cache,
+                         const std::string& tensor_name,
+                         size_t component_index,
+                         const DataVector& tensor_component,
+                         std::optional<double> target_abs_truncation_error,
+                         std::optional<double> target_rel_truncation_error);
 }  // namespace TruncationError_detail
 
 /*!
@@ -60,7 +63,9 @@ void max_over_components(
  *   removed, the element will be p-coarsened.
  *
  * For details on how the truncation error is computed see
- * `PowerMonitors::truncation_error`.
+ * `PowerMonitors::truncation_error`. The power monitors are retrieved from the
+ * amr::Criteria::MonitorCache, so they are computed only once per tensor
+ * component even if several criteria monitor the same tensors.
  *
  * \tparam Dim Spatial dimension of the grid
  * \tparam TensorTags List of tags of the tensors to be monitored
@@ -112,12 +117,14 @@ class TruncationError : public Criterion {
 
   std::string observation_name() override { return "TruncationError"; }
 
-  using compute_tags_for_observation_box = tmpl::list<>;
+  using compute_tags_for_observation_box =
+      tmpl::list<Tags::MonitorCacheCompute<Dim>>;
 
-  using argument_tags = tmpl::list<::Tags::DataBox>;
+  using argument_tags = tmpl::list<::Tags::DataBox, Tags::MonitorCache<Dim>>;
 
   template <typename DbTagsList, typename Metavariables>
   std::array<Flag, Dim> operator()(const db::DataBox<DbTagsList>& box,
+                                   const MonitorCache<Dim>& monitor_cache,
                                    Parallel::GlobalCache<Metavariables>& cache,
                                    const ElementId<Dim>& element_id) const;
 
@@ -156,15 +163,13 @@ TruncationError<Dim, TensorTags>::TruncationError(CkMigrateMessage* msg)
 template <size_t Dim, typename TensorTags>
 template <typename DbTagsList, typename Metavariables>
 std::array<Flag, Dim> TruncationError<Dim, TensorTags>::operator()(
-    const db::DataBox<DbTagsList>& box,
+    const db::DataBox<DbTagsList>& box, const MonitorCache<Dim>& monitor_cache,
     Parallel::GlobalCache<Metavariables>& /*cache*/,
     const ElementId<Dim>& /*element_id*/) const {
   auto result = make_array<Dim>(Flag::Undefined);
-  const auto& mesh = db::get<domain::Tags::Mesh<Dim>>(box);
-  std::array<DataVector, Dim> power_monitors_buffer{};
   // Check all tensors and all tensor components in turn
   tmpl::for_each<TensorTags>(
-      [&result, &box, &mesh, &power_monitors_buffer, this](const auto tag_v) {
+      [&result, &box, &monitor_cache, this](const auto tag_v) {
         // Stop if we have already decided to refine every dimension
         if (result == make_array<Dim>(Flag::IncreaseResolution)) {
           return;
@@ -176,11 +181,10 @@ std::array<Flag, Dim> TruncationError<Dim, TensorTags>::operator()(
           return;
         }
         const auto& tensor = db::get<tag>(box);
-        for (const DataVector& tensor_component : tensor) {
+        for (size_t i = 0; i < tensor.size(); ++i) {
           TruncationError_detail::max_over_components(
-              make_not_null(&result), make_not_null(&power_monitors_buffer),
-              tensor_component, mesh, target_abs_truncation_error_,
-              target_rel_truncation_error_);
+              make_not_null(&result), monitor_cache, tag_name, i, tensor[i],
+              target_abs_truncation_error_, target_rel_truncation_error_);
         }
       });
   return result;
@@ -0,0 +1,18 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "ParallelAlgorithms/Amr/Events/EvaluateAmrCriteria.hpp"
+
+#include <pup.h>
+
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+
+namespace amr::Events {
+EvaluateAmrCriteria::EvaluateAmrCriteria() = default;
+
+EvaluateAmrCriteria::EvaluateAmrCriteria(CkMigrateMessage* m) : Event(m) {}
+
+void EvaluateAmrCriteria::pup(PUP::er& p) { Event::pup(p); }
+
+PUP::able::PUP_ID EvaluateAmrCriteria::my_PUP_ID = 0;  // NOLINT
+}  // namespace amr::Events
@@ -0,0 +1,107 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/ObservationBox.hpp"
+#include "Domain/Amr/Flag.hpp"
+#include "Domain/Amr/Tags/Flags.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Options/String.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "ParallelAlgorithms/Amr/Actions/EvaluateRefinementCriteria.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "Utilities/Algorithm.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Serialization/CharmPupable.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace amr::Events {
+/// \ingroup AmrGroup
+/// \brief Evaluates the refinement criteria and negotiates the AMR decision
+/// with the neighbors of the Element without leaving the current phase
+///
+/// \details Runs amr::Actions::EvaluateRefinementCriteria on the Element,
+/// which sets amr::Tags::Info and sends it to the neighboring Element%s with
+/// amr::Actions::UpdateAmrDecision. The negotiation of the AMR decision
+/// between neighbors then proceeds asynchronously while the evolution
+/// continues, instead of stalling all Element%s in
+/// Parallel::Phase::EvaluateAmrCriteria until the whole domain has reached
+/// consensus. The decision is acted on the next time the executable enters
+/// Parallel::Phase::AdjustDomain, so Parallel::Phase::EvaluateAmrCriteria does
+/// not need to be visited. Since the phase change to
+/// Parallel::Phase::AdjustDomain waits for quiescence, all negotiation messages
+/// have been processed by the time the domain is adjusted.
+///
+/// If the AMR decision of the Element is already set (i.e. the decision from a
+/// previous evaluation has not yet been acted on by
+/// amr::Actions::AdjustDomain), the event does nothing, so it can be triggered
+/// more often than the domain is adjusted.
+///
+/// \warning All Element%s must evaluate this event at the same time (e.g. use
+/// a `Slabs` trigger), otherwise Element%s that did not evaluate the criteria
+/// would ignore the decisions of their neighbors. The Element and Mesh must not
+/// change between the evaluation of this event and the adjustment of the
+/// domain, so it cannot be combined with amr::Events::RefineMesh.
+class EvaluateAmrCriteria : public Event {
+ public:
+  /// \cond
+  explicit EvaluateAmrCriteria(CkMigrateMessage* m);
+  using PUP::able::register_constructor;
+  WRAPPED_PUPable_decl_template(EvaluateAmrCriteria);  // NOLINT
+  /// \endcond
+
+  using options = tmpl::list<>;
+  static constexpr Options::String help = {
+      "Evaluate the AMR criteria and negotiate the AMR decision with the "
+      "neighboring elements, without a global synchronization. The domain is "
+      "adjusted the next time the AdjustDomain phase is visited."};
+
+  EvaluateAmrCriteria();
+
+  using compute_tags_for_observation_box = tmpl::list<>;
+  using return_tags = tmpl::list<::Tags::DataBox>;
+  using argument_tags = tmpl::list<>;
+
+  template <typename DbTags, typename Metavariables, typename Component>
+  void operator()(const gsl::not_null<db::DataBox<DbTags>*> box,
+                  Parallel::GlobalCache<Metavariables>& cache,
+                  const ElementId<Metavariables::volume_dim>& element_id,
+                  const Component* const /*meta*/,
+                  const ObservationValue& /*observation_value*/) const {
+    constexpr size_t volume_dim = Metavariables::volume_dim;
+    // A decision is already pending
+    if (alg::any_of(db::get<amr::Tags::Info<volume_dim>>(*box).flags,
+                    [](const amr::Flag flag) {
+                      return flag != amr::Flag::Undefined;
+                    })) {
+      return;
+    }
+    amr::Actions::EvaluateRefinementCriteria::apply<Component>(*box, cache,
+                                                               element_id);
+  }
+
+  using is_ready_argument_tags = tmpl::list<>;
+
+  template <typename Metavariables, typename ArrayIndex, typename Component>
+  bool is_ready(Parallel::GlobalCache<Metavariables>& /*cache*/,
+                const ArrayIndex& /*array_index*/,
+                const Component* const /*meta*/) const {
+    return true;
+  }
+
+  bool needs_evolved_variables() const override { return true; }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) override;
+};
+}  // namespace amr::Events
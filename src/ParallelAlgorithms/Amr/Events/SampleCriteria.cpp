@@ -0,0 +1,30 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "ParallelAlgorithms/Amr/Events/SampleCriteria.hpp"
+
+#include <memory>
+#include <pup.h>
+#include <pup_stl.h>
+#include <utility>
+#include <vector>
+
+#include "ParallelAlgorithms/Amr/Criteria/Criterion.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+
+namespace amr::Events {
+SampleCriteria::SampleCriteria() = default;
+
+SampleCriteria::SampleCriteria(
+    std::vector<std::unique_ptr<amr::Criterion>> criteria)
+    : criteria_(std::move(criteria)) {}
+
+SampleCriteria::SampleCriteria(CkMigrateMessage* m) : Event(m) {}
+
+void SampleCriteria::pup(PUP::er& p) {
+  Event::pup(p);
+  p | criteria_;
+}
+
+PUP::able::PUP_ID SampleCriteria::my_PUP_ID = 0;  // NOLINT
+}  // namespace amr::Events
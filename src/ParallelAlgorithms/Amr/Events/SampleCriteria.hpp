@@ -0,0 +1,150 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/ObservationBox.hpp"
+#include "Domain/Amr/Flag.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Options/String.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/Criterion.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/Tags/AccumulatedFlags.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/MakeArray.hpp"
+#include "Utilities/Serialization/CharmPupable.hpp"
+#include "Utilities/TMPL.hpp"
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace amr::Events {
+namespace detail {
+template <typename Criterion>
+struct get_sampled_tags {
+  using type = typename Criterion::compute_tags_for_observation_box;
+};
+}  // namespace detail
+
+/// \ingroup AmrGroup
+/// \brief Evaluates a subset of the refinement criteria between AMR phases and
+/// accumulates the decision
+///
+/// \details Evaluates the refinement criteria given in the options of this
+/// event and stores, in each dimension, the highest-priority amr::Flag
+/// requested since the last AMR phase in
+/// amr::Criteria::Tags::AccumulatedFlags. The next time
+/// amr::Actions::EvaluateRefinementCriteria runs, the accumulated flags are
+/// combined with the decision of all criteria in amr::Criteria::Tags::Criteria.
+/// The accumulated flags are cleared at the end of each AMR phase by
+/// amr::Actions::AdjustDomain.
+///
+/// Only the criteria given to this event are evaluated, so choosing criteria
+/// that are cheap to evaluate (e.g. a subset of the criteria evaluated in the
+/// AMR phases) lets features that appear and disappear between AMR phases
+/// still be refined, without paying for a full AMR phase (with its global
+/// synchronization) or for all criteria every time the criteria are sampled.
+///
+/// This event does not change the mesh and does not communicate with
+/// neighbors.
+class SampleCriteria : public Event {
+ public:
+  /// \cond
+  explicit SampleCriteria(CkMigrateMessage* m);
+  using PUP::able::register_constructor;
+  WRAPPED_PUPable_decl_template(SampleCriteria);  // NOLINT
+  /// \endcond
+
+  /// The refinement criteria to sample
+  struct Criteria {
+    using type = std::vector<std::unique_ptr<amr::Criterion>>;
+    static constexpr Options::String help = {
+        "The refinement criteria to evaluate between AMR phases. Choose "
+        "criteria that are cheap to evaluate."};
+  };
+
+  using options = tmpl::list<Criteria>;
+  static constexpr Options::String help = {
+      "Evaluate the given AMR criteria and accumulate the decision until the "
+      "next AMR phase"};
+
+  SampleCriteria();
+  explicit SampleCriteria(
+      std::vector<std::unique_ptr<amr::Criterion>> criteria);
+
+  using compute_tags_for_observation_box = tmpl::list<>;
+  using return_tags = tmpl::list<::Tags::DataBox>;
+  using argument_tags = tmpl::list<>;
+
+  template <typename DbTags, typename Metavariables, typename Component>
+  void operator()(const gsl::not_null<db::DataBox<DbTags>*> box,
+                  Parallel::GlobalCache<Metavariables>& cache,
+                  const ElementId<Metavariables::volume_dim>& element_id,
+                  const Component* const /*meta*/,
+                  const ObservationValue& /*observation_value*/) const {
+    constexpr size_t volume_dim = Metavariables::volume_dim;
+    auto sampled_decision = make_array<volume_dim>(amr::Flag::Undefined);
+
+    // The compute tags are only evaluated when a sampled criterion retrieves
+    // them.
+    using compute_tags = tmpl::remove_duplicates<tmpl::flatten<tmpl::transform<
+        tmpl::at<typename Metavariables::factory_creation::factory_classes,
+                 Criterion>,
+        detail::get_sampled_tags<tmpl::_1>>>>;
+    auto observation_box = make_observation_box<compute_tags>(box);
+
+    for (const auto& criterion : criteria_) {
+      const auto decision =
+          criterion->evaluate(observation_box, cache, element_id);
+      for (size_t d = 0; d < volume_dim; ++d) {
+        sampled_decision[d] = std::max(sampled_decision[d], decision[d]);
+      }
+    }
+
+    db::mutate<amr::Criteria::Tags::AccumulatedFlags<volume_dim>>(
+        [&sampled_decision](
+            const gsl::not_null<std::optional<std::array<Flag, volume_dim>>*>
+                accumulated_flags) {
+          if (not accumulated_flags->has_value()) {
+            *accumulated_flags = sampled_decision;
+            return;
+          }
+          for (size_t d = 0; d < volume_dim; ++d) {
+            gsl::at(accumulated_flags->value(), d) =
+                std::max(gsl::at(accumulated_flags->value(), d),
+                         gsl::at(sampled_decision, d));
+          }
+        },
+        box);
+  }
+
+  using is_ready_argument_tags = tmpl::list<>;
+
+  template <typename Metavariables, typename ArrayIndex, typename Component>
+  bool is_ready(Parallel::GlobalCache<Metavariables>& /*cache*/,
+                const ArrayIndex& /*array_index*/,
+                const Component* const /*meta*/) const {
+    return true;
+  }
+
+  bool needs_evolved_variables() const override { return true; }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) override;
+
+ private:
+  std::vector<std::unique_ptr<amr::Criterion>> criteria_{};
+};
+}  // namespace amr::Events
@@ -162,30 +162,40 @@ FastFlow::iterate_horizon_finder(
   // here we compute the L2 integral norm.  The integral should be
   // more accurate, but if it turns out that this integral is
   // expensive, we can switch back to the pointwise L2 norm.
-  const double residual_mesh_norm = sqrt(strahlkorper.ylm_spherepack().average(
-      strahlkorper.ylm_spherepack().phys_to_spec(square(weighted_residual))));
+  //
+  // The weighted residual and its square are transformed together in a
+  // single batched transform.
+  const auto& mesh_ylm = strahlkorper.ylm_spherepack();
+  const DataVector squared_weighted_residual = square(weighted_residual);
+  DataVector squared_weighted_residual_coefs(mesh_ylm.spectral_size());
+  DataVector weighted_residual_coefs(mesh_ylm.spectral_size());
+  mesh_ylm.phys_to_spec(
+      std::array<double*, 2>{{squared_weighted_residual_coefs.data(),
+                              weighted_residual_coefs.data()}},
+      std::array<const double*, 2>{
+          {squared_weighted_residual.data(), weighted_residual.data()}});
+  const double residual_mesh_norm =
+      sqrt(mesh_ylm.average(squared_weighted_residual_coefs));
 
   if (residual_mesh_norm < min_residual_mesh_norm_) {
     min_residual_mesh_norm_ = residual_mesh_norm;
     iter_at_min_residual_mesh_norm_ = current_iter_;
   }
 
-  // Transform the weighted residual
-  const auto weighted_residual_coefs =
-      strahlkorper.ylm_spherepack().phys_to_spec(weighted_residual);
-
-  // Restrict to the basis of the surface
+  // Restrict to the basis of the surface. This only copies coefficients, so
+  // there is no transform to batch.
+  const auto& surface_ylm = current_strahlkorper->ylm_spherepack();
   const auto residual_on_surface =
-      strahlkorper.ylm_spherepack().prolong_or_restrict(
-          weighted_residual_coefs, current_strahlkorper->ylm_spherepack());
+      mesh_ylm.prolong_or_restrict(weighted_residual_coefs, surface_ylm);
 
   // Evaluate the norm of the residual on the surface of size l_surface.
   // See comment on pointwise norm vs integral norm above.
+  //
+  // The two transforms can't be batched since the second one acts on the
+  // square of the result of the first one.
   const auto residual_ylm_norm =
-      sqrt(current_strahlkorper->ylm_spherepack().average(
-          current_strahlkorper->ylm_spherepack().phys_to_spec(
-              square(current_strahlkorper->ylm_spherepack().spec_to_phys(
-                  residual_on_surface)))));
+      sqrt(surface_ylm.average(surface_ylm.phys_to_spec(
+          square(surface_ylm.spec_to_phys(residual_on_surface)))));
 
   // Fill iter_info
   const auto minmax_residual =
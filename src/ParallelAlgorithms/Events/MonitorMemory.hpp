@@ -16,6 +16,7 @@
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/TagName.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/MemoryTracking.hpp"
 #include "Domain/Structure/Element.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Tags.hpp"
@@ -27,6 +28,8 @@
 #include "IO/Observer/TypeOfObservation.hpp"
 #include "Options/Auto.hpp"
 #include "Options/String.hpp"
+#include "Parallel/ArrayComponentId.hpp"
+#include "Parallel/ArrayIndex.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Info.hpp"
 #include "Parallel/Invoke.hpp"
@@ -41,6 +44,7 @@
 #include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/Functional.hpp"
+#include "Utilities/GetOutput.hpp"
 #include "Utilities/Serialization/CharmPupable.hpp"
 #include "Utilities/Serialization/Serialize.hpp"
 #include "Utilities/TMPL.hpp"
@@ -54,6 +58,12 @@ struct Singleton;
 }  // namespace Parallel::Algorithms
 /// \endcond
 
+namespace mem_monitor {
+/// The name under which the memory tracked by `memory_tracking` is monitored
+/// and written to disk.
+inline const std::string tracked_allocations_name = "TrackedAllocations";
+}  // namespace mem_monitor
+
 namespace Events {
 /*!
  * \brief Event run on the DgElementArray that will monitor the memory usage of
@@ -71,6 +81,31 @@ namespace Events {
  * parallel component ("Blah" for example) in the input file. An ERROR will
  * occur and a list of the available components to monitor will be printed.
  *
+ * Monitoring a parallel component computes the size of every element or branch
+ * by serializing it, which can be slow for large components. In addition to the
+ * parallel components, you can monitor `TrackedAllocations`, which requires
+ * SpECTRE to be configured with `-D SPECTRE_TRACK_ALLOCATIONS=ON`. Requesting
+ * it otherwise is an input file error, and 'All' doesn't include it. It is
+ * reduced through the observers and written to the
+ * `/MemoryMonitors/TrackedAllocations` file with one row per observation and
+ * the columns
+ *
+ * - `Time`
+ * - `<Kind> on process <p> (MB)` for each `memory_tracking::Kind` and each
+ *   process: the memory held by all `DataVector`s, `Variables` and similar
+ *   data structures on the process.
+ * - `<Component>, <Group> on process <p> (MB)` for each parallel component,
+ *   each `memory_tracking::Group` and each process: the memory allocated by
+ *   the component for the group of DataBox items, e.g. the time stepper
+ *   history or the mortar data. The component `Other` holds the allocations
+ *   made outside of the actions of the parallel components.
+ *
+ * The values are read from the counters of `memory_tracking`, which are
+ * updated when the memory is allocated and freed, so this doesn't serialize or
+ * traverse the elements and is cheap enough to monitor frequently. Every
+ * element reads the same process-wide counters, so the values are
+ * max-reduced. A Charm++ node is one process, so `p` is the node number.
+ *
  * \note Currently, the only Parallel::Algorithms::Array parallel component that
  * can be monitored is the DgElementArray itself.
  */
@@ -85,6 +120,15 @@ class MonitorMemory : public Event {
       // Vector of total mem usage on each node
       Parallel::ReductionDatum<std::vector<double>,
                                funcl::ElementWise<funcl::Plus<>>>>;
+  // Reduction data for the tracked allocations. Every element reports the
+  // counters of its process, so we take the maximum instead of the sum.
+  using TrackedAllocationsReductionData = Parallel::ReductionData<
+      // Time
+      Parallel::ReductionDatum<double, funcl::AssertEqual<>>,
+      // Vector of tracked memory of each kind and of each category on each
+      // process
+      Parallel::ReductionDatum<std::vector<double>,
+                               funcl::ElementWise<funcl::Max<>>>>;
 
  public:
   explicit MonitorMemory(CkMigrateMessage* msg);
@@ -95,9 +139,11 @@ class MonitorMemory : public Event {
     using type =
         Options::Auto<std::vector<std::string>, Options::AutoLabel::All>;
     static constexpr Options::String help = {
-        "Names of parallel components to monitor the memory usage of. If you'd "
-        "like to monitor all available parallel components, pass 'All' "
-        "instead."};
+        "Names of parallel components to monitor the memory usage of, or "
+        "'TrackedAllocations' for the memory held by DataVectors and "
+        "Variables on each process, broken down by parallel component and "
+        "group of DataBox items (requires SPECTRE_TRACK_ALLOCATIONS). If you'd "
+        "like to monitor all of them, pass 'All' instead."};
   };
 
   using options = tmpl::list<ComponentsToMonitor>;
@@ -113,16 +159,17 @@ class MonitorMemory : public Event {
       const Options::Context& context, Metavariables /*meta*/);
 
   using observed_reduction_data_tags =
-      observers::make_reduction_data_tags<tmpl::list<ReductionData>>;
+      observers::make_reduction_data_tags<
+          tmpl::list<ReductionData, TrackedAllocationsReductionData>>;
 
   using compute_tags_for_observation_box = tmpl::list<>;
 
   using return_tags = tmpl::list<>;
-  using argument_tags = tmpl::list<domain::Tags::Element<Dim>>;
+  using argument_tags = tmpl::list<::Tags::DataBox>;
 
-  template <typename Metavariables, typename ArrayIndex,
+  template <typename DataBoxType, typename Metavariables, typename ArrayIndex,
             typename ParallelComponent>
-  void operator()(const ::Element<Dim>& element,
+  void operator()(const DataBoxType& box,
                   Parallel::GlobalCache<Metavariables>& cache,
                   const ArrayIndex& array_index,
                   const ParallelComponent* const /*meta*/,
@@ -133,7 +180,13 @@ class MonitorMemory : public Event {
   std::optional<
       std::pair<observers::TypeOfObservation, observers::ObservationKey>>
   get_observation_type_and_key_for_registration() const {
-    return {};
+    if (components_to_monitor_.count(mem_monitor::tracked_allocations_name) ==
+        1) {
+      return {{observers::TypeOfObservation::Reduction,
+               observers::ObservationKey{tracked_allocations_subfile() +
+                                         ".dat"}}};
+    }
+    return std::nullopt;
   }
 
   using is_ready_argument_tags = tmpl::list<>;
@@ -151,6 +204,17 @@ class MonitorMemory : public Event {
   void pup(PUP::er& p) override;
 
  private:
+  static std::string tracked_allocations_subfile() {
+    return "/MemoryMonitors/" + mem_monitor::tracked_allocations_name;
+  }
+
+  template <typename Metavariables, typename ArrayIndex,
+            typename ParallelComponent>
+  void observe_tracked_allocations(
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ArrayIndex& array_index,
+      const ObservationValue& observation_value) const;
+
   std::unordered_set<std::string> components_to_monitor_{};
 };
 
@@ -167,6 +231,8 @@ MonitorMemory<Dim>::MonitorMemory(
                                          Parallel::GlobalCache<Metavariables>>;
   std::unordered_map<std::string, std::string> existing_components{};
   std::string str_component_list{};
+  existing_components[mem_monitor::tracked_allocations_name] = "";
+  str_component_list += " - " + mem_monitor::tracked_allocations_name + "\n";
 
   tmpl::for_each<component_list>(
       [&existing_components, &str_component_list](auto component_v) {
@@ -191,7 +257,15 @@ MonitorMemory<Dim>::MonitorMemory(
       //     protects against spelling errors.
       //  2. Currently the only charm Array you can monitor the memory of is
       //     the DgElementArray so enforce this.
-      if (existing_components.count(component) != 1) {
+      if (component == mem_monitor::tracked_allocations_name and
+          not memory_tracking::enabled) {
+        PARSE_ERROR(context,
+                    "Cannot monitor '"
+                        << component
+                        << "' because SpECTRE was configured without "
+                           "allocation tracking. Reconfigure with "
+                           "'-D SPECTRE_TRACK_ALLOCATIONS=ON' to monitor it.");
+      } else if (existing_components.count(component) != 1) {
         PARSE_ERROR(
             context,
             "Cannot monitor memory usage of unknown parallel component '"
@@ -213,8 +287,12 @@ MonitorMemory<Dim>::MonitorMemory(
     }
   } else {
     // 'All' was specified. Filter out Array components that are not the
-    // DgElementArray
+    // DgElementArray, and the tracked allocations if they aren't tracked
     for (const auto& [name, chare] : existing_components) {
+      if (name == mem_monitor::tracked_allocations_name and
+          not memory_tracking::enabled) {
+        continue;
+      }
       if (chare != "Array") {
         components_to_monitor_.insert(name);
       } else if (name == "DgElementArray") {
@@ -225,12 +303,19 @@ MonitorMemory<Dim>::MonitorMemory(
 }
 
 template <size_t Dim>
-template <typename Metavariables, typename ArrayIndex,
+template <typename DataBoxType, typename Metavariables, typename ArrayIndex,
           typename ParallelComponent>
 void MonitorMemory<Dim>::operator()(
-    const ::Element<Dim>& element, Parallel::GlobalCache<Metavariables>& cache,
+    const DataBoxType& box, Parallel::GlobalCache<Metavariables>& cache,
     const ArrayIndex& array_index, const ParallelComponent* const /*meta*/,
     const ObservationValue& observation_value) const {
+  if (components_to_monitor_.count(mem_monitor::tracked_allocations_name) ==
+      1) {
+    observe_tracked_allocations<Metavariables, ArrayIndex, ParallelComponent>(
+        cache, array_index, observation_value);
+  }
+  const auto& element = db::get<domain::Tags::Element<Dim>>(box);
+
   using component_list = tmpl::push_back<typename Metavariables::component_list,
                                          Parallel::GlobalCache<Metavariables>>;
 
@@ -320,6 +405,89 @@ void MonitorMemory<Dim>::operator()(
   });
 }
 
+template <size_t Dim>
+template <typename Metavariables, typename ArrayIndex,
+          typename ParallelComponent>
+void MonitorMemory<Dim>::observe_tracked_allocations(
+    Parallel::GlobalCache<Metavariables>& cache, const ArrayIndex& array_index,
+    const ObservationValue& observation_value) const {
+  auto& local_observer = *Parallel::local_branch(
+      Parallel::get_parallel_component<
+          tmpl::conditional_t<Parallel::is_nodegroup_v<ParallelComponent>,
+                              observers::ObserverWriter<Metavariables>,
+                              observers::Observer<Metavariables>>>(cache));
+  const size_t num_processes = Parallel::number_of_nodes<size_t>(cache);
+  const size_t my_process = Parallel::my_node<size_t>(cache);
+
+  // The component IDs differ between processes, so the columns are ordered
+  // by the component list, which is the same everywhere
+  std::vector<size_t> component_ids{0};
+  tmpl::for_each<typename Metavariables::component_list>(
+      [&component_ids](auto component_v) {
+        using component = tmpl::type_from<decltype(component_v)>;
+        component_ids.push_back(memory_tracking::component_id<component>());
+      });
+
+  std::vector<std::string> legend{observation_value.name};
+  std::vector<double> sizes(
+      (memory_tracking::number_of_kinds +
+       component_ids.size() * memory_tracking::number_of_groups) *
+          num_processes,
+      0.0);
+  size_t column = 0;
+  const auto add_columns = [&column, &legend, &my_process, &num_processes,
+                            &sizes](const std::string& name,
+                                    const size_t bytes) {
+    for (size_t process = 0; process < num_processes; ++process) {
+      legend.emplace_back(name + " on process " + get_output(process) +
+                          " (MB)");
+    }
+    sizes[column * num_processes + my_process] =
+        static_cast<double>(bytes) / 1.0e6;
+    ++column;
+  };
+  for (size_t kind = 0; kind < memory_tracking::number_of_kinds; ++kind) {
+    add_columns(memory_tracking::name(static_cast<memory_tracking::Kind>(kind)),
+                memory_tracking::bytes_allocated(
+                    static_cast<memory_tracking::Kind>(kind)));
+  }
+  for (const size_t component_id : component_ids) {
+    for (size_t group = 0; group < memory_tracking::number_of_groups;
+         ++group) {
+      size_t bytes = 0;
+      for (size_t kind = 0; kind < memory_tracking::number_of_kinds; ++kind) {
+        bytes += memory_tracking::bytes_allocated(
+            component_id, static_cast<memory_tracking::Group>(group),
+            static_cast<memory_tracking::Kind>(kind));
+      }
+      add_columns(memory_tracking::component_name(component_id) + ", " +
+                      memory_tracking::name(
+                          static_cast<memory_tracking::Group>(group)),
+                  bytes);
+    }
+  }
+
+  observers::ObservationId observation_id{
+      observation_value.value, tracked_allocations_subfile() + ".dat"};
+  Parallel::ArrayComponentId array_component_id{
+      std::add_pointer_t<ParallelComponent>{nullptr},
+      Parallel::ArrayIndex<ArrayIndex>(array_index)};
+  TrackedAllocationsReductionData reduction_data{observation_value.value,
+                                                 std::move(sizes)};
+  if constexpr (Parallel::is_nodegroup_v<ParallelComponent>) {
+    Parallel::threaded_action<
+        observers::ThreadedActions::CollectReductionDataOnNode>(
+        local_observer, std::move(observation_id),
+        std::move(array_component_id), tracked_allocations_subfile(),
+        std::move(legend), std::move(reduction_data));
+  } else {
+    Parallel::simple_action<observers::Actions::ContributeReductionData>(
+        local_observer, std::move(observation_id),
+        std::move(array_component_id), tracked_allocations_subfile(),
+        std::move(legend), std::move(reduction_data));
+  }
+}
+
 template <size_t Dim>
 void MonitorMemory<Dim>::pup(PUP::er& p) {
   Event::pup(p);
@@ -0,0 +1,69 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "ParallelAlgorithms/Events/ObserveActionTraces.hpp"
+
+#include <cstddef>
+#include <map>
+#include <pup.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "IO/Observer/Actions/WriteActionTraces.hpp"
+#include "Parallel/Tracing.hpp"
+
+namespace Events {
+ObserveActionTraces::ObserveActionTraces(CkMigrateMessage* m) : Event(m) {}
+
+ObserveActionTraces::ObserveActionTraces(const bool write_events)
+    : write_events_(write_events) {}
+
+std::vector<observers::ActionTrace> ObserveActionTraces::make_action_traces(
+    const std::vector<Parallel::tracing::Event>& events,
+    const bool write_events) {
+  std::map<size_t, std::vector<Parallel::tracing::Event>> events_by_proc{};
+  for (const auto& event : events) {
+    events_by_proc[static_cast<size_t>(event.core)].push_back(event);
+  }
+  std::vector<observers::ActionTrace> result{};
+  for (const auto& [proc, proc_events] : events_by_proc) {
+    std::map<std::pair<std::string, std::string>, observers::ActionTrace>
+        traces{};
+    for (const auto& [names, summary] :
+         Parallel::tracing::summarize(proc_events)) {
+      traces[names] = observers::ActionTrace{
+          names.first,
+          names.second,
+          proc,
+          {static_cast<double>(summary.calls),
+           static_cast<double>(summary.retries),
+           static_cast<double>(summary.messages), summary.total_wall_time,
+           summary.max_wall_time, summary.total_queue_wait},
+          {}};
+    }
+    if (write_events) {
+      for (const auto& event : proc_events) {
+        traces
+            .at(std::pair{
+                Parallel::tracing::registered_name(event.component),
+                Parallel::tracing::registered_name(event.name)})
+            .events.push_back({event.start, event.duration, event.queue_wait,
+                               static_cast<double>(event.core),
+                               static_cast<double>(event.type)});
+      }
+    }
+    for (auto& [names, trace] : traces) {
+      result.push_back(std::move(trace));
+    }
+  }
+  return result;
+}
+
+void ObserveActionTraces::pup(PUP::er& p) {
+  Event::pup(p);
+  p | write_events_;
+}
+
+PUP::able::PUP_ID ObserveActionTraces::my_PUP_ID = 0;  // NOLINT
+}  // namespace Events
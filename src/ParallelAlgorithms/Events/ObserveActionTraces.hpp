@@ -0,0 +1,122 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <pup.h>
+#include <utility>
+#include <vector>
+
+#include "IO/Observer/Actions/WriteActionTraces.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
+#include "Options/String.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/Tracing.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "Utilities/Serialization/CharmPupable.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace Events {
+/*!
+ * \brief Write the actions traced by `Parallel::tracing` to the reduction file.
+ *
+ * \details The first element in each process that runs this event for an
+ * observation value drains the traced events of all threads of the process
+ * and sends them to the `observers::ObserverWriter` on node 0, which writes
+ * them with
+ * `observers::ThreadedActions::WriteActionTraces`. For every parallel
+ * component, action (or inbox tag, or phase) and processing element (PE) that
+ * ran the action since the last observation, the number of calls, retries and
+ * received messages as well as the total and maximum wall time and the total
+ * queue wait are written to `/ActionTraces/<Component>/<Name>/Summary`. If
+ * `WriteEvents` is enabled, the individual events are written to
+ * `/ActionTraces/<Component>/<Name>/Events` as well, which can be converted to
+ * a Chrome/Perfetto trace with `spectre export-action-traces`.
+ *
+ * Actions are only traced when SpECTRE is configured with
+ * `-D SPECTRE_ACTION_TRACING=ON`. Otherwise this event writes nothing.
+ *
+ * The event buffer of each thread holds `Parallel::tracing::buffer_capacity`
+ * events, so trigger this event often enough that no events are dropped. The
+ * number of dropped events of each PE is written to
+ * `/ActionTraces/DroppedEvents`.
+ */
+class ObserveActionTraces : public Event {
+ public:
+  /// \cond
+  explicit ObserveActionTraces(CkMigrateMessage* m);
+  using PUP::able::register_constructor;
+  WRAPPED_PUPable_decl_template(ObserveActionTraces);  // NOLINT
+  /// \endcond
+
+  struct WriteEvents {
+    using type = bool;
+    static constexpr Options::String help = {
+        "Write every traced event in addition to the summary of each action. "
+        "This is needed to export a time-resolved trace."};
+  };
+
+  using options = tmpl::list<WriteEvents>;
+  static constexpr Options::String help = {
+      "Write the wall time, queue wait and message counts of the actions "
+      "traced since the last observation. Requires configuring with "
+      "SPECTRE_ACTION_TRACING."};
+
+  ObserveActionTraces() = default;
+  explicit ObserveActionTraces(bool write_events);
+
+  using compute_tags_for_observation_box = tmpl::list<>;
+
+  using return_tags = tmpl::list<>;
+  using argument_tags = tmpl::list<>;
+
+  template <typename ArrayIndex, typename ParallelComponent,
+            typename Metavariables>
+  void operator()(Parallel::GlobalCache<Metavariables>& cache,
+                  const ArrayIndex& /*array_index*/,
+                  const ParallelComponent* const /*meta*/,
+                  const ObservationValue& observation_value) const {
+    const std::optional<std::vector<Parallel::tracing::Event>> events =
+        Parallel::tracing::drain(observation_value.value);
+    // Another element in this process has already drained the events for this
+    // observation, or nothing was traced
+    if (not events.has_value() or events->empty()) {
+      return;
+    }
+    auto& observer_writer = Parallel::get_parallel_component<
+        observers::ObserverWriter<Metavariables>>(cache);
+    Parallel::threaded_action<observers::ThreadedActions::WriteActionTraces>(
+        // Node 0 is always the writer
+        observer_writer[0], observation_value.value,
+        Parallel::tracing::number_of_dropped_events(),
+        make_action_traces(*events, write_events_));
+  }
+
+  using is_ready_argument_tags = tmpl::list<>;
+
+  template <typename Metavariables, typename ArrayIndex, typename Component>
+  bool is_ready(Parallel::GlobalCache<Metavariables>& /*cache*/,
+                const ArrayIndex& /*array_index*/,
+                const Component* const /*meta*/) const {
+    return true;
+  }
+
+  bool needs_evolved_variables() const override { return false; }
+
+  /// \brief Combine the `events` into one `observers::ActionTrace` for each
+  /// parallel component, action and PE.
+  ///
+  /// The events are only included if `write_events` is true.
+  static std::vector<observers::ActionTrace> make_action_traces(
+      const std::vector<Parallel::tracing::Event>& events, bool write_events);
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) override;
+
+ private:
+  bool write_events_{false};
+};
+}  // namespace Events
@@ -0,0 +1,17 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "ParallelAlgorithms/Events/ObserveElementCollectionStatistics.hpp"
+
+#include <pup.h>
+
+namespace Events {
+ObserveElementCollectionStatistics::ObserveElementCollectionStatistics(
+    CkMigrateMessage* m)
+    : Event(m) {}
+
+void ObserveElementCollectionStatistics::pup(PUP::er& p) { Event::pup(p); }
+
+PUP::able::PUP_ID ObserveElementCollectionStatistics::my_PUP_ID =  // NOLINT
+    0;
+}  // namespace Events
@@ -0,0 +1,150 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <pup.h>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "IO/Observer/ObserverComponent.hpp"
+#include "IO/Observer/ReductionActions.hpp"
+#include "Options/String.hpp"
+#include "Parallel/ArrayCollection/BoundaryDataAggregator.hpp"
+#include "Parallel/ArrayCollection/ElementReadyQueues.hpp"
+#include "Parallel/ArrayCollection/IsDgElementCollection.hpp"
+#include "Parallel/ArrayCollection/Tags/BoundaryDataAggregator.hpp"
+#include "Parallel/ArrayCollection/Tags/ElementReadyQueues.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Info.hpp"
+#include "Parallel/Invoke.hpp"
+#include "ParallelAlgorithms/Actions/GetItemFromDistributedObject.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "Utilities/Serialization/CharmPupable.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace Events {
+/*!
+ * \brief Write how the elements of a `Parallel::DgElementCollection` were
+ * scheduled and how their boundary data was sent to other nodes.
+ *
+ * \details The first element on each node that runs this event takes the
+ * counters of the node since the last observation and writes them as one row
+ * per node to two subfiles:
+ * - `/ElementCollection/ReadyQueues.dat` holds the counters of the
+ *   `Parallel::ElementReadyQueues`. The columns are the number of elements
+ *   that were stolen from another core's queue, the number of elements that
+ *   were queued again because another thread held their lock, the number of
+ *   times a core found no work on the node, and the number of queued elements
+ *   that were moved forward by a more urgent message.
+ * - `/ElementCollection/BoundaryDataAggregator.dat` holds the statistics of
+ *   the `Parallel::BoundaryDataAggregator`. The columns are the number of
+ *   messages sent to other nodes and the number of pieces of boundary data and
+ *   payload bytes they held.
+ *
+ * Rows whose counters are all zero are not written.
+ *
+ * The event does nothing for elements that are not part of a
+ * `Parallel::DgElementCollection`.
+ */
+class ObserveElementCollectionStatistics : public Event {
+ public:
+  /// \cond
+  explicit ObserveElementCollectionStatistics(CkMigrateMessage* m);
+  using PUP::able::register_constructor;
+  WRAPPED_PUPable_decl_template(ObserveElementCollectionStatistics);  // NOLINT
+  /// \endcond
+
+  using options = tmpl::list<>;
+  static constexpr Options::String help = {
+      "Write how the elements of a nodegroup element collection were scheduled "
+      "and how their boundary data was sent to other nodes since the last "
+      "observation."};
+
+  ObserveElementCollectionStatistics() = default;
+
+  using compute_tags_for_observation_box = tmpl::list<>;
+
+  using return_tags = tmpl::list<>;
+  using argument_tags = tmpl::list<>;
+
+  template <typename ArrayIndex, typename ParallelComponent,
+            typename Metavariables>
+  void operator()(
+      [[maybe_unused]] Parallel::GlobalCache<Metavariables>& cache,
+      const ArrayIndex& /*array_index*/,
+      const ParallelComponent* const /*meta*/,
+      [[maybe_unused]] const ObservationValue& observation_value) const {
+    if constexpr (Parallel::is_dg_element_collection_v<ParallelComponent>) {
+      constexpr size_t dim = ArrayIndex::volume_dim;
+      auto& nodegroup =
+          Parallel::get_parallel_component<ParallelComponent>(cache);
+      auto& observer_writer = Parallel::get_parallel_component<
+          observers::ObserverWriter<Metavariables>>(cache);
+      const size_t my_node = Parallel::my_node<size_t>(cache);
+
+      const auto queue_statistics =
+          Parallel::local_synchronous_action<
+              Parallel::Actions::GetItemFromDistributedOject<
+                  Parallel::Tags::ElementReadyQueues<dim>>>(nodegroup)
+              ->take_statistics();
+      // Another element on this node may have already taken the statistics
+      if (queue_statistics.number_of_steals != 0 or
+          queue_statistics.number_of_retries != 0 or
+          queue_statistics.number_of_idle_pops != 0 or
+          queue_statistics.number_of_promotions != 0) {
+        Parallel::threaded_action<
+            observers::ThreadedActions::WriteReductionDataRow>(
+            // Node 0 is always the writer
+            observer_writer[0], "/ElementCollection/ReadyQueues",
+            ready_queues_legend_,
+            std::make_tuple(observation_value.value, my_node,
+                            queue_statistics.number_of_steals,
+                            queue_statistics.number_of_retries,
+                            queue_statistics.number_of_idle_pops,
+                            queue_statistics.number_of_promotions));
+      }
+
+      const auto aggregator_statistics =
+          Parallel::local_synchronous_action<
+              Parallel::Actions::GetItemFromDistributedOject<
+                  Parallel::Tags::BoundaryDataAggregator<dim>>>(nodegroup)
+              ->take_statistics();
+      if (aggregator_statistics.number_of_messages_sent != 0) {
+        Parallel::threaded_action<
+            observers::ThreadedActions::WriteReductionDataRow>(
+            observer_writer[0], "/ElementCollection/BoundaryDataAggregator",
+            aggregator_legend_,
+            std::make_tuple(observation_value.value, my_node,
+                            aggregator_statistics.number_of_messages_sent,
+                            aggregator_statistics.number_of_entries_sent,
+                            aggregator_statistics.number_of_bytes_sent));
+      }
+    }
+  }
+
+  using is_ready_argument_tags = tmpl::list<>;
+
+  template <typename Metavariables, typename ArrayIndex, typename Component>
+  bool is_ready(Parallel::GlobalCache<Metavariables>& /*cache*/,
+                const ArrayIndex& /*array_index*/,
+                const Component* const /*meta*/) const {
+    return true;
+  }
+
+  bool needs_evolved_variables() const override { return false; }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) override;
+
+ private:
+  const static inline std::vector<std::string> ready_queues_legend_{
+      {"Time", "Node", "NumberOfSteals", "NumberOfRetries", "NumberOfIdlePops",
+       "NumberOfPromotions"}};
+  const static inline std::vector<std::string> aggregator_legend_{
+      {"Time", "Node", "NumberOfMessagesSent", "NumberOfEntriesSent",
+       "NumberOfBytesSent"}};
+};
+}  // namespace Events
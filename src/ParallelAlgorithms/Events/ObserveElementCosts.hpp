@@ -0,0 +1,159 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <pup.h>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "Domain/ElementCostModel.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Tags.hpp"
+#include "Domain/Tags/ElementCostModel.hpp"
+#include "Evolution/DgSubcell/ActiveGrid.hpp"
+#include "Evolution/DgSubcell/Tags/ActiveGrid.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
+#include "IO/Observer/ReductionActions.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Options/String.hpp"
+#include "Parallel/ArrayCollection/IsDgElementCollection.hpp"
+#include "Parallel/ElementCosts.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/Local.hpp"
+#include "Parallel/TypeTraits.hpp"
+#include "ParallelAlgorithms/Actions/GetItemFromDistributedObject.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "Utilities/Serialization/CharmPupable.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace Events {
+/*!
+ * \brief Write the measured computational cost of every element, to
+ * distribute the elements by their cost in a later run.
+ *
+ * \details The cost of an element is the wall time it spent executing iterable
+ * actions since the previous observation (or since the start of the run), see
+ * `Parallel::DistributedObject::take_iterable_action_wall_time()`. Every
+ * element appends a row with the columns listed in
+ * `domain::ElementCostModel::legend()` to the subfile
+ * `domain::Tags::ElementCostModel::subfile_name()` of the reduction file: the
+ * time, the block, the extents of the DG mesh, whether the element evolved on
+ * the subcell grid at the time of the observation, and the cost.
+ *
+ * Pass the reduction file to the `ElementCostModel` option of the
+ * `Parallelization` group in a later run to distribute the elements by their
+ * mean measured cost, see `domain::get_element_costs()`. For the costs of the
+ * elements to be comparable, trigger this event at the same times on all
+ * elements, e.g. with a trigger on slabs, and skip the first observation,
+ * which includes the initialization.
+ *
+ * The elements of both the `DgElementArray` and the `DgElementCollection` are
+ * measured. The elements only time their actions once this event is
+ * constructed, see `Parallel::element_costs`, so runs that don't observe the
+ * costs don't read the clock around every action.
+ */
+template <size_t Dim>
+class ObserveElementCosts : public Event {
+ public:
+  /// \cond
+  explicit ObserveElementCosts(CkMigrateMessage* m) : Event(m) {
+    Parallel::element_costs::enable();
+  }
+  using PUP::able::register_constructor;
+  WRAPPED_PUPable_decl_template(ObserveElementCosts);  // NOLINT
+  /// \endcond
+
+  using options = tmpl::list<>;
+  static constexpr Options::String help = {
+      "Write the wall time every element spent in its actions since the last "
+      "observation, by block, extents and active grid, to balance the "
+      "elements of a later run with the ElementCostModel option."};
+
+  ObserveElementCosts() { Parallel::element_costs::enable(); }
+
+  using compute_tags_for_observation_box = tmpl::list<>;
+
+  using return_tags = tmpl::list<>;
+  using argument_tags = tmpl::list<::Tags::DataBox>;
+
+  template <typename DataBoxType, typename ArrayIndex,
+            typename ParallelComponent, typename Metavariables>
+  void operator()(const DataBoxType& box,
+                  Parallel::GlobalCache<Metavariables>& cache,
+                  const ArrayIndex& array_index,
+                  const ParallelComponent* const /*meta*/,
+                  const ObservationValue& observation_value) const {
+    if constexpr (Parallel::is_array_v<ParallelComponent> or
+                  Parallel::is_dg_element_collection_v<ParallelComponent>) {
+      double cost = 0.0;
+      if constexpr (Parallel::is_dg_element_collection_v<ParallelComponent>) {
+        // The element is locked by the thread running this event
+        cost = Parallel::local_synchronous_action<
+                   Parallel::Actions::GetItemFromDistributedOject<
+                       typename ParallelComponent::element_collection_tag>>(
+                   Parallel::get_parallel_component<ParallelComponent>(cache))
+                   ->at(array_index)
+                   .take_iterable_action_wall_time();
+      } else {
+        cost = Parallel::local(
+                   Parallel::get_parallel_component<ParallelComponent>(
+                       cache)[array_index])
+                   ->take_iterable_action_wall_time();
+      }
+      bool subcell_active = false;
+      if constexpr (db::tag_is_retrievable_v<
+                        evolution::dg::subcell::Tags::ActiveGrid,
+                        DataBoxType>) {
+        subcell_active =
+            db::get<evolution::dg::subcell::Tags::ActiveGrid>(box) ==
+            evolution::dg::subcell::ActiveGrid::Subcell;
+      }
+      const ElementId<Dim>& element_id = array_index;
+      const Mesh<Dim>& mesh = db::get<domain::Tags::Mesh<Dim>>(box);
+      std::vector<double> row{observation_value.value,
+                              static_cast<double>(element_id.block_id())};
+      for (size_t d = 0; d < Dim; ++d) {
+        row.push_back(static_cast<double>(mesh.extents(d)));
+      }
+      row.push_back(subcell_active ? 1.0 : 0.0);
+      row.push_back(cost);
+
+      auto& observer_writer = Parallel::get_parallel_component<
+          observers::ObserverWriter<Metavariables>>(cache);
+      Parallel::threaded_action<
+          observers::ThreadedActions::WriteReductionDataRow>(
+          observer_writer[0],
+          domain::Tags::ElementCostModel<Dim>::subfile_name(),
+          domain::ElementCostModel<Dim>::legend(),
+          std::make_tuple(std::move(row)));
+    } else {
+      (void)box;
+      (void)cache;
+      (void)array_index;
+      (void)observation_value;
+    }
+  }
+
+  using is_ready_argument_tags = tmpl::list<>;
+
+  template <typename Metavariables, typename ArrayIndex, typename Component>
+  bool is_ready(Parallel::GlobalCache<Metavariables>& /*cache*/,
+                const ArrayIndex& /*array_index*/,
+                const Component* const /*meta*/) const {
+    return true;
+  }
+
+  bool needs_evolved_variables() const override { return false; }
+};
+
+/// \cond
+template <size_t Dim>
+PUP::able::PUP_ID ObserveElementCosts<Dim>::my_PUP_ID = 0;  // NOLINT
+/// \endcond
+}  // namespace Events
@@ -0,0 +1,20 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "ParallelAlgorithms/Events/ObserveEventTimings.hpp"
+
+#include <pup.h>
+
+#include "ParallelAlgorithms/EventsAndTriggers/EventTimings.hpp"
+
+namespace Events {
+ObserveEventTimings::ObserveEventTimings() { event_timings::enable(); }
+
+ObserveEventTimings::ObserveEventTimings(CkMigrateMessage* m) : Event(m) {
+  event_timings::enable();
+}
+
+void ObserveEventTimings::pup(PUP::er& p) { Event::pup(p); }
+
+PUP::able::PUP_ID ObserveEventTimings::my_PUP_ID = 0;  // NOLINT
+}  // namespace Events
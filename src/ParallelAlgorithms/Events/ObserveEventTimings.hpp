@@ -0,0 +1,110 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <pup.h>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "IO/Observer/ObserverComponent.hpp"
+#include "IO/Observer/ReductionActions.hpp"
+#include "Options/String.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Info.hpp"
+#include "Parallel/Invoke.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/EventTimings.hpp"
+#include "Utilities/Serialization/CharmPupable.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace Events {
+/*!
+ * \brief Write the wall time spent running each event.
+ *
+ * \details Constructing this event enables `event_timings`, so events are
+ * only timed in runs that write the timings. The first element on each
+ * processing element (PE) that runs this event for an observation value takes
+ * the timings recorded in `event_timings` on that PE since the last
+ * observation and writes one row per event instance and PE to
+ * `/EventTimings/<Name>.dat`, where `<Name>` is the
+ * `event_timings::instance_name` of the event. The other elements on the PE
+ * write nothing for that observation value. The columns are the number of
+ * times the event ran on the PE, the total wall time and the longest single
+ * run. Since the compute items of the `ObservationBox` are shared by the
+ * events that run on the same step, their cost is part of the time of the
+ * first event that needs them. The time of this event itself is part of the
+ * next observation.
+ */
+class ObserveEventTimings : public Event {
+ public:
+  /// \cond
+  explicit ObserveEventTimings(CkMigrateMessage* m);
+  using PUP::able::register_constructor;
+  WRAPPED_PUPable_decl_template(ObserveEventTimings);  // NOLINT
+  /// \endcond
+
+  using options = tmpl::list<>;
+  static constexpr Options::String help = {
+      "Write the wall time spent running each event since the last "
+      "observation."};
+
+  ObserveEventTimings();
+
+  using compute_tags_for_observation_box = tmpl::list<>;
+
+  using return_tags = tmpl::list<>;
+  using argument_tags = tmpl::list<>;
+
+  template <typename ArrayIndex, typename ParallelComponent,
+            typename Metavariables>
+  void operator()(Parallel::GlobalCache<Metavariables>& cache,
+                  const ArrayIndex& /*array_index*/,
+                  const ParallelComponent* const /*meta*/,
+                  const ObservationValue& observation_value) const {
+    const std::optional<
+        std::unordered_map<std::string, event_timings::Statistics>>
+        all_statistics =
+            event_timings::take_statistics(observation_value.value);
+    // Another element on this PE has already taken the statistics for this
+    // observation
+    if (not all_statistics.has_value()) {
+      return;
+    }
+    auto& observer_writer = Parallel::get_parallel_component<
+        observers::ObserverWriter<Metavariables>>(cache);
+    for (const auto& [name, statistics] : *all_statistics) {
+      Parallel::threaded_action<
+          observers::ThreadedActions::WriteReductionDataRow>(
+          // Node 0 is always the writer
+          observer_writer[0], "/EventTimings/" + name, legend_,
+          std::make_tuple(observation_value.value,
+                          Parallel::my_proc<size_t>(cache),
+                          statistics.number_of_runs, statistics.wall_time,
+                          statistics.max_wall_time));
+    }
+  }
+
+  using is_ready_argument_tags = tmpl::list<>;
+
+  template <typename Metavariables, typename ArrayIndex, typename Component>
+  bool is_ready(Parallel::GlobalCache<Metavariables>& /*cache*/,
+                const ArrayIndex& /*array_index*/,
+                const Component* const /*meta*/) const {
+    return true;
+  }
+
+  bool needs_evolved_variables() const override { return false; }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) override;
+
+ private:
+  const static inline std::vector<std::string> legend_{
+      {"Time", "Proc", "NumberOfRuns", "WallTime", "MaxWallTime"}};
+};
+}  // namespace Events
@@ -0,0 +1,15 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "ParallelAlgorithms/Events/ObserveFunctionOfTimeStalls.hpp"
+
+#include <pup.h>
+
+namespace Events {
+ObserveFunctionOfTimeStalls::ObserveFunctionOfTimeStalls(CkMigrateMessage* m)
+    : Event(m) {}
+
+void ObserveFunctionOfTimeStalls::pup(PUP::er& p) { Event::pup(p); }
+
+PUP::able::PUP_ID ObserveFunctionOfTimeStalls::my_PUP_ID = 0;  // NOLINT
+}  // namespace Events
@@ -0,0 +1,100 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <pup.h>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include "IO/Observer/ObserverComponent.hpp"
+#include "IO/Observer/ReductionActions.hpp"
+#include "Options/String.hpp"
+#include "Parallel/CacheStalls.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Info.hpp"
+#include "Parallel/Invoke.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "Utilities/Serialization/CharmPupable.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace Events {
+/*!
+ * \brief Write how long elements waited for the control system to update each
+ * function of time.
+ *
+ * \details The first element on each processing element (PE) that runs this
+ * event takes the statistics of the waits that ended on that PE since the
+ * last observation, see `Parallel::cache_stalls`, and writes one row per
+ * function of time and PE to `/FunctionOfTimeStalls/<Name>.dat`. The columns
+ * are the number of times an element had to wait for an update and the total
+ * wall time elements waited.
+ */
+class ObserveFunctionOfTimeStalls : public Event {
+ public:
+  /// \cond
+  explicit ObserveFunctionOfTimeStalls(CkMigrateMessage* m);
+  using PUP::able::register_constructor;
+  WRAPPED_PUPable_decl_template(ObserveFunctionOfTimeStalls);  // NOLINT
+  /// \endcond
+
+  using options = tmpl::list<>;
+  static constexpr Options::String help = {
+      "Write how long elements waited for each function of time to be updated "
+      "since the last observation."};
+
+  ObserveFunctionOfTimeStalls() = default;
+
+  using compute_tags_for_observation_box = tmpl::list<>;
+
+  using return_tags = tmpl::list<>;
+  using argument_tags = tmpl::list<>;
+
+  template <typename ArrayIndex, typename ParallelComponent,
+            typename Metavariables>
+  void operator()(Parallel::GlobalCache<Metavariables>& cache,
+                  const ArrayIndex& /*array_index*/,
+                  const ParallelComponent* const /*meta*/,
+                  const ObservationValue& observation_value) const {
+    const std::unordered_map<std::string, Parallel::cache_stalls::Statistics>
+        all_statistics = Parallel::cache_stalls::take_statistics();
+    // Another element on this PE has already taken the statistics
+    if (all_statistics.empty()) {
+      return;
+    }
+    auto& observer_writer = Parallel::get_parallel_component<
+        observers::ObserverWriter<Metavariables>>(cache);
+    for (const auto& [name, statistics] : all_statistics) {
+      Parallel::threaded_action<
+          observers::ThreadedActions::WriteReductionDataRow>(
+          // Node 0 is always the writer
+          observer_writer[0], "/FunctionOfTimeStalls/" + name, legend_,
+          std::make_tuple(observation_value.value,
+                          Parallel::my_proc<size_t>(cache),
+                          statistics.number_of_stalls,
+                          statistics.stall_wall_time));
+    }
+  }
+
+  using is_ready_argument_tags = tmpl::list<>;
+
+  template <typename Metavariables, typename ArrayIndex, typename Component>
+  bool is_ready(Parallel::GlobalCache<Metavariables>& /*cache*/,
+                const ArrayIndex& /*array_index*/,
+                const Component* const /*meta*/) const {
+    return true;
+  }
+
+  bool needs_evolved_variables() const override { return false; }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) override;
+
+ private:
+  const static inline std::vector<std::string> legend_{
+      {"Time", "Proc", "NumberOfStalls", "StallWallTime"}};
+};
+}  // namespace Events
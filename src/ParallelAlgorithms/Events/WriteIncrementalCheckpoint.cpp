@@ -0,0 +1,23 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "ParallelAlgorithms/Events/WriteIncrementalCheckpoint.hpp"
+
+#include <pup.h>
+#include <string>
+#include <utility>
+
+namespace Events {
+WriteIncrementalCheckpoint::WriteIncrementalCheckpoint(CkMigrateMessage* m)
+    : Event(m) {}
+
+WriteIncrementalCheckpoint::WriteIncrementalCheckpoint(std::string file_prefix)
+    : file_prefix_(std::move(file_prefix)) {}
+
+void WriteIncrementalCheckpoint::pup(PUP::er& p) {
+  Event::pup(p);
+  p | file_prefix_;
+}
+
+PUP::able::PUP_ID WriteIncrementalCheckpoint::my_PUP_ID = 0;  // NOLINT
+}  // namespace Events
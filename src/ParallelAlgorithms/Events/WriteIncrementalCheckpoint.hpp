@@ -0,0 +1,164 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <pup.h>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/SerializeItems.hpp"
+#include "IO/Observer/Actions/IncrementalCheckpoint.hpp"
+#include "IO/Observer/IncrementalCheckpoint.hpp"
+#include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
+#include "IO/Observer/TypeOfObservation.hpp"
+#include "Options/String.hpp"
+#include "Parallel/ArrayComponentId.hpp"
+#include "Parallel/ArrayIndex.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Info.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/Local.hpp"
+#include "Parallel/TypeTraits.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "Utilities/GetOutput.hpp"
+#include "Utilities/Serialization/CharmPupable.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace Events {
+/*!
+ * \brief Write an incremental snapshot of the mutable DataBox items of every
+ * element to disk without stopping the evolution.
+ *
+ * \details Each element computes the `Fingerprint` of each of its mutable
+ * DataBox items and asks the `observers::IncrementalCheckpointWriter` of its
+ * node which items changed since the previous snapshot of the element. Only
+ * those items are serialized and handed to the writer, which appends them to
+ * the file `<FilePrefix>Node<node>.bin` in a background thread. The element
+ * continues its evolution right away. For an evolution, the changed items are
+ * mostly the evolved variables, their time stepper history and the mortar
+ * data.
+ *
+ * Once all elements registered with the observers for this event have written
+ * their snapshot, each node commits the snapshot to its file. Elements may be
+ * created and destroyed between snapshots, e.g. by mesh refinement.
+ *
+ * Unlike the `WriteCheckpoint` phase, this doesn't wait for the machine to
+ * become quiescent and doesn't serialize the other parallel components. The
+ * elements can be restored from the most recent snapshot that was committed on
+ * all nodes with `observers::Actions::RestoreFromIncrementalCheckpoint` in a
+ * run with the same elements on the same nodes.
+ *
+ * This event should be triggered at the same steps on all elements, e.g. with
+ * a trigger on slabs, so that the snapshots of all elements are at the same
+ * time.
+ */
+class WriteIncrementalCheckpoint : public Event {
+ public:
+  /// \cond
+  explicit WriteIncrementalCheckpoint(CkMigrateMessage* m);
+  using PUP::able::register_constructor;
+  WRAPPED_PUPable_decl_template(WriteIncrementalCheckpoint);  // NOLINT
+  /// \endcond
+
+  struct FilePrefix {
+    using type = std::string;
+    static constexpr Options::String help = {
+        "Prefix of the files the snapshots are written to. Each node writes "
+        "to its own file."};
+  };
+
+  using options = tmpl::list<FilePrefix>;
+  static constexpr Options::String help = {
+      "Write an incremental snapshot of the DataBox of every element to disk "
+      "in the background, only writing the items that changed since the "
+      "previous snapshot."};
+
+  WriteIncrementalCheckpoint() = default;
+  explicit WriteIncrementalCheckpoint(std::string file_prefix);
+
+  using compute_tags_for_observation_box = tmpl::list<>;
+
+  using return_tags = tmpl::list<>;
+  using argument_tags = tmpl::list<::Tags::DataBox>;
+
+  template <typename DataBoxType, typename ArrayIndex,
+            typename ParallelComponent, typename Metavariables>
+  void operator()(const DataBoxType& box,
+                  Parallel::GlobalCache<Metavariables>& cache,
+                  const ArrayIndex& array_index,
+                  const ParallelComponent* const /*meta*/,
+                  const ObservationValue& observation_value) const {
+    const std::string file_name = observers::incremental_checkpoint_file_name(
+        file_prefix_, Parallel::my_node<size_t>(cache));
+    std::string key = get_output(array_index);
+    auto& observer_writer = Parallel::get_parallel_component<
+        observers::ObserverWriter<Metavariables>>(cache);
+    observers::IncrementalCheckpointWriter* const writer =
+        Parallel::local_synchronous_action<
+            observers::Actions::GetIncrementalCheckpointWriter>(
+            observer_writer, file_name);
+    using excluded_tags =
+        observers::incremental_checkpoint_excluded_tags<Metavariables,
+                                                        ArrayIndex>;
+    const std::vector<std::string> changed_items = writer->changed_items(
+        key, db::fingerprint_mutable_items<excluded_tags>(box));
+    writer->write(
+        observation_value.value, std::move(key),
+        db::serialize_mutable_items<excluded_tags>(box, changed_items));
+
+    observers::ObservationId observation_id{observation_value.value,
+                                            file_prefix_ + ".bin"};
+    Parallel::ArrayComponentId array_component_id{
+        std::add_pointer_t<ParallelComponent>{nullptr},
+        Parallel::ArrayIndex<ArrayIndex>(array_index)};
+    if constexpr (Parallel::is_nodegroup_v<ParallelComponent>) {
+      Parallel::threaded_action<
+          observers::ThreadedActions::CommitIncrementalCheckpoint>(
+          *Parallel::local_branch(observer_writer), std::move(observation_id),
+          std::move(array_component_id), file_name);
+    } else {
+      auto& local_observer = *Parallel::local_branch(
+          Parallel::get_parallel_component<observers::Observer<Metavariables>>(
+              cache));
+      Parallel::simple_action<
+          observers::Actions::ContributeIncrementalCheckpoint>(
+          local_observer, std::move(observation_id),
+          std::move(array_component_id), file_name);
+    }
+  }
+
+  using observation_registration_tags = tmpl::list<>;
+  std::pair<observers::TypeOfObservation, observers::ObservationKey>
+  get_observation_type_and_key_for_registration() const {
+    // Each node commits its own file, so only the contributors on each node
+    // are counted, like for volume observations
+    return {observers::TypeOfObservation::Volume,
+            observers::ObservationKey{file_prefix_ + ".bin"}};
+  }
+
+  using is_ready_argument_tags = tmpl::list<>;
+
+  template <typename Metavariables, typename ArrayIndex, typename Component>
+  bool is_ready(Parallel::GlobalCache<Metavariables>& /*cache*/,
+                const ArrayIndex& /*array_index*/,
+                const Component* const /*meta*/) const {
+    return true;
+  }
+
+  // The snapshot must hold the state of the algorithm, not variables
+  // interpolated to a dense output time.
+  bool needs_evolved_variables() const override { return false; }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) override;
+
+ private:
+  std::string file_prefix_{};
+};
+}  // namespace Events
@@ -3,11 +3,18 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <limits>
+#include <mutex>
+#include <string>
+#include <type_traits>
+#include <utility>
 
 #include "DataStructures/DataBox/ObservationBox.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Tags/Metavariables.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/EventTimings.hpp"
 #include "Utilities/CallWithDynamicType.hpp"
 #include "Utilities/Serialization/CharmPupable.hpp"
 #include "Utilities/TMPL.hpp"
@@ -26,14 +33,27 @@ namespace Events {}
 /// may be observed. For example, in the scalar wave system the 1- and 2-index
 /// constraints would be added as compute tags, as well as anything they depend
 /// on that's not already in the `DataBox`.
+///
+/// If `event_timings::enabled()`, the wall time of every event that runs is
+/// recorded per instance on the running thread in `event_timings`.
 class Event : public PUP::able {
  protected:
   /// \cond
   Event() = default;
-  Event(const Event&) = default;
-  Event(Event&&) = default;
-  Event& operator=(const Event&) = default;
-  Event& operator=(Event&&) = default;
+  // The cached timing name is not copied, since it depends on the options of
+  // the derived event
+  Event(const Event& rhs) : PUP::able(rhs) {}
+  Event(Event&& rhs) : PUP::able(std::move(rhs)) {}
+  Event& operator=(const Event& rhs) {
+    PUP::able::operator=(rhs);
+    has_timing_name_.store(false, std::memory_order_relaxed);
+    return *this;
+  }
+  Event& operator=(Event&& rhs) {
+    PUP::able::operator=(std::move(rhs));
+    has_timing_name_.store(false, std::memory_order_relaxed);
+    return *this;
+  }
   /// \endcond
 
  public:
@@ -59,8 +79,18 @@ class Event : public PUP::able {
         typename std::decay_t<Metavariables>::factory_creation::factory_classes;
     call_with_dynamic_type<void, tmpl::at<factory_classes, Event>>(
         this, [&](auto* const event) {
+          if (not event_timings::enabled()) {
+            mutate_apply(*event, box, cache, array_index, ComponentPointer{},
+                         observation_value);
+            return;
+          }
+          const auto start = std::chrono::steady_clock::now();
           mutate_apply(*event, box, cache, array_index, ComponentPointer{},
                        observation_value);
+          event_timings::record(
+              timing_name(*event), std::chrono::duration<double>(
+                                       std::chrono::steady_clock::now() - start)
+                                       .count());
         });
   }
 
@@ -90,4 +120,22 @@ class Event : public PUP::able {
   /// the evolved variables may have an incorrect value when the event
   /// is run.
   virtual bool needs_evolved_variables() const = 0;
+
+ private:
+  // The `event_timings::instance_name` of this event. Computing it serializes
+  // the event, so it is only done once.
+  template <typename EventType>
+  const std::string& timing_name(const EventType& event) const {
+    if (not has_timing_name_.load(std::memory_order_acquire)) {
+      const std::lock_guard lock(event_timings::detail::name_mutex());
+      if (not has_timing_name_.load(std::memory_order_relaxed)) {
+        timing_name_ = event_timings::instance_name(event);
+        has_timing_name_.store(true, std::memory_order_release);
+      }
+    }
+    return timing_name_;
+  }
+
+  mutable std::atomic<bool> has_timing_name_{false};
+  mutable std::string timing_name_{};
 };
@@ -0,0 +1,57 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "ParallelAlgorithms/EventsAndTriggers/EventTimings.hpp"
+
+#include <atomic>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace event_timings {
+namespace {
+std::atomic<bool> timing_enabled{false};
+
+// The statistics of the instances that ran on this thread since the last
+// `take_statistics`
+thread_local std::unordered_map<std::string, Statistics> statistics_of_thread{};
+// The observation value this thread last took the statistics for
+thread_local std::optional<double> last_observation_value{};
+}  // namespace
+
+bool enabled() { return timing_enabled.load(std::memory_order_relaxed); }
+
+void enable() { timing_enabled.store(true, std::memory_order_relaxed); }
+
+void record(const std::string& name, const double wall_time) {
+  auto& statistics = statistics_of_thread[name];
+  ++statistics.number_of_runs;
+  statistics.wall_time += wall_time;
+  if (wall_time > statistics.max_wall_time) {
+    statistics.max_wall_time = wall_time;
+  }
+}
+
+std::unordered_map<std::string, Statistics> take_statistics() {
+  return std::exchange(statistics_of_thread, {});
+}
+
+std::optional<std::unordered_map<std::string, Statistics>> take_statistics(
+    const double observation_value) {
+  if (last_observation_value.has_value() and
+      *last_observation_value >= observation_value) {
+    return std::nullopt;
+  }
+  last_observation_value = observation_value;
+  return take_statistics();
+}
+
+namespace detail {
+std::mutex& name_mutex() {
+  static std::mutex mutex{};
+  return mutex;
+}
+}  // namespace detail
+}  // namespace event_timings
@@ -0,0 +1,88 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <mutex>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+
+#include "Utilities/PrettyType.hpp"
+#include "Utilities/Serialization/Fingerprint.hpp"
+
+/*!
+ * \ingroup EventsAndTriggersGroup
+ * \brief Wall time spent running each `Event` instance on each thread.
+ *
+ * \details `Event::run` records the time of every event it runs. The
+ * statistics are kept per event instance, named by `instance_name`, so two
+ * events of the same type with different options are timed separately.
+ * Compute items of the `ObservationBox` are evaluated lazily and shared by all
+ * events that run on the same step, so their cost is attributed to the first
+ * event that retrieves them.
+ *
+ * The statistics are accumulated on the thread that runs the event, i.e. per
+ * processing element (PE), so recording doesn't take a lock. `take_statistics`
+ * only returns the statistics of the calling thread. They are written by
+ * `Events::ObserveEventTimings`, and events are only timed if that event is
+ * used, see `enabled`.
+ */
+namespace event_timings {
+/// Statistics of one event instance since the last `take_statistics`.
+struct Statistics {
+  size_t number_of_runs{0};
+  double wall_time{0.0};
+  double max_wall_time{0.0};
+};
+
+/// \brief The name the statistics of the `event` are recorded under.
+///
+/// \details The name is the type of the event followed by a hash of its
+/// serialized options, so it is the same on all processes. Instances of the
+/// same type with the same options share a name and their statistics are
+/// combined.
+template <typename EventType>
+std::string instance_name(const EventType& event) {
+  std::stringstream ss{};
+  ss << pretty_type::name<EventType>() << "-" << std::hex << std::setw(8)
+     << std::setfill('0') << (fingerprint(event).fnv_hash & 0xffffffffU);
+  return ss.str();
+}
+
+/// \brief Whether `Event::run` times the events it runs.
+///
+/// \details Timing is off until `enable` is called, which
+/// `Events::ObserveEventTimings` does when it is constructed. Runs without
+/// that event therefore don't pay for reading the clock or naming the events.
+bool enabled();
+
+/// Time all events that run in this process from now on.
+void enable();
+
+/// Record that the event instance `name` ran for `wall_time` seconds on the
+/// calling thread.
+void record(const std::string& name, double wall_time);
+
+/// Return the statistics of all event instances that ran on the calling
+/// thread, keyed by `instance_name`, and reset them.
+std::unordered_map<std::string, Statistics> take_statistics();
+
+/// \brief Return the statistics of the calling thread and reset them, unless
+/// they were already taken on this thread for this or a later
+/// `observation_value`.
+///
+/// \details This makes only the first of the elements on a thread that run an
+/// observation take the statistics.
+std::optional<std::unordered_map<std::string, Statistics>> take_statistics(
+    double observation_value);
+
+namespace detail {
+// Serializes computing the names of event instances, see `Event::run`
+std::mutex& name_mutex();
+}  // namespace detail
+}  // namespace event_timings
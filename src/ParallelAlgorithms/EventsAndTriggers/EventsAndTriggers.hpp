@@ -6,6 +6,8 @@
 #include <memory>
 #include <optional>
 #include <pup.h>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include "DataStructures/DataBox/DataBox.hpp"
@@ -36,6 +38,14 @@ class EventsAndTriggers {
     using type = typename Event::compute_tags_for_observation_box;
   };
 
+  template <typename Metavariables>
+  using compute_tags = tmpl::remove_duplicates<tmpl::filter<
+      tmpl::flatten<tmpl::transform<
+          tmpl::at<typename Metavariables::factory_creation::factory_classes,
+                   Event>,
+          get_tags<tmpl::_1>>>,
+      db::is_compute_tag<tmpl::_1>>>;
+
  public:
   struct TriggerAndEvents {
     struct Trigger {
@@ -63,6 +73,13 @@ class EventsAndTriggers {
   EventsAndTriggers();
   explicit EventsAndTriggers(Storage events_and_triggers);
 
+  /// The `ObservationBox` holding the compute items of all events that can
+  /// run on an element with a `db::DataBox<DbTags>`.
+  template <typename DbTags, typename Metavariables>
+  using ObservationBoxType = decltype(make_observation_box<
+                                      compute_tags<Metavariables>>(
+      std::declval<gsl::not_null<db::DataBox<DbTags>*>>()));
+
   /// Check the triggers and run the associated events.
   ///
   /// By default the trigger check just calls the `is_triggered`
@@ -76,14 +93,31 @@ class EventsAndTriggers {
                   const ArrayIndex& array_index, const Component* component,
                   const Event::ObservationValue& observation_value,
                   const CheckTrigger& check_trigger = nullptr) const {
-    using compute_tags = tmpl::remove_duplicates<tmpl::filter<
-        tmpl::flatten<tmpl::transform<
-            tmpl::at<typename Metavariables::factory_creation::factory_classes,
-                     Event>,
-            get_tags<tmpl::_1>>>,
-        db::is_compute_tag<tmpl::_1>>>;
-    std::optional<decltype(make_observation_box<compute_tags>(box))>
-        observation_box{};
+    std::optional<ObservationBoxType<DbTags, Metavariables>> observation_box{};
+    run_events(make_not_null(&observation_box), box, cache, array_index,
+               component, observation_value, check_trigger);
+  }
+
+  /// \brief Check the triggers and run the associated events, sharing the
+  /// compute items of the `observation_box` with earlier calls.
+  ///
+  /// \details The `observation_box` is created when the first trigger fires
+  /// and is left in place, so the compute items evaluated by the events are
+  /// reused by later calls for the same state of the `box`, e.g. when running
+  /// the events triggered at steps and at slabs on the same step. The caller
+  /// must not mutate the `box` between such calls. Events that mutate the
+  /// `box` reset the `observation_box` themselves.
+  template <typename DbTags, typename Metavariables, typename ArrayIndex,
+            typename Component, typename CheckTrigger = std::nullptr_t>
+  void run_events(
+      const gsl::not_null<
+          std::optional<ObservationBoxType<DbTags, Metavariables>>*>
+          observation_box,
+      const gsl::not_null<db::DataBox<DbTags>*> box,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ArrayIndex& array_index, const Component* component,
+      const Event::ObservationValue& observation_value,
+      const CheckTrigger& check_trigger = nullptr) const {
     for (const auto& trigger_and_events : events_and_triggers_) {
       const auto& trigger = trigger_and_events.trigger;
       const auto& events = trigger_and_events.events;
@@ -96,11 +130,11 @@ class EventsAndTriggers {
         }
       }();
       if (is_triggered) {
-        if (not observation_box.has_value()) {
-          observation_box = make_observation_box<compute_tags>(box);
+        if (not observation_box->has_value()) {
+          observation_box->emplace(box);
         }
         for (const auto& event : events) {
-          event->run(make_not_null(&observation_box.value()), cache,
+          event->run(make_not_null(&observation_box->value()), cache,
                      array_index, component, observation_value);
         }
       }
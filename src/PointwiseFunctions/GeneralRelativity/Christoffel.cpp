@@ -3,6 +3,7 @@
 
 #include "PointwiseFunctions/GeneralRelativity/Christoffel.hpp"
 
+#include <array>
 #include <cstddef>
 
 #include "DataStructures/Tensor/Tensor.hpp"
@@ -12,21 +13,37 @@
 #include "Utilities/MakeWithValue.hpp"
 
 namespace gr {
+namespace {
+// For each independent component (c, a, b) of a tensor symmetric in its last
+// two indices, the storage indices of the components (a, b, c) and (b, a, c)
+template <typename TensorType>
+constexpr auto permuted_storage_indices() {
+  std::array<std::array<size_t, 2>, TensorType::size()> storage_indices{};
+  for (size_t r = 0; r < TensorType::size(); ++r) {
+    const auto cab = TensorType::structure::get_canonical_tensor_index(r);
+    gsl::at(storage_indices, r) = {
+        {TensorType::structure::get_storage_index(
+             std::array<size_t, 3>{{cab[1], cab[2], cab[0]}}),
+         TensorType::structure::get_storage_index(
+             std::array<size_t, 3>{{cab[2], cab[1], cab[0]}})}};
+  }
+  return storage_indices;
+}
+}  // namespace
+
 template <size_t SpatialDim, typename Frame, IndexType Index, typename DataType>
 void christoffel_first_kind(
     const gsl::not_null<tnsr::abb<DataType, SpatialDim, Frame, Index>*>
         christoffel,
     const tnsr::abb<DataType, SpatialDim, Frame, Index>& d_metric) {
-  constexpr auto dimensionality =
-      Index == IndexType::Spatial ? SpatialDim : SpatialDim + 1;
-  for (size_t k = 0; k < dimensionality; ++k) {
-    for (size_t i = 0; i < dimensionality; ++i) {
-      for (size_t j = i; j < dimensionality; ++j) {
-        christoffel->get(k, i, j) =
-            0.5 * (d_metric.get(i, j, k) + d_metric.get(j, i, k) -
-                   d_metric.get(k, i, j));
-      }
-    }
+  // Only the independent components are visited, with the storage indices of
+  // the permuted components of d_metric known at compile time
+  static constexpr auto storage_indices = permuted_storage_indices<
+      tnsr::abb<DataType, SpatialDim, Frame, Index>>();
+  for (size_t r = 0; r < d_metric.size(); ++r) {
+    const auto& permuted = gsl::at(storage_indices, r);
+    (*christoffel)[r] =
+        0.5 * (d_metric[permuted[0]] + d_metric[permuted[1]] - d_metric[r]);
   }
 }
 
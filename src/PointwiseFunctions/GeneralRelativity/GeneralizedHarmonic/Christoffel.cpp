@@ -3,6 +3,9 @@
 
 #include "PointwiseFunctions/GeneralRelativity/GeneralizedHarmonic/Christoffel.hpp"
 
+#include <array>
+#include <cstddef>
+
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
@@ -12,6 +15,69 @@
 #include "Utilities/SetNumberOfGridPoints.hpp"
 
 namespace gh {
+namespace {
+// Storage indices of the components used by `trace_christoffel`, computed at
+// compile time so that the sums over the symmetric index pairs only visit the
+// independent components.
+template <size_t SpatialDim, typename Frame>
+struct TraceChristoffelStorageIndices {
+  using pi_type = tnsr::aa<double, SpatialDim, Frame>;
+  using phi_type = tnsr::iaa<double, SpatialDim, Frame>;
+  using inverse_spacetime_metric_type = tnsr::AA<double, SpatialDim, Frame>;
+  using inverse_spatial_metric_type = tnsr::II<double, SpatialDim, Frame>;
+  static constexpr size_t number_of_pairs = pi_type::size();
+
+  // For each independent component (b, c) of Pi: g^{bc}, Phi_{ibc} and the
+  // factor 1/2 that is doubled for the off-diagonal components
+  std::array<size_t, number_of_pairs> inverse_spacetime_metric{};
+  std::array<std::array<size_t, SpatialDim>, number_of_pairs> phi_ibc{};
+  std::array<double, number_of_pairs> factors{};
+  // gamma^{ij}, Phi_{i(j+1)a} and Pi_{ba}
+  std::array<std::array<size_t, SpatialDim>, SpatialDim>
+      inverse_spatial_metric{};
+  std::array<std::array<std::array<size_t, SpatialDim + 1>, SpatialDim>,
+             SpatialDim>
+      phi_ija{};
+  std::array<std::array<size_t, SpatialDim + 1>, SpatialDim + 1> pi_ba{};
+
+  static constexpr TraceChristoffelStorageIndices compute() {
+    TraceChristoffelStorageIndices result{};
+    for (size_t p = 0; p < number_of_pairs; ++p) {
+      const auto bc = pi_type::structure::get_canonical_tensor_index(p);
+      gsl::at(result.inverse_spacetime_metric, p) =
+          inverse_spacetime_metric_type::structure::get_storage_index(bc);
+      gsl::at(result.factors, p) =
+          0.5 * static_cast<double>(pi_type::structure::multiplicity(p));
+      for (size_t i = 0; i < SpatialDim; ++i) {
+        gsl::at(gsl::at(result.phi_ibc, p), i) =
+            phi_type::structure::get_storage_index(
+                std::array<size_t, 3>{{i, bc[0], bc[1]}});
+      }
+    }
+    for (size_t i = 0; i < SpatialDim; ++i) {
+      for (size_t j = 0; j < SpatialDim; ++j) {
+        gsl::at(gsl::at(result.inverse_spatial_metric, i), j) =
+            inverse_spatial_metric_type::structure::get_storage_index(
+                std::array<size_t, 2>{{i, j}});
+        for (size_t a = 0; a < SpatialDim + 1; ++a) {
+          gsl::at(gsl::at(gsl::at(result.phi_ija, i), j), a) =
+              phi_type::structure::get_storage_index(
+                  std::array<size_t, 3>{{i, j + 1, a}});
+        }
+      }
+    }
+    for (size_t b = 0; b < SpatialDim + 1; ++b) {
+      for (size_t a = 0; a < SpatialDim + 1; ++a) {
+        gsl::at(gsl::at(result.pi_ba, b), a) =
+            pi_type::structure::get_storage_index(
+                std::array<size_t, 2>{{b, a}});
+      }
+    }
+    return result;
+  }
+};
+}  // namespace
+
 template <typename DataType, size_t SpatialDim, typename Frame>
 void christoffel_second_kind(
     const gsl::not_null<tnsr::Ijj<DataType, SpatialDim, Frame>*> christoffel,
@@ -69,54 +135,61 @@ void trace_christoffel(
     const tnsr::AA<DataType, SpatialDim, Frame>& inverse_spacetime_metric,
     const tnsr::aa<DataType, SpatialDim, Frame>& pi,
     const tnsr::iaa<DataType, SpatialDim, Frame>& phi) {
+  static constexpr auto indices =
+      TraceChristoffelStorageIndices<SpatialDim, Frame>::compute();
+  constexpr size_t number_of_pairs = indices.inverse_spacetime_metric.size();
   set_number_of_grid_points(trace, spacetime_normal_one_form);
-  get<0>(*trace) = 0.0;
-  // Compute common terms between components.
-  for (size_t b = 0; b < SpatialDim + 1; ++b) {
-    get<0>(*trace) -= 0.5 * pi.get(b, b) * inverse_spacetime_metric.get(b, b);
-    for (size_t i = 0; i < SpatialDim; ++i) {
-      get<0>(*trace) -= 0.5 * spacetime_normal_vector.get(i + 1) *
-                        phi.get(i, b, b) * inverse_spacetime_metric.get(b, b);
-    }
-    for (size_t c = b + 1; c < SpatialDim + 1; ++c) {
-      get<0>(*trace) -= pi.get(b, c) * inverse_spacetime_metric.get(b, c);
+  const size_t number_of_points =
+      get_size(get<0>(spacetime_normal_one_form));
+  // All components are computed at each grid point, so every input component
+  // is read once and each component of the result is written once.
+  for (size_t s = 0; s < number_of_points; ++s) {
+    // 1/2 g^{bc} (n^i Phi_{ibc} + Pi_{bc}) and 1/2 g^{bc} Phi_{ibc}, summed
+    // over the independent components of the symmetric pair
+    double normal_term = 0.0;
+    std::array<double, SpatialDim> phi_term{};
+    for (size_t p = 0; p < number_of_pairs; ++p) {
+      const double weighted_inverse_metric =
+          gsl::at(indices.factors, p) *
+          get_element(inverse_spacetime_metric[gsl::at(
+                          indices.inverse_spacetime_metric, p)],
+                      s);
+      double normal_dot_phi_plus_pi = get_element(pi[p], s);
       for (size_t i = 0; i < SpatialDim; ++i) {
-        get<0>(*trace) -= spacetime_normal_vector.get(i + 1) *
-                          phi.get(i, b, c) * inverse_spacetime_metric.get(b, c);
+        const double phi_ibc =
+            get_element(phi[gsl::at(gsl::at(indices.phi_ibc, p), i)], s);
+        normal_dot_phi_plus_pi +=
+            get_element(spacetime_normal_vector.get(i + 1), s) * phi_ibc;
+        gsl::at(phi_term, i) += weighted_inverse_metric * phi_ibc;
       }
+      normal_term += weighted_inverse_metric * normal_dot_phi_plus_pi;
     }
-  }
 
-  // Compute spatial components
-  for (size_t a = 1; a < SpatialDim + 1; ++a) {
-    trace->get(a) = spacetime_normal_one_form.get(a) * get<0>(*trace);
-    for (size_t i = 0; i < SpatialDim; ++i) {
-      for (size_t j = 0; j < SpatialDim; ++j) {
-        trace->get(a) +=
-            inverse_spatial_metric.get(i, j) * phi.get(i, j + 1, a);
+    for (size_t a = 0; a < SpatialDim + 1; ++a) {
+      double trace_a =
+          -get_element(spacetime_normal_one_form.get(a), s) * normal_term;
+      for (size_t i = 0; i < SpatialDim; ++i) {
+        for (size_t j = 0; j < SpatialDim; ++j) {
+          trace_a +=
+              get_element(inverse_spatial_metric[gsl::at(
+                              gsl::at(indices.inverse_spatial_metric, i), j)],
+                          s) *
+              get_element(phi[gsl::at(
+                              gsl::at(gsl::at(indices.phi_ija, i), j), a)],
+                          s);
+        }
       }
-    }
-    for (size_t b = 0; b < SpatialDim + 1; ++b) {
-      trace->get(a) += spacetime_normal_vector.get(b) * pi.get(b, a);
-      // a is always > 0 in this case so delta^i_a is taken care of.
-      trace->get(a) -=
-          0.5 * phi.get(a - 1, b, b) * inverse_spacetime_metric.get(b, b);
-      for (size_t c = b + 1; c < SpatialDim + 1; ++c) {
-        trace->get(a) -=
-            phi.get(a - 1, b, c) * inverse_spacetime_metric.get(b, c);
+      for (size_t b = 0; b < SpatialDim + 1; ++b) {
+        trace_a += get_element(spacetime_normal_vector.get(b), s) *
+                   get_element(pi[gsl::at(gsl::at(indices.pi_ba, b), a)], s);
       }
+      // delta^i_a is only non-zero for spatial a
+      if (a > 0) {
+        trace_a -= gsl::at(phi_term, a - 1);
+      }
+      get_element(trace->get(a), s) = trace_a;
     }
   }
-  // Now set 0 component
-  get<0>(*trace) *= get<0>(spacetime_normal_one_form);
-  for (size_t i = 0; i < SpatialDim; ++i) {
-    for (size_t j = 0; j < SpatialDim; ++j) {
-      get<0>(*trace) += inverse_spatial_metric.get(i, j) * phi.get(i, j + 1, 0);
-    }
-  }
-  for (size_t b = 0; b < SpatialDim + 1; ++b) {
-    get<0>(*trace) += spacetime_normal_vector.get(b) * pi.get(b, 0);
-  }
 }
 }  // namespace gh
 
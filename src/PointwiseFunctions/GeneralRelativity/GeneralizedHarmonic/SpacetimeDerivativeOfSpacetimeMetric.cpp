@@ -3,14 +3,51 @@
 
 #include "PointwiseFunctions/GeneralRelativity/GeneralizedHarmonic/SpacetimeDerivativeOfSpacetimeMetric.hpp"
 
+#include <array>
+#include <cstddef>
+
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/ContainerHelpers.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/SetNumberOfGridPoints.hpp"
 
 namespace gh {
+namespace {
+// For each independent component (a, b) of a symmetric rank-2 spacetime
+// tensor, the storage indices of the components (0, a, b) and (i + 1, a, b)
+// of the spacetime derivative and (i, a, b) of Phi
+template <size_t NumberOfPairs, size_t SpatialDim>
+struct StorageIndices {
+  std::array<size_t, NumberOfPairs> dt{};
+  std::array<std::array<size_t, SpatialDim>, NumberOfPairs> di{};
+  std::array<std::array<size_t, SpatialDim>, NumberOfPairs> phi{};
+};
+
+template <typename DerivType, typename PhiType, typename PiType,
+          size_t SpatialDim>
+constexpr auto compute_storage_indices() {
+  StorageIndices<PiType::size(), SpatialDim> result{};
+  for (size_t p = 0; p < PiType::size(); ++p) {
+    const auto ab = PiType::structure::get_canonical_tensor_index(p);
+    gsl::at(result.dt, p) = DerivType::structure::get_storage_index(
+        std::array<size_t, 3>{{0, ab[0], ab[1]}});
+    for (size_t i = 0; i < SpatialDim; ++i) {
+      gsl::at(gsl::at(result.di, p), i) =
+          DerivType::structure::get_storage_index(
+              std::array<size_t, 3>{{i + 1, ab[0], ab[1]}});
+      gsl::at(gsl::at(result.phi, p), i) =
+          PhiType::structure::get_storage_index(
+              std::array<size_t, 3>{{i, ab[0], ab[1]}});
+    }
+  }
+  return result;
+}
+}  // namespace
+
 template <typename DataType, size_t SpatialDim, typename Frame>
 void spacetime_derivative_of_spacetime_metric(
     const gsl::not_null<tnsr::abb<DataType, SpatialDim, Frame>*>
@@ -19,13 +56,30 @@ void spacetime_derivative_of_spacetime_metric(
     const tnsr::I<DataType, SpatialDim, Frame>& shift,
     const tnsr::aa<DataType, SpatialDim, Frame>& pi,
     const tnsr::iaa<DataType, SpatialDim, Frame>& phi) {
-  for (size_t a = 0; a < SpatialDim + 1; ++a) {
-    for (size_t b = a; b < SpatialDim + 1; ++b) {
-      da_spacetime_metric->get(0, a, b) = -pi.get(a, b) * get(lapse);
+  // Loop over the independent components of the symmetric pair only, with
+  // the storage indices known at compile time, and sum the shift terms at
+  // each grid point so that the time derivative is written once
+  static constexpr auto storage_indices =
+      compute_storage_indices<tnsr::abb<DataType, SpatialDim, Frame>,
+                              tnsr::iaa<DataType, SpatialDim, Frame>,
+                              tnsr::aa<DataType, SpatialDim, Frame>,
+                              SpatialDim>();
+  set_number_of_grid_points(da_spacetime_metric, lapse);
+  const size_t number_of_points = get_size(get(lapse));
+  for (size_t p = 0; p < pi.size(); ++p) {
+    const auto& phi_indices = gsl::at(storage_indices.phi, p);
+    auto& dt_component = (*da_spacetime_metric)[gsl::at(storage_indices.dt, p)];
+    for (size_t s = 0; s < number_of_points; ++s) {
+      double dt_value = -get_element(pi[p], s) * get_element(get(lapse), s);
       for (size_t i = 0; i < SpatialDim; ++i) {
-        da_spacetime_metric->get(0, a, b) += shift.get(i) * phi.get(i, a, b);
-        da_spacetime_metric->get(i + 1, a, b) = phi.get(i, a, b);
+        dt_value += get_element(shift.get(i), s) *
+                    get_element(phi[gsl::at(phi_indices, i)], s);
       }
+      get_element(dt_component, s) = dt_value;
+    }
+    for (size_t i = 0; i < SpatialDim; ++i) {
+      (*da_spacetime_metric)[gsl::at(gsl::at(storage_indices.di, p), i)] =
+          phi[gsl::at(phi_indices, i)];
     }
   }
 }
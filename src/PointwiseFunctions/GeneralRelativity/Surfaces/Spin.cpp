@@ -31,6 +31,9 @@
 
 // Functions used by gr::surfaces::dimensionful_spin_magnitude
 namespace {
+// The Pfaffian derivatives returned by ylm::Spherepack
+using FirstDeriv = ylm::Spherepack::FirstDeriv;
+
 // Find the 2D surface metric by inserting the tangents \f$\partial_\theta\f$
 // and \f$\partial_\phi\f$ into the slots of the 3D spatial metric
 template <typename Fr>
@@ -84,23 +87,37 @@ tnsr::I<DataVector, 2, Frame::Spherical<Fr>> get_trace_christoffel_second_kind(
   // reimplement this code to avoid dividing by sin(theta).
   //
   // Note: ylm::Spherepack gradients are flat-space Pfaffian derivatives.
-  auto grad_surface_metric_theta_theta =
-      ylm.gradient(square(get(sin_theta)) * get<0, 0>(surface_metric));
+  //
+  // The three components are differentiated in a single batched gradient.
+  const DataVector sin_theta_squared_metric_theta_theta =
+      square(get(sin_theta)) * get<0, 0>(surface_metric);
+  const DataVector sin_theta_metric_theta_phi =
+      get(sin_theta) * get<0, 1>(surface_metric);
+  FirstDeriv grad_surface_metric_theta_theta(ylm.physical_size());
+  FirstDeriv grad_surface_metric_theta_phi(ylm.physical_size());
+  FirstDeriv grad_surface_metric_phi_phi(ylm.physical_size());
+  ylm.gradient(
+      std::array<std::array<double*, 2>, 3>{
+          {{{get<0>(grad_surface_metric_theta_theta).data(),
+             get<1>(grad_surface_metric_theta_theta).data()}},
+           {{get<0>(grad_surface_metric_theta_phi).data(),
+             get<1>(grad_surface_metric_theta_phi).data()}},
+           {{get<0>(grad_surface_metric_phi_phi).data(),
+             get<1>(grad_surface_metric_phi_phi).data()}}}},
+      std::array<const double*, 3>{{sin_theta_squared_metric_theta_theta.data(),
+                                    sin_theta_metric_theta_phi.data(),
+                                    get<1, 1>(surface_metric).data()}});
+
   get<0>(grad_surface_metric_theta_theta) /= square(get(sin_theta));
   get<1>(grad_surface_metric_theta_theta) /= square(get(sin_theta));
   get<0>(grad_surface_metric_theta_theta) -=
       2.0 * get<0, 0>(surface_metric) * get(cos_theta) / get(sin_theta);
 
-  auto grad_surface_metric_theta_phi =
-      ylm.gradient(get(sin_theta) * get<0, 1>(surface_metric));
-
   get<0>(grad_surface_metric_theta_phi) /= get(sin_theta);
   get<1>(grad_surface_metric_theta_phi) /= get(sin_theta);
   get<0>(grad_surface_metric_theta_phi) -=
       get<0, 1>(surface_metric) * get(cos_theta) / get(sin_theta);
 
-  auto grad_surface_metric_phi_phi = ylm.gradient(get<1, 1>(surface_metric));
-
   auto deriv_surface_metric =
       make_with_value<tnsr::ijj<DataVector, 2, Frame::Spherical<Fr>>>(
           get<0, 0>(surface_metric), 0.0);
@@ -232,11 +249,15 @@ void get_left_and_right_eigenproblem_matrices(
                                      get(grad_ricci_scalar_dot_grad_yi);
 
       // Transform back to spectral space, to get one column each for the left
-      // and right matrices for the eigenvalue problem.
-      const DataVector left_matrix_yi_spectral =
-          ylm.phys_to_spec(get(left_matrix_yi_physical));
-      const DataVector right_matrix_yi_spectral =
-          ylm.phys_to_spec(get(laplacian_yi));
+      // and right matrices for the eigenvalue problem. Both columns are
+      // transformed in a single batched transform.
+      DataVector left_matrix_yi_spectral(ylm.spectral_size());
+      DataVector right_matrix_yi_spectral(ylm.spectral_size());
+      ylm.phys_to_spec(
+          std::array<double*, 2>{{left_matrix_yi_spectral.data(),
+                                  right_matrix_yi_spectral.data()}},
+          std::array<const double*, 2>{
+              {get(left_matrix_yi_physical).data(), get(laplacian_yi).data()}});
 
       // Set the current column of the left and right matrices
       // for the eigenproblem.
@@ -314,13 +335,19 @@ std::array<DataVector, 3> get_normalized_spin_potentials(
     const ylm::Spherepack& ylm, const Scalar<DataVector>& area_element) {
   const double area = ylm.definite_integral(get(area_element).data());
 
-  std::array<DataVector, 3> potentials;
+  // The three potentials are transformed in a single batched transform.
+  std::array<DataVector, 3> potentials{
+      {DataVector(ylm.physical_size()), DataVector(ylm.physical_size()),
+       DataVector(ylm.physical_size())}};
+  ylm.spec_to_phys(
+      std::array<double*, 3>{{potentials[0].data(), potentials[1].data(),
+                              potentials[2].data()}},
+      std::array<const double*, 3>{{eigenvectors_for_potentials[0].data(),
+                                    eigenvectors_for_potentials[1].data(),
+                                    eigenvectors_for_potentials[2].data()}});
 
   DataVector temp_integrand(get(area_element));
   for (size_t i = 0; i < 3; ++i) {
-    gsl::at(potentials, i) =
-        ylm.spec_to_phys(gsl::at(eigenvectors_for_potentials, i));
-
     temp_integrand = gsl::at(potentials, i) * get(area_element);
     const double potential_average =
         ylm.definite_integral(temp_integrand.data()) / area;
@@ -404,12 +431,22 @@ void spin_function(const gsl::not_null<Scalar<DataVector>*> result,
   get(extrinsic_curvature_theta_normal_sin_theta) *= sin_theta;
   get(extrinsic_curvature_phi_normal) *= sin_theta;
 
-  // now computing actual result
-  get(*result) = (get<0>(strahlkorper.ylm_spherepack().gradient(
-                      get(extrinsic_curvature_phi_normal))) -
-                  get<1>(strahlkorper.ylm_spherepack().gradient(
-                      get(extrinsic_curvature_theta_normal_sin_theta)))) /
-                 (sin_theta * get(area_element));
+  // now computing actual result, differentiating both terms in a single
+  // batched gradient
+  const auto& spherepack = strahlkorper.ylm_spherepack();
+  FirstDeriv grad_phi_normal(spherepack.physical_size());
+  FirstDeriv grad_theta_normal_sin_theta(spherepack.physical_size());
+  spherepack.gradient(
+      std::array<std::array<double*, 2>, 2>{
+          {{{get<0>(grad_phi_normal).data(), get<1>(grad_phi_normal).data()}},
+           {{get<0>(grad_theta_normal_sin_theta).data(),
+             get<1>(grad_theta_normal_sin_theta).data()}}}},
+      std::array<const double*, 2>{
+          {get(extrinsic_curvature_phi_normal).data(),
+           get(extrinsic_curvature_theta_normal_sin_theta).data()}});
+  get(*result) =
+      (get<0>(grad_phi_normal) - get<1>(grad_theta_normal_sin_theta)) /
+      (sin_theta * get(area_element));
 }
 
 template <typename Frame>
@@ -15,6 +15,7 @@
 
 #include "DataStructures/CircularDeque.hpp"
 #include "DataStructures/MathWrapper.hpp"
+#include "DataStructures/MemoryTracking.hpp"
 #include "Time/History.hpp"
 #include "Time/TimeStepId.hpp"
 #include "Utilities/Algorithm.hpp"
@@ -465,6 +466,8 @@ auto BoundaryHistory<LocalData, RemoteData, CouplingResult>::EvaluatorImpl<
                              [remote_id.substep()][local_step_offset]
                              [local_id.substep()];
   if (not coupling_entry.has_value()) {
+    const memory_tracking::ScopedGroup tracked_group{
+        memory_tracking::Group::Mortars};
     coupling_entry.emplace(coupling_(
         local_entry->substeps[local_id.substep()].data,
         remote_entry->substeps[remote_id.substep()].data));
@@ -488,6 +491,8 @@ void BoundaryHistory<LocalData, RemoteData,
 
 template <typename LocalData, typename RemoteData, typename CouplingResult>
 void BoundaryHistory<LocalData, RemoteData, CouplingResult>::pup(PUP::er& p) {
+  const memory_tracking::ScopedGroup tracked_group{
+      memory_tracking::Group::Mortars};
   p | local_data_;
   p | remote_data_;
   p | couplings_;
@@ -13,6 +13,7 @@
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/MathWrapper.hpp"
+#include "DataStructures/MemoryTracking.hpp"
 #include "DataStructures/StaticDeque.hpp"
 #include "Time/TimeStepId.hpp"
 #include "Utilities/ContainsAllocations.hpp"
@@ -889,6 +890,8 @@ void History<Vars>::map_entries(F&& func) {
 
 template <typename Vars>
 void History<Vars>::pup(PUP::er& p) {
+  const memory_tracking::ScopedGroup tracked_group{
+      memory_tracking::Group::TimeStepperHistory};
   p | integration_order_;
   p | step_values_;
   p | substep_values_;
@@ -948,6 +951,8 @@ void History<Vars>::insert_impl(const TimeStepId& time_step_id,
          "New entry at " << time_step_id
          << " must be later than previous entry at "
          << this->back().time_step_id);
+  const memory_tracking::ScopedGroup tracked_group{
+      memory_tracking::Group::TimeStepperHistory};
   discard_value(&latest_value_if_discarded_);
   StepRecord<Vars> record{};
   record.time_step_id = time_step_id;
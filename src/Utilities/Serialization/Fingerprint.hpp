@@ -0,0 +1,96 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines the fingerprint function.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <pup.h>
+
+/*!
+ * \ingroup ParallelGroup
+ * \brief A short summary of the serialized representation of an object, used
+ * to detect whether the object changed without keeping a copy of it.
+ *
+ * \details Holds the size of the serialized representation and two independent
+ * 64-bit hashes of its bytes (FNV-1a and a multiply-rotate hash). The hashes
+ * are not cryptographic, but a change of the object is only missed if both
+ * hashes and the size collide, which for accidental changes happens with a
+ * probability of order \f$2^{-64}\f$ or less.
+ */
+struct Fingerprint {
+  uint64_t size{0};
+  uint64_t fnv_hash{0};
+  uint64_t mix_hash{0};
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) {
+    p | size;
+    p | fnv_hash;
+    p | mix_hash;
+  }
+};
+
+inline bool operator==(const Fingerprint& lhs, const Fingerprint& rhs) {
+  return lhs.size == rhs.size and lhs.fnv_hash == rhs.fnv_hash and
+         lhs.mix_hash == rhs.mix_hash;
+}
+
+inline bool operator!=(const Fingerprint& lhs, const Fingerprint& rhs) {
+  return not(lhs == rhs);
+}
+
+namespace Serialization_detail {
+// A PUP::er in packing mode that hashes the bytes instead of storing them
+class FingerprintPupper : public PUP::er {
+ public:
+  FingerprintPupper() : PUP::er(IS_PACKING) {}
+
+  const Fingerprint& fingerprint() const { return fingerprint_; }
+
+ protected:
+  void bytes(void* p, size_t n, size_t item_size,
+             PUP::dataType /*t*/) override {
+    const size_t number_of_bytes = n * item_size;
+    const auto* const data = static_cast<const unsigned char*>(p);
+    for (size_t i = 0; i < number_of_bytes; ++i) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      const uint64_t byte = data[i];
+      fingerprint_.fnv_hash =
+          (fingerprint_.fnv_hash ^ byte) * uint64_t{0x100000001b3};
+      fingerprint_.mix_hash =
+          (fingerprint_.mix_hash + byte + 1) * uint64_t{0x9e3779b97f4a7c15};
+      fingerprint_.mix_hash ^= fingerprint_.mix_hash >> 29;
+    }
+    fingerprint_.size += number_of_bytes;
+  }
+
+ private:
+  Fingerprint fingerprint_{0, 0xcbf29ce484222325, 0};
+};
+}  // namespace Serialization_detail
+
+/*!
+ * \ingroup ParallelGroup
+ * \brief Compute the `Fingerprint` of the serialized representation of an
+ * object using PUP.
+ *
+ * \details The object is serialized as by `serialize`, but the bytes are hashed
+ * as they are produced instead of being stored, so this doesn't allocate a
+ * buffer for the serialized object.
+ *
+ * \tparam T type to serialize as
+ */
+template <typename T>
+Fingerprint fingerprint(const T& obj) {
+  // pup routine is non-const, but shouldn't modify anything in serialization
+  // mode.
+  // clang-tidy: do not use const_cast
+  auto& mut_obj = const_cast<T&>(obj);  // NOLINT
+  Serialization_detail::FingerprintPupper pupper{};
+  pupper | mut_obj;
+  return pupper.fingerprint();
+}
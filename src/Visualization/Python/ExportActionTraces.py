@@ -0,0 +1,118 @@
+#!/usr/bin/env python
+
+# Distributed under the MIT License.
+# See LICENSE.txt for details.
+
+import json
+import logging
+from typing import Sequence
+
+import click
+import h5py
+
+from spectre.support.CliExceptions import RequiredChoiceError
+from spectre.Visualization.ReadH5 import available_subfiles, to_dataframe
+
+logger = logging.getLogger(__name__)
+
+# The names of the values in the "Type" column of the events, see
+# `Parallel::tracing::EventType`
+EVENT_TYPES = [
+    "IterableAction",
+    "RetriedIterableAction",
+    "SimpleAction",
+    "ThreadedAction",
+    "ReceiveData",
+    "Phase",
+]
+
+
+def action_trace_events(h5file: h5py.File) -> list:
+    """Convert the traced events in a reductions file to Chrome trace events
+
+    Reads all "Events.dat" subfiles in the "/ActionTraces" group, which are
+    written by `Events::ObserveActionTraces`. Each event becomes a complete
+    ("X") event in the Chrome trace format, with the node as process ID and the
+    core as thread ID.
+
+    Arguments:
+      h5file: The open reductions file.
+
+    Returns: List of Chrome trace events.
+    """
+    action_traces = h5file.get("ActionTraces")
+    if action_traces is None:
+        raise RequiredChoiceError(
+            f"Unable to open group 'ActionTraces' from h5 file {h5file}.",
+            choices=available_subfiles(h5file, extension=".dat"),
+        )
+    trace_events = []
+    for component_name, component in action_traces.items():
+        if not isinstance(component, h5py.Group):
+            continue
+        for name, subfiles in component.items():
+            events_subfile = subfiles.get("Events.dat")
+            if events_subfile is None:
+                continue
+            events = to_dataframe(events_subfile)
+            for _, event in events.iterrows():
+                trace_events.append(
+                    {
+                        "name": name,
+                        "cat": EVENT_TYPES[int(event["Type"])],
+                        "ph": "X",
+                        # Chrome traces are in microseconds
+                        "ts": event["Start"] * 1.0e6,
+                        "dur": event["Duration"] * 1.0e6,
+                        "pid": int(event["Node"]),
+                        "tid": int(event["Core"]),
+                        "args": {
+                            "Component": component_name,
+                            "QueueWait": event["QueueWait"],
+                        },
+                    }
+                )
+    return trace_events
+
+
+@click.command(name="export-action-traces")
+@click.argument(
+    "reduction_files",
+    type=click.Path(exists=True, file_okay=True, dir_okay=False, readable=True),
+    nargs=-1,
+    required=True,
+)
+@click.option(
+    "--output",
+    "-o",
+    type=click.Path(writable=True),
+    required=True,
+    help="Output JSON file.",
+)
+def export_action_traces_command(reduction_files: Sequence[str], output: str):
+    """Export traced actions to a Chrome/Perfetto trace
+
+    Reads the events written by the 'ObserveActionTraces' event from the
+    "/ActionTraces" group in the REDUCTION_FILES and writes them to a JSON file
+    in the Chrome trace event format. Open the file in https://ui.perfetto.dev
+    or chrome://tracing to inspect which actions ran on which node and core at
+    what time.
+
+    The events are only written if the simulation was built with
+    SPECTRE_ACTION_TRACING and 'ObserveActionTraces' was triggered with
+    'WriteEvents: True'.
+    """
+    trace_events = []
+    for reduction_file in reduction_files:
+        with h5py.File(reduction_file, "r") as open_h5file:
+            trace_events.extend(action_trace_events(open_h5file))
+    logger.info(f"Exporting {len(trace_events)} events to '{output}'.")
+    with open(output, "w") as open_output_file:
+        json.dump(
+            {"traceEvents": trace_events, "displayTimeUnit": "ms"},
+            open_output_file,
+        )
+
+
+if __name__ == "__main__":
+    export_action_traces_command(help_option_names=["-h", "--help"])
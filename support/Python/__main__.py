@@ -25,6 +25,7 @@ class Cli(click.MultiCommand):
             "clean-output",
             "combine-h5",
             "delete-subfiles",
+            "export-action-traces",
             "extend-connectivity",
             "extract-dat",
             "extract-input",
@@ -66,6 +67,12 @@ class Cli(click.MultiCommand):
             from spectre.IO.H5.DeleteSubfiles import delete_subfiles_command
 
             return delete_subfiles_command
+        elif name == "export-action-traces":
+            from spectre.Visualization.ExportActionTraces import (
+                export_action_traces_command,
+            )
+
+            return export_action_traces_command
         elif name == "extend-connectivity":
             from spectre.IO.H5.ExtendConnectivityData import (
                 extend_connectivity_data_command,
@@ -0,0 +1,109 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/SerializeItems.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/TypeAliases.hpp"
+#include "DataStructures/Variables.hpp"
+#include "DataStructures/VariablesTag.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Serialization/Fingerprint.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+struct Scalar1 : db::SimpleTag {
+  using type = Scalar<DataVector>;
+};
+struct Scalar2 : db::SimpleTag {
+  using type = Scalar<DataVector>;
+};
+struct Counter : db::SimpleTag {
+  using type = int;
+};
+struct TwiceCounter : db::SimpleTag {
+  using type = int;
+};
+struct TwiceCounterCompute : TwiceCounter, db::ComputeTag {
+  using base = TwiceCounter;
+  using return_type = int;
+  using argument_tags = tmpl::list<Counter>;
+  static void function(const gsl::not_null<int*> result, const int counter) {
+    *result = 2 * counter;
+  }
+};
+using vars_tag = Tags::Variables<tmpl::list<Scalar1, Scalar2>>;
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.DataStructures.DataBox.SerializeItems",
+                  "[Unit][DataStructures]") {
+  using vars_type = typename vars_tag::type;
+  auto box = db::create<db::AddSimpleTags<Counter, vars_tag>,
+                        db::AddComputeTags<TwiceCounterCompute>>(
+      3, vars_type{4, 1.5});
+
+  const auto items = db::serialize_mutable_items(box);
+  // Only the mutable items that aren't subitems are serialized
+  CHECK(items.size() == 2);
+  CHECK(items.count(db::tag_name<Counter>()) == 1);
+  CHECK(items.count(db::tag_name<vars_tag>()) == 1);
+  CHECK(items.count(db::tag_name<Scalar1>()) == 0);
+  CHECK(items.count(db::tag_name<TwiceCounter>()) == 0);
+  CHECK(db::serialize_mutable_items(
+            box, {db::tag_name<Counter>(), db::tag_name<Scalar1>()}) ==
+        std::map<std::string, std::vector<char>>{
+            {db::tag_name<Counter>(), items.at(db::tag_name<Counter>())}});
+
+  CHECK(db::serialize_mutable_items<tmpl::list<Counter>>(box) ==
+        std::map<std::string, std::vector<char>>{
+            {db::tag_name<vars_tag>(), items.at(db::tag_name<vars_tag>())}});
+  CHECK(db::fingerprint_mutable_items<tmpl::list<Counter>>(box).count(
+            db::tag_name<Counter>()) == 0);
+
+  const auto fingerprints = db::fingerprint_mutable_items(box);
+  CHECK(fingerprints.size() == 2);
+  CHECK(fingerprints.at(db::tag_name<vars_tag>()) ==
+        fingerprint(db::get<vars_tag>(box)));
+  CHECK(fingerprints.at(db::tag_name<Counter>()).size ==
+        items.at(db::tag_name<Counter>()).size());
+
+  db::mutate<Counter, vars_tag>(
+      [](const gsl::not_null<int*> counter,
+         const gsl::not_null<vars_type*> vars) {
+        *counter = 7;
+        vars->initialize(2, -1.0);
+      },
+      make_not_null(&box));
+  CHECK(db::get<TwiceCounter>(box) == 14);
+
+  // Only restore the Variables
+  db::deserialize_mutable_items(
+      make_not_null(&box),
+      std::map<std::string, std::vector<char>>{
+          {db::tag_name<vars_tag>(), items.at(db::tag_name<vars_tag>())},
+          {"NotAnItem", {}}});
+  CHECK(db::get<Counter>(box) == 7);
+  CHECK(db::get<vars_tag>(box) == vars_type{4, 1.5});
+  CHECK(get(db::get<Scalar2>(box)) == DataVector{4, 1.5});
+  CHECK(db::fingerprint_mutable_items(box).at(db::tag_name<vars_tag>()) ==
+        fingerprints.at(db::tag_name<vars_tag>()));
+  CHECK(db::fingerprint_mutable_items(box).at(db::tag_name<Counter>()) !=
+        fingerprints.at(db::tag_name<Counter>()));
+
+  // Excluded items are never restored
+  db::deserialize_mutable_items<tmpl::list<Counter>>(make_not_null(&box),
+                                                     items);
+  CHECK(db::get<Counter>(box) == 7);
+
+  db::deserialize_mutable_items(make_not_null(&box), items);
+  CHECK(db::get<Counter>(box) == 3);
+  CHECK(db::get<TwiceCounter>(box) == 6);
+  CHECK(db::serialize_mutable_items(box) == items);
+}
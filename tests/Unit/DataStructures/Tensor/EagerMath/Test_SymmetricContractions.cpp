@@ -0,0 +1,127 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <random>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/EagerMath/SymmetricContractions.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/MakeWithValue.hpp"
+
+namespace {
+template <typename DataType, size_t Dim>
+void test_contractions(const DataType& used_for_size) {
+  using lower_index = SpacetimeIndex<Dim, UpLo::Lo, Frame::Inertial>;
+  MAKE_GENERATOR(generator);
+  std::uniform_real_distribution<> dist(-1.0, 1.0);
+  const auto nn_generator = make_not_null(&generator);
+  const auto nn_dist = make_not_null(&dist);
+
+  const auto inverse_metric =
+      make_with_random_values<tnsr::AA<DataType, Dim, Frame::Inertial>>(
+          nn_generator, nn_dist, used_for_size);
+  const auto vector =
+      make_with_random_values<tnsr::I<DataType, Dim, Frame::Inertial>>(
+          nn_generator, nn_dist, used_for_size);
+  const auto rank_three =
+      make_with_random_values<tnsr::abb<DataType, Dim, Frame::Inertial>>(
+          nn_generator, nn_dist, used_for_size);
+  const auto phi =
+      make_with_random_values<tnsr::iaa<DataType, Dim, Frame::Inertial>>(
+          nn_generator, nn_dist, used_for_size);
+  const auto rank_four =
+      make_with_random_values<tnsr::abcc<DataType, Dim, Frame::Inertial>>(
+          nn_generator, nn_dist, used_for_size);
+  const auto symmetric_rank_four =
+      make_with_random_values<Tensor<DataType, Symmetry<2, 2, 1, 1>,
+                                     index_list<lower_index, lower_index,
+                                                lower_index, lower_index>>>(
+          nn_generator, nn_dist, used_for_size);
+
+  {
+    tnsr::a<DataType, Dim, Frame::Inertial> result{};
+    contract_last_symmetric_pair(make_not_null(&result), rank_three,
+                                 inverse_metric);
+    auto expected =
+        make_with_value<tnsr::a<DataType, Dim, Frame::Inertial>>(
+            used_for_size, 0.0);
+    for (size_t a = 0; a < Dim + 1; ++a) {
+      for (size_t b = 0; b < Dim + 1; ++b) {
+        for (size_t c = 0; c < Dim + 1; ++c) {
+          expected.get(a) += rank_three.get(a, b, c) * inverse_metric.get(b, c);
+        }
+      }
+    }
+    CHECK_ITERABLE_APPROX(result, expected);
+  }
+  {
+    tnsr::ab<DataType, Dim, Frame::Inertial> result{};
+    contract_last_symmetric_pair(make_not_null(&result), rank_four,
+                                 inverse_metric);
+    auto expected =
+        make_with_value<tnsr::ab<DataType, Dim, Frame::Inertial>>(
+            used_for_size, 0.0);
+    for (size_t a = 0; a < Dim + 1; ++a) {
+      for (size_t b = 0; b < Dim + 1; ++b) {
+        for (size_t c = 0; c < Dim + 1; ++c) {
+          for (size_t d = 0; d < Dim + 1; ++d) {
+            expected.get(a, b) +=
+                rank_four.get(a, b, c, d) * inverse_metric.get(c, d);
+          }
+        }
+      }
+    }
+    CHECK_ITERABLE_APPROX(result, expected);
+  }
+  {
+    tnsr::aa<DataType, Dim, Frame::Inertial> result{};
+    contract_last_symmetric_pair(make_not_null(&result), symmetric_rank_four,
+                                 inverse_metric);
+    auto expected =
+        make_with_value<tnsr::aa<DataType, Dim, Frame::Inertial>>(
+            used_for_size, 0.0);
+    for (size_t a = 0; a < Dim + 1; ++a) {
+      for (size_t b = a; b < Dim + 1; ++b) {
+        for (size_t c = 0; c < Dim + 1; ++c) {
+          for (size_t d = 0; d < Dim + 1; ++d) {
+            expected.get(a, b) +=
+                symmetric_rank_four.get(a, b, c, d) * inverse_metric.get(c, d);
+          }
+        }
+      }
+    }
+    CHECK_ITERABLE_APPROX(result, expected);
+  }
+  {
+    tnsr::aa<DataType, Dim, Frame::Inertial> result{};
+    contract_first_index(make_not_null(&result), vector, phi);
+    auto expected =
+        make_with_value<tnsr::aa<DataType, Dim, Frame::Inertial>>(
+            used_for_size, 0.0);
+    for (size_t i = 0; i < Dim; ++i) {
+      for (size_t a = 0; a < Dim + 1; ++a) {
+        for (size_t b = a; b < Dim + 1; ++b) {
+          expected.get(a, b) += vector.get(i) * phi.get(i, a, b);
+        }
+      }
+    }
+    CHECK_ITERABLE_APPROX(result, expected);
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.DataStructures.Tensor.EagerMath.SymmetricContractions",
+                  "[DataStructures][Unit]") {
+  test_contractions<double, 1>(0.0);
+  test_contractions<double, 2>(0.0);
+  test_contractions<double, 3>(0.0);
+  const DataVector used_for_size(5);
+  test_contractions<DataVector, 1>(used_for_size);
+  test_contractions<DataVector, 2>(used_for_size);
+  test_contractions<DataVector, 3>(used_for_size);
+}
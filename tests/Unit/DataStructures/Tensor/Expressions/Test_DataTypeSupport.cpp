@@ -17,6 +17,7 @@
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/VectorImpl.hpp"
 #include "Helpers/DataStructures/CustomStaticSizeVector.hpp"
+#include "Utilities/Simd/Simd.hpp"
 #include "Utilities/TMPL.hpp"
 
 namespace {
@@ -508,4 +509,27 @@ SPECTRE_TEST_CASE("Unit.DataStructures.Tensor.Expression.DataTypeSupport",
   test_tensorexpression_binop_datatypes_are_supported<
       tensor_expression<ComplexDataVector>,
       tensor_expression<ComplexDataVector>>(true);
+
+#ifdef SPECTRE_USE_XSIMD
+  // Test support for `Tensor`s holding `simd::batch<double>`
+  using SimdType = simd::batch<double>;
+  test_is_supported_tensor_datatype<true, tmpl::list<SimdType>>();
+  test_is_supported_number_datatype<false, tmpl::list<SimdType>>();
+  test_is_assignable<SimdType, SimdType>(true);
+  test_is_assignable<SimdType, double>(true);
+  test_is_assignable<double, SimdType>(false);
+  test_is_assignable<SimdType, DataVector>(false);
+  test_binop_datatype_support<SimdType, SimdType, SimdType>();
+  test_binop_datatype_support<SimdType, double, SimdType>();
+  test_binop_datatype_support<double, SimdType, SimdType>();
+  test_binop_datatype_support<SimdType, DataVector, NoSuchType>();
+  test_tensor_binop_datatypes_are_supported<SimdType, SimdType>(true);
+  test_tensor_binop_datatypes_are_supported<SimdType, double>(false);
+  test_tensorexpression_binop_datatypes_are_supported<
+      tensor_expression<SimdType>, number_expression<double>>(true);
+  test_tensorexpression_binop_datatypes_are_supported<
+      tensor_expression<SimdType>, tensor_expression<SimdType>>(true);
+  test_tensorexpression_binop_datatypes_are_supported<
+      tensor_expression<SimdType>, tensor_expression<DataVector>>(false);
+#endif  // SPECTRE_USE_XSIMD
 }
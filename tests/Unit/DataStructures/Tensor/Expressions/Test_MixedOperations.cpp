@@ -3,6 +3,7 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <array>
 #include <climits>
 #include <complex>
 #include <cstddef>
@@ -12,6 +13,7 @@
 #include "DataStructures/ComplexDataVector.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tags/TempTensor.hpp"
+#include "DataStructures/Tensor/Metafunctions.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
 #include "DataStructures/VectorImpl.hpp"
@@ -19,6 +21,7 @@
 #include "Helpers/DataStructures/MakeWithRandomValues.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeWithValue.hpp"
+#include "Utilities/Simd/Simd.hpp"
 #include "Utilities/TMPL.hpp"
 
 namespace {
@@ -955,6 +958,88 @@ void test_mixed_operations(const gsl::not_null<Generator*> generator,
   test_large_equation(generator, used_for_size);
   test_assign_double(used_for_size);
 }
+
+#ifdef SPECTRE_USE_XSIMD
+// Checks that evaluating expressions of `Tensor`s holding `simd::batch<double>`
+// gives the same result in each lane as evaluating the expression with
+// `Tensor`s holding `double`
+template <typename Generator>
+void test_simd_batch(const gsl::not_null<Generator*> generator) {
+  using SimdType = simd::batch<double>;
+  constexpr size_t simd_width = simd::size<SimdType>();
+  std::uniform_real_distribution<> distribution(0.1, 1.0);
+  std::uniform_real_distribution<> spatial_metric_distribution(3.0, 4.0);
+
+  std::array<tnsr::ab<double, 3, Frame::Grid>, simd_width> R{};
+  std::array<tnsr::A<double, 3, Frame::Grid>, simd_width> S{};
+  std::array<tnsr::a<double, 3, Frame::Grid>, simd_width> G{};
+  std::array<tnsr::abC<double, 3, Frame::Grid>, simd_width> H{};
+  std::array<Scalar<double>, simd_width> T{};
+  std::array<tnsr::II<double, 3, Frame::Grid>, simd_width> spatial_metric{};
+  for (size_t lane = 0; lane < simd_width; ++lane) {
+    const auto fill = [&generator, &distribution](const auto tensor) {
+      fill_with_random_values(tensor, generator, make_not_null(&distribution));
+    };
+    fill(make_not_null(&gsl::at(R, lane)));
+    fill(make_not_null(&gsl::at(S, lane)));
+    fill(make_not_null(&gsl::at(G, lane)));
+    fill(make_not_null(&gsl::at(H, lane)));
+    fill(make_not_null(&gsl::at(T, lane)));
+    fill_with_random_values(make_not_null(&gsl::at(spatial_metric, lane)),
+                            generator,
+                            make_not_null(&spatial_metric_distribution));
+  }
+
+  // Gathers the components of the `double` tensors of each lane into a
+  // `Tensor` holding `simd::batch<double>`
+  const auto to_simd = [](const auto& lane_tensors) {
+    using double_tensor_type = std::decay_t<decltype(lane_tensors[0])>;
+    TensorMetafunctions::swap_type<SimdType, double_tensor_type> result{};
+    for (size_t i = 0; i < result.size(); ++i) {
+      std::array<double, simd_width> component_values{};
+      for (size_t lane = 0; lane < simd_width; ++lane) {
+        gsl::at(component_values, lane) = gsl::at(lane_tensors, lane)[i];
+      }
+      result[i] = simd::load_unaligned(component_values.data());
+    }
+    return result;
+  };
+  const auto simd_R = to_simd(R);
+  const auto simd_S = to_simd(S);
+  const auto simd_G = to_simd(G);
+  const auto simd_H = to_simd(H);
+  const auto simd_T = to_simd(T);
+  const auto simd_spatial_metric = to_simd(spatial_metric);
+
+  tnsr::a<SimdType, 3, Frame::Grid> simd_mixed_result{};
+  tenex::evaluate<ti::a>(make_not_null(&simd_mixed_result),
+                         simd_R(ti::a, ti::b) * simd_S(ti::B) + simd_G(ti::a) -
+                             simd_H(ti::b, ti::a, ti::B) * simd_T());
+  const Scalar<SimdType> simd_sqrt_result = tenex::evaluate(
+      sqrt(simd_spatial_metric(ti::I, ti::J) * simd_R(ti::i, ti::j) + 2.0));
+  tnsr::ii<SimdType, 3, Frame::Grid> simd_assigned_result{};
+  tenex::evaluate<ti::i, ti::j>(make_not_null(&simd_assigned_result), 2.0);
+
+  for (size_t lane = 0; lane < simd_width; ++lane) {
+    const auto expected_mixed_result = tenex::evaluate<ti::a>(
+        gsl::at(R, lane)(ti::a, ti::b) * gsl::at(S, lane)(ti::B) +
+        gsl::at(G, lane)(ti::a) -
+        gsl::at(H, lane)(ti::b, ti::a, ti::B) * gsl::at(T, lane)());
+    for (size_t a = 0; a < 4; ++a) {
+      CHECK(simd_mixed_result.get(a).get(lane) ==
+            approx(expected_mixed_result.get(a)));
+    }
+    const Scalar<double> expected_sqrt_result = tenex::evaluate(
+        sqrt(gsl::at(spatial_metric, lane)(ti::I, ti::J) *
+                 gsl::at(R, lane)(ti::i, ti::j) +
+             2.0));
+    CHECK(get(simd_sqrt_result).get(lane) == approx(get(expected_sqrt_result)));
+    for (const auto& component : simd_assigned_result) {
+      CHECK(component.get(lane) == 2.0);
+    }
+  }
+}
+#endif  // SPECTRE_USE_XSIMD
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.DataStructures.Tensor.Expression.MixedOperations",
@@ -973,4 +1058,7 @@ SPECTRE_TEST_CASE("Unit.DataStructures.Tensor.Expression.MixedOperations",
   test_mixed_operations(
       make_not_null(&generator),
       ComplexDataVector(5, std::numeric_limits<double>::signaling_NaN()));
+#ifdef SPECTRE_USE_XSIMD
+  test_simd_batch(make_not_null(&generator));
+#endif  // SPECTRE_USE_XSIMD
 }
@@ -0,0 +1,229 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/MemoryTracking.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+struct Var1 : db::SimpleTag {
+  using type = Scalar<DataVector>;
+};
+struct Var2 : db::SimpleTag {
+  using type = tnsr::I<DataVector, 3>;
+};
+
+void test_vector_impl() {
+  using memory_tracking::Kind;
+  const size_t initial_bytes =
+      memory_tracking::bytes_allocated(Kind::VectorImpl);
+  const size_t initial_allocations =
+      memory_tracking::number_of_allocations(Kind::VectorImpl);
+  const size_t initial_total_allocations =
+      memory_tracking::allocations_on_this_thread();
+  const auto check = [&initial_bytes, &initial_allocations,
+                      &initial_total_allocations](
+                         const size_t expected_doubles,
+                         const size_t expected_allocations,
+                         const size_t expected_total_allocations) {
+    CHECK(memory_tracking::bytes_allocated(Kind::VectorImpl) ==
+          initial_bytes + expected_doubles * sizeof(double));
+    CHECK(memory_tracking::number_of_allocations(Kind::VectorImpl) ==
+          initial_allocations + expected_allocations);
+    CHECK(memory_tracking::allocations_on_this_thread() ==
+          initial_total_allocations + expected_total_allocations);
+  };
+
+  {
+    DataVector a{5, 1.0};
+    check(5, 1, 1);
+    // Non-owning vectors don't allocate
+    const DataVector b{a.data(), a.size()};
+    check(5, 1, 1);
+    DataVector c = a;
+    check(10, 2, 2);
+    a.destructive_resize(7);
+    check(12, 2, 3);
+    // Resizing to the same size doesn't allocate
+    a.destructive_resize(7);
+    check(12, 2, 3);
+    // Moving transfers the allocation
+    DataVector d = std::move(c);
+    check(12, 2, 3);
+    d = DataVector{3, 2.0};
+    check(10, 2, 4);
+    a.clear();
+    check(3, 1, 4);
+  }
+  check(0, 0, 4);
+}
+
+void test_variables() {
+  using memory_tracking::Kind;
+  const size_t initial_bytes =
+      memory_tracking::bytes_allocated(Kind::Variables);
+  const size_t initial_vector_bytes =
+      memory_tracking::bytes_allocated(Kind::VectorImpl);
+  {
+    Variables<tmpl::list<Var1, Var2>> vars{6, 0.0};
+    CHECK(memory_tracking::bytes_allocated(Kind::Variables) ==
+          initial_bytes + 24 * sizeof(double));
+    // The tensors in the Variables don't own their data
+    CHECK(memory_tracking::bytes_allocated(Kind::VectorImpl) ==
+          initial_vector_bytes);
+    CHECK(memory_tracking::bytes_allocated() >=
+          initial_bytes + 24 * sizeof(double));
+    vars.initialize(2);
+    CHECK(memory_tracking::bytes_allocated(Kind::Variables) ==
+          initial_bytes + 8 * sizeof(double));
+    auto moved_vars = std::move(vars);
+    CHECK(memory_tracking::bytes_allocated(Kind::Variables) ==
+          initial_bytes + 8 * sizeof(double));
+  }
+  CHECK(memory_tracking::bytes_allocated(Kind::Variables) == initial_bytes);
+}
+
+void test_other_thread() {
+  using memory_tracking::Kind;
+  const size_t initial_bytes =
+      memory_tracking::bytes_allocated(Kind::VectorImpl);
+  // Allocated on another thread and freed on this one
+  const size_t initial_allocations =
+      memory_tracking::allocations_on_this_thread();
+  DataVector a{};
+  size_t allocations_on_other_thread = 0;
+  std::thread other_thread{[&a, &allocations_on_other_thread]() {
+    a = DataVector{9, 1.0};
+    allocations_on_other_thread = memory_tracking::allocations_on_this_thread();
+  }};
+  other_thread.join();
+  CHECK(allocations_on_other_thread == 1);
+  CHECK(memory_tracking::allocations_on_this_thread() == initial_allocations);
+  CHECK(memory_tracking::bytes_allocated(Kind::VectorImpl) ==
+        initial_bytes + 9 * sizeof(double));
+  a.clear();
+  CHECK(memory_tracking::bytes_allocated(Kind::VectorImpl) == initial_bytes);
+}
+
+struct ComponentA {};
+struct ComponentB {};
+
+void test_component_registry() {
+  CHECK(memory_tracking::component_name(0) == "Other");
+  const size_t id_a = memory_tracking::component_id<ComponentA>();
+  const size_t id_b = memory_tracking::component_id<ComponentB>();
+  CHECK(id_a != 0);
+  CHECK(id_b != 0);
+  CHECK(id_a != id_b);
+  CHECK(memory_tracking::component_name(id_a) == "ComponentA");
+  CHECK(memory_tracking::register_component("ComponentA") == id_a);
+}
+
+void test_categories() {
+  using memory_tracking::Group;
+  using memory_tracking::Kind;
+  const size_t id_a = memory_tracking::component_id<ComponentA>();
+  const size_t id_b = memory_tracking::component_id<ComponentB>();
+  const size_t initial_other =
+      memory_tracking::bytes_allocated(0, Group::Other, Kind::VectorImpl);
+  const size_t initial_total =
+      memory_tracking::bytes_allocated(Kind::VectorImpl);
+
+  DataVector history_vector{};
+  std::optional<Variables<tmpl::list<Var1, Var2>>> mortar_vars{};
+  {
+    const memory_tracking::ScopedComponent scoped_a{id_a};
+    history_vector = DataVector{3, 1.0};
+    CHECK(memory_tracking::bytes_allocated(id_a, Group::Other,
+                                           Kind::VectorImpl) ==
+          3 * sizeof(double));
+    {
+      const memory_tracking::ScopedGroup scoped_group{Group::Mortars};
+      mortar_vars.emplace(2, 0.0);
+      {
+        // Nested scopes replace the component and restore it afterwards
+        const memory_tracking::ScopedComponent scoped_b{id_b};
+        const DataVector temporary{7, 0.0};
+        CHECK(memory_tracking::bytes_allocated(id_b, Group::Mortars,
+                                               Kind::VectorImpl) ==
+              7 * sizeof(double));
+      }
+      CHECK(memory_tracking::bytes_allocated(id_b, Group::Mortars,
+                                             Kind::VectorImpl) == 0);
+    }
+    CHECK(memory_tracking::bytes_allocated(id_a, Group::Mortars,
+                                           Kind::Variables) ==
+          8 * sizeof(double));
+    const DataVector other{4, 0.0};
+    CHECK(memory_tracking::bytes_allocated(id_a, Group::Other,
+                                           Kind::VectorImpl) ==
+          7 * sizeof(double));
+  }
+  // Allocations outside of the scopes are counted as "Other"
+  const DataVector outside{5, 0.0};
+  CHECK(memory_tracking::bytes_allocated(0, Group::Other, Kind::VectorImpl) ==
+        initial_other + 5 * sizeof(double));
+  CHECK(memory_tracking::bytes_allocated(Kind::VectorImpl) ==
+        initial_total + 8 * sizeof(double));
+
+  // Memory is subtracted from the category it was allocated in, wherever it
+  // is freed
+  {
+    const memory_tracking::ScopedComponent scoped_b{id_b};
+    history_vector = DataVector{};
+    mortar_vars.reset();
+  }
+  CHECK(memory_tracking::bytes_allocated(id_a, Group::Other,
+                                         Kind::VectorImpl) == 0);
+  CHECK(memory_tracking::bytes_allocated(id_a, Group::Mortars,
+                                         Kind::Variables) == 0);
+  CHECK(memory_tracking::bytes_allocated(id_b, Group::Other,
+                                         Kind::VectorImpl) == 0);
+}
+
+void test_disabled() {
+  const DataVector a{5, 1.0};
+  const Variables<tmpl::list<Var1, Var2>> vars{6, 0.0};
+  const memory_tracking::ScopedComponent scoped_component{
+      memory_tracking::component_id<ComponentA>()};
+  const memory_tracking::ScopedGroup scoped_group{
+      memory_tracking::Group::Mortars};
+  const DataVector b{5, 1.0};
+  CHECK(memory_tracking::bytes_allocated() == 0);
+  CHECK(memory_tracking::number_of_allocations(
+            memory_tracking::Kind::VectorImpl) == 0);
+  CHECK(memory_tracking::allocations_on_this_thread() == 0);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.DataStructures.MemoryTracking",
+                  "[DataStructures][Unit]") {
+  CHECK(memory_tracking::name(memory_tracking::Kind::VectorImpl) ==
+        std::string{"VectorImpl"});
+  CHECK(memory_tracking::name(memory_tracking::Kind::Variables) ==
+        std::string{"Variables"});
+  CHECK(memory_tracking::name(memory_tracking::Group::TimeStepperHistory) ==
+        std::string{"TimeStepperHistory"});
+  CHECK(memory_tracking::name(memory_tracking::Group::Mortars) ==
+        std::string{"Mortars"});
+  test_component_registry();
+  if constexpr (memory_tracking::enabled) {
+    test_vector_impl();
+    test_variables();
+    test_other_thread();
+    test_categories();
+  } else {
+    test_disabled();
+  }
+}
@@ -0,0 +1,51 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "Domain/ElementCostModel.hpp"
+#include "Domain/Tags/ElementCostModel.hpp"
+#include "Framework/TestCreation.hpp"
+#include "Helpers/DataStructures/DataBox/TestHelpers.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/Dat.hpp"
+#include "IO/H5/File.hpp"
+#include "Parallel/Tags/Parallelization.hpp"
+#include "Utilities/FileSystem.hpp"
+
+SPECTRE_TEST_CASE("Unit.Domain.Tags.ElementCostModel", "[Unit][Domain]") {
+  TestHelpers::db::test_simple_tag<domain::Tags::ElementCostModel<1>>(
+      "ElementCostModel");
+  CHECK(TestHelpers::test_option_tag<domain::OptionTags::ElementCostModel>(
+            "None") == std::nullopt);
+  CHECK(domain::Tags::ElementCostModel<1>::create_from_options(std::nullopt) ==
+        std::nullopt);
+
+  const std::string file_name{"Unit.Domain.Tags.ElementCostModel.h5"};
+  if (file_system::check_if_file_exists(file_name)) {
+    file_system::rm(file_name, true);
+  }
+  CHECK(TestHelpers::test_option_tag<domain::OptionTags::ElementCostModel>(
+            file_name) == std::optional{file_name});
+  {
+    h5::H5File<h5::AccessType::ReadWrite> file{file_name};
+    file.insert<h5::Dat>(domain::Tags::ElementCostModel<1>::subfile_name(),
+                         domain::ElementCostModel<1>::legend())
+        .append(std::vector<std::vector<double>>{{0.0, 0.0, 4.0, 0.0, 1.0},
+                                                 {0.0, 1.0, 5.0, 1.0, 2.0},
+                                                 {1.0, 0.0, 4.0, 0.0, 3.0}});
+    file.close_current_object();
+  }
+  const auto model =
+      domain::Tags::ElementCostModel<1>::create_from_options(file_name);
+  REQUIRE(model.has_value());
+  CHECK(model->number_of_measurements() == 3);
+  CHECK(model->cost(0, {{4}}, false) == std::optional{2.0});
+  CHECK(model->cost(1, {{5}}, true) == std::optional{2.0});
+
+  file_system::rm(file_name, true);
+}
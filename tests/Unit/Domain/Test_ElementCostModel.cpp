@@ -0,0 +1,119 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "DataStructures/Matrix.hpp"
+#include "Domain/Creators/AlignedLattice.hpp"
+#include "Domain/Domain.hpp"
+#include "Domain/ElementCostModel.hpp"
+#include "Domain/ElementDistribution.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Framework/TestHelpers.hpp"
+
+namespace {
+void test_model() {
+  CHECK(domain::ElementCostModel<2>::legend() ==
+        std::vector<std::string>{"Time", "BlockId", "Extent0", "Extent1",
+                                 "SubcellActive", "Cost"});
+
+  domain::ElementCostModel<2> model{};
+  CHECK(model.number_of_measurements() == 0);
+  CHECK_FALSE(model.cost(0, {{3, 3}}).has_value());
+
+  model.insert(0, {{3, 3}}, false, 1.0);
+  model.insert(0, {{3, 3}}, false, 3.0);
+  model.insert(0, {{3, 3}}, true, 8.0);
+  model.insert(1, {{4, 5}}, false, 4.0);
+  CHECK(model.number_of_measurements() == 4);
+  CHECK(model.cost(0, {{3, 3}}, false) == std::optional{2.0});
+  CHECK(model.cost(0, {{3, 3}}, true) == std::optional{8.0});
+  // The expected cost of an element that may switch to the subcell grid
+  CHECK(model.cost(0, {{3, 3}}) == std::optional{4.0});
+  CHECK(model.cost(1, {{4, 5}}) == std::optional{4.0});
+  CHECK_FALSE(model.cost(1, {{4, 5}}, true).has_value());
+  CHECK_FALSE(model.cost(1, {{3, 3}}).has_value());
+  CHECK_FALSE(model.cost(2, {{3, 3}}, false).has_value());
+  // (1 + 3 + 8 + 4) / (9 + 9 + 9 + 20)
+  CHECK(model.cost_per_grid_point() == approx(16.0 / 47.0));
+
+  test_serialization(model);
+
+  // Construct from the rows written by Events::ObserveElementCosts
+  const Matrix measured_costs{{0.0, 0.0, 3.0, 3.0, 0.0, 1.0},
+                              {0.0, 0.0, 3.0, 3.0, 1.0, 8.0},
+                              {0.0, 1.0, 4.0, 5.0, 0.0, 4.0},
+                              {1.0, 0.0, 3.0, 3.0, 0.0, 3.0}};
+  const domain::ElementCostModel<2> model_from_rows{measured_costs};
+  CHECK(model_from_rows == model);
+  CHECK_FALSE(model_from_rows != model);
+  model.insert(1, {{4, 5}}, false, 4.0);
+  CHECK(model_from_rows != model);
+
+  const Matrix missing_column{{0.0, 0.0, 3.0, 3.0, 1.0},
+                              {0.0, 1.0, 4.0, 5.0, 4.0}};
+  CHECK_THROWS_WITH(
+      domain::ElementCostModel<2>{missing_column},
+      Catch::Matchers::ContainsSubstring(
+          "The measured element costs must have the 6 columns"));
+  CHECK_THROWS_WITH(domain::ElementCostModel<1>{}.cost_per_grid_point(),
+                    Catch::Matchers::ContainsSubstring(
+                        "No element costs were measured."));
+}
+
+void test_get_element_costs() {
+  // Two blocks with two elements each. Only the first block was measured.
+  const auto domain_creator = domain::creators::AlignedLattice<2>(
+      {{{{0.0, 1.0, 2.0}}, {{0.0, 1.0}}}}, {{1, 0}}, {{3, 4}}, {}, {}, {});
+  const auto domain = domain_creator.create_domain();
+  const auto& initial_extents = domain_creator.initial_extents();
+
+  domain::ElementCostModel<2> model{};
+  model.insert(0, initial_extents[0], false, 1.0);
+  model.insert(0, initial_extents[0], true, 3.0);
+  // The second block was measured with different extents
+  model.insert(1, {{5, 5}}, false, 5.0);
+
+  const auto costs = domain::get_element_costs(
+      domain.blocks(), domain_creator.initial_refinement_levels(),
+      initial_extents, model);
+  CHECK(costs.size() == 4);
+  // (1 + 3 + 5) / (12 + 12 + 25)
+  const double cost_per_grid_point = 9.0 / 49.0;
+  for (const auto& [element_id, cost] : costs) {
+    if (element_id.block_id() == 0) {
+      CHECK(cost == 2.0);
+    } else {
+      CHECK(cost == approx(12.0 * cost_per_grid_point));
+    }
+  }
+
+  // The costs can be used to distribute the elements
+  const domain::BlockZCurveProcDistribution<2> distribution{
+      costs,
+      2,
+      domain.blocks(),
+      domain_creator.initial_refinement_levels(),
+      initial_extents};
+  CHECK(distribution.get_proc_for_element(
+            ElementId<2>{0, {{{1, 0}, {0, 0}}}}) == 0);
+  CHECK(distribution.get_proc_for_element(
+            ElementId<2>{0, {{{1, 1}, {0, 0}}}}) == 0);
+  CHECK(distribution.get_proc_for_element(
+            ElementId<2>{1, {{{1, 0}, {0, 0}}}}) == 1);
+  CHECK(distribution.get_proc_for_element(
+            ElementId<2>{1, {{{1, 1}, {0, 0}}}}) == 1);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Domain.ElementCostModel", "[Domain][Unit]") {
+  test_model();
+  test_get_element_costs();
+}
@@ -31,6 +31,7 @@
 #include "Domain/Tags.hpp"
 #include "Evolution/DgSubcell/BackgroundGrVars.hpp"
 #include "Evolution/DgSubcell/Mesh.hpp"
+#include "Evolution/DgSubcell/Tags/BackgroundGrVarsKey.hpp"
 #include "Evolution/DgSubcell/Tags/Coordinates.hpp"
 #include "Evolution/DgSubcell/Tags/DidRollback.hpp"
 #include "Evolution/DgSubcell/Tags/Inactive.hpp"
@@ -268,6 +269,7 @@ void test(const gsl::not_null<std::mt19937*> gen, const bool did_rollback) {
           evolution::dg::subcell::Tags::Coordinates<3, Frame::Inertial>,
           gr_variables_tag, inactive_gr_variables_tag,
           subcell_face_gr_variables_tag,
+          evolution::dg::subcell::Tags::BackgroundGrVarsKey<3>,
           evolution::dg::subcell::Tags::DidRollback,
           evolution::initial_data::Tags::InitialData>>(
           initial_time, brick.create_domain(), element,
@@ -279,7 +281,8 @@ void test(const gsl::not_null<std::mt19937*> gen, const bool did_rollback) {
           std::move(grid_to_inertial_map),
           clone_unique_ptrs(brick.functions_of_time()), subcell_mesh,
           subcell_initial_inertial_coords, dg_gr_vars,
-          typename inactive_gr_variables_tag::type{}, face_gr_vars, false,
+          typename inactive_gr_variables_tag::type{}, face_gr_vars,
+          evolution::dg::BackgroundGrVarsKey<3>{}, false,
           solution.get_clone());
     } else {
       return db::create<db::AddSimpleTags<
@@ -292,6 +295,7 @@ void test(const gsl::not_null<std::mt19937*> gen, const bool did_rollback) {
           evolution::dg::subcell::Tags::Coordinates<3, Frame::Inertial>,
           gr_variables_tag, inactive_gr_variables_tag,
           subcell_face_gr_variables_tag,
+          evolution::dg::subcell::Tags::BackgroundGrVarsKey<3>,
           evolution::dg::subcell::Tags::DidRollback,
           ::Tags::AnalyticSolution<gr::Solutions::KerrSchild>>>(
           initial_time, brick.create_domain(), element,
@@ -303,7 +307,8 @@ void test(const gsl::not_null<std::mt19937*> gen, const bool did_rollback) {
           std::move(grid_to_inertial_map),
           clone_unique_ptrs(brick.functions_of_time()), subcell_mesh,
           subcell_initial_inertial_coords, dg_gr_vars,
-          typename inactive_gr_variables_tag::type{}, face_gr_vars, false,
+          typename inactive_gr_variables_tag::type{}, face_gr_vars,
+          evolution::dg::BackgroundGrVarsKey<3>{}, false,
           solution);
     }
   }();
@@ -367,6 +372,9 @@ void test(const gsl::not_null<std::mt19937*> gen, const bool did_rollback) {
   // check results for the initialization phase
   check_cell_centered_vars(expected_initial_cell_centered_gr_vars, false);
   check_face_centered_vars(expected_initial_face_centered_gr_vars);
+  using key_tag = evolution::dg::subcell::Tags::BackgroundGrVarsKey<3>;
+  CHECK(get<key_tag>(box).mesh() == subcell_mesh);
+  CHECK(get<key_tag>(box).time() == initial_time);
 
   // Mutate time and inertial coords to those at t = `later_time`, mutate the
   // `DidRollback` tag to `did_rollback`, and apply the mutator again.
@@ -458,6 +466,10 @@ void test(const gsl::not_null<std::mt19937*> gen, const bool did_rollback) {
       }
     }
   }
+  CHECK(get<key_tag>(box).time() ==
+        ((TestMovingMesh and (did_rollback or not ComputeOnlyOnRollback))
+             ? later_time
+             : initial_time));
 }
 
 template <bool TestMovingMesh, bool TestRuntimeInitialData>
@@ -291,7 +291,11 @@ void test(const bool all_neighbors_are_doing_dg,
     }
 
     for (const auto& direction : expected_neighbor_directions<Dim>()) {
-      expected_neighbor_data.insert(std::pair{direction, data});
+      // The neighbor in Block1 is DG-only, so it is sent only the RDMP data
+      const bool neighbor_is_dg_only =
+          element.neighbors().at(direction).begin()->block_id() == 1;
+      expected_neighbor_data.insert(
+          std::pair{direction, neighbor_is_dg_only ? DataVector{} : data});
     }
   } else {
     // Set all directions to false, enable the desired ones below
@@ -350,6 +354,99 @@ void test(const bool all_neighbors_are_doing_dg,
     CHECK(*std::prev(data_in_direction.end(), 1) == approx(-1.0));
   }
 }
+
+// Neighbors in DG-only blocks are sent only the RDMP TCI data, even when
+// other neighbors are doing FD and need the sliced ghost data.
+template <size_t Dim>
+void test_only_dg_neighbors(const ::fd::DerivativeOrder fd_derivative_order) {
+  CAPTURE(fd_derivative_order);
+  CAPTURE(Dim);
+  using Interps = DirectionalIdMap<Dim, std::optional<intrp::Irregular<Dim>>>;
+  using variables_tag = ::Tags::Variables<tmpl::list<Var1>>;
+  const Mesh<Dim> dg_mesh{5, Spectral::Basis::Legendre,
+                          Spectral::Quadrature::GaussLobatto};
+  const Mesh<Dim> subcell_mesh = evolution::dg::subcell::fd::mesh(dg_mesh);
+  const auto dg_only_direction = Direction<Dim>::lower_xi();
+  const auto fd_direction = Direction<Dim>::upper_xi();
+  // The neighbor in Block1 is DG-only, the one in Block2 is doing FD
+  const ElementId<Dim> dg_only_neighbor{1, {}};
+  const ElementId<Dim> fd_neighbor{2, {}};
+  DirectionMap<Dim, Neighbors<Dim>> neighbors{};
+  neighbors[dg_only_direction] = Neighbors<Dim>{
+      {dg_only_neighbor}, OrientationMap<Dim>::create_aligned()};
+  neighbors[fd_direction] =
+      Neighbors<Dim>{{fd_neighbor}, OrientationMap<Dim>::create_aligned()};
+  const Element<Dim> element{ElementId<Dim>{0, {}}, std::move(neighbors)};
+  const DirectionalIdMap<Dim, Mesh<Dim>> neighbor_meshes{
+      {DirectionalId<Dim>{dg_only_direction, dg_only_neighbor}, dg_mesh},
+      {DirectionalId<Dim>{fd_direction, fd_neighbor}, subcell_mesh}};
+
+  Variables<tmpl::list<Var1>> vars{dg_mesh.number_of_grid_points(), 0.0};
+  get(get<Var1>(vars)) = get<0>(logical_coordinates(dg_mesh));
+  using flux_tag = ::Tags::Flux<Var1, tmpl::size_t<Dim>, Frame::Inertial>;
+  Variables<tmpl::list<flux_tag>> volume_fluxes{dg_mesh.number_of_grid_points(),
+                                                0.0};
+  for (size_t i = 0; i < Dim; ++i) {
+    get<flux_tag>(volume_fluxes).get(i) = logical_coordinates(dg_mesh).get(i);
+  }
+
+  const evolution::dg::subcell::SubcellOptions subcell_options{
+      evolution::dg::subcell::SubcellOptions{
+          4.0, 1_st, 1.0e-3, 1.0e-4, false,
+          evolution::dg::subcell::fd::ReconstructionMethod::DimByDim, false,
+          std::optional{std::vector<std::string>{"Block1"}},
+          fd_derivative_order, 1, 1, 1},
+      TestCreator<Dim>{}};
+
+  auto box = db::create<tmpl::list<
+      Tags::Reconstructor, domain::Tags::Mesh<Dim>,
+      evolution::dg::subcell::Tags::Mesh<Dim>, domain::Tags::Element<Dim>,
+      variables_tag, evolution::dg::subcell::Tags::DataForRdmpTci,
+      domain::Tags::NeighborMesh<Dim>,
+      evolution::dg::subcell::Tags::SubcellOptions<Dim>,
+      evolution::dg::subcell::Tags::InterpolatorsFromFdToNeighborFd<Dim>,
+      evolution::dg::subcell::Tags::InterpolatorsFromDgToNeighborFd<Dim>>>(
+      std::make_unique<DummyReconstructor>(), dg_mesh, subcell_mesh, element,
+      vars, evolution::dg::subcell::RdmpTciData{{1.0}, {-1.0}},
+      neighbor_meshes, subcell_options, Interps{}, Interps{});
+
+  std::optional<Mesh<Dim>> ghost_data_mesh{std::nullopt};
+  DirectionMap<Dim, DataVector> data_for_neighbors{};
+  evolution::dg::subcell::prepare_neighbor_data<Metavariables<Dim>>(
+      make_not_null(&data_for_neighbors), make_not_null(&ghost_data_mesh),
+      make_not_null(&box), volume_fluxes);
+
+  CHECK(ghost_data_mesh.value() == subcell_mesh);
+  REQUIRE(data_for_neighbors.size() == 2);
+
+  // Only the RDMP TCI maximum and minimum are sent to the DG-only neighbor
+  CHECK_ITERABLE_APPROX(data_for_neighbors.at(dg_only_direction),
+                        (DataVector{1.0, -1.0}));
+
+  // The FD neighbor still gets the full ghost data followed by the RDMP data
+  Variables<tmpl::list<Var1, flux_tag>> expected_var_and_flux{
+      dg_mesh.number_of_grid_points()};
+  get(get<Var1>(expected_var_and_flux)) = 2.0 * get(get<Var1>(vars));
+  get<flux_tag>(expected_var_and_flux) = get<flux_tag>(volume_fluxes);
+  const bool need_fluxes = fd_derivative_order != ::fd::DerivativeOrder::Two;
+  const DataVector data_to_slice =
+      need_fluxes ? DataVector{expected_var_and_flux.data(),
+                               expected_var_and_flux.size()}
+                  : DataVector{expected_var_and_flux.data(),
+                               dg_mesh.number_of_grid_points()};
+  const auto expected_fd_data = evolution::dg::subcell::slice_data(
+      evolution::dg::subcell::fd::project(data_to_slice, dg_mesh,
+                                          subcell_mesh.extents()),
+      subcell_mesh.extents(), DummyReconstructor::ghost_zone_size(),
+      std::unordered_set{fd_direction}, 0, {});
+  const auto& fd_data = data_for_neighbors.at(fd_direction);
+  REQUIRE(fd_data.size() == expected_fd_data.at(fd_direction).size() + 2);
+  CHECK_ITERABLE_APPROX(
+      expected_fd_data.at(fd_direction),
+      (DataVector{const_cast<double*>(fd_data.data()), fd_data.size() - 2}));
+  CHECK(*std::prev(fd_data.end(), 2) == approx(1.0));
+  CHECK(*std::prev(fd_data.end(), 1) == approx(-1.0));
+}
 }  // namespace
 
 // [[TimeOut, 10]]
@@ -363,4 +460,10 @@ SPECTRE_TEST_CASE("Unit.Evolution.Subcell.PrepareNeighborData",
     test<2>(all_neighbors_are_doing_dg, fd_deriv_order);
     test<3>(all_neighbors_are_doing_dg, fd_deriv_order);
   }
+  for (const auto fd_deriv_order :
+       {::fd::DerivativeOrder::Two, ::fd::DerivativeOrder::Four}) {
+    test_only_dg_neighbors<1>(fd_deriv_order);
+    test_only_dg_neighbors<2>(fd_deriv_order);
+    test_only_dg_neighbors<3>(fd_deriv_order);
+  }
 }
@@ -0,0 +1,80 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Evolution/DiscontinuousGalerkin/ApplyOnTiles.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+// A pointwise function of tensors that also takes non-tensor arguments
+void compute(const gsl::not_null<tnsr::i<DataVector, 2>*> result,
+             const gsl::not_null<Scalar<DataVector>*> norm,
+             const tnsr::i<DataVector, 2>& covector,
+             const std::optional<Scalar<DataVector>>& factor,
+             const double offset,
+             const gsl::not_null<std::vector<size_t>*> tile_sizes) {
+  const size_t size = get<0>(covector).size();
+  tile_sizes->push_back(size);
+  CHECK(get(*norm).size() == size);
+  CHECK(get<1>(*result).size() == size);
+  get(*norm) = sqrt(square(get<0>(covector)) + square(get<1>(covector)));
+  for (size_t i = 0; i < 2; ++i) {
+    result->get(i) = covector.get(i) / get(*norm) + offset;
+    if (factor.has_value()) {
+      CHECK(get(*factor).size() == size);
+      result->get(i) *= get(*factor);
+    }
+  }
+}
+
+void test_apply_on_tiles(const std::optional<Scalar<DataVector>>& factor) {
+  const size_t number_of_points = 37;
+  tnsr::i<DataVector, 2> covector{number_of_points};
+  for (size_t s = 0; s < number_of_points; ++s) {
+    get<0>(covector)[s] = 1.0 + 0.1 * static_cast<double>(s);
+    get<1>(covector)[s] = -2.0 + 0.3 * static_cast<double>(s);
+  }
+
+  tnsr::i<DataVector, 2> expected_result{number_of_points};
+  Scalar<DataVector> expected_norm{number_of_points};
+  std::vector<size_t> tile_sizes{};
+  compute(make_not_null(&expected_result), make_not_null(&expected_norm),
+          covector, factor, 0.5, make_not_null(&tile_sizes));
+  CHECK(tile_sizes == std::vector<size_t>{number_of_points});
+
+  tnsr::i<DataVector, 2> result{number_of_points, 0.0};
+  Scalar<DataVector> norm{number_of_points, 0.0};
+  tile_sizes.clear();
+  evolution::dg::apply_on_tiles(
+      [](const auto&... args) { compute(args...); }, number_of_points, 16,
+      make_not_null(&result), make_not_null(&norm), covector, factor, 0.5,
+      make_not_null(&tile_sizes));
+  CHECK(tile_sizes == std::vector<size_t>{16, 16, 5});
+  // Evaluated with the same operations, so the results are identical
+  CHECK(result == expected_result);
+  CHECK(norm == expected_norm);
+  // The output tensors still own their data
+  CHECK(get<0>(result).is_owning());
+  CHECK(get(norm).is_owning());
+
+  tile_sizes.clear();
+  evolution::dg::apply_on_tiles(
+      [](const auto&... args) { compute(args...); }, number_of_points, 64,
+      make_not_null(&result), make_not_null(&norm), covector, factor, 0.5,
+      make_not_null(&tile_sizes));
+  CHECK(tile_sizes == std::vector<size_t>{number_of_points});
+  CHECK(result == expected_result);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Evolution.DG.ApplyOnTiles", "[Unit][Evolution]") {
+  test_apply_on_tiles(std::nullopt);
+  test_apply_on_tiles(Scalar<DataVector>{size_t{37}, 1.5});
+}
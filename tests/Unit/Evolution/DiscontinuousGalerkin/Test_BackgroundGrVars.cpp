@@ -27,6 +27,7 @@
 #include "Domain/Structure/ElementId.hpp"
 #include "Domain/Tags.hpp"
 #include "Evolution/DiscontinuousGalerkin/BackgroundGrVars.hpp"
+#include "Evolution/DiscontinuousGalerkin/BackgroundGrVarsKey.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "Helpers/DataStructures/MakeWithRandomValues.hpp"
 #include "NumericalAlgorithms/Spectral/Basis.hpp"
@@ -137,8 +138,9 @@ void test(const gsl::not_null<std::mt19937*> gen) {
   const Mesh<3> mesh{num_dg_pts, Spectral::Basis::Legendre,
                      Spectral::Quadrature::GaussLobatto};
 
-  const auto compute_inertial_coords = [&brick, &domain, &element_id,
-                                        &mesh](const double time) {
+  const auto compute_inertial_coords = [&brick, &domain, &element_id](
+                                           const double time,
+                                           const Mesh<3>& coords_mesh) {
     const auto& block = domain.blocks()[element_id.block_id()];
     const auto element_map = ElementMap<3, Frame::Grid>{
         element_id, block.is_time_dependent()
@@ -155,11 +157,13 @@ void test(const gsl::not_null<std::mt19937*> gen) {
           ::domain::make_coordinate_map_base<Frame::Grid, Frame::Inertial>(
               ::domain::CoordinateMaps::Identity<3>{});
     }
-    return (*grid_to_inertial_map)(element_map(logical_coordinates(mesh)), time,
-                                   brick.functions_of_time());
+    return (*grid_to_inertial_map)(
+        element_map(logical_coordinates(coords_mesh)), time,
+        brick.functions_of_time());
   };
 
-  const auto initial_inertial_coords = compute_inertial_coords(initial_time);
+  const auto initial_inertial_coords =
+      compute_inertial_coords(initial_time, mesh);
 
   using gr_variables_tag =
       ::Tags::Variables<tmpl::remove_duplicates<tmpl::append<
@@ -189,18 +193,20 @@ void test(const gsl::not_null<std::mt19937*> gen) {
       return db::create<db::AddSimpleTags<
           ::Tags::Time, domain::Tags::Domain<3>, domain::Tags::Element<3>,
           domain::Tags::Mesh<3>, domain::Tags::Coordinates<3, Frame::Inertial>,
-          gr_variables_tag, evolution::initial_data::Tags::InitialData>>(
+          gr_variables_tag, evolution::dg::Tags::BackgroundGrVarsKey<3>,
+          evolution::initial_data::Tags::InitialData>>(
           initial_time, brick.create_domain(), element, mesh,
           initial_inertial_coords, typename gr_variables_tag::type{},
-          solution.get_clone());
+          evolution::dg::BackgroundGrVarsKey<3>{}, solution.get_clone());
     } else {
       return db::create<db::AddSimpleTags<
           ::Tags::Time, domain::Tags::Domain<3>, domain::Tags::Element<3>,
           domain::Tags::Mesh<3>, domain::Tags::Coordinates<3, Frame::Inertial>,
-          gr_variables_tag,
+          gr_variables_tag, evolution::dg::Tags::BackgroundGrVarsKey<3>,
           ::Tags::AnalyticSolution<gr::Solutions::KerrSchild>>>(
           initial_time, brick.create_domain(), element, mesh,
-          initial_inertial_coords, typename gr_variables_tag::type{}, solution);
+          initial_inertial_coords, typename gr_variables_tag::type{},
+          evolution::dg::BackgroundGrVarsKey<3>{}, solution);
     }
   }();
 
@@ -219,11 +225,14 @@ void test(const gsl::not_null<std::mt19937*> gen) {
         CHECK_ITERABLE_APPROX(get<tag>(expected_initial_gr_vars),
                               get<tag>(gr_vars_in_box));
       });
+  CHECK(get<evolution::dg::Tags::BackgroundGrVarsKey<3>>(box).mesh() == mesh);
+  CHECK(get<evolution::dg::Tags::BackgroundGrVarsKey<3>>(box).time() ==
+        initial_time);
 
   // Mutate time and inertial coords to those at t = `random_time` and apply the
   // mutator again.. Then check that the mutator has evaluated correct values of
   // GR variables at a later random time.
-  const auto inertial_coords = compute_inertial_coords(random_time);
+  const auto inertial_coords = compute_inertial_coords(random_time, mesh);
   db::mutate<::Tags::Time, domain::Tags::Coordinates<3, Frame::Inertial>>(
       [&random_time, &inertial_coords](const auto time_ptr,
                                        const auto inertial_coords_ptr) {
@@ -255,6 +264,40 @@ void test(const gsl::not_null<std::mt19937*> gen) {
                                 get<tag>(gr_vars_in_box));
         });
   }
+  CHECK(get<evolution::dg::Tags::BackgroundGrVarsKey<3>>(box).time() ==
+        (TestMovingMesh ? random_time : initial_time));
+
+  // Change the mesh as in p-refinement, which must reallocate and evaluate the
+  // GR variables again even if the block is time-independent.
+  const Mesh<3> refined_mesh{num_dg_pts + 1, Spectral::Basis::Legendre,
+                             Spectral::Quadrature::GaussLobatto};
+  const auto refined_inertial_coords =
+      compute_inertial_coords(random_time, refined_mesh);
+  db::mutate<domain::Tags::Mesh<3>,
+             domain::Tags::Coordinates<3, Frame::Inertial>>(
+      [&refined_mesh, &refined_inertial_coords](
+          const auto mesh_ptr, const auto inertial_coords_ptr) {
+        *mesh_ptr = refined_mesh;
+        *inertial_coords_ptr = refined_inertial_coords;
+      },
+      make_not_null(&box));
+  db::mutate_apply<evolution::dg::BackgroundGrVars<
+      SystemForTest, MetavariablesForTest, TestRuntimeInitialData>>(
+      make_not_null(&box));
+
+  const auto expected_refined_gr_vars = solution.variables(
+      refined_inertial_coords, random_time, gr_variables_tag::tags_list{});
+  CHECK(get<gr_variables_tag>(box).number_of_grid_points() ==
+        refined_mesh.number_of_grid_points());
+  tmpl::for_each<gr_variables_tag::tags_list>(
+      [&box, &expected_refined_gr_vars](const auto tag_v) {
+        using tag = tmpl::type_from<decltype(tag_v)>;
+        const auto& gr_vars_in_box = get<gr_variables_tag>(box);
+        CHECK_ITERABLE_APPROX(get<tag>(expected_refined_gr_vars),
+                              get<tag>(gr_vars_in_box));
+      });
+  CHECK(get<evolution::dg::Tags::BackgroundGrVarsKey<3>>(box).mesh() ==
+        refined_mesh);
 }
 
 SPECTRE_TEST_CASE("Unit.Evolution.DG.BackgroundGrVars", "[Unit][Evolution]") {
@@ -0,0 +1,95 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/DirectionalId.hpp"
+#include "Domain/Structure/DirectionalIdMap.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Evolution/DiscontinuousGalerkin/MessagePriorities.hpp"
+#include "Framework/TestCreation.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/DataStructures/DataBox/TestHelpers.hpp"
+#include "Time/Slab.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeStepId.hpp"
+
+namespace evolution::dg {
+namespace {
+void test_options() {
+  TestHelpers::db::test_simple_tag<Tags::MessagePriorities>(
+      "MessagePriorities");
+  CHECK(TestHelpers::test_option_tag<OptionTags::MessagePriorities>("None") ==
+        std::nullopt);
+  const auto priorities =
+      TestHelpers::test_option_tag<OptionTags::MessagePriorities>(
+          "PrioritizedBlocks: [Inner, Horizons]");
+  REQUIRE(priorities.has_value());
+  CHECK(*priorities == MessagePriorities{{"Inner", "Horizons"}});
+  CHECK(*priorities != MessagePriorities{{"Inner"}});
+  test_serialization(*priorities);
+
+  const std::unordered_map<std::string, std::unordered_set<std::string>>
+      block_groups{{"Horizons", {"ShellA", "ShellB"}}};
+  CHECK(priorities->is_prioritized("Inner", block_groups));
+  CHECK(priorities->is_prioritized("ShellB", block_groups));
+  CHECK_FALSE(priorities->is_prioritized("Outer", block_groups));
+  CHECK_FALSE(MessagePriorities{}.is_prioritized("Inner", block_groups));
+}
+
+void test_priority() {
+  const Slab slab(0.0, 1.0);
+  const TimeDelta step = slab.duration() / 8;
+  const TimeStepId now(true, 0, slab.start() + 4 * step);
+  const DirectionalId<1> lower{Direction<1>::lower_xi(), ElementId<1>{0}};
+  const DirectionalId<1> upper{Direction<1>::upper_xi(), ElementId<1>{2}};
+
+  DirectionalIdMap<1, TimeStepId> neighbors{};
+  // Without neighbors only the block decides
+  CHECK(MessagePriorities::priority(now, step, neighbors, false) == 0);
+  CHECK(MessagePriorities::priority(now, step, neighbors, true) == -1);
+
+  // Global time stepping: all neighbors are at the same time
+  neighbors[lower] = now;
+  neighbors[upper] = now;
+  CHECK(MessagePriorities::priority(now, step, neighbors, false) == 0);
+  CHECK(MessagePriorities::priority(now, step, neighbors, true) == -1);
+
+  // Two steps ahead of the slowest neighbor
+  neighbors[lower] = TimeStepId(true, 0, slab.start() + 2 * step);
+  CHECK(MessagePriorities::priority(now, step, neighbors, false) == 2);
+  CHECK(MessagePriorities::priority(now, step, neighbors, true) == 1);
+
+  // Behind all neighbors, measured in own (small) steps
+  neighbors[lower] = TimeStepId(true, 0, slab.end());
+  neighbors[upper] = TimeStepId(true, 0, slab.end());
+  CHECK(MessagePriorities::priority(now, step / 2, neighbors, false) == -8);
+
+  // Evolving backwards in time
+  const TimeStepId backwards_now(false, 0, slab.end() - step);
+  neighbors[lower] = TimeStepId(false, 0, slab.end());
+  neighbors[upper] = TimeStepId(false, 0, slab.end());
+  CHECK(MessagePriorities::priority(backwards_now, -step, neighbors, false) ==
+        1);
+
+  // The priority is bounded
+  neighbors[lower] = TimeStepId(true, 0, slab.start());
+  neighbors[upper] = TimeStepId(true, 0, slab.start());
+  CHECK(MessagePriorities::priority(TimeStepId(true, 0, slab.end()),
+                                    step / 10000, neighbors, false) ==
+        MessagePriorities::max_priority);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Evolution.DG.MessagePriorities",
+                  "[Unit][Evolution]") {
+  test_options();
+  test_priority();
+}
+}  // namespace evolution::dg
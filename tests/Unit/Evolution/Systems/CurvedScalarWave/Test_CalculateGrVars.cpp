@@ -13,6 +13,7 @@
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
 #include "Domain/Tags.hpp"
+#include "Evolution/DiscontinuousGalerkin/BackgroundGrVarsKey.hpp"
 #include "Evolution/Initialization/NonconservativeSystem.hpp"
 #include "Evolution/Systems/CurvedScalarWave/BackgroundSpacetime.hpp"
 #include "Evolution/Systems/CurvedScalarWave/CalculateGrVars.hpp"
@@ -20,6 +21,9 @@
 #include "Framework/ActionTesting.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "Helpers/DataStructures/MakeWithRandomValues.hpp"
+#include "NumericalAlgorithms/Spectral/Basis.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
 #include "Parallel/Phase.hpp"
 #include "PointwiseFunctions/AnalyticSolutions/GeneralRelativity/KerrSchild.hpp"
 #include "PointwiseFunctions/AnalyticSolutions/GeneralRelativity/Minkowski.hpp"
@@ -39,7 +43,8 @@ struct component {
   using initial_tags =
       tmpl::list<CurvedScalarWave::Tags::BackgroundSpacetime<
                      typename Metavariables::background_spacetime>,
-                 domain::Tags::Coordinates<Dim, Frame::Inertial>, ::Tags::Time>;
+                 domain::Tags::Coordinates<Dim, Frame::Inertial>,
+                 domain::Tags::Mesh<Dim>, ::Tags::Time>;
 
   using phase_dependent_action_list = tmpl::list<Parallel::PhaseActions<
       Parallel::Phase::Initialization,
@@ -65,14 +70,16 @@ void test(const BackgroundSpacetime& background_spacetime,
   using comp = component<Dim, metavars>;
   using MockRuntimeSystem = ActionTesting::MockRuntimeSystem<metavars>;
   MockRuntimeSystem runner{{}};
-  const size_t num_points = 42;
+  const Mesh<Dim> mesh(4, Spectral::Basis::Legendre,
+                       Spectral::Quadrature::GaussLobatto);
+  const size_t num_points = mesh.number_of_grid_points();
   std::uniform_real_distribution dist{-10., 10.};
   const auto random_coords = make_with_random_values<tnsr::I<DataVector, Dim>>(
       generator, make_not_null(&dist), DataVector{num_points});
   const double time = 0.;
   const ElementId<Dim> element_id{0};
   ActionTesting::emplace_component_and_initialize<comp>(
-      &runner, element_id, {background_spacetime, random_coords, time});
+      &runner, element_id, {background_spacetime, random_coords, mesh, time});
   // invoke CalculateGrVars
   ActionTesting::next_action<comp>(make_not_null(&runner), element_id);
   const auto solution_at_coords = background_spacetime.variables(
@@ -85,6 +92,13 @@ void test(const BackgroundSpacetime& background_spacetime,
                                                                   element_id) ==
               get<spacetime_tag>(solution_at_coords));
       });
+  const auto& key = ActionTesting::get_databox_tag<
+      comp, evolution::dg::Tags::BackgroundGrVarsKey<Dim>>(runner, element_id);
+  CHECK(key.mesh() == mesh);
+  CHECK(key.time() == time);
+  CHECK(key.is_valid_for(mesh, time, true));
+  CHECK_FALSE(key.is_valid_for(mesh, time + 1.0, true));
+  CHECK(key.is_valid_for(mesh, time + 1.0, false));
 }
 
 SPECTRE_TEST_CASE("Unit.Evolution.Systems.CurvedScalarWave.CalculateGrVars",
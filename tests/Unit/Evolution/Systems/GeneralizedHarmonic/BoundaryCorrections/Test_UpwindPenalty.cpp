@@ -5,19 +5,59 @@
 
 #include <array>
 #include <cstddef>
+#include <random>
 #include <string>
 
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Variables.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/BoundaryCorrections/Factory.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/BoundaryCorrections/UpwindPenalty.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/System.hpp"
 #include "Framework/SetupLocalPythonEnvironment.hpp"
 #include "Framework/TestCreation.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
 #include "Helpers/Evolution/DiscontinuousGalerkin/BoundaryCorrections.hpp"
+#include "Helpers/Utilities/Allocations/CountAllocations.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/Formulation.hpp"
 #include "NumericalAlgorithms/Spectral/Basis.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "NumericalAlgorithms/Spectral/Quadrature.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
 
 namespace {
+// The boundary terms are computed on every face at every step, so they must
+// not allocate memory.
+template <size_t Dim>
+void test_no_allocations(const gsl::not_null<std::mt19937*> gen,
+                         const size_t num_pts) {
+  using correction = gh::BoundaryCorrections::UpwindPenalty<Dim>;
+  using field_tags = typename correction::dg_package_field_tags;
+  std::uniform_real_distribution<> dist(-1.0, 1.0);
+  Variables<field_tags> interior_fields{num_pts};
+  Variables<field_tags> exterior_fields{num_pts};
+  fill_with_random_values(make_not_null(&interior_fields), gen,
+                          make_not_null(&dist));
+  fill_with_random_values(make_not_null(&exterior_fields), gen,
+                          make_not_null(&dist));
+  Variables<typename gh::System<Dim>::variables_tag::tags_list> corrections{
+      num_pts};
+  const correction upwind_penalty{};
+
+  const size_t allocations_before = TestHelpers::allocations_on_this_thread();
+  tmpl::as_pack<field_tags>([&](auto... tags) {
+    upwind_penalty.dg_boundary_terms(
+        make_not_null(
+            &get<gr::Tags::SpacetimeMetric<DataVector, Dim>>(corrections)),
+        make_not_null(&get<gh::Tags::Pi<DataVector, Dim>>(corrections)),
+        make_not_null(&get<gh::Tags::Phi<DataVector, Dim>>(corrections)),
+        get<tmpl::type_from<decltype(tags)>>(interior_fields)...,
+        get<tmpl::type_from<decltype(tags)>>(exterior_fields)...,
+        dg::Formulation::StrongInertial);
+  });
+  CHECK(TestHelpers::allocations_on_this_thread() == allocations_before);
+}
+
 template <size_t Dim>
 void test(const gsl::not_null<std::mt19937*> gen, const size_t num_pts) {
   PUPable_reg(gh::BoundaryCorrections::UpwindPenalty<Dim>);
@@ -51,6 +91,8 @@ void test(const gsl::not_null<std::mt19937*> gen, const size_t num_pts) {
 
   CHECK_FALSE(gh::BoundaryCorrections::UpwindPenalty<Dim>{} !=
               gh::BoundaryCorrections::UpwindPenalty<Dim>{});
+
+  test_no_allocations<Dim>(gen, num_pts);
 }
 }  // namespace
 
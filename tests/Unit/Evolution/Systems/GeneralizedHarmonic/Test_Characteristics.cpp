@@ -35,6 +35,7 @@
 #include "Helpers/DataStructures/MakeWithRandomValues.hpp"
 #include "Helpers/DataStructures/RandomUnitNormal.hpp"
 #include "Helpers/PointwiseFunctions/GeneralRelativity/TestHelpers.hpp"
+#include "Helpers/Utilities/Allocations/CountAllocations.hpp"
 #include "NumericalAlgorithms/Spectral/Basis.hpp"
 #include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
@@ -427,6 +428,81 @@ void test_evolved_from_characteristic_fields() {
       "TestFunctions", "evol_field_phi", {{{-2., 2.}}}, used_for_size);
 }
 
+// Check that the functions used in the boundary conditions and corrections
+// don't allocate when the outputs have the right size, and that converting to
+// characteristic fields and back recovers the evolved fields.
+template <size_t Dim>
+void test_no_allocations() {
+  MAKE_GENERATOR(generator);
+  std::uniform_real_distribution<> distribution(-1.0, 1.0);
+  const DataVector used_for_size(7);
+  const auto gamma_1 = make_with_random_values<Scalar<DataVector>>(
+      make_not_null(&generator), make_not_null(&distribution), used_for_size);
+  const auto gamma_2 = make_with_random_values<Scalar<DataVector>>(
+      make_not_null(&generator), make_not_null(&distribution), used_for_size);
+  const auto lapse = make_with_random_values<Scalar<DataVector>>(
+      make_not_null(&generator), make_not_null(&distribution), used_for_size);
+  const auto shift = make_with_random_values<tnsr::I<DataVector, Dim>>(
+      make_not_null(&generator), make_not_null(&distribution), used_for_size);
+  const std::optional<tnsr::I<DataVector, Dim>> mesh_velocity =
+      make_with_random_values<tnsr::I<DataVector, Dim>>(
+          make_not_null(&generator), make_not_null(&distribution),
+          used_for_size);
+  const auto inverse_spatial_metric =
+      make_with_random_values<tnsr::II<DataVector, Dim>>(
+          make_not_null(&generator), make_not_null(&distribution),
+          used_for_size);
+  const auto spacetime_metric =
+      make_with_random_values<tnsr::aa<DataVector, Dim>>(
+          make_not_null(&generator), make_not_null(&distribution),
+          used_for_size);
+  const auto pi = make_with_random_values<tnsr::aa<DataVector, Dim>>(
+      make_not_null(&generator), make_not_null(&distribution), used_for_size);
+  const auto phi = make_with_random_values<tnsr::iaa<DataVector, Dim>>(
+      make_not_null(&generator), make_not_null(&distribution), used_for_size);
+  const auto normal = make_with_random_values<tnsr::i<DataVector, Dim>>(
+      make_not_null(&generator), make_not_null(&distribution), used_for_size);
+
+  std::array<DataVector, 4> char_speeds{};
+  tnsr::aa<DataVector, Dim> v_spacetime_metric{used_for_size.size()};
+  tnsr::iaa<DataVector, Dim> v_zero{used_for_size.size()};
+  tnsr::aa<DataVector, Dim> v_plus{used_for_size.size()};
+  tnsr::aa<DataVector, Dim> v_minus{used_for_size.size()};
+  tnsr::aa<DataVector, Dim> spacetime_metric_from_char{used_for_size.size()};
+  tnsr::aa<DataVector, Dim> pi_from_char{used_for_size.size()};
+  tnsr::iaa<DataVector, Dim> phi_from_char{used_for_size.size()};
+  for (auto& char_speed : char_speeds) {
+    char_speed.destructive_resize(used_for_size.size());
+  }
+
+  const size_t allocations_before = TestHelpers::allocations_on_this_thread();
+  gh::characteristic_speeds(make_not_null(&char_speeds), gamma_1, lapse, shift,
+                            normal, mesh_velocity);
+  gh::characteristic_fields(
+      make_not_null(&v_spacetime_metric), make_not_null(&v_zero),
+      make_not_null(&v_plus), make_not_null(&v_minus), gamma_2,
+      inverse_spatial_metric, spacetime_metric, pi, phi, normal);
+  gh::evolved_fields_from_characteristic_fields(
+      make_not_null(&spacetime_metric_from_char), make_not_null(&pi_from_char),
+      make_not_null(&phi_from_char), gamma_2, v_spacetime_metric, v_zero,
+      v_plus, v_minus, normal);
+  CHECK(TestHelpers::allocations_on_this_thread() == allocations_before);
+
+  CHECK(char_speeds == gh::characteristic_speeds(gamma_1, lapse, shift, normal,
+                                                 mesh_velocity));
+  const auto char_fields = gh::characteristic_fields(
+      gamma_2, inverse_spatial_metric, spacetime_metric, pi, phi, normal);
+  CHECK(v_spacetime_metric ==
+        get<gh::Tags::VSpacetimeMetric<DataVector, Dim>>(char_fields));
+  CHECK(v_zero == get<gh::Tags::VZero<DataVector, Dim>>(char_fields));
+  CHECK(v_plus == get<gh::Tags::VPlus<DataVector, Dim>>(char_fields));
+  CHECK(v_minus == get<gh::Tags::VMinus<DataVector, Dim>>(char_fields));
+  // The inverse transformation holds for any normal and inverse spatial metric
+  CHECK_ITERABLE_APPROX(spacetime_metric_from_char, spacetime_metric);
+  CHECK_ITERABLE_APPROX(pi_from_char, pi);
+  CHECK_ITERABLE_APPROX(phi_from_char, phi);
+}
+
 // Test return-by-reference GH fundamental fields by comparing to Kerr-Schild
 template <typename Solution>
 void test_evolved_from_characteristic_fields_analytic(
@@ -600,6 +676,10 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.GeneralizedHarmonic.Characteristics",
   test_evolved_from_characteristic_fields<2, Frame::Inertial>();
   test_evolved_from_characteristic_fields<3, Frame::Inertial>();
 
+  test_no_allocations<1>();
+  test_no_allocations<2>();
+  test_no_allocations<3>();
+
   // Test GH characteristic fields against Kerr Schild
   test_characteristic_fields_analytic(solution, grid_size, lower_bound,
                                       upper_bound);
@@ -8,6 +8,7 @@
 #include <optional>
 #include <random>
 
+#include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
 #include "DataStructures/Tensor/EagerMath/RaiseOrLowerIndex.hpp"
@@ -16,11 +17,13 @@
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
 #include "Domain/TagsTimeDependent.hpp"
+#include "Evolution/DiscontinuousGalerkin/ApplyOnTiles.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/ConstraintDamping/Tags.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/Constraints.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/DuDtTempTags.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/DampedHarmonic.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/Dispatch.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/Harmonic.hpp"
 #include "Evolution/Systems/GeneralizedHarmonic/TimeDerivative.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "Helpers/DataStructures/MakeWithRandomValues.hpp"
@@ -861,6 +864,106 @@ void test_compute_dudt(const gsl::not_null<Generator*> generator) {
                                mesh_velocity_dot_three_index_constraint,
                                custom_approx_mesh_constraint);
 }
+
+template <size_t Dim, typename Generator, typename... TemporaryTags>
+void test_tiles(const gsl::not_null<Generator*> generator,
+                tmpl::list<TemporaryTags...> /*meta*/) {
+  std::uniform_real_distribution<> distribution(0.1, 1.0);
+  using gh_tags_list =
+      tmpl::list<gr::Tags::SpacetimeMetric<DataVector, Dim>,
+                 gh::Tags::Pi<DataVector, Dim>, gh::Tags::Phi<DataVector, Dim>>;
+  using DtVars = Variables<db::wrap_tags_in<Tags::dt, gh_tags_list>>;
+  using TemporaryVars = Variables<tmpl::list<TemporaryTags...>>;
+
+  const double time = 1.3;
+  const gh::gauges::DampedHarmonic gauge_condition{
+      100., std::array{1.2, 1.5, 1.7}, std::array{2, 4, 6}};
+  const Mesh<Dim> mesh(6, Spectral::Basis::Legendre,
+                       Spectral::Quadrature::GaussLobatto);
+  const size_t number_of_points = mesh.number_of_grid_points();
+  const DataVector used_for_size(number_of_points);
+
+  Variables<gh_tags_list> evolved_vars(number_of_points);
+  fill_with_random_values(make_not_null(&evolved_vars), generator,
+                          make_not_null(&distribution));
+  gr::spacetime_metric(
+      make_not_null(
+          &get<gr::Tags::SpacetimeMetric<DataVector, Dim>>(evolved_vars)),
+      TestHelpers::gr::random_lapse(generator, used_for_size),
+      TestHelpers::gr::random_shift<Dim>(generator, used_for_size),
+      TestHelpers::gr::random_spatial_metric<Dim>(generator, used_for_size));
+  const auto& spacetime_metric =
+      get<gr::Tags::SpacetimeMetric<DataVector, Dim>>(evolved_vars);
+  const auto& pi = get<gh::Tags::Pi<DataVector, Dim>>(evolved_vars);
+  const auto& phi = get<gh::Tags::Phi<DataVector, Dim>>(evolved_vars);
+
+  const auto logical_coords = logical_coordinates(mesh);
+  tnsr::I<DataVector, Dim, Frame::Inertial> inertial_coords{};
+  for (size_t i = 0; i < Dim; ++i) {
+    inertial_coords.get(i) = 2.0 * logical_coords.get(i);
+  }
+  InverseJacobian<DataVector, Dim, Frame::ElementLogical, Frame::Inertial>
+      inv_jac{number_of_points, 0.0};
+  for (size_t i = 0; i < Dim; ++i) {
+    inv_jac.get(i, i) = 0.5;
+  }
+  const auto partial_derivs =
+      partial_derivatives<gh_tags_list>(evolved_vars, mesh, inv_jac);
+  const auto gamma0 = make_with_random_values<Scalar<DataVector>>(
+      generator, make_not_null(&distribution), used_for_size);
+  const auto gamma1 = make_with_random_values<Scalar<DataVector>>(
+      generator, make_not_null(&distribution), used_for_size);
+  const auto gamma2 = make_with_random_values<Scalar<DataVector>>(
+      generator, make_not_null(&distribution), used_for_size);
+  const std::optional<tnsr::I<DataVector, Dim, Frame::Inertial>> mesh_velocity{
+      TestHelpers::gr::random_shift<Dim>(generator, used_for_size)};
+
+  CHECK(gh::TimeDerivative<Dim>::can_be_tiled(
+      spacetime_metric, pi, phi, gamma0, gamma1, gamma2, gauge_condition, mesh,
+      time, inertial_coords, inv_jac, mesh_velocity));
+  CHECK(gh::TimeDerivative<Dim>::can_be_tiled(
+      spacetime_metric, pi, phi, gamma0, gamma1, gamma2,
+      gh::gauges::Harmonic{}, mesh, time, inertial_coords, inv_jac,
+      mesh_velocity));
+
+  const auto evaluate = [&](const gsl::not_null<DtVars*> dt_vars,
+                            const gsl::not_null<TemporaryVars*> temporaries,
+                            const auto& call) {
+    call(make_not_null(
+             &get<Tags::dt<gr::Tags::SpacetimeMetric<DataVector, Dim>>>(
+                 *dt_vars)),
+         make_not_null(&get<Tags::dt<gh::Tags::Pi<DataVector, Dim>>>(*dt_vars)),
+         make_not_null(
+             &get<Tags::dt<gh::Tags::Phi<DataVector, Dim>>>(*dt_vars)),
+         make_not_null(&get<TemporaryTags>(*temporaries))...,
+         get<Tags::deriv<gr::Tags::SpacetimeMetric<DataVector, Dim>,
+                         tmpl::size_t<Dim>, Frame::Inertial>>(partial_derivs),
+         get<Tags::deriv<gh::Tags::Pi<DataVector, Dim>, tmpl::size_t<Dim>,
+                         Frame::Inertial>>(partial_derivs),
+         get<Tags::deriv<gh::Tags::Phi<DataVector, Dim>, tmpl::size_t<Dim>,
+                         Frame::Inertial>>(partial_derivs),
+         spacetime_metric, pi, phi, gamma0, gamma1, gamma2, gauge_condition,
+         mesh, time, inertial_coords, inv_jac, mesh_velocity);
+  };
+  const auto apply = [](const auto&... args) {
+    gh::TimeDerivative<Dim>::apply(args...);
+  };
+
+  DtVars dt_vars(number_of_points, 0.0);
+  TemporaryVars temporaries(number_of_points, 0.0);
+  evaluate(make_not_null(&dt_vars), make_not_null(&temporaries), apply);
+
+  DtVars tiled_dt_vars(number_of_points, 0.0);
+  TemporaryVars tiled_temporaries(number_of_points, 0.0);
+  evaluate(make_not_null(&tiled_dt_vars), make_not_null(&tiled_temporaries),
+           [&apply, &number_of_points](const auto&... args) {
+             evolution::dg::apply_on_tiles(apply, number_of_points, 16,
+                                           args...);
+           });
+  // Identical, not just approximately equal
+  CHECK(tiled_dt_vars == dt_vars);
+  CHECK(tiled_temporaries == temporaries);
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Evolution.Systems.GeneralizedHarmonic.DuDt",
@@ -871,4 +974,10 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.GeneralizedHarmonic.DuDt",
   test_compute_dudt<1>(make_not_null(&generator));
   test_compute_dudt<2>(make_not_null(&generator));
   test_compute_dudt<3>(make_not_null(&generator));
+  test_tiles<1>(make_not_null(&generator),
+                typename gh::TimeDerivative<1>::temporary_tags{});
+  test_tiles<2>(make_not_null(&generator),
+                typename gh::TimeDerivative<2>::temporary_tags{});
+  test_tiles<3>(make_not_null(&generator),
+                typename gh::TimeDerivative<3>::temporary_tags{});
 }
@@ -0,0 +1,183 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <random>
+#include <type_traits>
+
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "DataStructures/DataBox/TagName.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/FusedTimeDerivative.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/DampedHarmonic.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/Gauges.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/GaugeSourceFunctions/Harmonic.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/System.hpp"
+#include "Evolution/Systems/GeneralizedHarmonic/TimeDerivative.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
+#include "Helpers/PointwiseFunctions/GeneralRelativity/TestHelpers.hpp"
+#include "NumericalAlgorithms/LinearOperators/PartialDerivatives.hpp"
+#include "NumericalAlgorithms/Spectral/Basis.hpp"
+#include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
+#include "PointwiseFunctions/GeneralRelativity/SpacetimeMetric.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+template <size_t Dim, typename Generator>
+void test_against_time_derivative(
+    const gsl::not_null<Generator*> generator,
+    const gh::gauges::GaugeCondition& gauge_condition,
+    const bool with_mesh_velocity) {
+  CAPTURE(Dim);
+  CAPTURE(gauge_condition.is_harmonic());
+  CAPTURE(with_mesh_velocity);
+  std::uniform_real_distribution<> distribution(0.1, 1.0);
+  using gh_tags_list =
+      tmpl::list<gr::Tags::SpacetimeMetric<DataVector, Dim>,
+                 gh::Tags::Pi<DataVector, Dim>, gh::Tags::Phi<DataVector, Dim>>;
+  using DtVars = Variables<db::wrap_tags_in<Tags::dt, gh_tags_list>>;
+
+  const double time = 1.3;
+  const Mesh<Dim> mesh(5, Spectral::Basis::Legendre,
+                       Spectral::Quadrature::GaussLobatto);
+  const size_t number_of_points = mesh.number_of_grid_points();
+  const DataVector used_for_size(number_of_points);
+
+  Variables<gh_tags_list> evolved_vars(number_of_points);
+  fill_with_random_values(make_not_null(&evolved_vars), generator,
+                          make_not_null(&distribution));
+  gr::spacetime_metric(
+      make_not_null(
+          &get<gr::Tags::SpacetimeMetric<DataVector, Dim>>(evolved_vars)),
+      TestHelpers::gr::random_lapse(generator, used_for_size),
+      TestHelpers::gr::random_shift<Dim>(generator, used_for_size),
+      TestHelpers::gr::random_spatial_metric<Dim>(generator, used_for_size));
+  const auto& spacetime_metric =
+      get<gr::Tags::SpacetimeMetric<DataVector, Dim>>(evolved_vars);
+  const auto& pi = get<gh::Tags::Pi<DataVector, Dim>>(evolved_vars);
+  const auto& phi = get<gh::Tags::Phi<DataVector, Dim>>(evolved_vars);
+
+  const auto logical_coords = logical_coordinates(mesh);
+  tnsr::I<DataVector, Dim, Frame::Inertial> inertial_coords{};
+  for (size_t i = 0; i < Dim; ++i) {
+    inertial_coords.get(i) = 2.0 * logical_coords.get(i);
+  }
+  InverseJacobian<DataVector, Dim, Frame::ElementLogical, Frame::Inertial>
+      inv_jac{number_of_points, 0.0};
+  for (size_t i = 0; i < Dim; ++i) {
+    inv_jac.get(i, i) = 0.5;
+  }
+  const auto partial_derivs =
+      partial_derivatives<gh_tags_list>(evolved_vars, mesh, inv_jac);
+  const auto gamma0 = make_with_random_values<Scalar<DataVector>>(
+      generator, make_not_null(&distribution), used_for_size);
+  const auto gamma1 = make_with_random_values<Scalar<DataVector>>(
+      generator, make_not_null(&distribution), used_for_size);
+  const auto gamma2 = make_with_random_values<Scalar<DataVector>>(
+      generator, make_not_null(&distribution), used_for_size);
+  std::optional<tnsr::I<DataVector, Dim, Frame::Inertial>> mesh_velocity{};
+  if (with_mesh_velocity) {
+    mesh_velocity = TestHelpers::gr::random_shift<Dim>(generator,
+                                                       used_for_size);
+  }
+
+  const auto evaluate = [&](const auto time_derivative,
+                            const gsl::not_null<DtVars*> dt_vars,
+                            const auto temporaries) {
+    using TimeDerivative = std::decay_t<decltype(time_derivative)>;
+    tmpl::as_pack<typename TimeDerivative::temporary_tags>(
+        [&](auto... temporary_tags) {
+          TimeDerivative::apply(
+              make_not_null(
+                  &get<Tags::dt<gr::Tags::SpacetimeMetric<DataVector, Dim>>>(
+                      *dt_vars)),
+              make_not_null(
+                  &get<Tags::dt<gh::Tags::Pi<DataVector, Dim>>>(*dt_vars)),
+              make_not_null(
+                  &get<Tags::dt<gh::Tags::Phi<DataVector, Dim>>>(*dt_vars)),
+              make_not_null(
+                  &get<tmpl::type_from<decltype(temporary_tags)>>(
+                      *temporaries))...,
+              get<Tags::deriv<gr::Tags::SpacetimeMetric<DataVector, Dim>,
+                              tmpl::size_t<Dim>, Frame::Inertial>>(
+                  partial_derivs),
+              get<Tags::deriv<gh::Tags::Pi<DataVector, Dim>, tmpl::size_t<Dim>,
+                              Frame::Inertial>>(partial_derivs),
+              get<Tags::deriv<gh::Tags::Phi<DataVector, Dim>,
+                              tmpl::size_t<Dim>, Frame::Inertial>>(
+                  partial_derivs),
+              spacetime_metric, pi, phi, gamma0, gamma1, gamma2,
+              gauge_condition, mesh, time, inertial_coords, inv_jac,
+              mesh_velocity);
+        });
+  };
+
+  DtVars expected_dt_vars(number_of_points, 0.0);
+  Variables<typename gh::TimeDerivative<Dim>::temporary_tags>
+      expected_temporaries(number_of_points, 0.0);
+  evaluate(gh::TimeDerivative<Dim>{}, make_not_null(&expected_dt_vars),
+           make_not_null(&expected_temporaries));
+
+  DtVars dt_vars(number_of_points, 0.0);
+  Variables<typename gh::FusedTimeDerivative<Dim>::temporary_tags>
+      temporaries(number_of_points, 0.0);
+  evaluate(gh::FusedTimeDerivative<Dim>{}, make_not_null(&dt_vars),
+           make_not_null(&temporaries));
+
+  // The order of the floating point operations differs
+  Approx custom_approx = Approx::custom().epsilon(1.e-11).scale(1.0);
+  CHECK_VARIABLES_CUSTOM_APPROX(dt_vars, expected_dt_vars, custom_approx);
+  tmpl::for_each<typename gh::FusedTimeDerivative<Dim>::temporary_tags>(
+      [&](auto tag_v) {
+        using tag = tmpl::type_from<decltype(tag_v)>;
+        if (std::is_same_v<tag, gr::Tags::SqrtDetSpatialMetric<DataVector>> and
+            gauge_condition.is_harmonic()) {
+          // Not computed in harmonic gauge
+          return;
+        }
+        CAPTURE(db::tag_name<tag>());
+        CHECK_ITERABLE_CUSTOM_APPROX(get<tag>(temporaries),
+                                     get<tag>(expected_temporaries),
+                                     custom_approx);
+      });
+}
+
+template <size_t Dim, typename Generator>
+void test(const gsl::not_null<Generator*> generator) {
+  static_assert(
+      std::is_same_v<typename gh::System<Dim>::
+                         compute_volume_time_derivative_terms,
+                     gh::TimeDerivative<Dim>>);
+  static_assert(
+      std::is_same_v<typename gh::System<Dim, gh::FusedTimeDerivative<Dim>>::
+                         compute_volume_time_derivative_terms,
+                     gh::FusedTimeDerivative<Dim>>);
+
+  const gh::gauges::DampedHarmonic damped_harmonic{
+      100., std::array{1.2, 1.5, 1.7}, std::array{2, 4, 6}};
+  for (const bool with_mesh_velocity : {false, true}) {
+    test_against_time_derivative<Dim>(generator, gh::gauges::Harmonic{},
+                                      with_mesh_velocity);
+    test_against_time_derivative<Dim>(generator, damped_harmonic,
+                                      with_mesh_velocity);
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Evolution.Systems.GeneralizedHarmonic.FusedDuDt",
+                  "[Unit][GeneralizedHarmonic]") {
+  MAKE_GENERATOR(generator);
+  test<1>(make_not_null(&generator));
+  test<2>(make_not_null(&generator));
+  test<3>(make_not_null(&generator));
+}
@@ -3,15 +3,24 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cstddef>
+#include <optional>
+#include <random>
 #include <string>
+#include <utility>
 
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/EagerMath/DotProduct.hpp"
+#include "DataStructures/Tensor/EagerMath/Magnitude.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/BoundaryCorrections/Factory.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/BoundaryCorrections/Hll.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/System.hpp"
 #include "Framework/SetupLocalPythonEnvironment.hpp"
 #include "Framework/TestCreation.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
 #include "Helpers/Evolution/DiscontinuousGalerkin/BoundaryCorrections.hpp"
 #include "NumericalAlgorithms/Spectral/Basis.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
@@ -19,6 +28,7 @@
 #include "PointwiseFunctions/Hydro/EquationsOfState/EquationOfState.hpp"
 #include "PointwiseFunctions/Hydro/EquationsOfState/PolytropicFluid.hpp"
 #include "PointwiseFunctions/Hydro/Tags.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/TaggedTuple.hpp"
 
 namespace {
@@ -46,6 +56,203 @@ struct ConvertPolytropic {
   }
 };
 
+// The characteristic speeds as computed by the DataVector implementation of
+// `Hll::dg_package_data` that preceded the pointwise SIMD kernel
+std::pair<DataVector, DataVector> data_vector_char_speeds(
+    const bool use_hydro_speeds, const double light_speed_density_cutoff,
+    const Scalar<DataVector>& lapse,
+    const tnsr::I<DataVector, 3, Frame::Inertial>& shift,
+    const tnsr::i<DataVector, 3, Frame::Inertial>& spatial_velocity_one_form,
+    const Scalar<DataVector>& rest_mass_density,
+    const Scalar<DataVector>& electron_fraction,
+    const Scalar<DataVector>& temperature,
+    const tnsr::I<DataVector, 3, Frame::Inertial>& spatial_velocity,
+    const tnsr::i<DataVector, 3, Frame::Inertial>& normal_covector,
+    const std::optional<Scalar<DataVector>>& normal_dot_mesh_velocity,
+    const EquationsOfState::EquationOfState<true, 3>& equation_of_state) {
+  const DataVector shift_dot_normal = get(dot_product(shift, normal_covector));
+  DataVector outgoing_char_speed = get(lapse) - shift_dot_normal;
+  DataVector ingoing_char_speed = -get(lapse) - shift_dot_normal;
+  if (use_hydro_speeds) {
+    const DataVector sound_speed_squared =
+        clamp(get(equation_of_state
+                      .sound_speed_squared_from_density_and_temperature(
+                          rest_mass_density, temperature, electron_fraction)),
+              0.0, 1.0);
+    const DataVector v_dot_normal =
+        get(dot_product(spatial_velocity, normal_covector));
+    const DataVector v_squared =
+        clamp(get(dot_product(spatial_velocity, spatial_velocity_one_form)),
+              0.0, 1.0 - 1.0e-8);
+    const DataVector one_minus_v2_cs2 = 1.0 - v_squared * sound_speed_squared;
+    const DataVector one_minus_cs2 = 1.0 - sound_speed_squared;
+    const DataVector discriminant =
+        sqrt(max(sound_speed_squared * (1.0 - v_squared) *
+                     (one_minus_v2_cs2 -
+                      v_dot_normal * v_dot_normal * one_minus_cs2),
+                 0.0));
+    const DataVector lapse_over_one_minus_v2_cs2 =
+        get(lapse) / one_minus_v2_cs2;
+    for (size_t i = 0; i < lapse.size(); ++i) {
+      if (get(rest_mass_density)[i] > light_speed_density_cutoff) {
+        outgoing_char_speed[i] =
+            lapse_over_one_minus_v2_cs2[i] *
+                (v_dot_normal[i] * one_minus_cs2[i] + discriminant[i]) -
+            shift_dot_normal[i];
+        ingoing_char_speed[i] =
+            lapse_over_one_minus_v2_cs2[i] *
+                (v_dot_normal[i] * one_minus_cs2[i] - discriminant[i]) -
+            shift_dot_normal[i];
+      }
+    }
+  }
+  if (normal_dot_mesh_velocity.has_value()) {
+    outgoing_char_speed -= get(*normal_dot_mesh_velocity);
+    ingoing_char_speed -= get(*normal_dot_mesh_velocity);
+  }
+  return {std::move(outgoing_char_speed), std::move(ingoing_char_speed)};
+}
+
+// Check the characteristic speeds of the pointwise SIMD kernel against the
+// DataVector implementation, with points on both sides of the light speed
+// density cutoff and a number of points that is not a multiple of the SIMD
+// width.
+void test_simd_char_speeds(const gsl::not_null<std::mt19937*> gen) {
+  const size_t num_points = 13;
+  const DataVector used_for_size{num_points};
+  const double light_speed_density_cutoff = 1.0e-8;
+  const grmhd::ValenciaDivClean::BoundaryCorrections::Hll hll{
+      1.0e-30, light_speed_density_cutoff};
+  const auto equation_of_state =
+      EquationsOfState::PolytropicFluid<true>{100.0, 2.0}.promote_to_3d_eos();
+
+  std::uniform_real_distribution<> dist(-1.0, 1.0);
+  std::uniform_real_distribution<> velocity_dist(-0.3, 0.3);
+  std::uniform_real_distribution<> positive_dist(0.3, 1.0);
+  std::uniform_real_distribution<> shift_dist(-0.02, 0.02);
+
+  using scalar = Scalar<DataVector>;
+  using covector = tnsr::i<DataVector, 3, Frame::Inertial>;
+  using vector = tnsr::I<DataVector, 3, Frame::Inertial>;
+  const auto random_scalar = [&gen, &dist, &used_for_size]() {
+    return make_with_random_values<scalar>(gen, make_not_null(&dist),
+                                           used_for_size);
+  };
+  const auto random_vector = [&gen, &dist, &used_for_size]() {
+    return make_with_random_values<vector>(gen, make_not_null(&dist),
+                                           used_for_size);
+  };
+  const auto tilde_d = random_scalar();
+  const auto tilde_ye = random_scalar();
+  const auto tilde_tau = random_scalar();
+  const auto tilde_s = make_with_random_values<covector>(
+      gen, make_not_null(&dist), used_for_size);
+  const auto tilde_phi = random_scalar();
+  const auto flux_tilde_d = random_vector();
+  const auto flux_tilde_ye = random_vector();
+  const auto flux_tilde_tau = random_vector();
+  const auto flux_tilde_s =
+      make_with_random_values<tnsr::Ij<DataVector, 3, Frame::Inertial>>(
+          gen, make_not_null(&dist), used_for_size);
+  const auto flux_tilde_b =
+      make_with_random_values<tnsr::IJ<DataVector, 3, Frame::Inertial>>(
+          gen, make_not_null(&dist), used_for_size);
+  const auto flux_tilde_phi = random_vector();
+
+  const auto lapse = make_with_random_values<scalar>(
+      gen, make_not_null(&positive_dist), used_for_size);
+  const auto shift = make_with_random_values<vector>(
+      gen, make_not_null(&shift_dist), used_for_size);
+  const auto spatial_velocity = make_with_random_values<vector>(
+      gen, make_not_null(&velocity_dist), used_for_size);
+  // Flat spatial metric
+  covector spatial_velocity_one_form{};
+  for (size_t i = 0; i < 3; ++i) {
+    spatial_velocity_one_form.get(i) = spatial_velocity.get(i);
+  }
+  auto rest_mass_density = make_with_random_values<scalar>(
+      gen, make_not_null(&positive_dist), used_for_size);
+  // Put every third point in the atmosphere
+  for (size_t i = 0; i < num_points; i += 3) {
+    get(rest_mass_density)[i] = 1.0e-10;
+  }
+  const scalar electron_fraction{num_points, 0.1};
+  const auto temperature = make_with_random_values<scalar>(
+      gen, make_not_null(&positive_dist), used_for_size);
+  auto normal_covector = make_with_random_values<covector>(
+      gen, make_not_null(&dist), used_for_size);
+  const scalar normal_magnitude = magnitude(normal_covector);
+  for (size_t i = 0; i < 3; ++i) {
+    normal_covector.get(i) /= get(normal_magnitude);
+  }
+  // Only the normal covector and the normal dot mesh velocity are used
+  const vector normal_vector{num_points, 0.0};
+  const vector mesh_velocity{num_points, 0.0};
+
+  for (const bool use_hydro_speeds : {true, false}) {
+    const vector tilde_b = use_hydro_speeds ? vector{num_points, 0.0}
+                                            : random_vector();
+    for (const bool moving_mesh : {false, true}) {
+      CAPTURE(use_hydro_speeds);
+      CAPTURE(moving_mesh);
+      const std::optional<scalar> normal_dot_mesh_velocity =
+          moving_mesh ? std::optional{make_with_random_values<scalar>(
+                            gen, make_not_null(&shift_dist), used_for_size)}
+                      : std::nullopt;
+      scalar packaged_tilde_d{num_points};
+      scalar packaged_tilde_ye{num_points};
+      scalar packaged_tilde_tau{num_points};
+      covector packaged_tilde_s{num_points};
+      vector packaged_tilde_b{num_points};
+      scalar packaged_tilde_phi{num_points};
+      scalar packaged_normal_dot_flux_tilde_d{num_points};
+      scalar packaged_normal_dot_flux_tilde_ye{num_points};
+      scalar packaged_normal_dot_flux_tilde_tau{num_points};
+      covector packaged_normal_dot_flux_tilde_s{num_points};
+      vector packaged_normal_dot_flux_tilde_b{num_points};
+      scalar packaged_normal_dot_flux_tilde_phi{num_points};
+      scalar packaged_largest_outgoing_char_speed{num_points};
+      scalar packaged_largest_ingoing_char_speed{num_points};
+      const double max_speed = hll.dg_package_data(
+          make_not_null(&packaged_tilde_d), make_not_null(&packaged_tilde_ye),
+          make_not_null(&packaged_tilde_tau), make_not_null(&packaged_tilde_s),
+          make_not_null(&packaged_tilde_b), make_not_null(&packaged_tilde_phi),
+          make_not_null(&packaged_normal_dot_flux_tilde_d),
+          make_not_null(&packaged_normal_dot_flux_tilde_ye),
+          make_not_null(&packaged_normal_dot_flux_tilde_tau),
+          make_not_null(&packaged_normal_dot_flux_tilde_s),
+          make_not_null(&packaged_normal_dot_flux_tilde_b),
+          make_not_null(&packaged_normal_dot_flux_tilde_phi),
+          make_not_null(&packaged_largest_outgoing_char_speed),
+          make_not_null(&packaged_largest_ingoing_char_speed), tilde_d,
+          tilde_ye, tilde_tau, tilde_s, tilde_b, tilde_phi, flux_tilde_d,
+          flux_tilde_ye, flux_tilde_tau, flux_tilde_s, flux_tilde_b,
+          flux_tilde_phi, lapse, shift, spatial_velocity_one_form,
+          rest_mass_density, electron_fraction, temperature, spatial_velocity,
+          normal_covector, normal_vector,
+          moving_mesh ? std::optional{mesh_velocity} : std::nullopt,
+          normal_dot_mesh_velocity, *equation_of_state);
+
+      const auto [expected_outgoing_char_speed, expected_ingoing_char_speed] =
+          data_vector_char_speeds(
+              use_hydro_speeds, light_speed_density_cutoff, lapse, shift,
+              spatial_velocity_one_form, rest_mass_density, electron_fraction,
+              temperature, spatial_velocity, normal_covector,
+              normal_dot_mesh_velocity, *equation_of_state);
+      CHECK_ITERABLE_APPROX(get(packaged_largest_outgoing_char_speed),
+                            expected_outgoing_char_speed);
+      CHECK_ITERABLE_APPROX(get(packaged_largest_ingoing_char_speed),
+                            expected_ingoing_char_speed);
+      CHECK(max_speed ==
+            approx(std::max(max(abs(expected_outgoing_char_speed)),
+                            max(abs(expected_ingoing_char_speed)))));
+      CHECK(packaged_tilde_d == tilde_d);
+      CHECK_ITERABLE_APPROX(packaged_normal_dot_flux_tilde_d,
+                            dot_product(flux_tilde_d, normal_covector));
+    }
+  }
+}
+
 SPECTRE_TEST_CASE("Unit.GrMhd.ValenciaDivClean.BoundaryCorrections.Hll",
                   "[Unit][GrMhd]") {
   PUPable_reg(grmhd::ValenciaDivClean::BoundaryCorrections::Hll);
@@ -124,5 +331,7 @@ SPECTRE_TEST_CASE("Unit.GrMhd.ValenciaDivClean.BoundaryCorrections.Hll",
         grmhd::ValenciaDivClean::BoundaryCorrections::Hll{2.0e-30, 1.0e-8});
   CHECK(grmhd::ValenciaDivClean::BoundaryCorrections::Hll{1.0e-30, 1.0e-8} !=
         grmhd::ValenciaDivClean::BoundaryCorrections::Hll{1.0e-30, 2.0e-8});
+
+  test_simd_char_speeds(make_not_null(&gen));
 }
 }  // namespace
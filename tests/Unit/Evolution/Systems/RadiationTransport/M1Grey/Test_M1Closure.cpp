@@ -357,10 +357,129 @@ void check_random() {
       comoving_momentum_density_spatial, comoving_momentum_density_normal,
       pressure_tensor);
 }
+
+// Compute the closure of two species at once, on enough points that the root
+// find is done with full SIMD batches, and check that each species gets the
+// same result as when it is computed alone.
+void check_multiple_species() {
+  const size_t used_for_size = 20;
+  using species0 = neutrinos::ElectronNeutrinos<0>;
+  using species1 = neutrinos::ElectronAntiNeutrinos<0>;
+  using closure = RadiationTransport::M1Grey::ComputeM1Closure<
+      tmpl::list<species0, species1>>;
+  using single_closure =
+      RadiationTransport::M1Grey::ComputeM1Closure<tmpl::list<species0>>;
+
+  MAKE_GENERATOR(gen);
+  std::uniform_real_distribution metric_distribution(-0.1, 0.1);
+  std::uniform_real_distribution momentum_distribution(-10.0, 10.0);
+  std::uniform_real_distribution velocity_distribution(-0.5, 0.5);
+
+  auto spatial_metric =
+      make_with_random_values<tnsr::ii<DataVector, 3, Frame::Inertial>>(
+          make_not_null(&gen), make_not_null(&metric_distribution),
+          used_for_size);
+  for (size_t i = 0; i < 3; ++i) {
+    spatial_metric.get(i, i) += 1.0;
+  }
+  const auto& inv_spatial_metric =
+      determinant_and_inverse(spatial_metric).second;
+  auto fluid_velocity =
+      make_with_random_values<tnsr::I<DataVector, 3, Frame::Inertial>>(
+          make_not_null(&gen), make_not_null(&velocity_distribution),
+          used_for_size);
+  // Include a point with a fluid at rest
+  for (size_t i = 0; i < 3; ++i) {
+    fluid_velocity.get(i)[0] = 0.0;
+  }
+  Scalar<DataVector> fluid_lorentz_factor{};
+  tenex::evaluate(
+      make_not_null(&fluid_lorentz_factor),
+      1.0 / sqrt(1.0 - fluid_velocity(ti::I) * spatial_metric(ti::i, ti::j) *
+                           fluid_velocity(ti::J)));
+
+  std::array<tnsr::i<DataVector, 3, Frame::Inertial>, 2> momentum_density{};
+  std::array<Scalar<DataVector>, 2> energy_density{};
+  for (size_t species = 0; species < 2; ++species) {
+    gsl::at(momentum_density, species) =
+        make_with_random_values<tnsr::i<DataVector, 3, Frame::Inertial>>(
+            make_not_null(&gen), make_not_null(&momentum_distribution),
+            used_for_size);
+    const auto momentum_magnitude =
+        magnitude(gsl::at(momentum_density, species), inv_spatial_metric);
+    gsl::at(energy_density, species) = Scalar<DataVector>(used_for_size);
+    for (size_t i = 0; i < used_for_size; ++i) {
+      std::uniform_real_distribution energy_distribution(
+          get(momentum_magnitude)[i], 2.0 * get(momentum_magnitude)[i]);
+      get(gsl::at(energy_density, species))[i] = energy_distribution(gen);
+    }
+  }
+
+  std::array<Scalar<DataVector>, 3> closure_factor{};
+  std::array<tnsr::II<DataVector, 3, Frame::Inertial>, 3> pressure_tensor{};
+  std::array<Scalar<DataVector>, 3> comoving_energy_density{};
+  std::array<Scalar<DataVector>, 3> comoving_momentum_density_normal{};
+  std::array<tnsr::i<DataVector, 3, Frame::Inertial>, 3>
+      comoving_momentum_density_spatial{};
+  for (size_t i = 0; i < 3; ++i) {
+    gsl::at(closure_factor, i) = Scalar<DataVector>(used_for_size, -1.0);
+    gsl::at(pressure_tensor, i) =
+        tnsr::II<DataVector, 3, Frame::Inertial>(used_for_size);
+    gsl::at(comoving_energy_density, i) = Scalar<DataVector>(used_for_size);
+    gsl::at(comoving_momentum_density_normal, i) =
+        Scalar<DataVector>(used_for_size);
+    gsl::at(comoving_momentum_density_spatial, i) =
+        tnsr::i<DataVector, 3, Frame::Inertial>(used_for_size);
+  }
+
+  closure::apply(make_not_null(&closure_factor[0]),
+                 make_not_null(&closure_factor[1]),
+                 make_not_null(&pressure_tensor[0]),
+                 make_not_null(&pressure_tensor[1]),
+                 make_not_null(&comoving_energy_density[0]),
+                 make_not_null(&comoving_energy_density[1]),
+                 make_not_null(&comoving_momentum_density_normal[0]),
+                 make_not_null(&comoving_momentum_density_normal[1]),
+                 make_not_null(&comoving_momentum_density_spatial[0]),
+                 make_not_null(&comoving_momentum_density_spatial[1]),
+                 energy_density[0], energy_density[1], momentum_density[0],
+                 momentum_density[1], fluid_velocity, fluid_lorentz_factor,
+                 spatial_metric, inv_spatial_metric);
+
+  for (size_t species = 0; species < 2; ++species) {
+    CAPTURE(species);
+    check_closure_consistency(
+        spatial_metric, fluid_velocity, fluid_lorentz_factor,
+        gsl::at(energy_density, species), gsl::at(momentum_density, species),
+        gsl::at(closure_factor, species),
+        gsl::at(comoving_energy_density, species),
+        gsl::at(comoving_momentum_density_spatial, species),
+        gsl::at(comoving_momentum_density_normal, species),
+        gsl::at(pressure_tensor, species));
+    single_closure::apply(
+        make_not_null(&closure_factor[2]), make_not_null(&pressure_tensor[2]),
+        make_not_null(&comoving_energy_density[2]),
+        make_not_null(&comoving_momentum_density_normal[2]),
+        make_not_null(&comoving_momentum_density_spatial[2]),
+        gsl::at(energy_density, species), gsl::at(momentum_density, species),
+        fluid_velocity, fluid_lorentz_factor, spatial_metric,
+        inv_spatial_metric);
+    CHECK_ITERABLE_APPROX(gsl::at(closure_factor, species), closure_factor[2]);
+    CHECK_ITERABLE_APPROX(gsl::at(pressure_tensor, species),
+                          pressure_tensor[2]);
+    CHECK_ITERABLE_APPROX(gsl::at(comoving_energy_density, species),
+                          comoving_energy_density[2]);
+    CHECK_ITERABLE_APPROX(gsl::at(comoving_momentum_density_normal, species),
+                          comoving_momentum_density_normal[2]);
+    CHECK_ITERABLE_APPROX(gsl::at(comoving_momentum_density_spatial, species),
+                          comoving_momentum_density_spatial[2]);
+  }
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Evolution.Systems.RadiationTransport.M1Grey.M1Closure",
                   "[Unit][M1Grey]") {
   check_limits();
   check_random();
+  check_multiple_species();
 }
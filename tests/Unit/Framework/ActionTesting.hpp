@@ -470,10 +470,12 @@ class MockDistributedObjectProxy : public CProxyElement_ArrayElement {
 
   template <typename InboxTag, typename Data>
   void receive_data(const typename InboxTag::temporal_id& id, Data&& data,
-                    const bool enable_if_disabled = false) {
+                    const bool enable_if_disabled = false,
+                    const CkEntryOptions* /*options*/ = nullptr) {
     // The variable `enable_if_disabled` might be useful in the future but is
     // not needed now. However, it is required by the interface to be compliant
-    // with the Algorithm invocations.
+    // with the Algorithm invocations. Message priorities don't matter since
+    // the test decides in which order actions run.
     (void)enable_if_disabled;
     InboxTag::insert_into_inbox(make_not_null(&tuples::get<InboxTag>(*inbox_)),
                                 id, std::forward<Data>(data));
@@ -587,7 +589,8 @@ class MockCollectionOfDistributedObjectsProxy
 
   template <typename InboxTag, typename Data>
   void receive_data(const typename InboxTag::temporal_id& id, const Data& data,
-                    const bool enable_if_disabled = false) {
+                    const bool enable_if_disabled = false,
+                    const CkEntryOptions* /*options*/ = nullptr) {
     // Call (and possibly create/store) a proxy on the local node and core
     // that references each of the mock_distributed_objects.
     for (const auto& key_value_pair : *mock_distributed_objects_) {
@@ -437,6 +437,19 @@ class MockDistributedObject {
   /// phase.
   size_t get_next_action_index() const { return algorithm_step_; }
 
+  /// Mocks `Parallel::DistributedObject::take_iterable_action_wall_time()`.
+  /// The wall time isn't measured, set it with
+  /// `set_iterable_action_wall_time()` instead.
+  double take_iterable_action_wall_time() {
+    const double result = iterable_action_wall_time_;
+    iterable_action_wall_time_ = 0.0;
+    return result;
+  }
+
+  void set_iterable_action_wall_time(const double wall_time) {
+    iterable_action_wall_time_ = wall_time;
+  }
+
   /// Invoke the next action in the action list for the current phase,
   /// failing if it was not ready.
   void next_action();
@@ -589,10 +602,12 @@ class MockDistributedObject {
 
   template <typename InboxTag, typename Data>
   void receive_data(const typename InboxTag::temporal_id& id, Data&& data,
-                    const bool enable_if_disabled = false) {
+                    const bool enable_if_disabled = false,
+                    const CkEntryOptions* /*options*/ = nullptr) {
     // The variable `enable_if_disabled` might be useful in the future but is
     // not needed now. However, it is required by the interface to be compliant
-    // with the Algorithm invocations.
+    // with the Algorithm invocations. Message priorities don't matter since
+    // the test decides in which order actions run.
     (void)enable_if_disabled;
     InboxTag::insert_into_inbox(
         make_not_null(&tuples::get<InboxTag>(*inboxes_)), id,
@@ -710,6 +725,7 @@ class MockDistributedObject {
   // The next action we should execute.
   size_t algorithm_step_ = 0;
   bool performing_action_ = false;
+  double iterable_action_wall_time_ = 0.0;
   Parallel::Phase phase_{Parallel::Phase::Initialization};
 
   size_t mock_node_{0};
@@ -0,0 +1,45 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "Helpers/Utilities/Allocations/CountAllocations.hpp"
+
+SPECTRE_TEST_CASE("Unit.TestHelpers.CountAllocations", "[Unit]") {
+  size_t allocations_before = TestHelpers::allocations_on_this_thread();
+  {
+    const std::vector<double> vector(10, 1.0);
+    CHECK(TestHelpers::allocations_on_this_thread() == allocations_before + 1);
+  }
+  allocations_before = TestHelpers::allocations_on_this_thread();
+  {
+    DataVector a{10, 1.0};
+    const DataVector b{10, 2.0};
+    CHECK(TestHelpers::allocations_on_this_thread() == allocations_before + 2);
+    // Expression templates write into the existing allocation
+    a = 2.0 * a + b;
+    CHECK(TestHelpers::allocations_on_this_thread() == allocations_before + 2);
+    const auto pointer = std::make_unique<double>(1.0);
+    CHECK(TestHelpers::allocations_on_this_thread() == allocations_before + 3);
+  }
+
+  // Allocations on other threads aren't counted on this thread
+  allocations_before = TestHelpers::allocations_on_this_thread();
+  size_t allocations_on_other_thread = 0;
+  std::thread other_thread{[&allocations_on_other_thread]() {
+    const size_t before = TestHelpers::allocations_on_this_thread();
+    const std::vector<int> vector(5);
+    allocations_on_other_thread =
+        TestHelpers::allocations_on_this_thread() - before;
+  }};
+  // Starting the thread may allocate on this thread, so don't check this
+  // thread's count
+  other_thread.join();
+  CHECK(allocations_on_other_thread == 1);
+}
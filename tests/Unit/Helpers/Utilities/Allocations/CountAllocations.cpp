@@ -0,0 +1,125 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Helpers/Utilities/Allocations/CountAllocations.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+namespace {
+// A trivial thread-local, so reading it never allocates
+thread_local size_t allocations = 0;
+
+void* allocate(const std::size_t size) noexcept {
+  ++allocations;
+  // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+  return std::malloc(std::max(size, std::size_t{1}));
+}
+
+void* allocate(const std::size_t size,
+               const std::align_val_t alignment) noexcept {
+  ++allocations;
+  void* pointer = nullptr;
+  if (posix_memalign(&pointer,
+                     std::max(static_cast<std::size_t>(alignment),
+                              sizeof(void*)),
+                     std::max(size, std::size_t{1})) != 0) {
+    return nullptr;
+  }
+  return pointer;
+}
+
+template <typename... Alignment>
+void* allocate_or_throw(const std::size_t size,
+                        const Alignment... alignment) {
+  void* const pointer = allocate(size, alignment...);
+  if (pointer == nullptr) {
+    throw std::bad_alloc{};
+  }
+  return pointer;
+}
+
+// NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+void deallocate(void* const pointer) noexcept { std::free(pointer); }
+}  // namespace
+
+namespace TestHelpers {
+size_t allocations_on_this_thread() { return allocations; }
+}  // namespace TestHelpers
+
+// Memory from both `std::malloc` and `posix_memalign` is released with
+// `std::free`, so all versions of `operator delete` are the same.
+void* operator new(const std::size_t size) { return allocate_or_throw(size); }
+void* operator new[](const std::size_t size) {
+  return allocate_or_throw(size);
+}
+void* operator new(const std::size_t size,
+                   const std::nothrow_t& /*tag*/) noexcept {
+  return allocate(size);
+}
+void* operator new[](const std::size_t size,
+                     const std::nothrow_t& /*tag*/) noexcept {
+  return allocate(size);
+}
+void* operator new(const std::size_t size, const std::align_val_t alignment) {
+  return allocate_or_throw(size, alignment);
+}
+void* operator new[](const std::size_t size,
+                     const std::align_val_t alignment) {
+  return allocate_or_throw(size, alignment);
+}
+void* operator new(const std::size_t size, const std::align_val_t alignment,
+                   const std::nothrow_t& /*tag*/) noexcept {
+  return allocate(size, alignment);
+}
+void* operator new[](const std::size_t size, const std::align_val_t alignment,
+                     const std::nothrow_t& /*tag*/) noexcept {
+  return allocate(size, alignment);
+}
+
+void operator delete(void* const pointer) noexcept { deallocate(pointer); }
+void operator delete[](void* const pointer) noexcept { deallocate(pointer); }
+void operator delete(void* const pointer,
+                     const std::size_t /*size*/) noexcept {
+  deallocate(pointer);
+}
+void operator delete[](void* const pointer,
+                       const std::size_t /*size*/) noexcept {
+  deallocate(pointer);
+}
+void operator delete(void* const pointer,
+                     const std::nothrow_t& /*tag*/) noexcept {
+  deallocate(pointer);
+}
+void operator delete[](void* const pointer,
+                       const std::nothrow_t& /*tag*/) noexcept {
+  deallocate(pointer);
+}
+void operator delete(void* const pointer,
+                     const std::align_val_t /*alignment*/) noexcept {
+  deallocate(pointer);
+}
+void operator delete[](void* const pointer,
+                       const std::align_val_t /*alignment*/) noexcept {
+  deallocate(pointer);
+}
+void operator delete(void* const pointer, const std::size_t /*size*/,
+                     const std::align_val_t /*alignment*/) noexcept {
+  deallocate(pointer);
+}
+void operator delete[](void* const pointer, const std::size_t /*size*/,
+                       const std::align_val_t /*alignment*/) noexcept {
+  deallocate(pointer);
+}
+void operator delete(void* const pointer,
+                     const std::align_val_t /*alignment*/,
+                     const std::nothrow_t& /*tag*/) noexcept {
+  deallocate(pointer);
+}
+void operator delete[](void* const pointer,
+                       const std::align_val_t /*alignment*/,
+                       const std::nothrow_t& /*tag*/) noexcept {
+  deallocate(pointer);
+}
@@ -0,0 +1,22 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+
+namespace TestHelpers {
+/*!
+ * \brief The number of heap allocations made by the calling thread through
+ * the global `operator new` since it started.
+ *
+ * \details Linking the `AllocationsHelpers` library replaces the global
+ * `operator new` and `operator delete` of the test executable by versions
+ * that count the allocations of each thread. So unlike
+ * `memory_tracking::allocations_on_this_thread()` this counts all allocations,
+ * e.g. those of a `std::vector` or a `std::string`, and doesn't depend on the
+ * `SPECTRE_TRACK_ALLOCATIONS` option. Use the difference of two calls to check
+ * that a function doesn't allocate memory.
+ */
+size_t allocations_on_this_thread();
+}  // namespace TestHelpers
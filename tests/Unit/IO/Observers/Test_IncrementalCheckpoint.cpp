@@ -0,0 +1,242 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "Framework/TestHelpers.hpp"
+#include "IO/Observer/IncrementalCheckpoint.hpp"
+#include "Utilities/FileSystem.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Serialization/Fingerprint.hpp"
+
+namespace observers {
+namespace {
+std::vector<char> bytes(const std::string& value) {
+  return {value.begin(), value.end()};
+}
+
+SerializedItems snapshot(const std::string& mesh, const std::string& vars) {
+  return {{"Mesh", bytes(mesh)}, {"Vars", bytes(vars)}};
+}
+
+// Write the items of `key` that changed since its previous snapshot, as
+// `Events::WriteIncrementalCheckpoint` does
+void write_snapshot(const gsl::not_null<IncrementalCheckpointWriter*> writer,
+                    const double observation_value, const std::string& key,
+                    const SerializedItems& items) {
+  ItemFingerprints fingerprints{};
+  for (const auto& [name, data] : items) {
+    fingerprints.emplace(name, fingerprint(data));
+  }
+  SerializedItems changed{};
+  for (const auto& name : writer->changed_items(key, fingerprints)) {
+    changed.emplace(name, items.at(name));
+  }
+  writer->write(observation_value, key, std::move(changed));
+}
+
+std::vector<char> read_file(const std::string& file_name) {
+  std::ifstream file(file_name, std::ios::binary);
+  return {std::istreambuf_iterator<char>(file),
+          std::istreambuf_iterator<char>()};
+}
+
+void write_file(const std::string& file_name,
+                const std::vector<char>& contents) {
+  std::ofstream file(file_name, std::ios::binary | std::ios::trunc);
+  file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+}
+
+void test_write_and_read(const std::string& file_name) {
+  {
+    IncrementalCheckpointWriter writer{file_name};
+    CHECK(writer.file_name() == file_name);
+    write_snapshot(make_not_null(&writer), 0.0, "A",
+                   snapshot("mesh A", "vars A0"));
+    write_snapshot(make_not_null(&writer), 0.0, "B",
+                   snapshot("mesh B", "vars B0"));
+    writer.commit(0.0);
+    write_snapshot(make_not_null(&writer), 1.0, "A",
+                   snapshot("mesh A", "vars A1"));
+    write_snapshot(make_not_null(&writer), 1.0, "B",
+                   snapshot("mesh B", "vars B1"));
+    writer.commit(1.0);
+    writer.wait();
+    // Only the variables change after the first snapshot
+    CHECK(writer.number_of_items_written() == 6);
+    CHECK(writer.number_of_items_unchanged() == 2);
+    const size_t bytes_after_complete_snapshots =
+        writer.number_of_bytes_written();
+    CHECK(bytes_after_complete_snapshots > 0);
+
+    // Moving the writer keeps the fingerprints of the previous snapshots. B
+    // was removed, e.g. by mesh refinement, and C was created.
+    IncrementalCheckpointWriter moved_writer = std::move(writer);
+    write_snapshot(make_not_null(&moved_writer), 2.0, "A",
+                   snapshot("mesh A", "vars A1"));
+    write_snapshot(make_not_null(&moved_writer), 2.0, "C",
+                   snapshot("mesh C", "vars C2"));
+    moved_writer.commit(2.0);
+    moved_writer.wait();
+    CHECK(moved_writer.number_of_items_written() == 8);
+    CHECK(moved_writer.number_of_items_unchanged() == 4);
+    CHECK(moved_writer.number_of_bytes_written() >
+          bytes_after_complete_snapshots);
+
+    // A serialized writer writes the next snapshots in full to the same file
+    auto deserialized_writer = serialize_and_deserialize(moved_writer);
+    CHECK(deserialized_writer.file_name() == file_name);
+    CHECK(deserialized_writer.number_of_items_written() == 0);
+    write_snapshot(make_not_null(&deserialized_writer), 3.0, "A",
+                   snapshot("mesh A", "vars A3"));
+    write_snapshot(make_not_null(&deserialized_writer), 3.0, "C",
+                   snapshot("mesh C", "vars C2"));
+    deserialized_writer.commit(3.0);
+    // The snapshot at 4.0 is never committed, e.g. because the run was killed
+    write_snapshot(make_not_null(&deserialized_writer), 4.0, "A",
+                   snapshot("mesh A", "vars A4"));
+    deserialized_writer.wait();
+    CHECK(deserialized_writer.number_of_items_written() == 5);
+    CHECK(deserialized_writer.number_of_items_unchanged() == 1);
+    // Destructors wait for the snapshots to be written
+  }
+
+  CHECK(committed_observation_values(file_name) ==
+        std::vector<double>{0.0, 1.0, 2.0, 3.0});
+
+  const auto first = read_incremental_checkpoint(file_name, 0.0);
+  CHECK(first.observation_value == 0.0);
+  CHECK(first.items.size() == 2);
+  CHECK(first.items.at("A") == snapshot("mesh A", "vars A0"));
+  CHECK(first.items.at("B") == snapshot("mesh B", "vars B0"));
+
+  const auto second = read_incremental_checkpoint(file_name, 1.0);
+  CHECK(second.items.at("A") == snapshot("mesh A", "vars A1"));
+  CHECK(second.items.at("B") == snapshot("mesh B", "vars B1"));
+
+  // B didn't write a snapshot at 2.0, so it isn't restored
+  const auto third = read_incremental_checkpoint(file_name, 2.0);
+  CHECK(third.items.size() == 2);
+  CHECK(third.items.at("A") == snapshot("mesh A", "vars A1"));
+  CHECK(third.items.at("C") == snapshot("mesh C", "vars C2"));
+
+  const auto latest = read_incremental_checkpoint(file_name, 3.0);
+  CHECK(latest.observation_value == 3.0);
+  CHECK(latest.items.size() == 2);
+  CHECK(latest.items.at("A") == snapshot("mesh A", "vars A3"));
+  CHECK(latest.items.at("C") == snapshot("mesh C", "vars C2"));
+
+  CHECK(serialize_and_deserialize(latest).items == latest.items);
+
+  CHECK_THROWS_WITH(
+      read_incremental_checkpoint(file_name, 4.0),
+      Catch::Matchers::ContainsSubstring(
+          "doesn't hold a complete snapshot at observation 4"));
+}
+
+void test_latest_committed_observation(const std::string& file_name_prefix) {
+  const std::string file_name_0 =
+      incremental_checkpoint_file_name(file_name_prefix, 0);
+  const std::string file_name_1 =
+      incremental_checkpoint_file_name(file_name_prefix, 1);
+  const std::string missing_file_name =
+      incremental_checkpoint_file_name(file_name_prefix, 2);
+  {
+    IncrementalCheckpointWriter writer_0{file_name_0};
+    IncrementalCheckpointWriter writer_1{file_name_1};
+    for (const double observation_value : {0.0, 1.0, 2.0}) {
+      write_snapshot(make_not_null(&writer_0), observation_value, "A",
+                     snapshot("mesh A", "vars A"));
+      writer_0.commit(observation_value);
+    }
+    // The second node didn't commit its last snapshot
+    for (const double observation_value : {0.0, 1.0, 2.0}) {
+      write_snapshot(make_not_null(&writer_1), observation_value, "B",
+                     snapshot("mesh B", "vars B"));
+    }
+    writer_1.commit(0.0);
+    writer_1.commit(1.0);
+  }
+  CHECK(latest_committed_observation({file_name_0}) == 2.0);
+  CHECK(latest_committed_observation({file_name_0, file_name_1}) == 1.0);
+  // Nodes without elements don't write a file
+  CHECK(latest_committed_observation(
+            {file_name_0, file_name_1, missing_file_name}) == 1.0);
+  CHECK(latest_committed_observation({missing_file_name}) == std::nullopt);
+
+  file_system::rm(file_name_0, true);
+  file_system::rm(file_name_1, true);
+}
+
+void test_truncated_file(const std::string& file_name) {
+  {
+    IncrementalCheckpointWriter writer{file_name};
+    write_snapshot(make_not_null(&writer), 0.0, "A",
+                   snapshot("mesh A", "vars A0"));
+    writer.commit(0.0);
+    write_snapshot(make_not_null(&writer), 1.0, "A",
+                   snapshot("mesh A", "vars A1"));
+  }
+  // Simulate a run that was killed while writing the last record
+  const std::vector<char> contents = read_file(file_name);
+  write_file(file_name, {contents.begin(), std::prev(contents.end(), 3)});
+  CHECK(committed_observation_values(file_name) == std::vector<double>{0.0});
+  const auto latest = read_incremental_checkpoint(file_name, 0.0);
+  CHECK(latest.observation_value == 0.0);
+  CHECK(latest.items.at("A") == snapshot("mesh A", "vars A0"));
+
+  // A file that is not an incremental checkpoint
+  write_file(file_name, bytes("Not an incremental checkpoint"));
+  CHECK_THROWS_WITH(committed_observation_values(file_name),
+                    Catch::Matchers::ContainsSubstring(
+                        "is not an incremental checkpoint file of version"));
+
+  file_system::rm(file_name, true);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.IO.Observers.IncrementalCheckpoint",
+                  "[Unit][Observers]") {
+  const std::string file_name_prefix =
+      "Unit.IO.Observers.IncrementalCheckpoint";
+  const std::string file_name =
+      incremental_checkpoint_file_name(file_name_prefix, 0);
+  CHECK(file_name == file_name_prefix + "Node0.bin");
+  const std::string latest_file_name_prefix = file_name_prefix + "Latest";
+  const std::string truncated_file_name =
+      incremental_checkpoint_file_name(file_name_prefix + "Truncated", 0);
+  for (const auto& name :
+       {file_name, truncated_file_name,
+        incremental_checkpoint_file_name(latest_file_name_prefix, 0),
+        incremental_checkpoint_file_name(latest_file_name_prefix, 1)}) {
+    if (file_system::check_if_file_exists(name)) {
+      file_system::rm(name, true);
+    }
+  }
+
+  test_write_and_read(file_name);
+  test_latest_committed_observation(latest_file_name_prefix);
+  test_truncated_file(truncated_file_name);
+
+  CHECK_THROWS_WITH(
+      read_incremental_checkpoint(file_name_prefix + "Missing.bin", 0.0),
+      Catch::Matchers::ContainsSubstring(
+          "Could not open incremental checkpoint file"));
+  CHECK_THROWS_WITH(
+      IncrementalCheckpointWriter{}.write(0.0, "A", {}),
+      Catch::Matchers::ContainsSubstring("without a file name"));
+  CHECK_THROWS_WITH(
+      IncrementalCheckpointWriter{}.commit(0.0),
+      Catch::Matchers::ContainsSubstring("without a file name"));
+
+  file_system::rm(file_name, true);
+}
+}  // namespace observers
@@ -63,5 +63,9 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.Initialize", "[Unit][Observers]") {
   CHECK(ActionTesting::get_databox_tag<obs_component,
                                        observers::Tags::TensorData>(runner, 0)
             .empty());
+  CHECK(ActionTesting::get_databox_tag<
+            obs_component,
+            observers::Tags::ContributorsOfIncrementalCheckpoint>(runner, 0)
+            .empty());
 }
 }  // namespace
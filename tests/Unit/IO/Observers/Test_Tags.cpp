@@ -38,6 +38,14 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.Tags", "[Unit][Observers]") {
   TestHelpers::db::test_simple_tag<VolumeFileName>("VolumeFileName");
   TestHelpers::db::test_simple_tag<ReductionFileName>("ReductionFileName");
   TestHelpers::db::test_simple_tag<SurfaceFileName>("SurfaceFileName");
+  TestHelpers::db::test_simple_tag<IncrementalCheckpointWriters>(
+      "IncrementalCheckpointWriters");
+  TestHelpers::db::test_simple_tag<ContributorsOfIncrementalCheckpoint>(
+      "ContributorsOfIncrementalCheckpoint");
+  TestHelpers::db::test_simple_tag<RestoredIncrementalCheckpoints>(
+      "RestoredIncrementalCheckpoints");
+  TestHelpers::db::test_simple_tag<RestoreFromIncrementalCheckpoint>(
+      "RestoreFromIncrementalCheckpoint");
   static_assert(
       std::is_same_v<typename ReductionData<double, int, char>::names_tag,
                      ReductionDataNames<double, int, char>>,
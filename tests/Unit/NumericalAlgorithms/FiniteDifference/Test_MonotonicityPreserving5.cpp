@@ -3,7 +3,9 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <array>
 #include <cstddef>
+#include <random>
 
 #include "DataStructures/Index.hpp"
 #include "Domain/Structure/Direction.hpp"
@@ -13,6 +15,8 @@
 #include "Helpers/NumericalAlgorithms/FiniteDifference/Exact.hpp"
 #include "Helpers/NumericalAlgorithms/FiniteDifference/Python.hpp"
 #include "NumericalAlgorithms/FiniteDifference/MonotonicityPreserving5.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Simd/Simd.hpp"
 
 namespace {
 
@@ -60,6 +64,58 @@ void test() {
       Index<Dim>{5}, 5, "MonotonicityPreserving5", "test_mp5", recons,
       recons_neighbor_data);
 }
+
+#ifdef SPECTRE_USE_XSIMD
+// Checks that reconstructing a batch of cells at once gives the same result
+// as reconstructing each cell on its own. Every other cell has a smooth
+// stencil so that batches mix limited and unlimited cells.
+void test_simd_matches_scalar() {
+  using batch = simd::batch<double>;
+  constexpr size_t batch_size = simd::size<batch>();
+  constexpr size_t stencil_width = 5;
+  MAKE_GENERATOR(generator);
+  std::uniform_real_distribution<> dist(-1.0, 1.0);
+
+  for (size_t trial = 0; trial < 100; ++trial) {
+    // stencils[j][lane] is the j-th stencil point of the cell in `lane`
+    std::array<std::array<double, batch_size>, stencil_width> stencils{};
+    for (size_t lane = 0; lane < batch_size; ++lane) {
+      const bool smooth = (lane + trial) % 2 == 0;
+      const double offset = dist(generator);
+      const double slope = dist(generator);
+      for (size_t j = 0; j < stencil_width; ++j) {
+        gsl::at(gsl::at(stencils, j), lane) =
+            smooth ? offset + slope * static_cast<double>(j)
+                   : dist(generator);
+      }
+    }
+
+    std::array<batch, stencil_width> q_batch{};
+    for (size_t j = 0; j < stencil_width; ++j) {
+      gsl::at(q_batch, j) = simd::load_unaligned(gsl::at(stencils, j).data());
+    }
+    const auto batch_result = fd::reconstruction::detail::
+        MonotonicityPreserving5Reconstructor::pointwise(q_batch.data() + 2, 1,
+                                                        alpha, epsilon);
+    std::array<double, batch_size> batch_minus{};
+    std::array<double, batch_size> batch_plus{};
+    simd::store_unaligned(batch_minus.data(), batch_result[0]);
+    simd::store_unaligned(batch_plus.data(), batch_result[1]);
+
+    for (size_t lane = 0; lane < batch_size; ++lane) {
+      std::array<double, stencil_width> q{};
+      for (size_t j = 0; j < stencil_width; ++j) {
+        gsl::at(q, j) = gsl::at(gsl::at(stencils, j), lane);
+      }
+      const auto scalar_result = fd::reconstruction::detail::
+          MonotonicityPreserving5Reconstructor::pointwise(q.data() + 2, 1,
+                                                          alpha, epsilon);
+      CHECK(gsl::at(batch_minus, lane) == approx(scalar_result[0]));
+      CHECK(gsl::at(batch_plus, lane) == approx(scalar_result[1]));
+    }
+  }
+}
+#endif  // SPECTRE_USE_XSIMD
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.FiniteDifference.MonotonicityPreserving5",
@@ -69,4 +125,7 @@ SPECTRE_TEST_CASE("Unit.FiniteDifference.MonotonicityPreserving5",
   test<1>();
   test<2>();
   test<3>();
+#ifdef SPECTRE_USE_XSIMD
+  test_simd_matches_scalar();
+#endif  // SPECTRE_USE_XSIMD
 }
@@ -548,6 +548,68 @@ void test_prolong_restrict() {
   }
 }
 
+void test_batched_transforms(const size_t l_max, const size_t m_max) {
+  Spherepack ylm_spherepack(l_max, m_max);
+
+  const auto& theta = ylm_spherepack.theta_points();
+  const auto& phi = ylm_spherepack.phi_points();
+  std::vector<DataVector> u(3, DataVector(ylm_spherepack.physical_size()));
+  YlmTestFunctions::Y00().func(&u[0], 1, 0, theta, phi);
+  YlmTestFunctions::Y10().func(&u[1], 1, 0, theta, phi);
+  YlmTestFunctions::Y11().func(&u[2], 1, 0, theta, phi);
+
+  // Batched transforms must agree with transforming one field at a time.
+  std::vector<DataVector> u_spec(3, DataVector(ylm_spherepack.spectral_size()));
+  ylm_spherepack.phys_to_spec(
+      std::array<double*, 3>{
+          {u_spec[0].data(), u_spec[1].data(), u_spec[2].data()}},
+      std::array<const double*, 3>{{u[0].data(), u[1].data(), u[2].data()}});
+  std::vector<DataVector> u_test(3, DataVector(ylm_spherepack.physical_size()));
+  ylm_spherepack.spec_to_phys(
+      std::array<double*, 3>{
+          {u_test[0].data(), u_test[1].data(), u_test[2].data()}},
+      std::array<const double*, 3>{
+          {u_spec[0].data(), u_spec[1].data(), u_spec[2].data()}});
+  for (size_t i = 0; i < 3; ++i) {
+    CHECK_ITERABLE_APPROX(u_spec[i], ylm_spherepack.phys_to_spec(u[i]));
+    CHECK_ITERABLE_APPROX(u_test[i], u[i]);
+  }
+
+  // A batch of one field takes the unbatched path.
+  DataVector single_spec(ylm_spherepack.spectral_size());
+  ylm_spherepack.phys_to_spec(std::array<double*, 1>{{single_spec.data()}},
+                              std::array<const double*, 1>{{u[2].data()}});
+  CHECK_ITERABLE_APPROX(single_spec, u_spec[2]);
+
+  // Test simplified interface
+  const auto u_spec_simple = ylm_spherepack.phys_to_spec(u);
+  const auto u_test_simple = ylm_spherepack.spec_to_phys(u_spec_simple);
+  REQUIRE(u_spec_simple.size() == 3);
+  REQUIRE(u_test_simple.size() == 3);
+  for (size_t i = 0; i < 3; ++i) {
+    CHECK_ITERABLE_APPROX(u_spec_simple[i], u_spec[i]);
+    CHECK_ITERABLE_APPROX(u_test_simple[i], u[i]);
+  }
+  CHECK(ylm_spherepack.phys_to_spec(std::vector<DataVector>{}).empty());
+
+  // Batched gradients must agree with differentiating one field at a time.
+  std::array<Spherepack::FirstDeriv, 3> du{};
+  for (auto& du_field : du) {
+    du_field = Spherepack::FirstDeriv(ylm_spherepack.physical_size());
+  }
+  ylm_spherepack.gradient(
+      std::array<std::array<double*, 2>, 3>{
+          {{{get<0>(du[0]).data(), get<1>(du[0]).data()}},
+           {{get<0>(du[1]).data(), get<1>(du[1]).data()}},
+           {{get<0>(du[2]).data(), get<1>(du[2]).data()}}}},
+      std::array<const double*, 3>{{u[0].data(), u[1].data(), u[2].data()}});
+  for (size_t i = 0; i < 3; ++i) {
+    const auto expected_du = ylm_spherepack.gradient(u[i]);
+    CHECK_ITERABLE_APPROX(get<0>(gsl::at(du, i)), get<0>(expected_du));
+    CHECK_ITERABLE_APPROX(get<1>(gsl::at(du, i)), get<1>(expected_du));
+  }
+}
+
 void test_loop_over_offset(
     const size_t l_max, const size_t m_max, const size_t physical_stride,
     const YlmTestFunctions::ScalarFunctionWithDerivs& func) {
@@ -1326,6 +1388,8 @@ SPECTRE_TEST_CASE("Unit.ApparentHorizonFinder.Spherepack",
   }
 
   test_prolong_restrict();
+  test_batched_transforms(4, 4);
+  test_batched_transforms(6, 3);
 
   Spherepack s(4, 4);
   auto s_copy(s);
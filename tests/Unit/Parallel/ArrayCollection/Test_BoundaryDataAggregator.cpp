@@ -0,0 +1,118 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <utility>
+
+#include "DataStructures/DataVector.hpp"
+#include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/DirectionalId.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Evolution/DiscontinuousGalerkin/BoundaryData.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Parallel/ArrayCollection/BoundaryDataAggregator.hpp"
+#include "Time/Slab.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeStepId.hpp"
+
+namespace Parallel {
+namespace {
+using Aggregator = BoundaryDataAggregator<1>;
+
+Aggregator::Entry make_entry(const size_t block, const size_t points) {
+  evolution::dg::BoundaryData<1> data{};
+  data.boundary_correction_data = DataVector(points, 1.0);
+  const Slab slab(0.0, 1.0);
+  return {ElementId<1>{block},
+          TimeStepId(true, 0, slab.start()),
+          {DirectionalId<1>{Direction<1>::lower_xi(), ElementId<1>{0}},
+           std::move(data)}};
+}
+
+void test_flush_message() {
+  Aggregator aggregator{};
+  CHECK(aggregator.max_entries() == Aggregator::default_max_entries);
+  CHECK(aggregator.max_bytes() == Aggregator::default_max_bytes);
+
+  // Only the first data for each node needs a flush message
+  auto result = aggregator.append(1, make_entry(1, 3));
+  CHECK_FALSE(result.bundle_to_send.has_value());
+  CHECK(result.send_flush_message);
+  result = aggregator.append(1, make_entry(2, 3));
+  CHECK_FALSE(result.bundle_to_send.has_value());
+  CHECK_FALSE(result.send_flush_message);
+  result = aggregator.append(2, make_entry(3, 3));
+  CHECK(result.send_flush_message);
+  CHECK(aggregator.number_of_messages_sent() == 0);
+
+  auto deserialized = serialize_and_deserialize(aggregator);
+
+  for (Aggregator* agg : {&aggregator, &deserialized}) {
+    auto bundles = agg->take_all();
+    REQUIRE(bundles.size() == 2);
+    if (bundles[0].first != 1) {
+      std::swap(bundles[0], bundles[1]);
+    }
+    CHECK(bundles[0].first == 1);
+    REQUIRE(bundles[0].second.size() == 2);
+    CHECK(bundles[0].second[0].receiver == ElementId<1>{1});
+    CHECK(bundles[0].second[1].receiver == ElementId<1>{2});
+    CHECK(bundles[0].second[1].data.second == make_entry(2, 3).data.second);
+    CHECK(bundles[1].first == 2);
+    CHECK(bundles[1].second.size() == 1);
+
+    CHECK(agg->number_of_messages_sent() == 2);
+    CHECK(agg->number_of_entries_sent() == 3);
+    CHECK(agg->number_of_bytes_sent() == 9 * sizeof(double));
+    CHECK(agg->take_all().empty());
+    // Taking the statistics resets them
+    const auto statistics = agg->take_statistics();
+    CHECK(statistics.number_of_messages_sent == 2);
+    CHECK(statistics.number_of_entries_sent == 3);
+    CHECK(statistics.number_of_bytes_sent == 9 * sizeof(double));
+    CHECK(agg->number_of_messages_sent() == 0);
+    CHECK(agg->take_statistics().number_of_entries_sent == 0);
+    // The buffers are empty again, so a new flush message is needed
+    CHECK(agg->append(1, make_entry(1, 3)).send_flush_message);
+  }
+}
+
+void test_limits() {
+  {
+    INFO("Entry limit");
+    Aggregator aggregator{2};
+    CHECK(aggregator.append(0, make_entry(1, 3)).send_flush_message);
+    const auto result = aggregator.append(0, make_entry(2, 3));
+    REQUIRE(result.bundle_to_send.has_value());
+    CHECK(result.bundle_to_send->size() == 2);
+    CHECK_FALSE(result.send_flush_message);
+    CHECK(aggregator.take_all().empty());
+  }
+  {
+    INFO("Byte limit");
+    Aggregator aggregator{10, 4 * sizeof(double)};
+    CHECK(aggregator.append(0, make_entry(1, 3)).send_flush_message);
+    const auto result = aggregator.append(0, make_entry(2, 1));
+    REQUIRE(result.bundle_to_send.has_value());
+    CHECK(result.bundle_to_send->size() == 2);
+    CHECK(aggregator.number_of_bytes_sent() == 4 * sizeof(double));
+  }
+  {
+    INFO("No aggregation");
+    Aggregator aggregator{1};
+    const auto result = aggregator.append(0, make_entry(1, 3));
+    REQUIRE(result.bundle_to_send.has_value());
+    CHECK(result.bundle_to_send->size() == 1);
+    CHECK_FALSE(result.send_flush_message);
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Parallel.ArrayCollection.BoundaryDataAggregator",
+                  "[Unit][Parallel]") {
+  test_flush_message();
+  test_limits();
+}
+}  // namespace Parallel
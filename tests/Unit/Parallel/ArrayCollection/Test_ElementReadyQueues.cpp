@@ -0,0 +1,141 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <optional>
+#include <utility>
+
+#include "Domain/Structure/ElementId.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Parallel/ArrayCollection/ElementReadyQueues.hpp"
+
+namespace Parallel {
+namespace {
+template <typename Id>
+std::optional<std::pair<Id, int>> popped(const Id& id, const int priority = 0) {
+  return std::pair{id, priority};
+}
+
+void test_priorities() {
+  const ElementId<1> id_a{0, {{{1, 0}}}};
+  const ElementId<1> id_b{0, {{{1, 1}}}};
+  const ElementId<1> id_c{1, {{{1, 0}}}};
+  const ElementId<1> id_d{1, {{{1, 1}}}};
+
+  ElementReadyQueues<1> queues{2};
+  CHECK(queues.push(id_a, 0, 2));
+  CHECK(queues.push(id_b, 0));
+  CHECK(queues.push(id_c, 0, -1));
+  // Equal priorities are first-in first-out
+  CHECK(queues.push(id_d, 0));
+  CHECK(queues.pop(0) == popped(id_c, -1));
+
+  // Pushing a queued element with a larger priority doesn't move it back
+  CHECK_FALSE(queues.push(id_b, 0, 3));
+  CHECK(queues.number_of_promotions() == 0);
+  // Pushing a queued element with a smaller priority moves it forward
+  CHECK_FALSE(queues.push(id_a, 0, -2));
+  CHECK(queues.number_of_promotions() == 1);
+  CHECK(queues.size() == 3);
+
+  // Stealing takes the least urgent element, skipping the entry that was
+  // left behind when `id_a` was moved forward
+  CHECK(queues.pop(1) == popped(id_d));
+  CHECK(queues.number_of_steals() == 1);
+  // A retried element keeps its priority and is queued on the core that
+  // popped it
+  queues.retry(id_d, 0, 0);
+  CHECK(queues.pop(0) == popped(id_a, -2));
+  CHECK(queues.pop(0) == popped(id_b));
+  queues.retry(id_a, 0, -2);
+  CHECK(queues.size() == 2);
+
+  const auto deserialized_queues = serialize_and_deserialize(queues);
+  CHECK(deserialized_queues.number_of_promotions() == 1);
+  CHECK(deserialized_queues.size() == 2);
+
+  CHECK(queues.pop(0) == popped(id_a, -2));
+  CHECK(queues.pop(0) == popped(id_d));
+  CHECK(queues.number_of_steals() == 2);
+  CHECK(queues.pop(0) == std::nullopt);
+}
+
+void test_runners() {
+  ElementReadyQueues<1> queues{2};
+  queues.start_running();
+  queues.start_running();
+  CHECK_FALSE(queues.stop_running());
+  CHECK(queues.stop_running());
+  queues.start_running();
+  CHECK(queues.stop_running());
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Parallel.ArrayCollection.ElementReadyQueues",
+                  "[Unit][Parallel]") {
+  const ElementId<1> id_a{0, {{{1, 0}}}};
+  const ElementId<1> id_b{0, {{{1, 1}}}};
+  const ElementId<1> id_c{1, {{{1, 0}}}};
+
+  ElementReadyQueues<1> queues{2};
+  CHECK(queues.number_of_cores() == 2);
+  CHECK(queues.size() == 0);
+
+  // Elements are only queued once
+  CHECK(queues.push(id_a, 0));
+  CHECK(queues.push(id_b, 0));
+  CHECK_FALSE(queues.push(id_a, 0));
+  CHECK(queues.push(id_c, 1));
+  CHECK(queues.size() == 3);
+
+  // Own queue is first-in first-out
+  CHECK(queues.pop(0) == popped(id_a));
+  // A popped element can be queued again, and is queued on the core that
+  // last ran it instead of its home core
+  CHECK(queues.push(id_a, 1));
+  CHECK(queues.pop(1) == popped(id_c));
+  CHECK(queues.number_of_steals() == 0);
+
+  // Core 1 steals the most recently queued element of core 0
+  CHECK(queues.pop(1) == popped(id_a));
+  CHECK(queues.number_of_steals() == 1);
+
+  // Retrying an element that was queued again in the meantime doesn't
+  // duplicate it
+  queues.retry(id_c, 0, 0);
+  queues.retry(id_c, 0, 0);
+  CHECK(queues.number_of_retries() == 2);
+  CHECK(queues.size() == 2);
+
+  const auto deserialized_queues = serialize_and_deserialize(queues);
+  CHECK(deserialized_queues.number_of_cores() == 2);
+  CHECK(deserialized_queues.size() == 2);
+  CHECK(deserialized_queues.number_of_steals() == 1);
+  CHECK(deserialized_queues.number_of_retries() == 2);
+
+  CHECK(queues.pop(0) == popped(id_b));
+  // `id_c` was queued on core 1, which ran it last
+  CHECK(queues.pop(0) == popped(id_c));
+  CHECK(queues.number_of_steals() == 2);
+  CHECK(queues.number_of_idle_pops() == 0);
+  CHECK(queues.pop(0) == std::nullopt);
+  CHECK(queues.pop(1) == std::nullopt);
+  CHECK(queues.number_of_idle_pops() == 2);
+  CHECK(queues.size() == 0);
+
+  // Taking the statistics resets the counters
+  const auto statistics = queues.take_statistics();
+  CHECK(statistics.number_of_steals == 2);
+  CHECK(statistics.number_of_retries == 2);
+  CHECK(statistics.number_of_idle_pops == 2);
+  CHECK(statistics.number_of_promotions == 0);
+  CHECK(queues.number_of_steals() == 0);
+  CHECK(queues.number_of_retries() == 0);
+  CHECK(queues.number_of_idle_pops() == 0);
+  CHECK(queues.take_statistics().number_of_idle_pops == 0);
+
+  test_priorities();
+  test_runners();
+}
+}  // namespace Parallel
@@ -5,20 +5,35 @@
 
 #include <string>
 
+#include "Framework/TestCreation.hpp"
 #include "Helpers/DataStructures/DataBox/TestHelpers.hpp"
+#include "Parallel/ArrayCollection/Tags/BoundaryDataAggregator.hpp"
 #include "Parallel/ArrayCollection/Tags/ElementCollection.hpp"
 #include "Parallel/ArrayCollection/Tags/ElementLocations.hpp"
 #include "Parallel/ArrayCollection/Tags/ElementLocationsReference.hpp"
+#include "Parallel/ArrayCollection/Tags/ElementReadyQueues.hpp"
 #include "Parallel/ArrayCollection/Tags/NumberOfElementsTerminated.hpp"
 
 namespace Parallel {
 SPECTRE_TEST_CASE("Unit.Parallel.ArrayCollection.Tags", "[Unit][Parallel]") {
+  TestHelpers::db::test_simple_tag<Tags::BoundaryDataAggregator<3>>(
+      "BoundaryDataAggregator");
+  TestHelpers::db::test_simple_tag<Tags::BoundaryDataAggregationMaxEntries>(
+      "BoundaryDataAggregationMaxEntries");
+  TestHelpers::db::test_simple_tag<Tags::BoundaryDataAggregationMaxBytes>(
+      "BoundaryDataAggregationMaxBytes");
+  CHECK(TestHelpers::test_option_tag<
+            OptionTags::BoundaryDataAggregationMaxEntries>("16") == 16);
+  CHECK(TestHelpers::test_option_tag<
+            OptionTags::BoundaryDataAggregationMaxBytes>("4096") == 4096);
   TestHelpers::db::test_simple_tag<
       Tags::ElementCollection<3, void, void, void>>("ElementCollection");
   TestHelpers::db::test_simple_tag<Tags::ElementLocations<3>>(
       "ElementLocations");
   TestHelpers::db::test_reference_tag<
       Tags::ElementLocationsReference<3, void, void>>("ElementLocations");
+  TestHelpers::db::test_simple_tag<Tags::ElementReadyQueues<3>>(
+      "ElementReadyQueues");
   TestHelpers::db::test_simple_tag<Tags::NumberOfElementsTerminated>(
       "NumberOfElementsTerminated");
 }
@@ -0,0 +1,72 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <string>
+#include <thread>
+#include <unordered_map>
+
+#include "Domain/Structure/ElementId.hpp"
+#include "Parallel/ArrayComponentId.hpp"
+#include "Parallel/CacheStalls.hpp"
+
+namespace {
+struct Component0 {};
+struct Component1 {};
+
+SPECTRE_TEST_CASE("Unit.Parallel.CacheStalls", "[Unit][Parallel]") {
+  using Parallel::cache_stalls::begin_stall;
+  using Parallel::cache_stalls::end_stall;
+  using Parallel::cache_stalls::take_statistics;
+  const auto element_0 =
+      Parallel::make_array_component_id<Component0>(ElementId<1>{0});
+  const auto element_1 =
+      Parallel::make_array_component_id<Component0>(ElementId<1>{1});
+  // Same array index as `element_0`, but a different component
+  const auto other_component =
+      Parallel::make_array_component_id<Component1>(ElementId<1>{0});
+
+  CHECK(take_statistics().empty());
+  // Ending a stall that didn't start does nothing
+  end_stall(element_0);
+  CHECK(take_statistics().empty());
+
+  begin_stall(element_0, "Expansion");
+  // Repeated readiness checks don't restart the stall
+  begin_stall(element_0, "Expansion");
+  begin_stall(element_1, "Expansion");
+  begin_stall(other_component, "Rotation");
+  end_stall(element_0);
+  end_stall(element_0);
+
+  {
+    const std::unordered_map<std::string, Parallel::cache_stalls::Statistics>
+        statistics = take_statistics();
+    CHECK(statistics.size() == 1);
+    CHECK(statistics.at("Expansion").number_of_stalls == 1);
+    CHECK(statistics.at("Expansion").stall_wall_time >= 0.0);
+    CHECK(take_statistics().empty());
+  }
+
+  // A stall that started on another thread is accumulated on the thread that
+  // ends it
+  std::unordered_map<std::string, Parallel::cache_stalls::Statistics>
+      other_thread_statistics{};
+  std::thread other_thread{[&element_1, &other_thread_statistics]() {
+    end_stall(element_1);
+    other_thread_statistics = take_statistics();
+  }};
+  other_thread.join();
+  CHECK(other_thread_statistics.size() == 1);
+  CHECK(other_thread_statistics.at("Expansion").number_of_stalls == 1);
+  CHECK(take_statistics().empty());
+
+  end_stall(other_component);
+  {
+    const auto statistics = take_statistics();
+    CHECK(statistics.size() == 1);
+    CHECK(statistics.at("Rotation").number_of_stalls == 1);
+  }
+}
+}  // namespace
@@ -3,23 +3,35 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <optional>
 #include <string>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Matrix.hpp"
+#include "DataStructures/MemoryTracking.hpp"
 #include "Domain/Structure/Element.hpp"
 #include "Domain/Structure/ElementId.hpp"
 #include "Framework/ActionTesting.hpp"
 #include "Helpers/DataStructures/DataBox/TestHelpers.hpp"
 #include "Helpers/DataStructures/MakeWithRandomValues.hpp"
 #include "Helpers/IO/Observers/MockWriteReductionDataRow.hpp"
+#include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
+#include "IO/Observer/ReductionActions.hpp"
+#include "IO/Observer/TypeOfObservation.hpp"
+#include "Parallel/ArrayComponentId.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
 #include "Parallel/Local.hpp"
 #include "Parallel/MemoryMonitor/MemoryMonitor.hpp"
 #include "Parallel/MemoryMonitor/Tags.hpp"
+#include "Parallel/NodeLock.hpp"
 #include "Parallel/Phase.hpp"
+#include "Parallel/Reduction.hpp"
 #include "Parallel/TypeTraits.hpp"
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ContributeMemoryData.hpp"
 #include "ParallelAlgorithms/Actions/MemoryMonitor/ProcessArray.hpp"
@@ -28,6 +40,7 @@
 #include "ParallelAlgorithms/Events/MonitorMemory.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Numeric.hpp"
+#include "Utilities/PrettyType.hpp"
 #include "Utilities/Serialization/Serialize.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TypeTraits/RemoveReferenceWrapper.hpp"
@@ -102,6 +115,115 @@ struct FakeDgElementArray {
                                  tmpl::list<domain::Tags::Element<3>>>>>>;
 };
 
+struct TrackedResults {
+  observers::ObservationId observation_id{};
+  std::string subfile_name{};
+  std::vector<std::string> legend{};
+  std::vector<double> process_sizes{};
+};
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+std::optional<TrackedResults> tracked_results{};
+
+template <typename... ReductionDatums>
+void record_tracked_allocations(
+    const observers::ObservationId& observation_id,
+    const std::string& subfile_name, const std::vector<std::string>& legend,
+    const Parallel::ReductionData<ReductionDatums...>& reduction_data) {
+  tracked_results = TrackedResults{observation_id, subfile_name, legend,
+                                   std::get<1>(reduction_data.data())};
+}
+
+struct MockContributeReductionData {
+  template <typename ParallelComponent, typename DbTags, typename Metavariables,
+            typename ArrayIndex, typename... ReductionDatums,
+            typename Formatter = observers::NoFormatter>
+  static void apply(
+      db::DataBox<DbTags>& /*box*/,
+      Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ArrayIndex& /*array_index*/,
+      const observers::ObservationId& observation_id,
+      Parallel::ArrayComponentId /*sender_array_id*/,
+      const std::string& subfile_name,
+      const std::vector<std::string>& reduction_names,
+      Parallel::ReductionData<ReductionDatums...>&& reduction_data,
+      std::optional<Formatter>&& /*formatter*/ = std::nullopt,
+      const bool /*observe_per_core*/ = false) {
+    record_tracked_allocations(observation_id, subfile_name, reduction_names,
+                               reduction_data);
+  }
+};
+
+struct MockCollectReductionDataOnNode {
+  template <typename ParallelComponent, typename DbTags, typename Metavariables,
+            typename ArrayIndex, typename... ReductionDatums,
+            typename Formatter = observers::NoFormatter>
+  static void apply(
+      db::DataBox<DbTags>& /*box*/,
+      Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ArrayIndex& /*array_index*/,
+      const gsl::not_null<Parallel::NodeLock*> /*node_lock*/,
+      const observers::ObservationId& observation_id,
+      Parallel::ArrayComponentId /*sender_array_id*/,
+      const std::string& subfile_name,
+      std::vector<std::string>&& reduction_names,
+      Parallel::ReductionData<ReductionDatums...>&& reduction_data,
+      std::optional<Formatter>&& /*formatter*/ = std::nullopt,
+      const std::optional<int> /*observe_with_core_id*/ = std::nullopt) {
+    record_tracked_allocations(observation_id, subfile_name, reduction_names,
+                               reduction_data);
+  }
+};
+
+template <typename Metavariables>
+struct MockObserver {
+  using component_being_mocked = observers::Observer<Metavariables>;
+  using replace_these_simple_actions =
+      tmpl::list<observers::Actions::ContributeReductionData>;
+  using with_these_simple_actions = tmpl::list<MockContributeReductionData>;
+
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockGroupChare;
+  using array_index = int;
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<Parallel::Phase::Initialization, tmpl::list<>>>;
+};
+
+template <typename Metavariables>
+struct MockObserverWriterForTracking {
+  using component_being_mocked = observers::ObserverWriter<Metavariables>;
+  using replace_these_threaded_actions =
+      tmpl::list<observers::ThreadedActions::CollectReductionDataOnNode>;
+  using with_these_threaded_actions =
+      tmpl::list<MockCollectReductionDataOnNode>;
+
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockNodeGroupChare;
+  using array_index = int;
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<Parallel::Phase::Initialization, tmpl::list<>>>;
+};
+
+// A singleton for the same reason as the FakeDgElementArray below
+template <typename Metavariables>
+struct TrackedElementComponent {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockSingletonChare;
+  using array_index = int;
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<Parallel::Phase::Initialization, tmpl::list<>>>;
+};
+
+struct TrackedAllocationsMetavariables {
+  using component_list =
+      tmpl::list<MockMemoryMonitor<TrackedAllocationsMetavariables>,
+                 MockObserver<TrackedAllocationsMetavariables>,
+                 MockObserverWriterForTracking<TrackedAllocationsMetavariables>,
+                 TrackedElementComponent<TrackedAllocationsMetavariables>>;
+
+  void pup(PUP::er& /*p*/) {}
+};
+
 struct TestMetavariables {
   using component_list =
       tmpl::list<MockMemoryMonitor<TestMetavariables>,
@@ -533,13 +655,13 @@ void test_monitor_memory_event() {
   Events::MonitorMemory<3> monitor_memory{
       {components_to_monitor}, Options::Context{}, metavars{}};
 
-  const auto& element =
+  const auto box = db::create<db::AddSimpleTags<domain::Tags::Element<3>>>(
       ActionTesting::get_databox_tag<dg_elem_comp<event_metavars>,
-                                     domain::Tags::Element<3>>(runner, 0);
+                                     domain::Tags::Element<3>>(runner, 0));
 
   // Run the event. This will queue a lot of actions
   const double time = 1.4;
-  monitor_memory(element, cache, 0,
+  monitor_memory(box, cache, 0,
                  std::add_pointer_t<dg_elem_comp<event_metavars>>{},
                  {"TimeName", time});
 
@@ -652,6 +774,141 @@ void test_monitor_memory_event() {
             obs_writer_comp<event_metavars>>(runner, 0) == 0);
 }
 
+void test_tracked_allocations() {
+  INFO("Checking TrackedAllocations");
+  using metavars = TrackedAllocationsMetavariables;
+  using element_comp = TrackedElementComponent<metavars>;
+  using observer_comp = MockObserver<metavars>;
+  using writer_comp = MockObserverWriterForTracking<metavars>;
+
+  // 2 mock nodes, 2 mock cores per node
+  const size_t num_nodes = 2;
+  ActionTesting::MockRuntimeSystem<metavars> runner{
+      {}, {}, std::vector<size_t>(num_nodes, 2)};
+  ActionTesting::emplace_group_component<observer_comp>(&runner);
+  ActionTesting::emplace_nodegroup_component<writer_comp>(&runner);
+  ActionTesting::emplace_singleton_component<element_comp>(
+      &runner, ActionTesting::NodeId{1}, ActionTesting::LocalCoreId{0});
+  runner.set_phase(Parallel::Phase::Testing);
+
+  Events::MonitorMemory<3> monitor_memory{
+      {std::vector<std::string>{mem_monitor::tracked_allocations_name}},
+      Options::Context{}, metavars{}};
+  const auto registration =
+      monitor_memory.get_observation_type_and_key_for_registration();
+  REQUIRE(registration.has_value());
+  CHECK(registration->first == observers::TypeOfObservation::Reduction);
+  CHECK(registration->second ==
+        observers::ObservationKey{"/MemoryMonitors/TrackedAllocations.dat"});
+  CHECK_FALSE(
+      Events::MonitorMemory<3>{{std::vector<std::string>{}},
+                               Options::Context{},
+                               metavars{}}
+          .get_observation_type_and_key_for_registration()
+          .has_value());
+  CHECK(Events::MonitorMemory<3>{std::nullopt, Options::Context{}, metavars{}}
+            .get_observation_type_and_key_for_registration()
+            .has_value());
+
+  const auto box = db::create<db::AddSimpleTags<domain::Tags::Element<3>>>(
+      Element<3>{ElementId<3>{0}, {}});
+
+  // Memory the element component allocated for its mortars
+  DataVector mortar_data{};
+  {
+    const memory_tracking::ScopedComponent scoped_component{
+        memory_tracking::component_id<element_comp>()};
+    const memory_tracking::ScopedGroup scoped_group{
+        memory_tracking::Group::Mortars};
+    mortar_data = DataVector{10, 0.0};
+  }
+
+  // The kinds, and the groups of the four components of the metavariables
+  // and of the allocations outside of any component
+  const size_t num_categories = memory_tracking::number_of_kinds +
+                                5 * memory_tracking::number_of_groups;
+  // The element component is the last one of the component list
+  const size_t mortars_of_element = memory_tracking::number_of_kinds +
+                                    4 * memory_tracking::number_of_groups +
+                                    2;
+  const auto check_results = [&num_categories, &mortars_of_element](
+                                 const double time, const size_t process) {
+    REQUIRE(tracked_results.has_value());
+    CHECK(tracked_results->observation_id ==
+          observers::ObservationId{time,
+                                   "/MemoryMonitors/TrackedAllocations.dat"});
+    CHECK(tracked_results->subfile_name ==
+          "/MemoryMonitors/TrackedAllocations");
+    const auto& legend = tracked_results->legend;
+    REQUIRE(legend.size() == 1 + num_categories * num_nodes);
+    CHECK(legend[0] == "TimeName");
+    CHECK(legend[1] == "VectorImpl on process 0 (MB)");
+    CHECK(legend[num_nodes + 1] == "Variables on process 0 (MB)");
+    CHECK(legend[2 * num_nodes + 1] == "Other, Other on process 0 (MB)");
+    CHECK(legend[mortars_of_element * num_nodes + 2] ==
+          "TrackedElementComponent, Mortars on process 1 (MB)");
+
+    const auto& process_sizes = tracked_results->process_sizes;
+    REQUIRE(process_sizes.size() == num_categories * num_nodes);
+    for (size_t category = 0; category < num_categories; ++category) {
+      for (size_t p = 0; p < num_nodes; ++p) {
+        INFO("category = " + get_output(category) + ", p = " + get_output(p));
+        if (p != process) {
+          CHECK(process_sizes[category * num_nodes + p] == 0.0);
+        }
+      }
+    }
+    CHECK(process_sizes[mortars_of_element * num_nodes + process] ==
+          approx(10.0 * static_cast<double>(sizeof(double)) / 1.0e6));
+  };
+
+  {
+    INFO("Array or singleton");
+    tracked_results.reset();
+    auto& cache = ActionTesting::cache<element_comp>(runner, 0);
+    monitor_memory(box, cache, 0, std::add_pointer_t<element_comp>{},
+                   {"TimeName", 2.1});
+    CHECK(ActionTesting::number_of_queued_simple_actions<observer_comp>(
+              runner, 2) == 1);
+    ActionTesting::invoke_queued_simple_action<observer_comp>(
+        make_not_null(&runner), 2);
+    check_results(2.1, 1);
+  }
+  {
+    INFO("Nodegroup");
+    tracked_results.reset();
+    // As for a DgElementCollection, the elements contribute to the
+    // ObserverWriter of their node, which combines them into one row
+    auto& cache = ActionTesting::cache<writer_comp>(runner, 1);
+    monitor_memory(box, cache, 0, std::add_pointer_t<writer_comp>{},
+                   {"TimeName", 3.4});
+    CHECK(ActionTesting::number_of_queued_threaded_actions<writer_comp>(
+              runner, 1) == 1);
+    ActionTesting::invoke_queued_threaded_action<writer_comp>(
+        make_not_null(&runner), 1);
+    check_results(3.4, 1);
+  }
+}
+
+void test_tracked_allocations_disabled() {
+  INFO("Checking TrackedAllocations without allocation tracking");
+  using metavars = TrackedAllocationsMetavariables;
+  CHECK_THROWS_WITH(
+      ([]() {
+        Events::MonitorMemory<3> event{
+            {std::vector<std::string>{mem_monitor::tracked_allocations_name}},
+            Options::Context{},
+            metavars{}};
+      }()),
+      Catch::Matchers::ContainsSubstring(
+          "because SpECTRE was configured without allocation tracking"));
+  // 'All' doesn't include the tracked allocations
+  CHECK_FALSE(
+      Events::MonitorMemory<3>{std::nullopt, Options::Context{}, metavars{}}
+          .get_observation_type_and_key_for_registration()
+          .has_value());
+}
+
 SPECTRE_TEST_CASE("Unit.Parallel.MemoryMonitor", "[Unit][Parallel]") {
   MAKE_GENERATOR(gen);
   test_tags();
@@ -663,5 +920,10 @@ SPECTRE_TEST_CASE("Unit.Parallel.MemoryMonitor", "[Unit][Parallel]") {
   test_process_singleton();
   test_event_construction();
   test_monitor_memory_event();
+  if constexpr (memory_tracking::enabled) {
+    test_tracked_allocations();
+  } else {
+    test_tracked_allocations_disabled();
+  }
 }
 }  // namespace
@@ -5,6 +5,7 @@
 
 #include <cstddef>
 #include <optional>
+#include <set>
 #include <string>
 #include <unordered_set>
 #include <utility>
@@ -76,6 +77,16 @@ void test_singleton_info() {
   CHECK_FALSE(info_holder == info_holder2);
   CHECK(info_holder != info_holder2);
 
+  const auto info_holder3 = TestHelpers::test_creation<
+      Parallel::SingletonInfoHolder<fake_singleton<0>>>(
+      "NearBlocks: [InnerShell, Wedges]\n");
+  CHECK(info_holder3.proc() == std::nullopt);
+  CHECK(info_holder3.is_exclusive());
+  CHECK(info_holder3.near_blocks() ==
+        std::vector<std::string>{"InnerShell", "Wedges"});
+  CHECK(info_holder3 != info_holder2);
+  CHECK(serialize_and_deserialize(info_holder3) == info_holder3);
+
   CHECK_THROWS_WITH(([]() {
                       auto info_holder_error = TestHelpers::test_creation<
                           Parallel::SingletonInfoHolder<fake_singleton<0>>>(
@@ -85,6 +96,14 @@ void test_singleton_info() {
                     })(),
                     Catch::Matchers::ContainsSubstring(
                         "Proc must be a non-negative integer."));
+  CHECK_THROWS_WITH(([]() {
+                      auto info_holder_error = TestHelpers::test_creation<
+                          Parallel::SingletonInfoHolder<fake_singleton<0>>>(
+                          "NearBlocks: []\n");
+                      (void)info_holder_error;
+                    })(),
+                    Catch::Matchers::ContainsSubstring(
+                        "NearBlocks must contain at least one block."));
 }
 
 void test_singleton_pack() {
@@ -903,6 +922,162 @@ void test_multi_node_multi_core_large(const gsl::not_null<Gen*> gen) {
     check_resource_info(cache, true, singletons, expected);
   }
 }
+
+void test_near_blocks() {
+  // 3 nodes, 2 procs per node
+  using near_metavars = Metavariables<0, 1, 2, 3>;
+  Parallel::GlobalCache<near_metavars> cache{{}, {}, {2, 2, 2}};
+  // The elements of "Horizon" are mostly on node 1, those of "Outer" all on
+  // node 2. Once a proc is ignored, the elements move to later procs.
+  std::vector<std::unordered_set<size_t>> ignored_procs_in_calls{};
+  const ElementCostsOnNodes element_costs_on_nodes =
+      [&ignored_procs_in_calls](
+          const std::vector<std::string>& block_names,
+          const std::unordered_set<size_t>& procs_to_ignore) {
+        ignored_procs_in_calls.push_back(procs_to_ignore);
+        if (block_names == std::vector<std::string>{"Horizon"}) {
+          return std::vector<double>{1., 3., 0.};
+        }
+        return std::vector<double>{0., 0., 4.};
+      };
+
+  {
+    INFO("Singletons near blocks");
+    auto resource_info = serialize_and_deserialize(
+        TestHelpers::test_option_tag<OptionTags::ResourceInfo<near_metavars>>(
+            "AvoidGlobalProc0: true\n"
+            "Singletons:\n"
+            "  FakeSingleton0:\n"
+            "    NearBlocks: [Horizon]\n"
+            "  FakeSingleton1:\n"
+            "    NearBlocks: [Horizon]\n"
+            "  FakeSingleton2:\n"
+            "    NearBlocks: [Horizon]\n"
+            "  FakeSingleton3:\n"
+            "    Proc: Auto\n"
+            "    Exclusive: true\n"));
+    resource_info.build_singleton_map(cache, element_costs_on_nodes);
+    // Node 1 holds most of the elements of the blocks, so the first two
+    // singletons are placed there. Then node 1 is full and the third singleton
+    // goes to the node with the next-largest share. The remaining exclusive
+    // singleton is then placed on the node with the fewest singletons.
+    CHECK(resource_info.proc_for<FakeSingleton<near_metavars, 0>>() == 2);
+    CHECK(resource_info.proc_for<FakeSingleton<near_metavars, 1>>() == 3);
+    CHECK(resource_info.proc_for<FakeSingleton<near_metavars, 2>>() == 1);
+    CHECK(resource_info.proc_for<FakeSingleton<near_metavars, 3>>() == 4);
+    CHECK(resource_info.get_singleton_info<FakeSingleton<near_metavars, 2>>()
+              .is_exclusive());
+    CHECK(resource_info.procs_to_ignore() ==
+          std::unordered_set<size_t>{0, 1, 2, 3, 4});
+    CHECK(resource_info.procs_available_for_elements() == std::set<size_t>{5});
+    // Once the auto exclusive singleton is placed, the placement of the
+    // elements is predicted again for each near-blocks singleton
+    CHECK(ignored_procs_in_calls ==
+          std::vector<std::unordered_set<size_t>>{{0},
+                                                  {0, 2},
+                                                  {0, 2, 3},
+                                                  {0, 1, 2, 3, 4},
+                                                  {0, 1, 2, 3, 4},
+                                                  {0, 1, 2, 3, 4}});
+    CHECK(serialize_and_deserialize(resource_info) == resource_info);
+  }
+  {
+    INFO("Different blocks");
+    auto resource_info =
+        TestHelpers::test_option_tag<OptionTags::ResourceInfo<near_metavars>>(
+            "AvoidGlobalProc0: false\n"
+            "Singletons:\n"
+            "  FakeSingleton0:\n"
+            "    NearBlocks: [Outer]\n"
+            "  FakeSingleton1:\n"
+            "    NearBlocks: [Horizon]\n"
+            "  FakeSingleton2: Auto\n"
+            "  FakeSingleton3:\n"
+            "    Proc: 2\n"
+            "    Exclusive: false\n");
+    resource_info.build_singleton_map(cache, element_costs_on_nodes);
+    CHECK(resource_info.proc_for<FakeSingleton<near_metavars, 0>>() == 4);
+    // Proc 2 was requested by a nonexclusive singleton
+    CHECK(resource_info.proc_for<FakeSingleton<near_metavars, 1>>() == 3);
+    CHECK(resource_info.proc_for<FakeSingleton<near_metavars, 3>>() == 2);
+    CHECK(resource_info.procs_to_ignore() == std::unordered_set<size_t>{3, 4});
+  }
+  {
+    INFO("Move near exclusive singletons");
+    // The elements of "Horizon" move to the last node once the auto exclusive
+    // singleton takes a proc there
+    std::vector<std::unordered_set<size_t>> ignored_procs{};
+    const ElementCostsOnNodes shifting_element_costs_on_nodes =
+        [&ignored_procs](const std::vector<std::string>& /*block_names*/,
+                         const std::unordered_set<size_t>& procs_to_ignore) {
+          ignored_procs.push_back(procs_to_ignore);
+          return procs_to_ignore.count(4) > 0 ? std::vector<double>{0., 1., 3.}
+                                              : std::vector<double>{2., 1., 1.};
+        };
+    auto resource_info =
+        TestHelpers::test_option_tag<OptionTags::ResourceInfo<near_metavars>>(
+            "AvoidGlobalProc0: false\n"
+            "Singletons:\n"
+            "  FakeSingleton0:\n"
+            "    NearBlocks: [Horizon]\n"
+            "  FakeSingleton1:\n"
+            "    Proc: Auto\n"
+            "    Exclusive: true\n"
+            "  FakeSingleton2:\n"
+            "    Proc: Auto\n"
+            "    Exclusive: true\n"
+            "  FakeSingleton3: Auto\n");
+    resource_info.build_singleton_map(cache, shifting_element_costs_on_nodes);
+    CHECK(resource_info.proc_for<FakeSingleton<near_metavars, 1>>() == 2);
+    CHECK(resource_info.proc_for<FakeSingleton<near_metavars, 2>>() == 4);
+    CHECK(resource_info.proc_for<FakeSingleton<near_metavars, 0>>() == 5);
+    CHECK(resource_info.procs_to_ignore() ==
+          std::unordered_set<size_t>{2, 4, 5});
+    CHECK(resource_info.procs_available_for_elements() ==
+          std::set<size_t>{0, 1, 3});
+    CHECK(ignored_procs == std::vector<std::unordered_set<size_t>>{
+                               {}, {0, 2, 4}, {2, 4, 5}});
+  }
+  {
+    INFO("Errors");
+    CHECK_THROWS_WITH(
+        ([&cache]() {
+          auto resource_info = TestHelpers::test_option_tag<
+              OptionTags::ResourceInfo<near_metavars>>(
+              "AvoidGlobalProc0: false\n"
+              "Singletons:\n"
+              "  FakeSingleton0:\n"
+              "    NearBlocks: [Horizon]\n"
+              "  FakeSingleton1: Auto\n"
+              "  FakeSingleton2: Auto\n"
+              "  FakeSingleton3: Auto\n");
+          resource_info.build_singleton_map(cache);
+        })(),
+        Catch::Matchers::ContainsSubstring(
+            "Singleton FakeSingleton0 requested to be placed near the blocks "
+            "(Horizon), but it is not known where the elements are placed."));
+    Parallel::GlobalCache<near_metavars> small_cache{{}, {}, {1, 2}};
+    CHECK_THROWS_WITH(
+        ([&small_cache, &element_costs_on_nodes]() {
+          auto resource_info = TestHelpers::test_option_tag<
+              OptionTags::ResourceInfo<near_metavars>>(
+              "AvoidGlobalProc0: false\n"
+              "Singletons:\n"
+              "  FakeSingleton0:\n"
+              "    NearBlocks: [Horizon]\n"
+              "  FakeSingleton1:\n"
+              "    NearBlocks: [Horizon]\n"
+              "  FakeSingleton2:\n"
+              "    NearBlocks: [Horizon]\n"
+              "  FakeSingleton3: Auto\n");
+          resource_info.build_singleton_map(small_cache,
+                                            element_costs_on_nodes);
+        })(),
+        Catch::Matchers::ContainsSubstring(
+            "The total number of cores requested is less than or equal to the "
+            "number of cores that requested to be exclusive"));
+  }
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Parallel.ResourceInfo", "[Unit][Parallel]") {
@@ -914,6 +1089,7 @@ SPECTRE_TEST_CASE("Unit.Parallel.ResourceInfo", "[Unit][Parallel]") {
   test_single_node_multi_core(make_not_null(&gen));
   test_multi_node_multi_core(make_not_null(&gen));
   test_multi_node_multi_core_large(make_not_null(&gen));
+  test_near_blocks();
   test_errors();
 }
 }  // namespace Parallel
@@ -0,0 +1,192 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "Domain/BoundaryConditions/BoundaryCondition.hpp"
+#include "Domain/CoordinateMaps/Affine.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.tpp"
+#include "Domain/Creators/DomainCreator.hpp"
+#include "Domain/Creators/OptionTags.hpp"
+#include "Domain/Creators/Tags/Domain.hpp"
+#include "Domain/Domain.hpp"
+#include "Domain/ElementCostModel.hpp"
+#include "Domain/ElementDistribution.hpp"
+#include "Domain/Structure/DirectionMap.hpp"
+#include "Domain/Tags/ElementCostModel.hpp"
+#include "Domain/Tags/ElementDistribution.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/SingletonLocality.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace Parallel {
+namespace {
+// Two intervals: "Inner" with 2 elements of 4 grid points and "Outer" with 4
+// elements of 4 grid points
+Domain<1> two_intervals() {
+  using Affine = domain::CoordinateMaps::Affine;
+  return Domain<1>{
+      domain::make_vector_coordinate_map_base<Frame::BlockLogical,
+                                              Frame::Inertial>(
+          Affine{-1., 1., 0., 1.}, Affine{-1., 1., 1., 2.}),
+      {},
+      {"Inner", "Outer"},
+      {{"All", {"Inner", "Outer"}}}};
+}
+
+class TwoIntervals : public DomainCreator<1> {
+ public:
+  Domain<1> create_domain() const override { return two_intervals(); }
+  std::vector<DirectionMap<
+      1, std::unique_ptr<domain::BoundaryConditions::BoundaryCondition>>>
+  external_boundary_conditions() const override {
+    return {};
+  }
+  std::vector<std::string> block_names() const override {
+    return {"Inner", "Outer"};
+  }
+  std::vector<std::array<size_t, 1>> initial_extents() const override {
+    return {{{4}}, {{4}}};
+  }
+  std::vector<std::array<size_t, 1>> initial_refinement_levels()
+      const override {
+    return {{{1}}, {{2}}};
+  }
+};
+
+struct EmptyMetavars {
+  using component_list = tmpl::list<>;
+};
+
+struct Metavariables {
+  using component_list = tmpl::list<>;
+  using const_global_cache_tags =
+      tmpl::list<domain::Tags::Domain<1>, domain::Tags::ElementDistribution>;
+};
+
+struct CostModelMetavariables {
+  using component_list = tmpl::list<>;
+  using const_global_cache_tags =
+      tmpl::list<domain::Tags::Domain<1>, domain::Tags::ElementDistribution,
+                 domain::Tags::ElementCostModel<1>>;
+};
+
+void test_no_domain() {
+  const Parallel::GlobalCache<EmptyMetavars> cache{
+      tuples::TaggedTuple<>{}, {}, {1, 1}};
+  CHECK_FALSE(static_cast<bool>(element_costs_on_nodes<EmptyMetavars>(
+      tuples::TaggedTuple<>{}, cache)));
+}
+
+void test_element_costs_on_nodes() {
+  // 2 nodes with 1 proc each
+  const Parallel::GlobalCache<Metavariables> cache{
+      tuples::TaggedTuple<domain::Tags::Domain<1>,
+                          domain::Tags::ElementDistribution>{
+          two_intervals(), domain::ElementWeight::NumGridPoints},
+      {},
+      {1, 1}};
+  tuples::TaggedTuple<domain::OptionTags::DomainCreator<1>> options{
+      std::make_unique<TwoIntervals>()};
+  const ElementCostsOnNodes costs_on_nodes =
+      element_costs_on_nodes<Metavariables>(options, cache);
+  REQUIRE(static_cast<bool>(costs_on_nodes));
+
+  // The elements are distributed in block order, so the 8 grid points of the
+  // inner block are all on the first node, and most of the 16 grid points of
+  // the outer block are on the second node.
+  const std::vector<double> inner = costs_on_nodes({"Inner"}, {});
+  CHECK(inner == std::vector<double>{8., 0.});
+  const std::vector<double> outer = costs_on_nodes({"Outer"}, {});
+  REQUIRE(outer.size() == 2);
+  CHECK(outer[0] + outer[1] == 16.);
+  CHECK(outer[1] > outer[0]);
+  const std::vector<double> all = costs_on_nodes({"All"}, {});
+  CHECK(all[0] + all[1] == 24.);
+  CHECK(costs_on_nodes({"Inner", "All"}, {}) == all);
+
+  // Without elements on the first node everything is on the second node
+  CHECK(costs_on_nodes({"Inner"}, {0}) == std::vector<double>{0., 8.});
+  CHECK(costs_on_nodes({"All"}, {0}) == std::vector<double>{0., 24.});
+
+  CHECK_THROWS_WITH(costs_on_nodes({"Horizon"}, {}),
+                    Catch::Matchers::ContainsSubstring(
+                        "The block or group 'Horizon' is not one of the block "
+                        "names or groups of the domain."));
+  CHECK_THROWS_WITH(
+      costs_on_nodes({"Inner"}, {0, 1}),
+      Catch::Matchers::ContainsSubstring(
+          "All procs are ignored, so no elements can be placed."));
+}
+
+void test_round_robin() {
+  // 2 nodes with 1 proc each
+  const Parallel::GlobalCache<Metavariables> cache{
+      tuples::TaggedTuple<domain::Tags::Domain<1>,
+                          domain::Tags::ElementDistribution>{two_intervals(),
+                                                             std::nullopt},
+      {},
+      {1, 1}};
+  tuples::TaggedTuple<domain::OptionTags::DomainCreator<1>> options{
+      std::make_unique<TwoIntervals>()};
+  const ElementCostsOnNodes costs_on_nodes =
+      element_costs_on_nodes<Metavariables>(options, cache);
+  REQUIRE(static_cast<bool>(costs_on_nodes));
+
+  // The elements alternate between the procs, so unlike the ZCurve
+  // distribution the elements of the inner block are split between the nodes
+  CHECK(costs_on_nodes({"Inner"}, {}) == std::vector<double>{4., 4.});
+  CHECK(costs_on_nodes({"Outer"}, {}) == std::vector<double>{8., 8.});
+  CHECK(costs_on_nodes({"All"}, {1}) == std::vector<double>{24., 0.});
+}
+
+void test_cost_model() {
+  // The elements of the inner block are measured to be much more expensive
+  // than those of the outer block
+  domain::ElementCostModel<1> cost_model{};
+  cost_model.insert(0, {{4}}, false, 10.);
+  cost_model.insert(1, {{4}}, false, 1.);
+  // 2 nodes with 1 proc each
+  const Parallel::GlobalCache<CostModelMetavariables> cache{
+      tuples::TaggedTuple<domain::Tags::Domain<1>,
+                          domain::Tags::ElementDistribution,
+                          domain::Tags::ElementCostModel<1>>{
+          two_intervals(), domain::ElementWeight::NumGridPoints,
+          std::move(cost_model)},
+      {},
+      {1, 1}};
+  tuples::TaggedTuple<domain::OptionTags::DomainCreator<1>> options{
+      std::make_unique<TwoIntervals>()};
+  const ElementCostsOnNodes costs_on_nodes =
+      element_costs_on_nodes<CostModelMetavariables>(options, cache);
+  REQUIRE(static_cast<bool>(costs_on_nodes));
+
+  // The measured costs are summed, and the two expensive elements of the
+  // inner block are distributed over both nodes
+  const std::vector<double> inner = costs_on_nodes({"Inner"}, {});
+  CHECK(inner == std::vector<double>{10., 10.});
+  const std::vector<double> all = costs_on_nodes({"All"}, {});
+  CHECK(all[0] + all[1] == 24.);
+  CHECK(costs_on_nodes({"Inner"}, {0}) == std::vector<double>{0., 20.});
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Parallel.SingletonLocality", "[Unit][Parallel]") {
+  test_no_domain();
+  test_element_costs_on_nodes();
+  test_round_robin();
+  test_cost_model();
+}
+}  // namespace Parallel
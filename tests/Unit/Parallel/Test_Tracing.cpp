@@ -0,0 +1,159 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "Framework/TestHelpers.hpp"
+#include "Parallel/Tracing.hpp"
+#include "Utilities/GetOutput.hpp"
+#include "Utilities/Literals.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
+
+namespace Parallel::tracing {
+namespace {
+struct TracedComponent {};
+struct TracedAction {};
+
+void test_names() {
+  const size_t id = register_name("Unit.Parallel.Tracing.Name");
+  CHECK(register_name("Unit.Parallel.Tracing.Name") == id);
+  CHECK(register_name("Unit.Parallel.Tracing.OtherName") != id);
+  CHECK(registered_name(id) == "Unit.Parallel.Tracing.Name");
+  CHECK(name_id<TracedComponent>() == register_name("TracedComponent"));
+  CHECK(name_id<TracedComponent>() != name_id<TracedAction>());
+  CHECK(registered_name(name_id<TracedAction>()) == "TracedAction");
+
+  CHECK(get_output(EventType::IterableAction) == "IterableAction");
+  CHECK(get_output(EventType::RetriedIterableAction) ==
+        "RetriedIterableAction");
+  CHECK(get_output(EventType::SimpleAction) == "SimpleAction");
+  CHECK(get_output(EventType::ThreadedAction) == "ThreadedAction");
+  CHECK(get_output(EventType::ReceiveData) == "ReceiveData");
+  CHECK(get_output(EventType::Phase) == "Phase");
+}
+
+void test_record_and_summarize() {
+  // Remove events recorded before this test
+  (void)drain();
+  CHECK(drain().empty());
+
+  const size_t component = name_id<TracedComponent>();
+  const size_t action = name_id<TracedAction>();
+  const size_t inbox = register_name("TracedInbox");
+  record({3.0, 0.5, 0.25, component, action, 0, EventType::IterableAction});
+  record({1.0, 0.1, 1.0, component, action, 0,
+          EventType::RetriedIterableAction});
+  record({2.0, 1.5, 0.5, component, action, 0, EventType::IterableAction});
+  // Events recorded by other threads are drained as well
+  std::thread other_thread{[component, inbox]() {
+    record({0.5, 0.01, 0.0, component, inbox, 1, EventType::ReceiveData});
+    record({0.75, 0.02, 0.0, component, inbox, 1, EventType::ReceiveData});
+  }};
+  other_thread.join();
+  {
+    const ScopedEvent scoped_event{EventType::SimpleAction, component,
+                                   register_name("TracedSimpleAction")};
+  }
+  {
+    ScopedEvent scoped_event{EventType::IterableAction, component,
+                             register_name("TracedRetry"), 2.0};
+    scoped_event.set_type(EventType::RetriedIterableAction);
+  }
+
+  const std::vector<Event> events = drain();
+  CHECK(drain().empty());
+  REQUIRE(events.size() == 7);
+  // Events are sorted by their start time
+  CHECK(events[0].start == 0.5);
+  CHECK(events[0].core == 1);
+  CHECK(events[1].start == 0.75);
+  CHECK(events[2].start == 1.0);
+  CHECK(events[3].start == 2.0);
+  CHECK(events[4].start == 3.0);
+  CHECK(events[5].type == EventType::SimpleAction);
+  CHECK(events[5].duration >= 0.0);
+  CHECK(events[6].type == EventType::RetriedIterableAction);
+  CHECK(events[6].queue_wait == 2.0);
+
+  const auto summaries = summarize(events);
+  CHECK(summaries.size() == 4);
+  const auto& action_summary =
+      summaries.at(std::pair{"TracedComponent", "TracedAction"});
+  CHECK(action_summary.calls == 2);
+  CHECK(action_summary.retries == 1);
+  CHECK(action_summary.messages == 0);
+  CHECK(action_summary.total_wall_time == approx(2.1));
+  CHECK(action_summary.max_wall_time == 1.5);
+  // The queue wait of the retry isn't counted
+  CHECK(action_summary.total_queue_wait == 0.75);
+  const auto& inbox_summary =
+      summaries.at(std::pair{"TracedComponent", "TracedInbox"});
+  CHECK(inbox_summary.calls == 0);
+  CHECK(inbox_summary.messages == 2);
+  CHECK(inbox_summary.total_wall_time == approx(0.03));
+  CHECK(summaries.at(std::pair{"TracedComponent", "TracedSimpleAction"})
+            .calls == 1);
+  const auto& retry_summary =
+      summaries.at(std::pair{"TracedComponent", "TracedRetry"});
+  CHECK(retry_summary.calls == 0);
+  CHECK(retry_summary.retries == 1);
+  CHECK(retry_summary.total_queue_wait == 0.0);
+}
+
+void test_dropped_events() {
+  (void)drain();
+  // The events recorded by this thread are attributed to its PE
+  const auto proc = static_cast<size_t>(sys::my_proc());
+  const auto dropped_on_proc = [&proc]() {
+    const auto dropped = number_of_dropped_events();
+    const auto it = dropped.find(proc);
+    return it == dropped.end() ? 0_st : it->second;
+  };
+  const size_t dropped_before = dropped_on_proc();
+  const Event event{0.0, 1.0, 0.0, name_id<TracedComponent>(),
+                    name_id<TracedAction>(), 0, EventType::SimpleAction};
+  for (size_t i = 0; i < buffer_capacity + 10; ++i) {
+    record(event);
+  }
+  CHECK(number_of_dropped_events().count(proc) == 1);
+  CHECK(dropped_on_proc() == dropped_before + 10);
+  CHECK(drain().size() == buffer_capacity);
+  // The buffer can be used again once drained
+  record(event);
+  CHECK(dropped_on_proc() == dropped_before + 10);
+  CHECK(drain().size() == 1);
+}
+
+void test_drain_for_observation() {
+  (void)drain();
+  const Event event{0.0, 1.0, 0.0, name_id<TracedComponent>(),
+                    name_id<TracedAction>(), 0, EventType::SimpleAction};
+  record(event);
+  const auto first_drain = drain(1.0);
+  REQUIRE(first_drain.has_value());
+  CHECK(first_drain->size() == 1);
+  // Other elements observing at the same or an earlier value don't drain
+  record(event);
+  CHECK_FALSE(drain(1.0).has_value());
+  CHECK_FALSE(drain(0.5).has_value());
+  const auto next_drain = drain(2.0);
+  REQUIRE(next_drain.has_value());
+  CHECK(next_drain->size() == 1);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Parallel.Tracing", "[Unit][Parallel]") {
+  test_names();
+  test_record_and_summarize();
+  test_dropped_events();
+  test_drain_for_observation();
+}
+}  // namespace Parallel::tracing
@@ -6,6 +6,7 @@
 #include <array>
 #include <cstddef>
 #include <deque>
+#include <optional>
 #include <pup.h>
 #include <unordered_map>
 #include <unordered_set>
@@ -33,6 +34,7 @@
 #include "ParallelAlgorithms/Amr/Actions/Component.hpp"
 #include "ParallelAlgorithms/Amr/Actions/CreateChild.hpp"
 #include "ParallelAlgorithms/Amr/Actions/CreateParent.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/Tags/AccumulatedFlags.hpp"
 #include "ParallelAlgorithms/Amr/Projectors/DefaultInitialize.hpp"
 #include "ParallelAlgorithms/Amr/Protocols/AmrMetavariables.hpp"
 #include "Utilities/StdHelpers.hpp"
@@ -95,7 +97,8 @@ struct ArrayComponent {
   using simple_tags = tmpl::list<
       domain::Tags::Element<volume_dim>, domain::Tags::Mesh<volume_dim>,
       domain::Tags::NeighborMesh<volume_dim>, amr::Tags::Info<volume_dim>,
-      amr::Tags::NeighborInfo<volume_dim>>;
+      amr::Tags::NeighborInfo<volume_dim>,
+      amr::Criteria::Tags::AccumulatedFlags<volume_dim>>;
   using phase_dependent_action_list = tmpl::list<Parallel::PhaseActions<
       Parallel::Phase::Initialization,
       tmpl::list<ActionTesting::InitializeDataBox<simple_tags>>>>;
@@ -225,24 +228,27 @@ void test() {
       {element_3_id, element_3_info}};
 
   using NeighborMeshes = DirectionalIdMap<1, Mesh<1>>;
+  // Flags accumulated by amr::Events::SampleCriteria before the AMR phase
+  const std::optional<std::array<amr::Flag, 1>> sampled_flags{
+      std::array{amr::Flag::Split}};
 
   ActionTesting::MockRuntimeSystem<Metavariables> runner{{::Verbosity::Debug}};
   ActionTesting::emplace_component_and_initialize<array_component>(
       &runner, element_1_id,
       {element_1, element_1_mesh, NeighborMeshes{}, element_1_info,
-       element_1_neighbor_info});
+       element_1_neighbor_info, sampled_flags});
   ActionTesting::emplace_component_and_initialize<array_component>(
       &runner, element_2_id,
       {element_2, element_2_mesh, NeighborMeshes{}, element_2_info,
-       element_2_neighbor_info});
+       element_2_neighbor_info, sampled_flags});
   ActionTesting::emplace_component_and_initialize<array_component>(
       &runner, element_3_id,
       {element_3, element_3_mesh, NeighborMeshes{}, element_3_info,
-       element_3_neighbor_info});
+       element_3_neighbor_info, sampled_flags});
   ActionTesting::emplace_component_and_initialize<array_component>(
       &runner, element_4_id,
       {element_4, element_4_mesh, NeighborMeshes{}, element_4_info,
-       element_4_neighbor_info});
+       element_4_neighbor_info, sampled_flags});
   ActionTesting::emplace_component<singleton_component>(&runner, 0);
 
   const auto check_for_empty_queues_on_elements =
@@ -325,6 +331,17 @@ void test() {
             element_3_mesh_post_refinement, expected_element_3_neighbor_meshes,
             {std::array{amr::Flag::Undefined}, element_3_mesh_post_refinement},
             {});
+
+  // The sampled flags are cleared on the element that remains, and left
+  // alone on the elements that are replaced by new elements
+  using accumulated_flags_tag = amr::Criteria::Tags::AccumulatedFlags<1>;
+  CHECK(ActionTesting::get_databox_tag<array_component, accumulated_flags_tag>(
+            runner, element_3_id) == std::nullopt);
+  for (const auto& id : std::vector{element_1_id, element_2_id, element_4_id}) {
+    CHECK(
+        ActionTesting::get_databox_tag<array_component, accumulated_flags_tag>(
+            runner, id) == sampled_flags);
+  }
 }
 }  // namespace
 
@@ -20,6 +20,7 @@
 #include "Parallel/GlobalCache.hpp"
 #include "ParallelAlgorithms/Amr/Criteria/Criterion.hpp"
 #include "ParallelAlgorithms/Amr/Criteria/Loehner.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/Tags/MonitorCache.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Serialization/RegisterDerivedClassesWithCharm.hpp"
 #include "Utilities/TMPL.hpp"
@@ -91,7 +92,7 @@ SPECTRE_TEST_CASE("Unit.Amr.Criteria.Loehner", "[Unit][ParallelAlgorithms]") {
       db::create<tmpl::list<::domain::Tags::Mesh<Dim>, TestVector<Dim>>>(
           mesh, std::move(test_data));
   ObservationBox<
-      tmpl::list<>,
+      tmpl::list<Tags::MonitorCacheCompute<Dim>>,
       db::DataBox<tmpl::list<::domain::Tags::Mesh<Dim>, TestVector<Dim>>>>
       box{make_not_null(&databox)};
 
@@ -0,0 +1,103 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/ObservationBox.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "Domain/Tags.hpp"
+#include "Helpers/DataStructures/DataBox/TestHelpers.hpp"
+#include "NumericalAlgorithms/LinearOperators/PowerMonitors.hpp"
+#include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/Loehner.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/MonitorCache.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/Persson.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/Tags/MonitorCache.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace amr::Criteria {
+namespace {
+
+void test_monitor_cache() {
+  const Mesh<2> mesh{{{6, 5}},
+                     Spectral::Basis::Legendre,
+                     Spectral::Quadrature::GaussLobatto};
+  const auto logical_coords = logical_coordinates(mesh);
+  const DataVector component_a =
+      exp(-square(get<0>(logical_coords))) + 2. * get<1>(logical_coords);
+  const DataVector component_b =
+      get<0>(logical_coords) - 3. * get<1>(logical_coords);
+
+  const MonitorCache<2> cache{mesh};
+  CHECK(cache.mesh() == mesh);
+  CHECK(cache.number_of_evaluations() == 0);
+  CHECK(cache.number_of_cache_hits() == 0);
+
+  CHECK(cache.max_abs("A", 0, component_a) == approx(max(abs(component_a))));
+  CHECK(cache.max_abs("A", 0, component_a) == approx(max(abs(component_a))));
+  CHECK(cache.number_of_evaluations() == 1);
+  CHECK(cache.number_of_cache_hits() == 1);
+
+  // Different component index and different tensor name are separate entries
+  CHECK(cache.max_abs("A", 1, component_b) == approx(max(abs(component_b))));
+  CHECK(cache.max_abs("B", 0, component_b) == approx(max(abs(component_b))));
+  CHECK(cache.number_of_evaluations() == 3);
+  CHECK(cache.number_of_cache_hits() == 1);
+
+  const auto expected_power_monitors =
+      PowerMonitors::power_monitors(component_a, mesh);
+  for (size_t i = 0; i < 2; ++i) {
+    const auto& power_monitors = cache.power_monitors("A", 0, component_a);
+    CHECK_ITERABLE_APPROX(power_monitors, expected_power_monitors);
+  }
+  CHECK(cache.number_of_evaluations() == 4);
+  CHECK(cache.number_of_cache_hits() == 2);
+
+  const auto expected_persson_2 =
+      persson_smoothness_indicator(component_a, mesh, 2);
+  const auto expected_persson_3 =
+      persson_smoothness_indicator(component_a, mesh, 3);
+  const auto expected_loehner = loehner_smoothness_indicator(component_a, mesh);
+  for (size_t repeat = 0; repeat < 2; ++repeat) {
+    for (size_t d = 0; d < 2; ++d) {
+      CHECK(cache.persson_indicator("A", 0, component_a, d, 2) ==
+            approx(gsl::at(expected_persson_2, d)));
+      CHECK(cache.persson_indicator("A", 0, component_a, d, 3) ==
+            approx(gsl::at(expected_persson_3, d)));
+      CHECK(cache.loehner_indicator("A", 0, component_a, d) ==
+            approx(gsl::at(expected_loehner, d)));
+    }
+  }
+  CHECK(cache.number_of_evaluations() == 10);
+  CHECK(cache.number_of_cache_hits() == 8);
+}
+
+void test_compute_tag() {
+  TestHelpers::db::test_simple_tag<Tags::MonitorCache<2>>("MonitorCache");
+  TestHelpers::db::test_compute_tag<Tags::MonitorCacheCompute<2>>(
+      "MonitorCache");
+
+  const Mesh<2> mesh{4, Spectral::Basis::Legendre,
+                     Spectral::Quadrature::GaussLobatto};
+  auto databox = db::create<tmpl::list<::domain::Tags::Mesh<2>>>(mesh);
+  const auto box = make_observation_box<
+      tmpl::list<Tags::MonitorCacheCompute<2>>>(make_not_null(&databox));
+  const auto& cache = get<Tags::MonitorCache<2>>(box);
+  CHECK(cache.mesh() == mesh);
+  CHECK(cache.number_of_evaluations() == 0);
+}
+
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Amr.Criteria.MonitorCache",
+                  "[Unit][ParallelAlgorithms]") {
+  test_monitor_cache();
+  test_compute_tag();
+}
+
+}  // namespace amr::Criteria
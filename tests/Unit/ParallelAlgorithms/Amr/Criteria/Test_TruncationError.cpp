@@ -18,6 +18,7 @@
 #include "Options/Protocols/FactoryCreation.hpp"
 #include "Parallel/GlobalCache.hpp"
 #include "ParallelAlgorithms/Amr/Criteria/Criterion.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/Tags/MonitorCache.hpp"
 #include "ParallelAlgorithms/Amr/Criteria/TruncationError.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Serialization/RegisterDerivedClassesWithCharm.hpp"
@@ -77,7 +78,7 @@ SPECTRE_TEST_CASE("Unit.Amr.Criteria.TruncationError",
         db::create<tmpl::list<::domain::Tags::Mesh<Dim>, TestVector<Dim>>>(
             mesh, std::move(test_data));
     ObservationBox<
-        tmpl::list<>,
+        tmpl::list<Tags::MonitorCacheCompute<Dim>>,
         db::DataBox<tmpl::list<::domain::Tags::Mesh<Dim>, TestVector<Dim>>>>
         box{make_not_null(&databox)};
 
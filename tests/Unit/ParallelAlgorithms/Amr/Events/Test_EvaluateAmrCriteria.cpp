@@ -0,0 +1,158 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/ObservationBox.hpp"
+#include "Domain/Amr/Flag.hpp"
+#include "Domain/Amr/Info.hpp"
+#include "Domain/Amr/Tags/Flags.hpp"
+#include "Domain/Amr/Tags/NeighborFlags.hpp"
+#include "Domain/Structure/Direction.hpp"
+#include "Domain/Structure/Element.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/OrientationMap.hpp"
+#include "Domain/Tags.hpp"
+#include "Framework/ActionTesting.hpp"
+#include "Framework/TestCreation.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Options/Protocols/FactoryCreation.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Phase.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/DriveToTarget.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/Tags/Criteria.hpp"
+#include "ParallelAlgorithms/Amr/Events/EvaluateAmrCriteria.hpp"
+#include "ParallelAlgorithms/Amr/Policies/Isotropy.hpp"
+#include "ParallelAlgorithms/Amr/Policies/Limits.hpp"
+#include "ParallelAlgorithms/Amr/Policies/Policies.hpp"
+#include "ParallelAlgorithms/Amr/Policies/Tags.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/ProtocolHelpers.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+
+template <typename Metavariables>
+struct ElementComponent {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = ElementId<1>;
+  using const_global_cache_tags =
+      tmpl::list<amr::Criteria::Tags::Criteria, amr::Tags::Policies>;
+  using simple_tags =
+      tmpl::list<domain::Tags::Element<1>, domain::Tags::Mesh<1>,
+                 amr::Tags::Info<1>, amr::Tags::NeighborInfo<1>>;
+  using phase_dependent_action_list = tmpl::list<Parallel::PhaseActions<
+      Parallel::Phase::Initialization,
+      tmpl::list<ActionTesting::InitializeDataBox<simple_tags>>>>;
+};
+
+struct Metavariables {
+  static constexpr size_t volume_dim = 1;
+  using component_list = tmpl::list<ElementComponent<Metavariables>>;
+  struct factory_creation
+      : tt::ConformsTo<Options::protocols::FactoryCreation> {
+    using factory_classes = tmpl::map<
+        tmpl::pair<Event, tmpl::list<amr::Events::EvaluateAmrCriteria>>,
+        tmpl::pair<amr::Criterion,
+                   tmpl::list<amr::Criteria::DriveToTarget<1>>>>;
+  };
+};
+
+void test(const Event& event) {
+  using element_component = ElementComponent<Metavariables>;
+  using NeighborInfo = std::unordered_map<ElementId<1>, amr::Info<1>>;
+
+  CHECK(event.needs_evolved_variables());
+
+  const ElementId<1> self_id(0, {{{1, 0}}});
+  const ElementId<1> sibling_id(0, {{{1, 1}}});
+  const Mesh<1> mesh{3_st, Spectral::Basis::Legendre,
+                     Spectral::Quadrature::GaussLobatto};
+  const Element<1> self(
+      self_id, {{{Direction<1>::upper_xi(),
+                  {{sibling_id}, OrientationMap<1>::create_aligned()}}}});
+  const Element<1> sibling(
+      sibling_id, {{{Direction<1>::lower_xi(),
+                     {{self_id}, OrientationMap<1>::create_aligned()}}}});
+  const amr::Info<1> initial_info{std::array{amr::Flag::Undefined}, Mesh<1>{}};
+
+  // Both elements are at the target, so they do nothing
+  std::vector<std::unique_ptr<amr::Criterion>> criteria{};
+  criteria.emplace_back(std::make_unique<amr::Criteria::DriveToTarget<1>>(
+      std::array{3_st}, std::array{1_st}, std::array{amr::Flag::DoNothing}));
+  ActionTesting::MockRuntimeSystem<Metavariables> runner{
+      {std::move(criteria),
+       amr::Policies{amr::Isotropy::Anisotropic, amr::Limits{}, true}}};
+  ActionTesting::emplace_component_and_initialize<element_component>(
+      &runner, self_id, {self, mesh, initial_info, NeighborInfo{}});
+  ActionTesting::emplace_component_and_initialize<element_component>(
+      &runner, sibling_id, {sibling, mesh, initial_info, NeighborInfo{}});
+  runner.set_phase(Parallel::Phase::Testing);
+
+  const auto run_event = [&event, &runner](const ElementId<1>& id) {
+    auto& box =
+        ActionTesting::get_databox<element_component>(make_not_null(&runner),
+                                                      id);
+    auto obs_box = make_observation_box<tmpl::list<>>(make_not_null(&box));
+    event.run(make_not_null(&obs_box),
+              ActionTesting::cache<element_component>(runner, id), id,
+              std::add_pointer_t<element_component>{}, {"Unused", -1.0});
+  };
+  const auto info = [&runner](const ElementId<1>& id) {
+    return ActionTesting::get_databox_tag<element_component,
+                                          amr::Tags::Info<1>>(runner, id);
+  };
+  const auto number_of_queued_actions = [&runner](const ElementId<1>& id) {
+    return ActionTesting::number_of_queued_simple_actions<element_component>(
+        runner, id);
+  };
+
+  const amr::Info<1> expected_info{std::array{amr::Flag::DoNothing}, mesh};
+  run_event(self_id);
+  CHECK(info(self_id) == expected_info);
+  CHECK(info(sibling_id) == initial_info);
+  CHECK(number_of_queued_actions(self_id) == 0);
+  CHECK(number_of_queued_actions(sibling_id) == 1);
+
+  // The decision is pending, so evaluating again does nothing
+  run_event(self_id);
+  CHECK(info(self_id) == expected_info);
+  CHECK(number_of_queued_actions(sibling_id) == 1);
+
+  // The sibling receives the decision before evaluating its own
+  ActionTesting::invoke_queued_simple_action<element_component>(
+      make_not_null(&runner), sibling_id);
+  CHECK(info(sibling_id) == initial_info);
+  CHECK(ActionTesting::get_databox_tag<element_component,
+                                       amr::Tags::NeighborInfo<1>>(
+            runner, sibling_id) == NeighborInfo{{self_id, expected_info}});
+
+  run_event(sibling_id);
+  CHECK(info(sibling_id) == expected_info);
+  CHECK(number_of_queued_actions(self_id) == 1);
+  CHECK(number_of_queued_actions(sibling_id) == 0);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Amr.Events.EvaluateAmrCriteria",
+                  "[Unit][ParallelAlgorithms]") {
+  register_factory_classes_with_charm<Metavariables>();
+  const amr::Events::EvaluateAmrCriteria event{};
+  test(event);
+  test(serialize_and_deserialize(event));
+  const auto option_event =
+      TestHelpers::test_creation<std::unique_ptr<Event>, Metavariables>(
+          "EvaluateAmrCriteria\n");
+  test(*option_event);
+  test(*serialize_and_deserialize(option_event));
+}
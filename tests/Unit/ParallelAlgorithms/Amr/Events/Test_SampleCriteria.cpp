@@ -0,0 +1,141 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/ObservationBox.hpp"
+#include "Domain/Amr/Flag.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Tags.hpp"
+#include "Framework/ActionTesting.hpp"
+#include "Framework/TestCreation.hpp"
+#include "Options/Protocols/FactoryCreation.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Phase.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/DriveToTarget.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/IncreaseResolution.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/Tags/AccumulatedFlags.hpp"
+#include "ParallelAlgorithms/Amr/Criteria/Tags/Criteria.hpp"
+#include "ParallelAlgorithms/Amr/Events/SampleCriteria.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/ProtocolHelpers.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+
+template <typename Metavariables>
+struct ElementComponent {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = ElementId<1>;
+  using const_global_cache_tags = tmpl::list<amr::Criteria::Tags::Criteria>;
+  using simple_tags =
+      tmpl::list<domain::Tags::Mesh<1>,
+                 amr::Criteria::Tags::AccumulatedFlags<1>>;
+  using phase_dependent_action_list = tmpl::list<Parallel::PhaseActions<
+      Parallel::Phase::Initialization,
+      tmpl::list<ActionTesting::InitializeDataBox<simple_tags>>>>;
+};
+
+struct Metavariables {
+  static constexpr size_t volume_dim = 1;
+  using component_list = tmpl::list<ElementComponent<Metavariables>>;
+  struct factory_creation
+      : tt::ConformsTo<Options::protocols::FactoryCreation> {
+    using factory_classes =
+        tmpl::map<tmpl::pair<Event, tmpl::list<amr::Events::SampleCriteria>>,
+                  tmpl::pair<amr::Criterion,
+                             tmpl::list<amr::Criteria::IncreaseResolution<1>,
+                                        amr::Criteria::DriveToTarget<1>>>>;
+  };
+};
+
+std::vector<std::unique_ptr<amr::Criterion>> sampled_criteria() {
+  std::vector<std::unique_ptr<amr::Criterion>> criteria{};
+  criteria.emplace_back(
+      std::make_unique<amr::Criteria::IncreaseResolution<1>>());
+  return criteria;
+}
+
+void test(const Event& event) {
+  using element_component = ElementComponent<Metavariables>;
+  using accumulated_flags_tag = amr::Criteria::Tags::AccumulatedFlags<1>;
+
+  CHECK(event.needs_evolved_variables());
+
+  const ElementId<1> element_id{0};
+  const Mesh<1> mesh{std::array{3_st}, Spectral::Basis::Legendre,
+                     Spectral::Quadrature::GaussLobatto};
+
+  const auto run_event =
+      [&element_id, &event, &mesh](
+          const std::optional<std::array<amr::Flag, 1>>& initial_flags) {
+        // The criteria of the AMR phases would split the element. They must
+        // not be evaluated by the event, which only evaluates its own
+        // criteria.
+        std::vector<std::unique_ptr<amr::Criterion>> criteria{};
+        criteria.emplace_back(std::make_unique<amr::Criteria::DriveToTarget<1>>(
+            std::array{3_st}, std::array{1_st},
+            std::array{amr::Flag::DoNothing}));
+        ActionTesting::MockRuntimeSystem<Metavariables> runner{
+            {std::move(criteria)}};
+        ActionTesting::emplace_component_and_initialize<element_component>(
+            &runner, element_id, {mesh, initial_flags});
+        auto& box = ActionTesting::get_databox<element_component>(
+            make_not_null(&runner), element_id);
+        auto obs_box = make_observation_box<tmpl::list<>>(make_not_null(&box));
+
+        event.run(make_not_null(&obs_box),
+                  ActionTesting::cache<element_component>(runner, element_id),
+                  element_id, std::add_pointer_t<element_component>{},
+                  {"Unused", -1.0});
+
+        // The mesh is never changed by this event
+        CHECK(ActionTesting::get_databox_tag<element_component,
+                                             domain::Tags::Mesh<1>>(
+                  runner, element_id) == mesh);
+        return ActionTesting::get_databox_tag<element_component,
+                                              accumulated_flags_tag>(
+            runner, element_id);
+      };
+
+  {
+    INFO("Nothing accumulated yet");
+    CHECK(run_event(std::nullopt) ==
+          std::optional{std::array{amr::Flag::IncreaseResolution}});
+  }
+  {
+    INFO("Higher-priority flag replaces accumulated flag");
+    CHECK(run_event(std::array{amr::Flag::Join}) ==
+          std::optional{std::array{amr::Flag::IncreaseResolution}});
+  }
+  {
+    INFO("Lower-priority flag keeps accumulated flag");
+    CHECK(run_event(std::array{amr::Flag::Split}) ==
+          std::optional{std::array{amr::Flag::Split}});
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Amr.Events.SampleCriteria",
+                  "[Unit][ParallelAlgorithms]") {
+  register_factory_classes_with_charm<Metavariables>();
+  const amr::Events::SampleCriteria event{sampled_criteria()};
+  test(event);
+  test(serialize_and_deserialize(event));
+  const auto option_event =
+      TestHelpers::test_creation<std::unique_ptr<Event>, Metavariables>(
+          "SampleCriteria:\n"
+          "  Criteria:\n"
+          "    - IncreaseResolution\n");
+  test(*option_event);
+  test(*serialize_and_deserialize(option_event));
+}
@@ -0,0 +1,221 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/ObservationBox.hpp"
+#include "DataStructures/Matrix.hpp"
+#include "Framework/ActionTesting.hpp"
+#include "Framework/TestCreation.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/IO/Observers/ObserverHelpers.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/Dat.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/Observer/Actions/WriteActionTraces.hpp"
+#include "IO/Observer/Tags.hpp"
+#include "Options/Protocols/FactoryCreation.hpp"
+#include "Parallel/Phase.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "Parallel/Tracing.hpp"
+#include "ParallelAlgorithms/Events/ObserveActionTraces.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "Utilities/FileSystem.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/ProtocolHelpers.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+struct TracedComponent {};
+struct TracedAction {};
+
+template <typename Metavariables>
+struct ElementComponent {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = int;
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<Parallel::Phase::Initialization, tmpl::list<>>>;
+};
+
+struct Metavariables {
+  using component_list =
+      tmpl::list<ElementComponent<Metavariables>,
+                 TestObservers_detail::observer_writer_component<
+                     Metavariables>>;
+  struct factory_creation
+      : tt::ConformsTo<Options::protocols::FactoryCreation> {
+    using factory_classes = tmpl::map<
+        tmpl::pair<Event, tmpl::list<Events::ObserveActionTraces>>>;
+  };
+};
+
+void record_events() {
+  using Parallel::tracing::EventType;
+  const size_t component = Parallel::tracing::name_id<TracedComponent>();
+  const size_t action = Parallel::tracing::name_id<TracedAction>();
+  const size_t inbox = Parallel::tracing::register_name("TracedInbox");
+  Parallel::tracing::record(
+      {1.0, 0.5, 0.25, component, action, 2, EventType::IterableAction});
+  Parallel::tracing::record({2.0, 0.125, 0.0, component, action, 2,
+                             EventType::RetriedIterableAction});
+  Parallel::tracing::record(
+      {3.0, 1.5, 0.5, component, action, 3, EventType::IterableAction});
+  Parallel::tracing::record(
+      {0.5, 0.25, 0.0, component, inbox, 3, EventType::ReceiveData});
+}
+
+void test_make_action_traces() {
+  (void)Parallel::tracing::drain();
+  record_events();
+  const auto events = Parallel::tracing::drain();
+  const auto traces =
+      Events::ObserveActionTraces::make_action_traces(events, false);
+  // The traces are split by the PE the events ran on
+  REQUIRE(traces.size() == 3);
+  CHECK(traces[0].component == "TracedComponent");
+  CHECK(traces[0].name == "TracedAction");
+  CHECK(traces[0].proc == 2);
+  CHECK(traces[0].summary ==
+        std::vector<double>{1.0, 1.0, 0.0, 0.625, 0.5, 0.25});
+  CHECK(traces[0].events.empty());
+  CHECK(traces[1].name == "TracedAction");
+  CHECK(traces[1].proc == 3);
+  CHECK(traces[1].summary ==
+        std::vector<double>{1.0, 0.0, 0.0, 1.5, 1.5, 0.5});
+  CHECK(traces[2].name == "TracedInbox");
+  CHECK(traces[2].proc == 3);
+  CHECK(traces[2].summary ==
+        std::vector<double>{0.0, 0.0, 1.0, 0.25, 0.25, 0.0});
+
+  const auto traces_with_events =
+      Events::ObserveActionTraces::make_action_traces(events, true);
+  REQUIRE(traces_with_events.size() == 3);
+  CHECK(traces_with_events[0].summary == traces[0].summary);
+  CHECK(traces_with_events[0].events ==
+        std::vector<std::vector<double>>{{1.0, 0.5, 0.25, 2.0, 0.0},
+                                         {2.0, 0.125, 0.0, 2.0, 1.0}});
+  CHECK(traces_with_events[1].events ==
+        std::vector<std::vector<double>>{{3.0, 1.5, 0.5, 3.0, 0.0}});
+  CHECK(traces_with_events[2].events ==
+        std::vector<std::vector<double>>{{0.5, 0.25, 0.0, 3.0, 4.0}});
+
+  const auto serialized_trace = serialize_and_deserialize(traces_with_events);
+  CHECK(serialized_trace[0].proc == traces_with_events[0].proc);
+  CHECK(serialized_trace[0].events == traces_with_events[0].events);
+}
+
+void test_event() {
+  using element_component = ElementComponent<Metavariables>;
+  using obs_writer =
+      TestObservers_detail::observer_writer_component<Metavariables>;
+
+  const std::string file_prefix =
+      "Unit.ParallelAlgorithms.ObserveActionTraces";
+  const std::string h5_file_name = file_prefix + ".h5";
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+  tuples::TaggedTuple<observers::Tags::ReductionFileName,
+                      observers::Tags::VolumeFileName>
+      cache_data{file_prefix, "Unused"};
+  // Two nodes with two PEs each, so the traced PEs 2 and 3 are on node 1
+  ActionTesting::MockRuntimeSystem<Metavariables> runner{
+      cache_data, {}, {2, 2}};
+  ActionTesting::emplace_component<element_component>(&runner, 0);
+  ActionTesting::emplace_component<element_component>(&runner, 1);
+  ActionTesting::emplace_nodegroup_component<obs_writer>(&runner);
+  for (size_t i = 0; i < 2; ++i) {
+    ActionTesting::next_action<obs_writer>(make_not_null(&runner), 0);
+  }
+  runner.set_phase(Parallel::Phase::Testing);
+
+  const auto event =
+      TestHelpers::test_creation<std::unique_ptr<Event>, Metavariables>(
+          "ObserveActionTraces:\n"
+          "  WriteEvents: True");
+  CHECK_FALSE(event->needs_evolved_variables());
+  const auto serialized_event = serialize_and_deserialize(event);
+
+  auto box = db::create<db::AddSimpleTags<>>();
+  auto obs_box = make_observation_box<tmpl::list<>>(make_not_null(&box));
+  element_component* const component_ptr = nullptr;
+
+  (void)Parallel::tracing::drain();
+  record_events();
+  for (const int element : {0, 1}) {
+    serialized_event->run(
+        make_not_null(&obs_box),
+        ActionTesting::cache<element_component>(runner, element), element,
+        component_ptr, {"Unused", 4.0});
+    // The second element recorded events of its own before observing, but
+    // they are only drained at the next observation
+    record_events();
+  }
+  // Only the first element drained the events for this observation
+  CHECK(ActionTesting::number_of_queued_threaded_actions<obs_writer>(runner,
+                                                                     0) == 1);
+  ActionTesting::invoke_queued_threaded_action<obs_writer>(
+      make_not_null(&runner), 0);
+
+  {
+    h5::H5File<h5::AccessType::ReadOnly> read_file{h5_file_name};
+    const auto& summary = read_file.get<h5::Dat>(
+        "/ActionTraces/TracedComponent/TracedAction/Summary");
+    CHECK(summary.get_legend() == observers::ActionTrace::summary_legend());
+    const Matrix summary_data = summary.get_data();
+    REQUIRE(summary_data.rows() == 2);
+    CHECK(summary_data(0, 0) == 4.0);
+    CHECK(summary_data(0, 1) == 2.0);
+    CHECK(summary_data(0, 2) == 1.0);
+    CHECK(summary_data(0, 3) == 1.0);
+    CHECK(summary_data(0, 5) == 0.625);
+    CHECK(summary_data(1, 1) == 3.0);
+    CHECK(summary_data(1, 2) == 1.0);
+    CHECK(summary_data(1, 5) == 1.5);
+    read_file.close_current_object();
+
+    const auto& events = read_file.get<h5::Dat>(
+        "/ActionTraces/TracedComponent/TracedAction/Events");
+    CHECK(events.get_legend() == observers::ActionTrace::events_legend());
+    const Matrix events_data = events.get_data();
+    REQUIRE(events_data.rows() == 3);
+    CHECK(events_data(1, 0) == 2.0);
+    CHECK(events_data(1, 3) == 1.0);
+    CHECK(events_data(1, 4) == 2.0);
+    CHECK(events_data(1, 5) == 1.0);
+    read_file.close_current_object();
+
+    // The events in this test are recorded by this thread
+    const auto& dropped = read_file.get<h5::Dat>("/ActionTraces/DroppedEvents");
+    CHECK(dropped.get_legend() ==
+          std::vector<std::string>{"Time", "Proc", "DroppedEvents"});
+    CHECK(dropped.get_data().rows() ==
+          Parallel::tracing::number_of_dropped_events().size());
+  }
+
+  // The events recorded after the first element drained them are written at
+  // the next observation
+  serialized_event->run(make_not_null(&obs_box),
+                        ActionTesting::cache<element_component>(runner, 0), 0,
+                        component_ptr, {"Unused", 5.0});
+  CHECK(ActionTesting::number_of_queued_threaded_actions<obs_writer>(runner,
+                                                                     0) == 1);
+  ActionTesting::invoke_queued_threaded_action<obs_writer>(
+      make_not_null(&runner), 0);
+  CHECK(Parallel::tracing::drain().empty());
+  file_system::rm(h5_file_name, true);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.ParallelAlgorithms.Events.ObserveActionTraces",
+                  "[Unit][ParallelAlgorithms]") {
+  test_make_action_traces();
+  test_event();
+}
@@ -0,0 +1,154 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/ObservationBox.hpp"
+#include "DataStructures/Matrix.hpp"
+#include "Domain/ElementCostModel.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Tags.hpp"
+#include "Domain/Tags/ElementCostModel.hpp"
+#include "Evolution/DgSubcell/ActiveGrid.hpp"
+#include "Evolution/DgSubcell/Tags/ActiveGrid.hpp"
+#include "Framework/ActionTesting.hpp"
+#include "Framework/TestCreation.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/IO/Observers/ObserverHelpers.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/Dat.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/Observer/Tags.hpp"
+#include "NumericalAlgorithms/Spectral/Basis.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
+#include "Options/Protocols/FactoryCreation.hpp"
+#include "Parallel/ElementCosts.hpp"
+#include "Parallel/Phase.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "ParallelAlgorithms/Events/ObserveElementCosts.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "Utilities/FileSystem.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/ProtocolHelpers.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+template <typename Metavariables>
+struct ElementComponent {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = ElementId<2>;
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<Parallel::Phase::Initialization, tmpl::list<>>>;
+};
+
+struct Metavariables {
+  using component_list =
+      tmpl::list<ElementComponent<Metavariables>,
+                 TestObservers_detail::observer_writer_component<
+                     Metavariables>>;
+  struct factory_creation
+      : tt::ConformsTo<Options::protocols::FactoryCreation> {
+    using factory_classes = tmpl::map<
+        tmpl::pair<Event, tmpl::list<Events::ObserveElementCosts<2>>>>;
+  };
+};
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.ParallelAlgorithms.Events.ObserveElementCosts",
+                  "[Unit][ParallelAlgorithms]") {
+  using element_component = ElementComponent<Metavariables>;
+  using obs_writer =
+      TestObservers_detail::observer_writer_component<Metavariables>;
+
+  const std::string file_prefix =
+      "Unit.ParallelAlgorithms.ObserveElementCosts";
+  const std::string h5_file_name = file_prefix + ".h5";
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+  tuples::TaggedTuple<observers::Tags::ReductionFileName,
+                      observers::Tags::VolumeFileName>
+      cache_data{file_prefix, "Unused"};
+  ActionTesting::MockRuntimeSystem<Metavariables> runner{cache_data};
+  const ElementId<2> dg_element{0};
+  const ElementId<2> subcell_element{1};
+  ActionTesting::emplace_component<element_component>(&runner, dg_element);
+  ActionTesting::emplace_component<element_component>(&runner,
+                                                      subcell_element);
+  ActionTesting::emplace_nodegroup_component<obs_writer>(&runner);
+  for (size_t i = 0; i < 2; ++i) {
+    ActionTesting::next_action<obs_writer>(make_not_null(&runner), 0);
+  }
+  runner.set_phase(Parallel::Phase::Testing);
+
+  // The elements only time their actions once the event is used
+  CHECK_FALSE(Parallel::element_costs::enabled());
+  const auto event =
+      TestHelpers::test_creation<std::unique_ptr<Event>, Metavariables>(
+          "ObserveElementCosts:");
+  CHECK(Parallel::element_costs::enabled());
+  CHECK_FALSE(event->needs_evolved_variables());
+  const auto serialized_event = serialize_and_deserialize(event);
+  element_component* const component_ptr = nullptr;
+
+  auto& elements =
+      runner.template mock_distributed_objects<element_component>();
+  elements.at(dg_element).set_iterable_action_wall_time(2.0);
+  elements.at(subcell_element).set_iterable_action_wall_time(5.0);
+
+  const Mesh<2> mesh{{{4, 5}},
+                     Spectral::Basis::Legendre,
+                     Spectral::Quadrature::GaussLobatto};
+  {
+    // An element of an executable without subcell
+    auto box = db::create<db::AddSimpleTags<domain::Tags::Mesh<2>>>(mesh);
+    auto obs_box = make_observation_box<tmpl::list<>>(make_not_null(&box));
+    serialized_event->run(
+        make_not_null(&obs_box),
+        ActionTesting::cache<element_component>(runner, dg_element),
+        dg_element, component_ptr, {"Unused", 4.0});
+  }
+  {
+    auto box = db::create<db::AddSimpleTags<
+        domain::Tags::Mesh<2>, evolution::dg::subcell::Tags::ActiveGrid>>(
+        mesh, evolution::dg::subcell::ActiveGrid::Subcell);
+    auto obs_box = make_observation_box<tmpl::list<>>(make_not_null(&box));
+    serialized_event->run(
+        make_not_null(&obs_box),
+        ActionTesting::cache<element_component>(runner, subcell_element),
+        subcell_element, component_ptr, {"Unused", 4.0});
+  }
+  // The measured time is reset by the observation
+  CHECK(elements.at(dg_element).take_iterable_action_wall_time() == 0.0);
+
+  REQUIRE(ActionTesting::number_of_queued_threaded_actions<obs_writer>(
+              runner, 0) == 2);
+  for (size_t i = 0; i < 2; ++i) {
+    ActionTesting::invoke_queued_threaded_action<obs_writer>(
+        make_not_null(&runner), 0);
+  }
+
+  {
+    h5::H5File<h5::AccessType::ReadOnly> read_file{h5_file_name};
+    const auto& costs = read_file.get<h5::Dat>(
+        domain::Tags::ElementCostModel<2>::subfile_name());
+    CHECK(costs.get_legend() == domain::ElementCostModel<2>::legend());
+    const Matrix data = costs.get_data();
+    CHECK(data == Matrix{{4.0, 0.0, 4.0, 5.0, 0.0, 2.0},
+                         {4.0, 1.0, 4.0, 5.0, 1.0, 5.0}});
+
+    const domain::ElementCostModel<2> model{data};
+    CHECK(model.cost(0, {{4, 5}}, false) == std::optional{2.0});
+    CHECK(model.cost(1, {{4, 5}}, true) == std::optional{5.0});
+  }
+  file_system::rm(h5_file_name, true);
+}
@@ -0,0 +1,295 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Evolution/Systems/ScalarWave/System.hpp"
+#include "Framework/ActionTesting.hpp"
+#include "Framework/TestCreation.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
+#include "Helpers/IO/Observers/ObserverHelpers.hpp"
+#include "IO/Observer/Actions/IncrementalCheckpoint.hpp"
+#include "IO/Observer/Actions/ObserverRegistration.hpp"
+#include "IO/Observer/Actions/RestoreFromIncrementalCheckpoint.hpp"
+#include "IO/Observer/IncrementalCheckpoint.hpp"
+#include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/Tags.hpp"
+#include "IO/Observer/TypeOfObservation.hpp"
+#include "Parallel/ArrayComponentId.hpp"
+#include "Parallel/Phase.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "ParallelAlgorithms/Events/WriteIncrementalCheckpoint.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "Time/History.hpp"
+#include "Time/Slab.hpp"
+#include "Time/Tags/HistoryEvolvedVariables.hpp"
+#include "Time/Tags/TimeStepId.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Utilities/FileSystem.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace {
+using system = ScalarWave::System<1>;
+using variables_tag = typename system::variables_tag;
+using vars_type = typename variables_tag::type;
+using history_tag = ::Tags::HistoryEvolvedVariables<variables_tag>;
+using history_type = typename history_tag::type;
+
+template <typename Metavariables>
+struct ElementComponent {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = ElementId<1>;
+  using simple_tags =
+      tmpl::list<variables_tag, history_tag, ::Tags::TimeStepId>;
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<
+          Parallel::Phase::Initialization,
+          tmpl::list<ActionTesting::InitializeDataBox<simple_tags>>>,
+      Parallel::PhaseActions<
+          Parallel::Phase::Testing,
+          tmpl::list<observers::Actions::RestoreFromIncrementalCheckpoint>>>;
+};
+
+struct Metavariables {
+  using component_list = tmpl::list<
+      ElementComponent<Metavariables>,
+      TestObservers_detail::observer_component<Metavariables>,
+      TestObservers_detail::observer_writer_component<Metavariables>>;
+  using observed_reduction_data_tags = tmpl::list<>;
+};
+
+using element_component = ElementComponent<Metavariables>;
+using observer_component =
+    TestObservers_detail::observer_component<Metavariables>;
+using writer_component =
+    TestObservers_detail::observer_writer_component<Metavariables>;
+
+// The state of an element of a ScalarWave evolution at a time step
+struct ElementState {
+  vars_type vars{};
+  history_type history{};
+  TimeStepId time_step_id{};
+};
+
+ElementState make_state(const gsl::not_null<std::mt19937*> gen,
+                        const size_t time_step) {
+  std::uniform_real_distribution<> dist{-1.0, 1.0};
+  const Slab slab{0.0, 1.0};
+  const TimeStepId time_step_id{true, static_cast<int64_t>(time_step),
+                                slab.start()};
+  ElementState state{make_with_random_values<vars_type>(gen, dist, 5_st),
+                     history_type{2}, time_step_id};
+  state.history.insert(
+      time_step_id, state.vars,
+      make_with_random_values<typename history_type::DerivVars>(gen, dist,
+                                                                5_st));
+  return state;
+}
+
+auto make_runner(std::optional<std::string> restore_from,
+                 const std::vector<ElementId<1>>& element_ids,
+                 const std::vector<ElementState>& states) {
+  using cache_tags =
+      tuples::TaggedTuple<observers::Tags::ReductionFileName,
+                          observers::Tags::VolumeFileName,
+                          observers::Tags::RestoreFromIncrementalCheckpoint>;
+  auto runner =
+      std::make_unique<ActionTesting::MockRuntimeSystem<Metavariables>>(
+          cache_tags{"", "", std::move(restore_from)});
+  ActionTesting::emplace_group_component<observer_component>(runner.get());
+  for (size_t i = 0; i < 2; ++i) {
+    ActionTesting::next_action<observer_component>(runner.get(), 0);
+  }
+  ActionTesting::emplace_nodegroup_component<writer_component>(runner.get());
+  for (size_t i = 0; i < 2; ++i) {
+    ActionTesting::next_action<writer_component>(runner.get(), 0);
+  }
+  for (size_t i = 0; i < element_ids.size(); ++i) {
+    ActionTesting::emplace_array_component_and_initialize<element_component>(
+        runner.get(), ActionTesting::NodeId{0}, ActionTesting::LocalCoreId{0},
+        element_ids[i],
+        {states[i].vars, states[i].history, states[i].time_step_id});
+  }
+  return runner;
+}
+
+// Register the elements for the event with the observers, as
+// `observers::Actions::RegisterEventsWithObservers` does
+void register_elements(
+    const gsl::not_null<ActionTesting::MockRuntimeSystem<Metavariables>*>
+        runner,
+    const Events::WriteIncrementalCheckpoint& event,
+    const std::vector<ElementId<1>>& element_ids) {
+  const auto [type_of_observation, observation_key] =
+      event.get_observation_type_and_key_for_registration();
+  CHECK(type_of_observation == observers::TypeOfObservation::Volume);
+  for (const auto& element_id : element_ids) {
+    ActionTesting::simple_action<
+        observer_component,
+        observers::Actions::RegisterContributorWithObserver>(
+        runner, 0, observation_key,
+        Parallel::make_array_component_id<element_component>(element_id),
+        type_of_observation);
+  }
+  // The observer registers with the writer once
+  ActionTesting::invoke_queued_simple_action<writer_component>(runner, 0);
+  REQUIRE(ActionTesting::is_simple_action_queue_empty<writer_component>(
+      *runner, 0));
+}
+
+// Run the event on the `writing_elements`, which completes the snapshot if
+// these are all registered elements
+void write_snapshot(
+    const gsl::not_null<ActionTesting::MockRuntimeSystem<Metavariables>*>
+        runner,
+    const Events::WriteIncrementalCheckpoint& event,
+    const std::vector<ElementId<1>>& writing_elements, const double time,
+    const bool expect_commit) {
+  for (const auto& element_id : writing_elements) {
+    event(ActionTesting::get_databox<element_component>(runner, element_id),
+          ActionTesting::cache<element_component>(*runner, element_id),
+          element_id, std::add_pointer_t<element_component>{},
+          {"Time", time});
+    // The snapshot is only committed once all elements have written it
+    CHECK(ActionTesting::is_threaded_action_queue_empty<writer_component>(
+        *runner, 0));
+    ActionTesting::invoke_queued_simple_action<observer_component>(runner, 0);
+  }
+  if (expect_commit) {
+    ActionTesting::invoke_queued_threaded_action<writer_component>(runner, 0);
+  }
+  CHECK(ActionTesting::is_threaded_action_queue_empty<writer_component>(
+      *runner, 0));
+  CHECK(ActionTesting::get_databox_tag<
+            writer_component,
+            observers::Tags::ContributorsOfIncrementalCheckpoint>(*runner, 0)
+            .empty());
+}
+
+void set_state(
+    const gsl::not_null<ActionTesting::MockRuntimeSystem<Metavariables>*>
+        runner,
+    const ElementId<1>& element_id, const ElementState& state) {
+  db::mutate<variables_tag, history_tag, ::Tags::TimeStepId>(
+      [&state](const gsl::not_null<vars_type*> vars,
+               const gsl::not_null<history_type*> history,
+               const gsl::not_null<TimeStepId*> time_step_id) {
+        *vars = state.vars;
+        *history = state.history;
+        *time_step_id = state.time_step_id;
+      },
+      make_not_null(
+          &ActionTesting::get_databox<element_component>(runner, element_id)));
+}
+
+void check_state(const ActionTesting::MockRuntimeSystem<Metavariables>& runner,
+                 const ElementId<1>& element_id, const ElementState& state) {
+  CHECK(ActionTesting::get_databox_tag<element_component, variables_tag>(
+            runner, element_id) == state.vars);
+  CHECK(ActionTesting::get_databox_tag<element_component, history_tag>(
+            runner, element_id) == state.history);
+  CHECK(ActionTesting::get_databox_tag<element_component, ::Tags::TimeStepId>(
+            runner, element_id) == state.time_step_id);
+}
+
+void test_round_trip(const std::string& file_prefix) {
+  MAKE_GENERATOR(gen);
+  const std::string file_name =
+      observers::incremental_checkpoint_file_name(file_prefix, 0);
+  const std::vector<ElementId<1>> element_ids{ElementId<1>{0, {{{1, 0}}}},
+                                              ElementId<1>{0, {{{1, 1}}}}};
+  const std::vector<ElementState> initial_states{
+      make_state(make_not_null(&gen), 0), make_state(make_not_null(&gen), 0)};
+  // The time step ID doesn't change at step one, so it has to be restored from
+  // the snapshot at step zero
+  std::vector<ElementState> states_at_step_one{
+      make_state(make_not_null(&gen), 1), make_state(make_not_null(&gen), 1)};
+  for (size_t i = 0; i < element_ids.size(); ++i) {
+    states_at_step_one[i].time_step_id = initial_states[i].time_step_id;
+  }
+  const std::vector<ElementState> states_at_step_two{
+      make_state(make_not_null(&gen), 2), make_state(make_not_null(&gen), 2)};
+
+  const auto event =
+      TestHelpers::test_creation<Events::WriteIncrementalCheckpoint>(
+          "FilePrefix: " + file_prefix);
+  CHECK_FALSE(event.needs_evolved_variables());
+  CHECK(serialize_and_deserialize(event)
+            .get_observation_type_and_key_for_registration() ==
+        event.get_observation_type_and_key_for_registration());
+
+  {
+    auto runner = make_runner(std::nullopt, element_ids, initial_states);
+    ActionTesting::set_phase(runner.get(), Parallel::Phase::Register);
+    register_elements(runner.get(), event, element_ids);
+    ActionTesting::set_phase(runner.get(), Parallel::Phase::Testing);
+
+    write_snapshot(runner.get(), event, element_ids, 0.0, true);
+    for (size_t i = 0; i < element_ids.size(); ++i) {
+      set_state(runner.get(), element_ids[i], states_at_step_one[i]);
+    }
+    write_snapshot(runner.get(), event, element_ids, 1.0, true);
+    // Only the first element writes its snapshot at step two, so the snapshot
+    // is incomplete. Only its variables change.
+    ElementState state_at_step_two = states_at_step_one[0];
+    state_at_step_two.vars = states_at_step_two[0].vars;
+    set_state(runner.get(), element_ids[0], state_at_step_two);
+    write_snapshot(runner.get(), event, {element_ids[0]}, 2.0, false);
+
+    const auto& writer =
+        ActionTesting::get_databox_tag<
+            writer_component, observers::Tags::IncrementalCheckpointWriters>(
+            *runner, 0)
+            .at(file_name);
+    writer.wait();
+    CHECK(observers::committed_observation_values(file_name) ==
+          std::vector<double>{0.0, 1.0});
+    // All three items of both elements are written at step zero, the
+    // variables and the history at step one, and the variables of the first
+    // element at step two.
+    CHECK(writer.number_of_items_written() == 11);
+    CHECK(writer.number_of_items_unchanged() == 4);
+  }
+
+  // Restore into elements that hold different data
+  auto runner = make_runner(file_prefix, element_ids, states_at_step_two);
+  ActionTesting::set_phase(runner.get(), Parallel::Phase::Testing);
+  for (size_t i = 0; i < element_ids.size(); ++i) {
+    ActionTesting::next_action<element_component>(runner.get(),
+                                                  element_ids[i]);
+    check_state(*runner, element_ids[i], states_at_step_one[i]);
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Evolution.Events.WriteIncrementalCheckpoint",
+                  "[Unit][Evolution]") {
+  const std::string file_prefix =
+      "Unit.Evolution.Events.WriteIncrementalCheckpoint";
+  const std::string file_name =
+      observers::incremental_checkpoint_file_name(file_prefix, 0);
+  if (file_system::check_if_file_exists(file_name)) {
+    file_system::rm(file_name, true);
+  }
+  test_round_trip(file_prefix);
+  file_system::rm(file_name, true);
+}
@@ -6,8 +6,13 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <cstddef>
 #include <memory>
+#include <optional>
+#include <pup.h>
 #include <string>
+#include <thread>
+#include <unordered_map>
 #include <utility>
 
 #include "DataStructures/DataBox/DataBox.hpp"
@@ -19,6 +24,7 @@
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Tags/Metavariables.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/EventTimings.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/EventsAndTriggers.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/LogicalTriggers.hpp"
 #include "ParallelAlgorithms/EventsAndTriggers/Trigger.hpp"
@@ -50,6 +56,21 @@ struct ObservationCompute : Observation, db::ComputeTag {
 struct RunCount : db::SimpleTag {
   using type = int;
 };
+
+struct Counted : db::SimpleTag {
+  using type = int;
+};
+
+size_t number_of_evaluations = 0;
+
+struct CountedCompute : Counted, db::ComputeTag {
+  using base = Counted;
+  using argument_tags = tmpl::list<Data>;
+  static void function(const gsl::not_null<int*> counted, const int data) {
+    ++number_of_evaluations;
+    *counted = 2 * data;
+  }
+};
 }  // namespace Tags
 
 struct TestEvent : public Event {
@@ -98,6 +119,48 @@ struct TestEvent : public Event {
 
 PUP::able::PUP_ID TestEvent::my_PUP_ID = 0;  // NOLINT
 
+// Doesn't mutate the DataBox, so the compute items stay cached
+struct CountedEvent : public Event {
+ public:
+  explicit CountedEvent(CkMigrateMessage* /*unused*/) {}
+  using PUP::able::register_constructor;
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wunused-function"
+  WRAPPED_PUPable_decl_template(CountedEvent);  // NOLINT
+#pragma GCC diagnostic pop
+
+  using compute_tags_for_observation_box = tmpl::list<Tags::CountedCompute>;
+  using options = tmpl::list<>;
+  static constexpr Options::String help = "";
+
+  CountedEvent() = default;
+
+  using return_tags = tmpl::list<>;
+  using argument_tags = tmpl::list<Tags::Counted>;
+
+  template <typename Metavariables, typename ArrayIndex, typename Component>
+  void operator()(const int counted,
+                  Parallel::GlobalCache<Metavariables>& /*cache*/,
+                  const ArrayIndex& /*array_index*/,
+                  const Component* const /*meta*/,
+                  const ObservationValue& /*observation_value*/) const {
+    CHECK(counted == 4);
+  }
+
+  using is_ready_argument_tags = tmpl::list<>;
+
+  template <typename Metavariables, typename ArrayIndex, typename Component>
+  bool is_ready(Parallel::GlobalCache<Metavariables>& /*cache*/,
+                const ArrayIndex& /*array_index*/,
+                const Component* const /*meta*/) const {
+    return true;
+  }
+
+  bool needs_evolved_variables() const override { return false; }
+};
+
+PUP::able::PUP_ID CountedEvent::my_PUP_ID = 0;  // NOLINT
+
 struct Component {};
 
 struct Metavariables {
@@ -105,7 +168,7 @@ struct Metavariables {
   struct factory_creation
       : tt::ConformsTo<Options::protocols::FactoryCreation> {
     using factory_classes =
-        tmpl::map<tmpl::pair<Event, tmpl::list<TestEvent>>,
+        tmpl::map<tmpl::pair<Event, tmpl::list<TestEvent, CountedEvent>>,
                   tmpl::pair<Trigger, Triggers::logical_triggers>>;
   };
 };
@@ -292,6 +355,139 @@ void test_custom_check_trigger() {
                        [](const Trigger& /*trigger*/) { return true; });
   CHECK(db::get<Tags::RunCount>(box) == 1);
 }
+
+void test_shared_observation_box() {
+  auto box = db::create<
+      db::AddSimpleTags<Parallel::Tags::MetavariablesImpl<Metavariables>,
+                        Tags::Data, Tags::RunCount>>(Metavariables{}, 2, 0);
+  Parallel::GlobalCache<Metavariables> cache{};
+  Component* const component_ptr = nullptr;
+
+  const auto events_and_triggers =
+      TestHelpers::test_creation<EventsAndTriggers, Metavariables>(
+          "- Trigger: Always\n"
+          "  Events:\n"
+          "    - CountedEvent\n"
+          "    - CountedEvent\n"
+          "- Trigger: Always\n"
+          "  Events:\n"
+          "    - CountedEvent\n");
+
+  // Events are only timed once timing is enabled
+  (void)event_timings::take_statistics();
+  if (not event_timings::enabled()) {
+    events_and_triggers.run_events(make_not_null(&box), cache, 0,
+                                   component_ptr, {"Name", 0.5});
+    CHECK(event_timings::take_statistics().empty());
+    event_timings::enable();
+  }
+  CHECK(event_timings::enabled());
+
+  Tags::number_of_evaluations = 0;
+  events_and_triggers.run_events(make_not_null(&box), cache, 0, component_ptr,
+                                 {"Name", 1.0});
+  CHECK(Tags::number_of_evaluations == 1);
+  {
+    // The three instances have the same options, so they share a name
+    const auto timings = event_timings::take_statistics();
+    REQUIRE(timings.size() == 1);
+    const auto& statistics =
+        timings.at(event_timings::instance_name(CountedEvent{}));
+    CHECK(statistics.number_of_runs == 3);
+    CHECK(statistics.wall_time >= statistics.max_wall_time);
+    CHECK(statistics.max_wall_time >= 0.0);
+  }
+  CHECK(event_timings::take_statistics().empty());
+
+  // Sharing the ObservationBox between calls evaluates the compute items once
+  std::optional<EventsAndTriggers::ObservationBoxType<
+      typename decltype(box)::tags_list, Metavariables>>
+      observation_box{};
+  events_and_triggers.run_events(make_not_null(&observation_box),
+                                 make_not_null(&box), cache, 0, component_ptr,
+                                 {"Name", 1.0});
+  events_and_triggers.run_events(make_not_null(&observation_box),
+                                 make_not_null(&box), cache, 0, component_ptr,
+                                 {"Name", 2.0});
+  CHECK(Tags::number_of_evaluations == 2);
+  CHECK(event_timings::take_statistics()
+            .at(event_timings::instance_name(CountedEvent{}))
+            .number_of_runs == 6);
+
+  // Events that mutate the DataBox reset the compute items
+  const auto mutating_events_and_triggers =
+      TestHelpers::test_creation<EventsAndTriggers, Metavariables>(
+          "- Trigger: Always\n"
+          "  Events:\n"
+          "    - CountedEvent\n"
+          "    - TestEvent\n"
+          "    - CountedEvent\n");
+  observation_box.reset();
+  mutating_events_and_triggers.run_events(make_not_null(&observation_box),
+                                          make_not_null(&box), cache, 0,
+                                          component_ptr, {"Name", 1234.5});
+  CHECK(Tags::number_of_evaluations == 4);
+  CHECK(db::get<Tags::RunCount>(box) == 1);
+}
+
+// Stands in for an event with an option
+struct TimedEvent {
+  int option{};
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) { p | option; }
+};
+
+void test_event_timings() {
+  (void)event_timings::take_statistics();
+  const TimedEvent event{1};
+  const TimedEvent same_options{1};
+  const TimedEvent other_options{2};
+  CHECK(event_timings::instance_name(event) ==
+        event_timings::instance_name(same_options));
+  CHECK(event_timings::instance_name(event) !=
+        event_timings::instance_name(other_options));
+  CHECK(event_timings::instance_name(event).substr(0, 11) == "TimedEvent-");
+
+  const std::string name = event_timings::instance_name(event);
+  event_timings::record(name, 1.0);
+  event_timings::record(name, 3.0);
+  event_timings::record(event_timings::instance_name(same_options), 0.5);
+  event_timings::record(event_timings::instance_name(other_options), 2.0);
+  // Statistics recorded on other threads are taken on those threads
+  std::unordered_map<std::string, event_timings::Statistics>
+      other_thread_timings{};
+  std::thread other_thread{[&name, &other_thread_timings]() {
+    event_timings::record(name, 10.0);
+    other_thread_timings = event_timings::take_statistics();
+  }};
+  other_thread.join();
+  CHECK(other_thread_timings.at(name).number_of_runs == 1);
+
+  const auto timings = event_timings::take_statistics();
+  REQUIRE(timings.size() == 2);
+  const auto& statistics = timings.at(name);
+  CHECK(statistics.number_of_runs == 3);
+  CHECK(statistics.wall_time == 4.5);
+  CHECK(statistics.max_wall_time == 3.0);
+  const auto& other_statistics =
+      timings.at(event_timings::instance_name(other_options));
+  CHECK(other_statistics.number_of_runs == 1);
+  CHECK(other_statistics.wall_time == 2.0);
+  CHECK(event_timings::take_statistics().empty());
+
+  // Only the first take on a thread for an observation gets the statistics
+  event_timings::record(name, 1.0);
+  const auto first_take = event_timings::take_statistics(10.0);
+  REQUIRE(first_take.has_value());
+  CHECK(first_take->at(name).number_of_runs == 1);
+  event_timings::record(name, 1.0);
+  CHECK_FALSE(event_timings::take_statistics(10.0).has_value());
+  CHECK_FALSE(event_timings::take_statistics(5.0).has_value());
+  const auto next_take = event_timings::take_statistics(11.0);
+  REQUIRE(next_take.has_value());
+  CHECK(next_take->at(name).number_of_runs == 1);
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.ParallelAlgorithms.EventsAndTriggers",
@@ -301,4 +497,6 @@ SPECTRE_TEST_CASE("Unit.ParallelAlgorithms.EventsAndTriggers",
   test_basic_triggers();
   test_factory();
   test_custom_check_trigger();
+  test_shared_observation_box();
+  test_event_timings();
 }
@@ -0,0 +1,32 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Framework/TestHelpers.hpp"
+#include "Utilities/Serialization/Fingerprint.hpp"
+#include "Utilities/Serialization/Serialize.hpp"
+
+SPECTRE_TEST_CASE("Unit.Serialization.Fingerprint", "[Unit][Serialization]") {
+  const std::vector<double> a{1.0, 2.0, 3.0};
+  const Fingerprint fingerprint_a = fingerprint(a);
+  CHECK(fingerprint_a.size == size_of_object_in_bytes(a));
+  CHECK(fingerprint_a == fingerprint(std::vector<double>{1.0, 2.0, 3.0}));
+  // Changing a single value, the order of the values, or the size changes the
+  // fingerprint
+  CHECK(fingerprint_a != fingerprint(std::vector<double>{1.0, 2.0, 3.5}));
+  CHECK(fingerprint_a != fingerprint(std::vector<double>{3.0, 2.0, 1.0}));
+  CHECK(fingerprint_a != fingerprint(std::vector<double>{1.0, 2.0}));
+
+  const std::map<std::string, int> b{{"A", 1}, {"B", 2}};
+  CHECK(fingerprint(b) == fingerprint(serialize_and_deserialize(b)));
+  CHECK(fingerprint(b) !=
+        fingerprint(std::map<std::string, int>{{"A", 1}, {"C", 2}}));
+  CHECK(fingerprint(std::string{}) == fingerprint(std::string{}));
+
+  CHECK(serialize_and_deserialize(fingerprint_a) == fingerprint_a);
+}
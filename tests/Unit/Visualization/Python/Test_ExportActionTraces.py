@@ -0,0 +1,77 @@
+# Distributed under the MIT License.
+# See LICENSE.txt for details.
+
+import json
+import os
+import shutil
+import unittest
+
+import numpy as np
+from click.testing import CliRunner
+
+import spectre.IO.H5 as spectre_h5
+from spectre.Informer import unit_test_build_path
+from spectre.Visualization.ExportActionTraces import (
+    export_action_traces_command,
+)
+
+
+class TestExportActionTraces(unittest.TestCase):
+    def setUp(self):
+        self.work_dir = os.path.join(
+            unit_test_build_path(), "Visualization/ExportActionTraces"
+        )
+        shutil.rmtree(self.work_dir, ignore_errors=True)
+        os.makedirs(self.work_dir, exist_ok=True)
+        self.reduction_file_name = os.path.join(
+            self.work_dir, "TestActionTraces.h5"
+        )
+        legend = ["Start", "Duration", "QueueWait", "Node", "Core", "Type"]
+        with spectre_h5.H5File(self.reduction_file_name, "w") as open_h5_file:
+            subfile = open_h5_file.insert_dat(
+                "/ActionTraces/DgElementArray/ComputeTimeDerivative/Events.dat",
+                legend=legend,
+                version=0,
+            )
+            subfile.append(np.array([1.0, 0.5, 0.25, 0.0, 2.0, 0.0]))
+            subfile.append(np.array([2.0, 0.125, 0.0, 1.0, 3.0, 1.0]))
+            open_h5_file.close_current_object()
+            subfile = open_h5_file.insert_dat(
+                "/ActionTraces/DroppedEvents.dat",
+                legend=["Time", "Proc", "DroppedEvents"],
+                version=0,
+            )
+            subfile.append(np.array([1.0, 0.0, 0.0]))
+            open_h5_file.close_current_object()
+        self.runner = CliRunner()
+
+    def tearDown(self):
+        shutil.rmtree(self.work_dir, ignore_errors=True)
+
+    def test_export_action_traces(self):
+        output_file_name = os.path.join(self.work_dir, "Trace.json")
+        result = self.runner.invoke(
+            export_action_traces_command,
+            [self.reduction_file_name, "-o", output_file_name],
+            catch_exceptions=False,
+        )
+        self.assertEqual(result.exit_code, 0, result.output)
+        with open(output_file_name, "r") as open_output_file:
+            trace = json.load(open_output_file)
+        events = trace["traceEvents"]
+        self.assertEqual(len(events), 2)
+        self.assertEqual(events[0]["name"], "ComputeTimeDerivative")
+        self.assertEqual(events[0]["cat"], "IterableAction")
+        self.assertEqual(events[0]["ph"], "X")
+        self.assertAlmostEqual(events[0]["ts"], 1.0e6)
+        self.assertAlmostEqual(events[0]["dur"], 0.5e6)
+        self.assertEqual(events[0]["pid"], 0)
+        self.assertEqual(events[0]["tid"], 2)
+        self.assertEqual(events[0]["args"]["Component"], "DgElementArray")
+        self.assertAlmostEqual(events[0]["args"]["QueueWait"], 0.25)
+        self.assertEqual(events[1]["cat"], "RetriedIterableAction")
+        self.assertEqual(events[1]["pid"], 1)
+
+
+if __name__ == "__main__":
+    unittest.main(verbosity=2)